@@ -121,6 +121,17 @@
 #define EPD_Digital_Read(_pin)          HAL_GPIO_ReadPin(_pin)
 
 #define EPD_SPI_WriteByte(_value)       SPI_TxRxByte(_value)
+#define EPD_SPI_Write_nByte(_pData, _Len) SPI_TxBytes(_pData, _Len)
 #define EPD_Delay_ms(__xms)             HAL_Delay(__xms)
 
+/**
+ * BUSY (PA4) on EXTI line 4, both edges: wakes the core from __WFI()
+ */
+#define EPD_Busy_IRQ_Enable()           do { __HAL_GPIO_EXTI_CLEAR_IT(GPIO_PIN_4); \
+                                             SET_BIT(EXTI->IMR, GPIO_PIN_4); } while (0)
+#define EPD_Busy_IRQ_Disable()          CLEAR_BIT(EXTI->IMR, GPIO_PIN_4)
+#define EPD_Busy_Idle()                 __WFI()
+#define EPD_Busy_Lock()                 __disable_irq()
+#define EPD_Busy_Unlock()               __enable_irq()
+
 #endif
@@ -46,6 +46,11 @@ void SPI_TxRxByte(uint8_t data)
   HAL_SPI_Transmit(&spi1Handle, &data, 1, HAL_MAX_DELAY);
 }
 
+void SPI_TxBytes(const uint8_t *data, uint16_t len)
+{
+  HAL_SPI_Transmit(&spi1Handle, (uint8_t *)data, len, HAL_MAX_DELAY);
+}
+
 static void APP_GPIO_Config(void)
 {
   GPIO_InitTypeDef GPIO_InitStruct;
@@ -66,12 +71,23 @@ static void APP_GPIO_Config(void)
   GPIO_InitStruct.Pin = GPIO_PIN_6;
   HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
-  /* PA4 Busy (input) */
+  /* PA4 Busy (input), EXTI masked until a refresh is started */
   GPIO_InitStruct.Pin = GPIO_PIN_4;
-  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
   HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+  EPD_Busy_IRQ_Disable();
+  HAL_NVIC_SetPriority(EXTI4_15_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(EXTI4_15_IRQn);
+}
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  if (GPIO_Pin == GPIO_PIN_4)
+  {
+    EPD_BusyIRQHandler();
+  }
 }
 
 static void APP_SPI_Config(void)
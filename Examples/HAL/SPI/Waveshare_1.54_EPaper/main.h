@@ -9,6 +9,7 @@ extern "C" {
 
 void APP_ErrorHandler(void);
 void SPI_TxRxByte(uint8_t data);
+void SPI_TxBytes(const uint8_t *data, uint16_t len);
 
 #ifdef __cplusplus
 }
@@ -82,4 +82,12 @@ void SysTick_Handler(void)
 /* please refer to the startup file.                                          */
 /******************************************************************************/
 
+/**
+  * @brief This function handles EXTI line 4 to 15 (e-paper BUSY on PA4).
+  */
+void EXTI4_15_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_4);
+}
+
 /************************ (C) COPYRIGHT Puya *****END OF FILE******************/
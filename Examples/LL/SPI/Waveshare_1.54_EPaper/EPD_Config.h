@@ -120,6 +120,7 @@
 #define EPD_Digital_Read(_pin)          LL_GPIO_IsInputPinSet(_pin)
 
 #define EPD_SPI_WriteByte(_value)       SPI_TxRxByte(_value)
+#define EPD_SPI_Write_nByte(_pData, _Len) SPI_TxBytes(_pData, _Len)
 #define EPD_Delay_ms(__xms)             LL_mDelay(__xms)
 
 #endif
@@ -56,6 +56,17 @@ uint8_t SPI_TxRxByte(uint8_t data)
   return LL_SPI_ReceiveData8(SPI1);
 }
 
+void SPI_TxBytes(const uint8_t *data, uint16_t len)
+{
+  while (len--)
+  {
+    while (READ_BIT(SPI1->SR, SPI_SR_TXE) == RESET);
+    LL_SPI_TransmitData8(SPI1, *data++);
+  }
+  /* Let the last byte leave the shifter before CS/DC change */
+  while (READ_BIT(SPI1->SR, SPI_SR_BSY) != RESET);
+}
+
 static void APP_GPIOConfig(void)
 {
   LL_GPIO_InitTypeDef GPIO_InitStruct;
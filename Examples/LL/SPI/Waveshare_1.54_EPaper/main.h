@@ -20,6 +20,7 @@ extern "C" {
 
 void APP_ErrorHandler(void);
 uint8_t SPI_TxRxByte(uint8_t data);
+void SPI_TxBytes(const uint8_t *data, uint16_t len);
 void APP_GPIO_WriteOutputPin(GPIO_TypeDef *GPIOx, uint32_t PinMask, uint8_t Val);
 
 #ifdef __cplusplus
@@ -70,6 +70,21 @@ LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
 
+/* Paint heap and stack with the watermark pattern (see ram_watermark.c).
+   Nothing is on the stack yet, so the fill runs right up to _estack. */
+  ldr r2, =end
+  ldr r4, =_estack
+  ldr r3, =0xA5A5A5A5
+  b LoopPaintRam
+
+PaintRam:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopPaintRam:
+  cmp r2, r4
+  bcc PaintRam
+
 /* Call the clock system intitialization function.*/
   bl  SystemInit
 /* Call static constructors. Remove this line if compile with `-nostartfiles` reports error */
@@ -97,15 +97,15 @@ int EPD_test(void)
 
 #if 1   //Partial refresh, example shows time    
 
-    // The image of the previous frame must be uploaded, otherwise the
-    // first few seconds will display an exception.
-    
-    EPD_1IN54_V2_DisplayPartBaseImage(BlackImage);
-
-    // enter partial mode
-	EPD_1IN54_V2_Init_Partial();
+    // The first flush after Paint_NewImage() is a full refresh that also
+    // uploads the base image; then only the redrawn time window is sent,
+    // with a full refresh every 20 updates against ghosting.
+    static const PAINT_PANEL Panel = {
+        EPD_1IN54_V2_RefreshFull, EPD_1IN54_V2_RefreshWindow, 20
+    };
     printf("Partial refresh\r\n");
     Paint_SelectImage(BlackImage);
+    Paint_Flush(&Panel);
     PAINT_TIME sPaint_time;
     sPaint_time.Hour = 12;
     sPaint_time.Min = 34;
@@ -132,12 +132,44 @@ int EPD_test(void)
         if(num == 0) {
             break;
         }
-        EPD_1IN54_V2_DisplayPart(BlackImage);
+        Paint_Flush(&Panel);
         EPD_Delay_ms(500);//Analog clock 1s
     }
 
 #endif
 
+#if 1   // Asynchronous refresh: the MCU is free while the panel updates
+    printf("Asynchronous refresh\r\n");
+    UWORD X0, Y0, X1, Y1;
+    UDOUBLE Spare = 0;
+    Paint_ClearWindows(15, 65, 15 + Font20.Width * 7, 65 + Font20.Height, WHITE);
+    Paint_DrawString_EN(15, 65, "async", &Font20, WHITE, BLACK);
+    Paint_GetDirty(&X0, &Y0, &X1, &Y1);
+    EPD_1IN54_V2_RefreshWindowAsync(BlackImage, X0, Y0, X1, Y1, NULL);
+    while (EPD_BusyPoll()) {
+        Spare++;    // buttons, LED, ... would be serviced here
+        EPD_Busy_Idle();
+    }
+    printf("%lu idle loops during the refresh\r\n", (unsigned long)Spare);
+    Paint_ClearDirty();
+    EPD_Delay_ms(2000);
+#endif
+
+#if 1   // Banded drawing: 20 lines (500 bytes) of cache instead of the whole frame
+    printf("Banded drawing\r\n");
+    static UBYTE BandImage[25 * 20];
+    static PAINT_CMD DrawList[8];
+    EPD_1IN54_V2_Init();
+    Paint_NewImage(BandImage, EPD_1IN54_V2_WIDTH, EPD_1IN54_V2_HEIGHT, 270, WHITE);
+    Paint_BeginList(DrawList, 8);
+    Paint_DrawRectangle(20, 10, 180, 60, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    Paint_DrawCircle(100, 130, 50, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    Paint_DrawString_EN(30, 25, "banded", &Font20, BLACK, WHITE);
+    Paint_DrawNum(60, 120, 1024, &Font20, BLACK, WHITE);
+    Paint_RenderBands(20, EPD_1IN54_V2_DisplayBand);
+    EPD_Delay_ms(2000);
+#endif
+
     printf("Clear...\r\n");
     EPD_1IN54_V2_Init();
     EPD_1IN54_V2_Clear();
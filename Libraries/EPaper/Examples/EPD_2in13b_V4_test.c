@@ -46,39 +46,22 @@ int EPD_test(void)
     EPD_2IN13B_V4_Clear();
     EPD_Delay_ms(500);
 
-    //Create a new image cache named IMAGE_BW and fill it with white
-    UBYTE *BlackImage, *RYImage; // Red or Yellow
-    UWORD Imagesize = ((EPD_2IN13B_V4_WIDTH % 8 == 0)? (EPD_2IN13B_V4_WIDTH / 8 ): (EPD_2IN13B_V4_WIDTH / 8 + 1)) * EPD_2IN13B_V4_HEIGHT;
-    if((BlackImage = (UBYTE *)malloc(Imagesize)) == NULL) {
-        printf("Failed to apply for black memory...\r\n");
-        return -1;
-    }
-    if((RYImage = (UBYTE *)malloc(Imagesize)) == NULL) {
-        printf("Failed to apply for red memory...\r\n");
-        return -1;
-    }
-    printf("NewImage:BlackImage and RYImage\r\n");
-    Paint_NewImage(BlackImage, EPD_2IN13B_V4_WIDTH, EPD_2IN13B_V4_HEIGHT, 90, WHITE);
-    Paint_NewImage(RYImage, EPD_2IN13B_V4_WIDTH, EPD_2IN13B_V4_HEIGHT, 90, WHITE);
-
-    //Select Image
-    Paint_SelectImage(BlackImage);
-    Paint_Clear(WHITE);
-    Paint_SelectImage(RYImage);
-    Paint_Clear(WHITE);
-
 #if 1   // show image for array    
     printf("show image for array\r\n");
     EPD_2IN13B_V4_Display(gImage_2in13b_V4b, gImage_2in13b_V4r);
     EPD_Delay_ms(2000);
 #endif
 
-#if 1   // Drawing on the image
+#if 1   // Drawing in bands: one display list, both planes, 320 bytes of cache
     /*Horizontal screen*/
+    static UBYTE BandImage[16 * 20];
+    static PAINT_CMD DrawList[16];
+    Paint_NewImage(BandImage, EPD_2IN13B_V4_WIDTH, EPD_2IN13B_V4_HEIGHT, 90, WHITE);
+    Paint_BeginList(DrawList, 16);
+
     //1.Draw black image
     printf("Draw black image\r\n");
-    Paint_SelectImage(BlackImage);
-    Paint_Clear(WHITE);
+    Paint_SelectPlane(PAINT_PLANE_BLACK);
     Paint_DrawPoint(5, 70, BLACK, DOT_PIXEL_1X1, DOT_STYLE_DFT);
     Paint_DrawPoint(5, 80, BLACK, DOT_PIXEL_2X2, DOT_STYLE_DFT);
     Paint_DrawLine(20, 70, 50, 100, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
@@ -89,8 +72,7 @@ int EPD_test(void)
 
     //2.Draw red image
     printf("Draw red image\r\n");
-    Paint_SelectImage(RYImage);
-    Paint_Clear(WHITE);
+    Paint_SelectPlane(PAINT_PLANE_RED);
     Paint_DrawPoint(5, 90, RED, DOT_PIXEL_3X3, DOT_STYLE_DFT);
     Paint_DrawPoint(5, 100, RED, DOT_PIXEL_4X4, DOT_STYLE_DFT);
     Paint_DrawLine(125, 70, 125, 100, RED, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
@@ -101,7 +83,7 @@ int EPD_test(void)
     Paint_DrawNum(5, 50, 987654321, &Font16, WHITE, RED);
 
     printf("EPD_Display\r\n");
-    EPD_2IN13B_V4_Display(BlackImage, RYImage);
+    Paint_RenderPlanes(20, 2, EPD_2IN13B_V4_DisplayBand);
     EPD_Delay_ms(5000);
 #endif
 
@@ -110,10 +92,6 @@ int EPD_test(void)
 
     printf("Goto Sleep...\r\n");
     EPD_2IN13B_V4_Sleep();
-    free(BlackImage);
-    free(RYImage);
-    BlackImage = NULL;
-    RYImage = NULL;
     EPD_Delay_ms(2000);//important, at least 2s
     // close 5V
     printf("close 5V, Module enters 0 power consumption ...\r\n");
@@ -32,6 +32,14 @@
 #include "time.h"
 
 #ifdef EPD_3IN0G
+// Picture for the dithering demo: red to yellow across, fading to black down
+static UDOUBLE Gradient(UWORD X, UWORD Y)
+{
+    UDOUBLE Level = 255 - (UDOUBLE)Y * 255 / (EPD_3IN0G_HEIGHT - 1);
+    UDOUBLE Green = (UDOUBLE)X * 255 / (EPD_3IN0G_WIDTH - 1);
+    return (Level << 16) | ((Green * Level / 255) << 8);
+}
+
 int EPD_test(void)
 {
     printf("EPD_3IN0G_test Demo\r\n");
@@ -142,6 +150,20 @@ int EPD_test(void)
     EPD_Delay_ms(3000);
 #endif
 
+#if 1   // Dithered picture in bands: 840 bytes of cache instead of the whole frame
+    printf("Dithered picture\r\n");
+    static const PAINT_DITHER Dither = { Gradient, Paint_Palette4G, 4, 64 };
+    static UBYTE BandImage[42 * 20];
+    static PAINT_CMD DrawList[2];
+    EPD_3IN0G_Init();
+    Paint_NewImage(BandImage, EPD_3IN0G_WIDTH, EPD_3IN0G_HEIGHT, 0, EPD_3IN0G_WHITE);
+    Paint_SetScale(4);
+    Paint_BeginList(DrawList, 2);
+    Paint_DrawDithered(0, 0, EPD_3IN0G_WIDTH, EPD_3IN0G_HEIGHT, &Dither);
+    Paint_RenderBands(20, EPD_3IN0G_DisplayBand);
+    EPD_Delay_ms(3000);
+#endif
+
     EPD_3IN0G_Init();
     printf("Clear...\r\n");
     EPD_3IN0G_Clear(EPD_3IN0G_WHITE);
@@ -46,8 +46,8 @@ int EPD_test(void)
     EPD_3IN52_lut_GC();
     EPD_3IN52_refresh();
 
-    EPD_3IN52_SendCommand(0x50);
-    EPD_3IN52_SendData(0x17);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x17);
 
     EPD_Delay_ms(500);
 
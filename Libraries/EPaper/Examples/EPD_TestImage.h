@@ -37,6 +37,10 @@
 extern const unsigned char gImage_2in13b_V4b[];
 extern const unsigned char gImage_2in13b_V4r[];
 
+// EPD_TestImagePacked.c, Paint_DrawBitMapPacked()
+extern const unsigned char gImage_2in13b_V4b_Packed[];
+extern const unsigned char gImage_2in13b_V4r_Packed[];
+
 extern const unsigned char gImage_1in64g[];
 extern const unsigned char gImage_2in36g[];
 extern const unsigned char gImage_3in0g[];
@@ -0,0 +1,161 @@
+/* Generated by Misc/Python/epd_pack.py from EPD_TestImage2.c, do not edit.
+   gImage_2in13b_V4b: 4000 -> 1145 bytes (bit runs)
+   gImage_2in13b_V4r: 4000 -> 1242 bytes (bit runs) */
+
+const unsigned char gImage_2in13b_V4b_Packed[] = {
+  0, /* codec */
+  0x0F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x47,0xF0,0x3F,
+  0x03,0x6F,0x44,0xF0,0x6F,0x03,0x6F,0x43,0xB1,0xAF,0x03,0x6F,0x41,0xA5,0x9F,0x03,
+  0x6F,0x40,0x97,0x9F,0x03,0x6F,0x3F,0x79,0xAF,0x03,0x6F,0x3F,0x69,0xBF,0x03,0x6F,
+  0x3E,0x77,0xDF,0x03,0x6F,0x3E,0x88,0xBF,0x03,0x6F,0x3D,0xC6,0xAF,0x03,0x6F,0x3D,
+  0xC7,0x9F,0x03,0x6F,0x3D,0x99,0xAF,0x03,0x6F,0x3C,0x97,0xDF,0x03,0x6F,0x3C,0x96,
+  0xEF,0x03,0x6F,0x3C,0xA8,0xBF,0x03,0x6F,0x3C,0xC9,0x8F,0x03,0x6F,0x3C,0xE9,0x6F,
+  0x03,0x6F,0x3C,0x95,0x46,0x5F,0x03,0x6F,0x3C,0x95,0x55,0x4F,0x04,0x6F,0x3C,0x97,
+  0xCF,0x04,0x6F,0x3C,0xB7,0xAF,0x04,0x6F,0x3C,0x45,0x47,0x7F,0x05,0x6F,0x3C,0x45,
+  0x56,0x6F,0x06,0x6F,0x3C,0x5E,0x7F,0x06,0x6F,0x3C,0x6B,0x8F,0x07,0x6F,0x3C,0x96,
+  0x9F,0x08,0x6F,0x3C,0xB2,0x9F,0x0A,0x6F,0x3C,0xF0,0x6F,0x0B,0x6F,0x3C,0xF0,0x3F,
+  0x0E,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,
+  0x6B,0x6F,0x6B,0x6F,0x44,0xF0,0x1F,0x08,0x6F,0x42,0xF0,0x4F,0x07,0x6F,0x41,0xF0,
+  0x5F,0x07,0x6F,0x41,0x5D,0x1F,0x08,0x6F,0x40,0x5F,0x17,0x6F,0x40,0x4F,0x18,0x6F,
+  0x40,0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,
+  0x40,0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,0xF0,0x6F,0x07,
+  0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x40,0x4F,0x18,0x6F,0x40,
+  0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,
+  0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,0x4F,0x18,0x6F,0x40,0x5F,0x17,0x6F,0x41,
+  0x5F,0x16,0x6F,0x41,0xF0,0x5F,0x07,0x6F,0x42,0xF0,0x4F,0x07,0x6F,0x43,0xF0,0x2F,
+  0x08,0x6F,0x6B,0x6F,0x41,0x1F,0x1A,0x6F,0x40,0xF0,0x3F,0x0A,0x6F,0x40,0xF0,0x4F,
+  0x09,0x6F,0x41,0xF0,0x3F,0x09,0x6F,0x47,0x44,0x5F,0x08,0x6F,0x47,0x45,0x4F,0x08,
+  0x6F,0x47,0x45,0x5F,0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,
+  0x47,0x46,0x4F,0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,
+  0x46,0x4F,0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,0x45,0x4F,0x08,0x6F,0x47,0x45,
+  0x4F,0x08,0x6F,0x46,0x53,0x6F,0x08,0x6F,0x40,0xF0,0x4F,0x09,0x6F,0x40,0xF0,0x3F,
+  0x0A,0x6F,0x40,0xF0,0x1F,0x0C,0x6F,0x6B,0x6F,0x52,0x3F,0x07,0x6F,0x50,0x5F,0x07,
+  0x6F,0x4E,0x7F,0x07,0x6F,0x4C,0x8F,0x08,0x6F,0x4A,0x8F,0x0A,0x6F,0x49,0x7F,0x0C,
+  0x6F,0x46,0x8F,0x0E,0x6F,0x45,0x7F,0x10,0x6F,0x43,0x7F,0x12,0x6F,0x41,0x7F,0x14,
+  0x6F,0x40,0x6F,0x16,0x6F,0x41,0x7F,0x14,0x6F,0x43,0x7F,0x12,0x6F,0x45,0x7F,0x10,
+  0x6F,0x46,0x8F,0x0E,0x6F,0x48,0x7F,0x0D,0x6F,0x4A,0x7F,0x0B,0x6F,0x4C,0x7F,0x09,
+  0x6F,0x4E,0x7F,0x07,0x6F,0x50,0x5F,0x07,0x6F,0x52,0x3F,0x07,0x6F,0x6B,0x6F,0x6B,
+  0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x40,0xF0,0x6F,0x07,0x6F,
+  0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,
+  0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,
+  0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,
+  0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,
+  0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x4D,
+  0x4F,0x07,0x6F,0x40,0x4D,0x4F,0x07,0x6F,0x40,0x4D,0x4F,0x07,0x6F,0x6B,0x6F,0x6B,
+  0x6F,0x40,0x48,0x7F,0x09,0x6F,0x40,0x47,0x9F,0x08,0x6F,0x40,0x47,0x9F,0x08,0x6F,
+  0x40,0x46,0x42,0x4F,0x08,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,
+  0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,
+  0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,
+  0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,
+  0x07,0x6F,0x41,0x45,0x43,0x4F,0x07,0x6F,0x41,0x53,0x53,0x4F,0x07,0x6F,0x41,0xC4,
+  0x4F,0x07,0x6F,0x42,0xA5,0x4F,0x07,0x6F,0x44,0x7F,0x11,0x6F,0x6B,0x6F,0x6B,0x6F,
+  0x40,0xF0,0x6F,0x07,0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x4A,
+  0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,
+  0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,
+  0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,0x4F,0x0E,0x6F,0x4A,
+  0x4F,0x0E,0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x40,0xF0,0x6F,
+  0x07,0x6F,0x6B,0x6F,0x6B,0x6F,0x40,0xF0,0x2F,0x0B,0x6F,0x40,0xF0,0x3F,0x0A,0x6F,
+  0x40,0xF0,0x4F,0x09,0x6F,0x47,0x43,0x6F,0x08,0x6F,0x47,0x45,0x4F,0x08,0x6F,0x47,
+  0x45,0x4F,0x08,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,0x46,
+  0x4F,0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,0x46,0x4F,
+  0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x47,0x45,0x5F,0x07,0x6F,0x47,0x45,0x4F,0x08,
+  0x6F,0x47,0x44,0x5F,0x08,0x6F,0x40,0xF0,0x4F,0x09,0x6F,0x40,0xF0,0x3F,0x0A,0x6F,
+  0x40,0xF0,0x2F,0x0B,0x6F,0x6B,0x6F,0x6B,0x6F,0x40,0xF0,0x5F,0x08,0x6F,0x40,0xF0,
+  0x6F,0x07,0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x47,0x45,0x5F,0x07,0x6F,0x47,0x46,0x4F,
+  0x07,0x6F,0x47,0x46,0x4F,0x07,0x6F,0x46,0x56,0x4F,0x07,0x6F,0x46,0x56,0x4F,0x07,
+  0x6F,0x45,0x66,0x4F,0x07,0x6F,0x44,0x76,0x4F,0x07,0x6F,0x43,0x86,0x4F,0x07,0x6F,
+  0x43,0x86,0x4F,0x07,0x6F,0x42,0x41,0x46,0x4F,0x07,0x6F,0x41,0x42,0x46,0x4F,0x07,
+  0x6F,0x41,0x42,0x45,0x5F,0x07,0x6F,0x40,0x43,0x45,0x4F,0x08,0x6F,0x40,0x34,0x51,
+  0x11,0x5F,0x08,0x6F,0x40,0x35,0xCF,0x08,0x6F,0x40,0x27,0xAF,0x09,0x6F,0x40,0x19,
+  0x7F,0x0B,0x6F,0x6B,0x6F,0x6B,0x6F,0x40,0xF0,0x5F,0x08,0x6F,0x40,0xF0,0x6F,0x07,
+  0x6F,0x40,0xF0,0x6F,0x07,0x6F,0x40,0x46,0x42,0x5F,0x07,0x6F,0x40,0x46,0x43,0x4F,
+  0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,
+  0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,
+  0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,
+  0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,0x43,0x4F,0x07,0x6F,0x40,0x46,
+  0x43,0x4F,0x07,0x6F,0x40,0x47,0x11,0x13,0x4F,0x07,0x6F,0x40,0x4D,0x4F,0x07,0x6F,
+  0x40,0x4D,0x4F,0x07,0x6F,0x41,0x1F,0x00,0x11,0x1F,0x08,0x6F,0x6B,0x6F,0x6B,0x6F,
+  0x6B,0x6F,0x6B,0x6F,0x6B,0x6F,0x6B,0x60,
+};
+
+const unsigned char gImage_2in13b_V4r_Packed[] = {
+  0, /* codec */
+  0xF2,0xDF,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,
+  0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF0,0xC3,0xE1,0xF0,0x6F,
+  0x2F,0xF0,0xC4,0xC3,0xF0,0x5F,0x2F,0xF0,0xC5,0xB4,0xF0,0x4F,0x2F,0xF0,0xC5,0xC3,
+  0xF0,0x4F,0x2F,0xF0,0xC7,0xA4,0xF0,0x3F,0x2F,0xF0,0xC8,0xA3,0xF0,0x3F,0x2F,0xF0,
+  0xC9,0x93,0xF0,0x3F,0x2F,0xF0,0xC3,0x25,0x74,0xF0,0x3F,0x2F,0xF0,0xC3,0x36,0x45,
+  0xF0,0x3F,0x2F,0xF0,0xC3,0x4D,0xF0,0x4F,0x2F,0xF0,0xC3,0x5C,0xF0,0x4F,0x2F,0xF0,
+  0xC3,0x79,0xF0,0x5F,0x2F,0xF0,0xC3,0x95,0xF0,0x7F,0x2F,0xF0,0xC3,0xF1,0x5F,0x2F,
+  0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF0,0xD4,0xF1,0x3F,
+  0x2F,0xF0,0xC5,0xF1,0x3F,0x2F,0xF0,0xC5,0xF1,0x3F,0x2F,0xF0,0xC5,0xF1,0x3F,0x2F,
+  0xF0,0xD3,0xF1,0x4F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,
+  0x2F,0xF0,0xC3,0xE2,0xF0,0x5F,0x2F,0xF0,0xC3,0xE2,0xF0,0x5F,0x2F,0xF0,0xC3,0xE3,
+  0xF0,0x4F,0x2F,0xF0,0xC3,0xE3,0xF0,0x4F,0x2F,0xF0,0xCF,0x06,0xF0,0x3F,0x2F,0xF0,
+  0xCF,0x06,0xF0,0x3F,0x2F,0xF0,0xCF,0x06,0xF0,0x3F,0x2F,0xF0,0xCF,0x06,0xF0,0x3F,
+  0x2F,0xF0,0xC3,0xF1,0x5F,0x2F,0xF0,0xC3,0xF1,0x5F,0x2F,0xF0,0xC3,0xF1,0x5F,0x2F,
+  0xF0,0xC3,0xF1,0x5F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF0,0xE2,
+  0xF1,0x4F,0x2F,0xF0,0xE3,0xC2,0xF0,0x5F,0x2F,0xF0,0xD4,0xB4,0xF0,0x4F,0x2F,0xF0,
+  0xD3,0xD3,0xF0,0x4F,0x2F,0xF0,0xC4,0x53,0x54,0xF0,0x3F,0x2F,0xF0,0xC3,0x63,0x63,
+  0xF0,0x3F,0x2F,0xF0,0xC3,0x63,0x63,0xF0,0x3F,0x2F,0xF0,0xC3,0x64,0x44,0xF0,0x3F,
+  0x2F,0xF0,0xC4,0x45,0x44,0xF0,0x3F,0x2F,0xF0,0xC4,0x4C,0xF0,0x4F,0x2F,0xF0,0xD9,
+  0x19,0xF0,0x4F,0x2F,0xF0,0xD9,0x27,0xF0,0x5F,0x2F,0xF0,0xE7,0x45,0xF0,0x6F,0x2F,
+  0xF1,0x04,0xF1,0x0F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF1,0xF3,
+  0xF0,0x2F,0x2F,0xF0,0xCF,0x01,0x24,0xF0,0x2F,0x2F,0xF0,0xCF,0x01,0x24,0xF0,0x2F,
+  0x2F,0xF0,0xCF,0x01,0x24,0xF0,0x2F,0x2F,0xF0,0xCF,0x01,0x33,0xF0,0x2F,0x2F,0xF3,
+  0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF0,0xCF,0x01,0xF0,0x8F,
+  0x2F,0xF0,0xCF,0x01,0xF0,0x8F,0x2F,0xF0,0xCF,0x01,0xF0,0x8F,0x2F,0xF0,0xCE,0xF0,
+  0xAF,0x2F,0xF1,0x73,0xF0,0xAF,0x2F,0xF1,0x83,0xF0,0x9F,0x2F,0xF1,0x83,0xF0,0x9F,
+  0x2F,0xF1,0x93,0xF0,0x8F,0x2F,0xF1,0x84,0xF0,0x8F,0x2F,0xF1,0x84,0xF0,0x8F,0x2F,
+  0xF0,0xCF,0x01,0xF0,0x8F,0x2F,0xF0,0xCF,0x00,0xF0,0x9F,0x2F,0xF0,0xCF,0x00,0xF0,
+  0x9F,0x2F,0xF0,0xCD,0xF0,0xBF,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,
+  0xF1,0x16,0xF0,0xDF,0x2F,0xF0,0xFA,0xF0,0xBF,0x2F,0xF0,0xEC,0xF0,0xAF,0x2F,0xF0,
+  0xDE,0xF0,0x9F,0x2F,0xF0,0xD5,0x45,0xF0,0x9F,0x2F,0xF0,0xC4,0x84,0xF0,0x8F,0x2F,
+  0xF0,0xC4,0x84,0xF0,0x8F,0x2F,0xF0,0xC3,0xA3,0xF0,0x8F,0x2F,0xF0,0xC3,0xA3,0xF0,
+  0x8F,0x2F,0xF0,0xC4,0x84,0xF0,0x8F,0x2F,0xF0,0xD3,0x83,0xF0,0x9F,0x2F,0xF0,0xD3,
+  0x92,0xF0,0x9F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,
+  0xF0,0xCF,0x07,0xF0,0x2F,0x2F,0xF0,0xCF,0x07,0xF0,0x2F,0x2F,0xF0,0xCF,0x07,0xF0,
+  0x2F,0x2F,0xF0,0xCF,0x07,0xF0,0x2F,0x2F,0xF1,0x73,0xF0,0xAF,0x2F,0xF1,0x83,0xF0,
+  0x9F,0x2F,0xF1,0x83,0xF0,0x9F,0x2F,0xF1,0x93,0xF0,0x8F,0x2F,0xF1,0x84,0xF0,0x8F,
+  0x2F,0xF1,0x84,0xF0,0x8F,0x2F,0xF0,0xCF,0x01,0xF0,0x8F,0x2F,0xF0,0xCF,0x00,0xF0,
+  0x9F,0x2F,0xF0,0xCF,0x00,0xF0,0x9F,0x2F,0xF0,0xCD,0xF0,0xBF,0x2F,0xF3,0x3F,0x2F,
+  0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,
+  0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF1,0x24,0xF0,0xEF,0x2F,0xF0,0xF9,0xF0,
+  0xCF,0x2F,0xF0,0xEC,0xF0,0xAF,0x2F,0xF0,0xDE,0xF0,0x9F,0x2F,0xF0,0xD4,0x22,0x24,
+  0xF0,0x9F,0x2F,0xF0,0xC4,0x32,0x34,0xF0,0x8F,0x2F,0xF0,0xC4,0x32,0x43,0xF0,0x8F,
+  0x2F,0xF0,0xC3,0x42,0x43,0xF0,0x8F,0x2F,0xF0,0xC3,0x42,0x43,0xF0,0x8F,0x2F,0xF0,
+  0xC3,0x42,0x34,0xF0,0x8F,0x2F,0xF0,0xC4,0x38,0xF0,0x9F,0x2F,0xF0,0xD3,0x38,0xF0,
+  0x9F,0x2F,0xF0,0xD2,0x47,0xF0,0xAF,0x2F,0xF1,0x35,0xF0,0xCF,0x2F,0xF3,0x3F,0x2F,
+  0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF1,0x33,0xF0,0xEF,0x2F,0xF1,0x33,0xF0,0xEF,0x2F,
+  0xF1,0x33,0xF0,0xEF,0x2F,0xF1,0x33,0xF0,0xEF,0x2F,0xF1,0x33,0xF0,0xEF,0x2F,0xF1,
+  0x33,0xF0,0xEF,0x2F,0xF1,0x33,0xF0,0xEF,0x2F,0xF1,0x33,0xF0,0xEF,0x2F,0xF3,0x3F,
+  0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF0,0xCF,0x06,0xF0,0x3F,0x2F,
+  0xF0,0xCF,0x06,0xF0,0x3F,0x2F,0xF0,0xCF,0x06,0xF0,0x3F,0x2F,0xF0,0xCF,0x06,0xF0,
+  0x3F,0x2F,0xF1,0x43,0x73,0xF0,0x3F,0x2F,0xF1,0x43,0x73,0xF0,0x3F,0x2F,0xF1,0x43,
+  0x73,0xF0,0x3F,0x2F,0xF1,0x43,0x73,0xF0,0x3F,0x2F,0xF1,0x43,0x64,0xF0,0x3F,0x2F,
+  0xF1,0x44,0x54,0xF0,0x3F,0x2F,0xF1,0x5B,0xF0,0x4F,0x2F,0xF1,0x5B,0xF0,0x4F,0x2F,
+  0xF1,0x69,0xF0,0x5F,0x2F,0xF1,0x85,0xF0,0x7F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,
+  0xF3,0x3F,0x2F,0xF0,0xE4,0xF1,0x2F,0x2F,0xF0,0xD7,0x42,0xF0,0xAF,0x2F,0xF0,0xC8,
+  0x43,0xF0,0x9F,0x2F,0xF0,0xC9,0x33,0xF0,0x9F,0x2F,0xF0,0xC4,0x23,0x34,0xF0,0x8F,
+  0x2F,0xF0,0xC3,0x42,0x43,0xF0,0x8F,0x2F,0xF0,0xC3,0x43,0x33,0xF0,0x8F,0x2F,0xF0,
+  0xD3,0x42,0x24,0xF0,0x8F,0x2F,0xF0,0xD3,0x42,0x24,0xF0,0x8F,0x2F,0xF0,0xEE,0xF0,
+  0x8F,0x2F,0xF0,0xCF,0x00,0xF0,0x9F,0x2F,0xF0,0xCE,0xF0,0xAF,0x2F,0xF0,0xCC,0xF0,
+  0xCF,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF0,0x6F,
+  0x07,0xF0,0x8F,0x2F,0xF0,0x6F,0x07,0xF0,0x8F,0x2F,0xF0,0x6F,0x07,0xF0,0x8F,0x2F,
+  0xF0,0x6F,0x06,0xF0,0x9F,0x2F,0xF0,0xD3,0x83,0xF0,0x9F,0x2F,0xF0,0xD3,0x83,0xF0,
+  0x9F,0x2F,0xF0,0xC3,0xA3,0xF0,0x8F,0x2F,0xF0,0xC3,0xA3,0xF0,0x8F,0x2F,0xF0,0xC4,
+  0x93,0xF0,0x8F,0x2F,0xF0,0xC4,0x84,0xF0,0x8F,0x2F,0xF0,0xD5,0x46,0xF0,0x8F,0x2F,
+  0xF0,0xDE,0xF0,0x9F,0x2F,0xF0,0xED,0xF0,0x9F,0x2F,0xF0,0xFB,0xF0,0xAF,0x2F,0xF1,
+  0x16,0xF0,0xDF,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF1,0x16,0xF0,
+  0xDF,0x2F,0xF0,0xFA,0xF0,0xBF,0x2F,0xF0,0xEC,0xF0,0xAF,0x2F,0xF0,0xDE,0xF0,0x9F,
+  0x2F,0xF0,0xD4,0x22,0x33,0xF0,0x9F,0x2F,0xF0,0xC4,0x32,0x34,0xF0,0x8F,0x2F,0xF0,
+  0xC3,0x42,0x43,0xF0,0x8F,0x2F,0xF0,0xC3,0x42,0x43,0xF0,0x8F,0x2F,0xF0,0xC3,0x42,
+  0x43,0xF0,0x8F,0x2F,0xF0,0xC3,0x42,0x34,0xF0,0x8F,0x2F,0xF0,0xD3,0x38,0xF0,0x9F,
+  0x2F,0xF0,0xD3,0x37,0xF0,0xAF,0x2F,0xF1,0x36,0xF0,0xBF,0x2F,0xF3,0x3F,0x2F,0xF3,
+  0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF0,0xCF,0x01,0xF0,0x8F,0x2F,0xF0,0xCF,
+  0x01,0xF0,0x8F,0x2F,0xF0,0xCF,0x01,0xF0,0x8F,0x2F,0xF0,0xCE,0xF0,0xAF,0x2F,0xF1,
+  0x64,0xF0,0xAF,0x2F,0xF1,0x83,0xF0,0x9F,0x2F,0xF1,0x84,0xF0,0x8F,0x2F,0xF1,0x84,
+  0xF0,0x8F,0x2F,0xF1,0x84,0xF0,0x8F,0x2F,0xF1,0xA2,0xF0,0x8F,0x2F,0xF3,0x3F,0x2F,
+  0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,
+  0x3F,0x2F,0xF3,0x3F,0x2F,0xF3,0x3F,0x2F,0x60,
+};
@@ -108,12 +108,16 @@ const CH_CN Font12CN_Table[] =
 
 };
 
+/* Font12CN_Table entries in index byte order (stable), for the binary search */
+static const uint16_t Font12CN_Order[] = {5, 2, 3, 4, 0, 1};
+
 cFONT Font12CN = {
   Font12CN_Table,
   sizeof(Font12CN_Table)/sizeof(CH_CN),  /*size of table*/
   11, /* ASCII Width */
   16, /* Width */
   21, /* Height */
+  Font12CN_Order, /* index order */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
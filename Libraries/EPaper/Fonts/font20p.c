@@ -0,0 +1,142 @@
+/* Generated by Misc/Python/epd_pack.py from font20.c, do not edit.
+   95 glyphs 14x20: 3800 -> 1967 bytes */
+#include <stddef.h>
+#include "fonts.h"
+
+static const uint8_t Font20P_Data[] = {
+  0xFF,0xF0,0xA0,0xF0,0x43,0xB3,0xB3,0xB3,0xB3,0xB3,0xB3,0xC1,0xD1,0xF1,0x93,0xB3,
+  0xF4,0xB0,0xF1,0x03,0x23,0x63,0x23,0x63,0x23,0x71,0x41,0x81,0x41,0x81,0x41,0xF9,
+  0xD0,0x42,0x22,0x82,0x22,0x82,0x22,0x82,0x22,0x82,0x22,0x6A,0x4A,0x62,0x22,0x82,
+  0x22,0x6A,0x4A,0x62,0x22,0x82,0x22,0x82,0x22,0x82,0x22,0x82,0x22,0xF2,0xD0,0x62,
+  0xC2,0xB6,0x77,0x62,0x42,0x62,0xC5,0xA6,0xC3,0x62,0x42,0x62,0x42,0x67,0x76,0xB2,
+  0xC2,0xC2,0xF2,0xF0,0xF0,0x23,0xA1,0x31,0x91,0x31,0x91,0x31,0xA3,0x32,0xA4,0x75,
+  0x74,0xA2,0x33,0xA1,0x31,0x91,0x31,0x91,0x31,0xA3,0xF4,0x90,0xF2,0x15,0x77,0x72,
+  0xC2,0xD2,0xB4,0x22,0x59,0x52,0x24,0x62,0x32,0x79,0x74,0x12,0xF4,0x70,0xF1,0x33,
+  0xB3,0xB3,0xC1,0xD1,0xD1,0xF9,0xF0,0xF0,0x72,0xC2,0xB2,0xC2,0xC2,0xB2,0xC2,0xC2,
+  0xC2,0xC2,0xC2,0xD2,0xC2,0xC2,0xD2,0xC2,0xF1,0xF0,0xF0,0x32,0xC2,0xD2,0xC2,0xC2,
+  0xD2,0xC2,0xC2,0xC2,0xC2,0xC2,0xB2,0xC2,0xC2,0xB2,0xC2,0xF2,0x30,0xF0,0x52,0xC2,
+  0xC2,0x92,0x12,0x12,0x68,0x84,0xA4,0x96,0x82,0x22,0xF8,0x10,0xF2,0x12,0xC2,0xC2,
+  0xC2,0x8A,0x4A,0x82,0xC2,0xC2,0xC2,0xF5,0x90,0xF9,0x13,0xB2,0xC2,0xB2,0xC2,0xC1,
+  0xF2,0x30,0xF5,0x59,0x59,0xF8,0xE0,0xF9,0x13,0xB3,0xB3,0xF4,0xA0,0x92,0xC2,0xB2,
+  0xC2,0xC2,0xB2,0xC2,0xB2,0xC2,0xB2,0xC2,0xB2,0xC2,0xC2,0xB2,0xC2,0xF3,0x20,0xF0,
+  0x35,0x87,0x72,0x32,0x62,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,
+  0x52,0x52,0x62,0x32,0x77,0x85,0xF4,0xA0,0xF0,0x52,0x95,0x95,0xC2,0xC2,0xC2,0xC2,
+  0xC2,0xC2,0xC2,0xC2,0x98,0x68,0xF4,0x80,0xF0,0x35,0x87,0x63,0x33,0x52,0x52,0xC2,
+  0xB2,0xB2,0xB2,0xB2,0xB2,0xB2,0xB9,0x59,0xF4,0x80,0xF0,0x35,0x78,0x62,0x43,0xC2,
+  0xB3,0x85,0x95,0xC3,0xC2,0xC2,0x42,0x53,0x49,0x67,0xF4,0xA0,0xF0,0x63,0xA4,0xA4,
+  0x92,0x12,0x82,0x22,0x82,0x22,0x72,0x32,0x62,0x42,0x69,0x59,0xB2,0xA5,0x95,0xF4,
+  0x80,0xF0,0x27,0x77,0x72,0xC2,0xC6,0x87,0x72,0x33,0xC2,0xC2,0xC2,0x52,0x43,0x58,
+  0x76,0xF4,0xA0,0xF0,0x55,0x77,0x64,0xA2,0xB3,0xB2,0x14,0x78,0x63,0x33,0x52,0x52,
+  0x52,0x52,0x62,0x33,0x67,0x94,0xF4,0xA0,0xF0,0x19,0x59,0x52,0x52,0xC2,0xB2,0xC2,
+  0xC2,0xB2,0xC2,0xC2,0xB2,0xC2,0xC2,0xF4,0xB0,0xF0,0x35,0x87,0x63,0x33,0x52,0x52,
+  0x53,0x33,0x67,0x77,0x63,0x33,0x52,0x52,0x52,0x52,0x53,0x33,0x67,0x85,0xF4,0xA0,
+  0xF0,0x34,0x97,0x63,0x32,0x62,0x52,0x52,0x52,0x53,0x33,0x68,0x74,0x12,0xB3,0xB2,
+  0xA4,0x67,0x75,0xF4,0xC0,0xF3,0xD3,0xB3,0xB3,0xF2,0x63,0xB3,0xB3,0xF4,0xA0,0xF3,
+  0xE3,0xB3,0xB3,0xF2,0x53,0xB2,0xB2,0xC2,0xC1,0xF3,0x10,0xF2,0x52,0xA4,0x84,0x93,
+  0x93,0x94,0xC3,0xD3,0xC4,0xC4,0xC2,0xF4,0x70,0xF3,0x8B,0x3B,0xF1,0x0B,0x3B,0xF7,
+  0x10,0xF1,0xD2,0xC4,0xC4,0xC3,0xD3,0xC4,0x93,0x93,0x94,0x84,0xA2,0xF4,0xF0,0xF1,
+  0x15,0x87,0x72,0x42,0x62,0x42,0xC2,0xA3,0xA3,0xB2,0xF1,0x83,0xB3,0xF4,0xB0,0xF0,
+  0x53,0x92,0x21,0x91,0x41,0x71,0x51,0x71,0x51,0x71,0x33,0x71,0x21,0x21,0x71,0x21,
+  0x21,0x71,0x21,0x21,0x71,0x33,0x71,0xE1,0xD1,0x41,0x94,0xF3,0xC0,0xF1,0x06,0x86,
+  0xB3,0xA2,0x12,0x92,0x12,0x82,0x22,0x82,0x32,0x68,0x68,0x52,0x62,0x34,0x44,0x24,
+  0x44,0xF4,0x60,0xF0,0xF7,0x78,0x72,0x42,0x62,0x42,0x62,0x33,0x67,0x78,0x62,0x43,
+  0x52,0x52,0x52,0x52,0x4A,0x49,0xF4,0x80,0xF1,0x24,0x12,0x68,0x53,0x33,0x43,0x52,
+  0x42,0xC2,0xC2,0xC2,0xC3,0x52,0x53,0x33,0x67,0x85,0xF4,0x90,0xF0,0xE8,0x69,0x62,
+  0x43,0x52,0x53,0x42,0x62,0x42,0x62,0x42,0x62,0x42,0x62,0x42,0x53,0x42,0x43,0x49,
+  0x58,0xF4,0xA0,0xF0,0xFA,0x4A,0x52,0x52,0x52,0x52,0x52,0x22,0x86,0x86,0x82,0x22,
+  0x82,0x52,0x52,0x52,0x4A,0x4A,0xF4,0x70,0xF0,0xFA,0x4A,0x52,0x52,0x52,0x52,0x52,
+  0x22,0x86,0x86,0x82,0x22,0x82,0xC2,0xB6,0x86,0xF4,0xB0,0xF1,0x24,0x12,0x59,0x52,
+  0x43,0x42,0x62,0x42,0xC2,0xC2,0x36,0x32,0x36,0x32,0x62,0x52,0x52,0x59,0x75,0xF4,
+  0x90,0xF0,0xF4,0x24,0x44,0x24,0x52,0x42,0x62,0x42,0x62,0x42,0x68,0x68,0x62,0x42,
+  0x62,0x42,0x62,0x42,0x54,0x24,0x44,0x24,0xF4,0x70,0xF1,0x08,0x68,0x92,0xC2,0xC2,
+  0xC2,0xC2,0xC2,0xC2,0xC2,0x98,0x68,0xF4,0x80,0xF1,0x37,0x77,0xA2,0xC2,0xC2,0xC2,
+  0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x43,0x58,0x85,0xF4,0xA0,0xF0,0xF5,0x15,0x35,
+  0x15,0x42,0x33,0x62,0x22,0x82,0x12,0x95,0x93,0x12,0x82,0x32,0x72,0x32,0x72,0x42,
+  0x55,0x24,0x35,0x33,0xF4,0x60,0xF0,0xF6,0x86,0xA2,0xC2,0xC2,0xC2,0xC2,0xC2,0x42,
+  0x62,0x42,0x62,0x42,0x4A,0x4A,0xF4,0x70,0xF0,0xE4,0x44,0x24,0x44,0x33,0x43,0x44,
+  0x24,0x42,0x11,0x21,0x12,0x42,0x14,0x12,0x42,0x14,0x12,0x42,0x22,0x22,0x42,0x22,
+  0x22,0x42,0x62,0x35,0x25,0x25,0x25,0xF4,0x60,0xF0,0xF3,0x25,0x44,0x15,0x53,0x32,
+  0x64,0x22,0x64,0x22,0x62,0x12,0x12,0x62,0x12,0x12,0x62,0x24,0x62,0x24,0x62,0x33,
+  0x55,0x13,0x55,0x22,0xF4,0x80,0xF1,0x24,0x96,0x73,0x23,0x53,0x43,0x42,0x62,0x42,
+  0x62,0x42,0x62,0x42,0x62,0x43,0x43,0x53,0x23,0x76,0x94,0xF4,0xA0,0xF0,0xF8,0x69,
+  0x62,0x43,0x52,0x52,0x52,0x52,0x52,0x43,0x58,0x67,0x72,0xC2,0xB6,0x86,0xF4,0xB0,
+  0xF1,0x24,0x96,0x73,0x23,0x53,0x43,0x42,0x62,0x42,0x62,0x42,0x62,0x42,0x62,0x43,
+  0x43,0x53,0x23,0x76,0x94,0xA4,0x12,0x68,0x62,0x23,0xF1,0xE0,0xF0,0xF8,0x69,0x62,
+  0x43,0x52,0x52,0x52,0x43,0x58,0x67,0x72,0x33,0x62,0x42,0x62,0x43,0x45,0x33,0x35,
+  0x42,0xF4,0x60,0xF1,0x15,0x12,0x59,0x43,0x43,0x42,0x62,0x43,0xC6,0xA6,0xC3,0x42,
+  0x62,0x43,0x43,0x49,0x52,0x15,0xF4,0x90,0xF0,0xFA,0x4A,0x42,0x22,0x22,0x42,0x22,
+  0x22,0x42,0x22,0x22,0x82,0xC2,0xC2,0xC2,0xC2,0xA6,0x86,0xF4,0x90,0xF0,0xF4,0x24,
+  0x44,0x24,0x52,0x42,0x62,0x42,0x62,0x42,0x62,0x42,0x62,0x42,0x62,0x42,0x62,0x42,
+  0x63,0x23,0x76,0x94,0xF4,0xA0,0xF0,0xE4,0x34,0x34,0x34,0x42,0x52,0x52,0x52,0x62,
+  0x32,0x72,0x32,0x82,0x12,0x92,0x12,0x92,0x12,0xA3,0xB3,0xB3,0xF4,0xB0,0xF0,0xE5,
+  0x35,0x15,0x35,0x22,0x72,0x32,0x23,0x22,0x32,0x23,0x22,0x32,0x23,0x22,0x32,0x12,
+  0x12,0x12,0x41,0x12,0x12,0x11,0x53,0x33,0x53,0x33,0x53,0x33,0x52,0x52,0xF4,0x70,
+  0xF0,0xE4,0x34,0x34,0x34,0x42,0x52,0x62,0x32,0x82,0x12,0xA3,0xB3,0xA2,0x12,0x82,
+  0x32,0x62,0x52,0x44,0x34,0x34,0x34,0xF4,0x70,0xF0,0xF4,0x24,0x44,0x24,0x52,0x42,
+  0x72,0x22,0x94,0xA4,0xB2,0xC2,0xC2,0xC2,0xA6,0x86,0xF4,0x90,0xF1,0x08,0x68,0x62,
+  0x42,0x62,0x32,0xB2,0xB2,0xC2,0xB2,0xB2,0x32,0x62,0x42,0x68,0x68,0xF4,0x80,0xF0,
+  0x54,0xA4,0xA2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC4,0xA4,
+  0xF1,0xF0,0x32,0xC2,0xD2,0xC2,0xC2,0xD2,0xC2,0xD2,0xC2,0xD2,0xC2,0xD2,0xC2,0xC2,
+  0xD2,0xC2,0xF2,0xC0,0xF0,0x34,0xA4,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,
+  0xC2,0xC2,0xC2,0xA4,0xA4,0xF2,0x10,0xF0,0x51,0xC3,0xA2,0x12,0x82,0x32,0x62,0x52,
+  0x51,0x71,0xFA,0xA0,0xFE,0xDF,0x0D,0xF0,0x41,0xE2,0xE1,0xFD,0x60,0xF3,0xB6,0x78,
+  0xC2,0x77,0x68,0x53,0x42,0x52,0x43,0x5A,0x55,0x13,0xF4,0x70,0xF0,0x03,0xB3,0xC2,
+  0xC2,0xC2,0x14,0x79,0x53,0x42,0x52,0x62,0x42,0x62,0x42,0x62,0x43,0x42,0x4A,0x43,
+  0x14,0xF4,0xA0,0xF3,0xC4,0x12,0x59,0x52,0x52,0x42,0x62,0x42,0xC2,0xC3,0x52,0x59,
+  0x66,0xF4,0x90,0xF0,0x83,0xB3,0xC2,0xC2,0x74,0x12,0x59,0x52,0x43,0x42,0x62,0x42,
+  0x62,0x42,0x62,0x43,0x43,0x5A,0x64,0x13,0xF4,0x60,0xF3,0xC4,0x88,0x62,0x42,0x5A,
+  0x4A,0x42,0xD2,0x52,0x59,0x75,0xF4,0x90,0xF0,0x56,0x77,0x72,0xC2,0xA8,0x68,0x82,
+  0xC2,0xC2,0xC2,0xC2,0xA8,0x68,0xF4,0x80,0xF3,0xC4,0x13,0x4A,0x42,0x43,0x42,0x62,
+  0x42,0x62,0x42,0x62,0x52,0x43,0x59,0x74,0x12,0xC2,0xB3,0x67,0x76,0xF1,0x10,0xF0,
+  0x13,0xB3,0xC2,0xC2,0xC2,0x14,0x78,0x63,0x32,0x62,0x42,0x62,0x42,0x62,0x42,0x62,
+  0x42,0x54,0x24,0x44,0x24,0xF4,0x70,0xF0,0x52,0xC2,0xF1,0x65,0x95,0xC2,0xC2,0xC2,
+  0xC2,0xC2,0x98,0x68,0xF4,0x80,0xF0,0x52,0xC2,0xF1,0x67,0x77,0xC2,0xC2,0xC2,0xC2,
+  0xC2,0xC2,0xC2,0xC2,0xB3,0x67,0x76,0xF1,0x30,0xF0,0x13,0xB3,0xC2,0xC2,0xC2,0x15,
+  0x62,0x15,0x62,0x12,0x94,0xA4,0xA2,0x12,0x92,0x22,0x73,0x25,0x43,0x25,0xF4,0x70,
+  0xF0,0x25,0x95,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0x98,0x68,0xF4,0x80,
+  0xF3,0x86,0x13,0x4B,0x42,0x22,0x22,0x42,0x22,0x22,0x42,0x22,0x22,0x42,0x22,0x22,
+  0x42,0x22,0x22,0x34,0x13,0x13,0x24,0x13,0x13,0xF4,0x60,0xF3,0x93,0x14,0x69,0x63,
+  0x32,0x62,0x42,0x62,0x42,0x62,0x42,0x62,0x42,0x54,0x24,0x44,0x24,0xF4,0x70,0xF3,
+  0xC4,0x88,0x62,0x42,0x52,0x62,0x42,0x62,0x42,0x62,0x52,0x42,0x68,0x84,0xF4,0xA0,
+  0xF3,0x83,0x14,0x6A,0x53,0x42,0x52,0x62,0x42,0x62,0x42,0x62,0x43,0x42,0x59,0x52,
+  0x14,0x72,0xC2,0xB5,0x95,0xF1,0x50,0xF3,0xC4,0x13,0x4A,0x42,0x43,0x42,0x62,0x42,
+  0x62,0x42,0x62,0x52,0x43,0x59,0x74,0x12,0xC2,0xC2,0xA5,0x95,0xF0,0xE0,0xF3,0x94,
+  0x23,0x54,0x15,0x64,0x22,0x63,0xB2,0xC2,0xC2,0xA8,0x68,0xF4,0x90,0xF3,0xC6,0x68,
+  0x62,0x42,0x64,0xB6,0xB4,0x62,0x42,0x68,0x66,0xF4,0xA0,0xF1,0x12,0xC2,0xC2,0xA9,
+  0x59,0x72,0xC2,0xC2,0xC2,0xC2,0x42,0x68,0x75,0xF4,0x90,0xF3,0x93,0x33,0x53,0x33,
+  0x62,0x42,0x62,0x42,0x62,0x42,0x62,0x42,0x62,0x33,0x69,0x64,0x13,0xF4,0x70,0xF3,
+  0x84,0x34,0x34,0x34,0x42,0x52,0x62,0x32,0x72,0x32,0x82,0x12,0x92,0x12,0xA3,0xB3,
+  0xF4,0xB0,0xF3,0x84,0x34,0x34,0x34,0x42,0x21,0x22,0x52,0x21,0x22,0x52,0x16,0x63,
+  0x13,0x73,0x13,0x72,0x32,0x72,0x32,0xF4,0x90,0xF3,0x94,0x24,0x44,0x24,0x62,0x22,
+  0x94,0xB2,0xB4,0x92,0x22,0x64,0x24,0x44,0x24,0xF4,0x70,0xF3,0x84,0x34,0x34,0x34,
+  0x42,0x52,0x62,0x32,0x72,0x32,0x82,0x12,0x95,0xA3,0xB2,0xC2,0xB2,0x97,0x77,0xF1,
+  0x30,0xF3,0xA8,0x68,0x62,0x32,0xB2,0xB2,0xB2,0xB2,0x32,0x68,0x68,0xF4,0x80,0xF0,
+  0x63,0xA4,0xA2,0xC2,0xC2,0xC2,0xC2,0xB3,0xA3,0xC3,0xC2,0xC2,0xC2,0xC2,0xC4,0xB3,
+  0xF1,0xF0,0xF0,0x52,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,
+  0xC2,0xC2,0xC2,0xF2,0x10,0xF0,0x23,0xB4,0xC2,0xC2,0xC2,0xC2,0xC2,0xC3,0xC3,0xA3,
+  0xB2,0xC2,0xC2,0xC2,0xA4,0xA3,0xF2,0x30,0xF4,0x93,0x96,0x22,0x42,0x26,0x94,0xF8,
+  0x00,
+};
+
+/* Glyph offsets into Font20P_Data, 0x8000: raw bits instead of runs */
+static const uint16_t Font20P_Offset[] = {
+  0x0000,0x0003,0x0012,0x0021,0x003F,0x0054,0x006C,0x007E,
+  0x0087,0x009A,0x00AD,0x00BC,0x00C9,0x00D2,0x00D7,0x00DD,
+  0x00EF,0x0108,0x0118,0x012A,0x013C,0x0151,0x0163,0x0178,
+  0x0189,0x01A0,0x01B5,0x01BF,0x01CB,0x01D9,0x01E1,0x01EF,
+  0x01FF,0x021D,0x0233,0x0248,0x025C,0x0273,0x0288,0x029B,
+  0x02B1,0x02CA,0x02D9,0x02EC,0x0306,0x0318,0x0339,0x0356,
+  0x036D,0x0380,0x039C,0x03B3,0x03C8,0x03DD,0x03F6,0x040E,
+  0x0430,0x0449,0x045C,0x046F,0x0482,0x0494,0x04A7,0x04B4,
+  0x04B7,0x04BD,0x04CC,0x04E3,0x04F3,0x050A,0x0518,0x0528,
+  0x053F,0x0557,0x0566,0x0579,0x0590,0x05A0,0x05BB,0x05CF,
+  0x05E0,0x05F7,0x060E,0x061D,0x062B,0x063B,0x064F,0x0662,
+  0x0679,0x068B,0x06A1,0x06AF,0x06C2,0x06D5,0x06E8,
+};
+
+sFONT Font20P = {
+  Font20P_Data,
+  14, /* Width */
+  20, /* Height */
+  Font20P_Offset, /* packed glyphs */
+};
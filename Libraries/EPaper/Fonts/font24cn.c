@@ -467,12 +467,19 @@ const CH_CN Font24CN_Table[] =
 
 };
 
+/* Font24CN_Table entries in index byte order (stable), for the binary search */
+static const uint16_t Font24CN_Order[] = {
+  19, 20, 21, 22, 9, 15, 8, 0, 1, 26, 7, 10, 11, 2,
+  23, 16, 6, 18, 13, 25, 12, 17, 3, 14, 4, 24, 5
+};
+
 cFONT Font24CN = {
   Font24CN_Table,
   sizeof(Font24CN_Table)/sizeof(CH_CN),  /*size of table*/
   24, /* ASCII Width */
   32, /* Width */
   41, /* Height */
+  Font24CN_Order, /* index order */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
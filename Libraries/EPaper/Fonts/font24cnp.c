@@ -0,0 +1,182 @@
+/* Generated by Misc/Python/epd_pack.py from font24cn.c, do not edit.
+   26 glyphs 32x41: 4509 -> 2296 bytes */
+#include <stddef.h>
+#include "fonts.h"
+
+static const uint8_t Font24CNP_Data[] = {
+  0xFF,0xA5,0xF0,0xB6,0xF0,0xB7,0xF0,0xA7,0xF0,0x99,0xF0,0x89,0xF0,0x84,0x14,0xF0,
+  0x75,0x15,0xF0,0x64,0x25,0xF0,0x55,0x34,0xF0,0x55,0x35,0xF0,0x44,0x45,0xF0,0x35,
+  0x55,0xF0,0x25,0x55,0xF0,0x24,0x74,0xF0,0x1F,0x02,0xF0,0x0F,0x02,0xEF,0x04,0xD5,
+  0x95,0xD4,0xA5,0xC5,0xB5,0xB5,0xB5,0xB4,0xD4,0xA5,0xD5,0x95,0xD5,0xFF,0xA0,0xFF,
+  0xF0,0xFC,0x88,0xF0,0x7C,0xF0,0x4D,0xF0,0x45,0x36,0xF0,0x33,0x65,0xF0,0xD4,0xF0,
+  0xD4,0xF0,0x7A,0xF0,0x4D,0xF0,0x37,0x34,0xF0,0x25,0x64,0xF0,0x25,0x64,0xF0,0x24,
+  0x65,0xF0,0x25,0x55,0xF0,0x26,0x27,0xF0,0x2F,0x00,0xF0,0x3E,0xF0,0x56,0x24,0xFF,
+  0xF0,0x20,0xFD,0x34,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,
+  0xF0,0xD4,0xF0,0xD4,0x27,0xF0,0x44,0x1A,0xF0,0x2F,0x01,0xF0,0x17,0x36,0xF0,0x16,
+  0x56,0xF0,0x05,0x75,0xF0,0x05,0x75,0xF0,0x04,0x94,0xF0,0x04,0x94,0xF0,0x04,0x94,
+  0xF0,0x04,0x85,0xF0,0x05,0x75,0xF0,0x05,0x75,0xF0,0x06,0x55,0xF0,0x17,0x36,0xF0,
+  0x1F,0x00,0xF0,0x2E,0xF0,0x34,0x26,0xFF,0xF0,0x40,0xFF,0xF0,0xFC,0xA7,0xF0,0x8A,
+  0xF0,0x5C,0xF0,0x47,0x42,0xF0,0x45,0xF0,0xB5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC4,0xF0,
+  0xD4,0xF0,0xD5,0xF0,0xC5,0xF0,0xC5,0xF0,0xD5,0xF0,0xC7,0x42,0xF0,0x5C,0xF0,0x6B,
+  0xF0,0x88,0xFF,0xF0,0x40,0xFF,0x1F,0x31,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,
+  0xC5,0xF0,0xC5,0xF0,0xC7,0xF0,0xA9,0xF0,0x8A,0xF0,0x75,0x16,0xF0,0x55,0x26,0xF0,
+  0x45,0x46,0xF0,0x25,0x56,0xF0,0x15,0x75,0xF0,0x05,0x85,0xE5,0x93,0xF0,0x05,0xF0,
+  0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,
+  0xC5,0xFA,0x00,0xFD,0xE4,0xF0,0x43,0x64,0xF0,0x35,0x54,0xF0,0x45,0x44,0xF0,0x55,
+  0x34,0xF0,0x74,0x24,0xF0,0x82,0x34,0xF0,0xD4,0xF0,0x1F,0x0E,0x3F,0x0E,0xF0,0x04,
+  0x94,0xE5,0x94,0xE4,0xA4,0xE4,0xA4,0xE4,0x12,0x74,0xD9,0x64,0xD4,0x24,0x54,0xC5,
+  0x34,0x44,0xC4,0x45,0x34,0xB5,0x55,0x24,0xB4,0x74,0x24,0xA5,0x82,0x34,0x95,0xE4,
+  0x85,0xE5,0x75,0xF0,0x05,0x65,0xF0,0x14,0x65,0xF0,0x15,0x55,0x9C,0x55,0xAB,0x73,
+  0xF8,0xC0,0xFD,0x74,0x84,0xF0,0x14,0x84,0xF0,0x14,0x84,0xF0,0x04,0x94,0xF0,0x04,
+  0x94,0xF0,0x04,0x94,0xEF,0x0D,0x4F,0x0D,0x35,0x78,0xC5,0x79,0xA6,0x79,0xA6,0x6A,
+  0x97,0x6B,0x87,0x54,0x17,0x78,0x54,0x18,0x63,0x14,0x44,0x24,0x13,0x62,0x24,0x44,
+  0x24,0x14,0x94,0x34,0x34,0x14,0x94,0x34,0x34,0x24,0x84,0x24,0x44,0x34,0x74,0x15,
+  0x44,0x35,0x69,0x54,0x45,0x58,0x1D,0x15,0x47,0x2D,0x24,0x46,0x84,0x72,0x54,0xA4,
+  0xE4,0xA4,0xE4,0xA4,0xE4,0xA4,0xE4,0xA4,0xF7,0xB0,0xFD,0x83,0x53,0xF0,0x64,0x35,
+  0xF0,0x45,0x34,0xF0,0x54,0x34,0xF0,0x64,0x3F,0x04,0x54,0x3F,0x05,0x54,0x34,0xC4,
+  0x44,0x34,0xC4,0x54,0x24,0x54,0x44,0x45,0x24,0x54,0x35,0x45,0x32,0x64,0x34,0x46,
+  0xB4,0x43,0x37,0xB4,0xA7,0x54,0x24,0x23,0x48,0x54,0x24,0x14,0x43,0x14,0x45,0x24,
+  0x24,0x42,0x14,0x44,0x34,0x24,0x74,0x44,0x34,0x34,0x64,0x34,0x44,0x34,0x64,0x34,
+  0x44,0x44,0x54,0x24,0x54,0x44,0x54,0x24,0x54,0x45,0x44,0x15,0x54,0x54,0x44,0x14,
+  0x64,0x53,0x54,0xB4,0xD4,0xB4,0xD4,0xA4,0xE4,0x59,0xE4,0x58,0xF9,0xC0,0xFB,0x54,
+  0xF0,0xD4,0xF0,0xD4,0x5F,0x03,0x54,0x5F,0x03,0x54,0xF0,0x35,0x44,0xF0,0x26,0x2D,
+  0xA5,0x4D,0x95,0x84,0x24,0x85,0x94,0x24,0x75,0x94,0x34,0x74,0xA4,0x34,0x74,0xA4,
+  0x34,0x74,0xA4,0x34,0x74,0xA4,0x3F,0x08,0x14,0x3F,0x09,0x14,0x34,0x84,0x94,0x34,
+  0x84,0xA4,0x14,0x94,0xB8,0x94,0xC7,0x94,0xD5,0xA4,0xD6,0x94,0xD7,0x84,0xC9,0x74,
+  0xB4,0x25,0x64,0xA4,0x43,0x74,0x94,0xF0,0x04,0x84,0xAA,0x92,0xC8,0xF9,0xA0,0xFF,
+  0x4F,0x0B,0x6F,0x0B,0xF0,0xB6,0xF0,0x96,0xF0,0xA6,0xF0,0xA6,0xF0,0xA5,0xF0,0xA6,
+  0xF0,0xA6,0xF0,0xA5,0xF0,0xC5,0xF0,0xC5,0xDF,0x31,0xE5,0xF0,0xC5,0xF0,0xC5,0xF0,
+  0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,0xC5,0xF0,
+  0xC4,0xF0,0x6B,0xF0,0x79,0xFA,0x00,0xF9,0xF3,0xF0,0xD4,0xF0,0xE4,0xF0,0xD5,0xF0,
+  0xD4,0xEF,0x0F,0x2F,0x0F,0x24,0xF0,0x74,0x24,0xF0,0x74,0x24,0xF0,0x74,0x24,0xF0,
+  0x74,0x24,0x1F,0x05,0x14,0x7F,0x05,0xF0,0xB6,0xF0,0x96,0xF0,0xA6,0xF0,0x96,0xF0,
+  0xB4,0xF0,0xD4,0xDF,0x31,0xF0,0x04,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,0xF0,
+  0xD4,0xF0,0xC5,0xF0,0xC4,0xF0,0x7A,0xF0,0x79,0xFA,0x00,0xFE,0xA4,0xF0,0xD4,0xF0,
+  0xD4,0x4D,0xB4,0x4D,0xB4,0xD4,0xB4,0xDF,0x07,0x22,0x6F,0x07,0x14,0x54,0xB4,0x54,
+  0x43,0xC4,0x55,0x24,0xC4,0x64,0x24,0x32,0x74,0x74,0x14,0x24,0x64,0x78,0x44,0x54,
+  0x87,0x45,0x44,0x96,0x54,0x44,0xA4,0x74,0x34,0x96,0x65,0x24,0x96,0x72,0x44,0x88,
+  0xC4,0x89,0xB4,0x74,0x25,0xA4,0x65,0x34,0xA4,0x55,0x45,0x94,0x45,0x63,0x95,0x35,
+  0xF0,0x44,0x44,0xEA,0x52,0xF0,0x09,0xFB,0x60,0xFA,0x03,0xF0,0xD5,0xF0,0xD4,0xF0,
+  0xD5,0xF0,0xD4,0xF0,0x0F,0x0E,0x3F,0x0E,0x34,0xF0,0xD4,0xF0,0xD4,0x84,0x64,0x64,
+  0x84,0x64,0x64,0x13,0x44,0x64,0x69,0x35,0x45,0x64,0x14,0x44,0x44,0x74,0x14,0x44,
+  0x44,0x74,0x15,0x34,0x44,0x74,0x24,0x34,0x35,0x74,0x24,0x35,0x24,0x84,0x24,0x44,
+  0x24,0x84,0x25,0x34,0x15,0x84,0x34,0x34,0x14,0x94,0x34,0x34,0x14,0x94,0x34,0x34,
+  0x14,0x84,0x45,0x64,0x94,0x53,0x74,0x94,0xF0,0x04,0x94,0xE4,0x94,0xF0,0x04,0x94,
+  0x1F,0x0F,0x2F,0x0F,0xF0,0xE2,0xF8,0xE0,0xFB,0x72,0x53,0x74,0xA4,0x43,0x74,0xA3,
+  0x53,0x73,0xA8,0x13,0x14,0x23,0x94,0x14,0x13,0x14,0x14,0x94,0x14,0x13,0x14,0x13,
+  0x94,0x24,0x13,0x14,0x1A,0x14,0x34,0x13,0x14,0x1F,0x00,0x34,0x13,0x18,0x24,0x14,
+  0x1F,0x05,0x24,0x22,0x2F,0x05,0x24,0x63,0x98,0x23,0x64,0xC5,0x23,0x54,0xC6,0x23,
+  0x54,0x2F,0x01,0x14,0x45,0x2B,0x28,0x45,0xF0,0x08,0x36,0xF0,0x16,0x37,0xF0,0x16,
+  0x37,0x2A,0x46,0x32,0x14,0x2A,0x46,0x64,0x24,0x33,0x54,0x74,0x24,0x33,0x13,0x14,
+  0x74,0x24,0x3C,0x74,0x24,0x36,0x16,0x64,0x24,0x26,0x18,0x54,0x14,0x35,0x14,0x14,
+  0x54,0x14,0x43,0x15,0x24,0x48,0x94,0x44,0x34,0x12,0x94,0x54,0x34,0xD2,0x73,0xF7,
+  0x10,0xFD,0x54,0xF0,0x33,0x74,0xF0,0x33,0x74,0xF0,0x33,0x74,0x2B,0x53,0x74,0x2B,
+  0x53,0x74,0x94,0x53,0x3B,0x6F,0x0B,0x6F,0x00,0x44,0x93,0x63,0x74,0x32,0x34,0x63,
+  0x65,0x24,0x24,0x63,0x65,0x33,0x27,0x33,0x67,0x14,0x17,0x33,0x59,0x17,0x14,0x23,
+  0x5F,0x02,0x14,0x23,0x5A,0x16,0x24,0x13,0x47,0x12,0x25,0x34,0x13,0x47,0x64,0x43,
+  0x13,0x38,0x56,0x73,0x33,0x14,0x56,0x73,0x33,0x14,0x48,0x63,0x32,0x24,0x39,0x63,
+  0x74,0x34,0x24,0x53,0x74,0x24,0x35,0x43,0x74,0x14,0x54,0x43,0x79,0x53,0x53,0x74,
+  0x12,0xE4,0x74,0xC9,0x74,0xD7,0x84,0xF8,0x90,0xFD,0xA4,0x54,0xF0,0x44,0x54,0xF0,
+  0x44,0x54,0xF0,0x44,0x54,0xF0,0x44,0x54,0xF0,0x44,0x54,0x62,0x44,0x34,0x54,0x54,
+  0x34,0x34,0x54,0x46,0x24,0x34,0x54,0x25,0x54,0x3D,0x15,0x64,0x3F,0x03,0x74,0x34,
+  0x57,0x94,0x34,0x55,0xB4,0x34,0x54,0xC4,0x34,0x54,0xC4,0x34,0x54,0xC4,0x34,0x54,
+  0xC4,0x34,0x54,0xC4,0x34,0x54,0xC4,0x34,0x54,0x63,0x34,0x34,0x54,0x64,0x24,0x34,
+  0x54,0x64,0x24,0x34,0x27,0x64,0x24,0x3D,0x64,0x2E,0x24,0x64,0x2A,0x65,0x44,0x18,
+  0xBC,0x14,0xF0,0x1A,0xFB,0x30,0xFD,0x33,0xF0,0x65,0x25,0xCD,0x36,0x2F,0x03,0x76,
+  0x19,0xF0,0x34,0x14,0xF0,0x92,0x24,0xF0,0xD4,0xC4,0xC4,0x6B,0x23,0x64,0x1E,0x35,
+  0x54,0x19,0x95,0x44,0x14,0x24,0x96,0x24,0x14,0x24,0xA5,0x24,0x14,0x24,0x33,0x53,
+  0x34,0x14,0x24,0x25,0xA4,0x14,0x2A,0xB3,0x24,0x28,0xD3,0x24,0x36,0x73,0x43,0x24,
+  0x34,0x94,0x24,0x24,0x34,0x94,0x24,0x24,0x44,0x84,0x24,0x24,0x44,0x74,0x34,0x24,
+  0x54,0x64,0x34,0x24,0x55,0x54,0x24,0x34,0x65,0x44,0x24,0x34,0x32,0x15,0x35,0x15,
+  0x34,0x14,0x26,0x14,0x24,0x48,0x45,0x14,0x15,0x46,0x73,0x24,0x14,0x45,0xE4,0x22,
+  0x63,0xF7,0xF0,0xFB,0xF4,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,0xF0,0xDF,0x03,0xEF,0x03,
+  0xE4,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,0xF0,0x3F,0x0A,0x7F,0x0A,0x74,0xF0,0x24,0x74,
+  0xF0,0x24,0x74,0xF0,0x24,0x74,0xF0,0x24,0x74,0xF0,0x24,0x74,0xF0,0x24,0x7F,0x0A,
+  0x7F,0x0A,0x74,0xF0,0x24,0xF1,0x82,0x43,0x53,0x52,0x74,0x25,0x34,0x44,0x55,0x34,
+  0x34,0x44,0x54,0x44,0x44,0x44,0x35,0x45,0x34,0x45,0x15,0x64,0x34,0x54,0x14,0x74,
+  0x44,0x45,0x13,0x74,0x43,0x63,0xF9,0x20,0xFB,0xE4,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,
+  0xF0,0x1F,0x0D,0x4F,0x0D,0x44,0x84,0x75,0x44,0x84,0x75,0x44,0x84,0x75,0x44,0x84,
+  0x75,0x44,0x84,0x75,0x44,0x84,0x75,0x4F,0x0D,0x4F,0x0D,0x44,0x84,0x75,0x44,0x84,
+  0x75,0x44,0x84,0x75,0x44,0x84,0x75,0x44,0x84,0x75,0x44,0x84,0x75,0x4F,0x0D,0x4F,
+  0x0D,0x44,0x84,0xB3,0x24,0x84,0xB4,0xD4,0xB4,0xD4,0xB4,0xD4,0xA5,0xD4,0xA4,0xF0,
+  0x0F,0x02,0xF0,0x1F,0x00,0xF9,0x30,0xFB,0x73,0x94,0xF0,0x05,0x85,0xE4,0x94,0xF0,
+  0x04,0x85,0xE4,0x94,0xCE,0x2E,0x2E,0x1F,0x00,0x24,0x64,0x14,0x74,0x24,0x68,0x84,
+  0x24,0x68,0x84,0x24,0x67,0x94,0x24,0x67,0x94,0x24,0x69,0x74,0x24,0x64,0x15,0x64,
+  0x24,0x64,0x25,0x54,0x2E,0x34,0x54,0x2E,0x44,0x44,0x24,0x64,0x45,0x34,0x24,0x64,
+  0x55,0x24,0x24,0x64,0x64,0x24,0x24,0x64,0x63,0x34,0x24,0x64,0xC4,0x24,0x64,0xC4,
+  0x24,0x64,0xB5,0x24,0x64,0xB4,0x34,0x64,0xB4,0x3E,0xB4,0x3E,0xA5,0x34,0x64,0x3B,
+  0x44,0x64,0x3A,0xF9,0x50,0xFB,0xB4,0x54,0xF0,0x44,0x54,0xF0,0x44,0x54,0x9F,0x31,
+  0xA4,0x54,0xE4,0x14,0x54,0xE4,0xF0,0xCF,0x0B,0x6F,0x0B,0x54,0xF0,0xC4,0xF0,0xD4,
+  0xF0,0xCF,0x0C,0x44,0x1F,0x08,0x62,0x14,0x53,0x74,0x94,0x45,0x64,0x94,0x56,0x44,
+  0x93,0x83,0x54,0x4F,0x31,0x44,0x44,0x83,0x94,0x45,0x64,0x93,0x75,0x44,0x84,0x83,
+  0x54,0x8F,0x0D,0x4F,0x0D,0xF0,0x94,0xF0,0xC4,0xF0,0x7A,0xF0,0x79,0xF7,0x80,0xF9,
+  0x74,0x74,0xF0,0x14,0x84,0xF0,0x14,0x84,0xF0,0x14,0x74,0xF0,0x14,0x84,0xCF,0x31,
+  0x34,0x74,0x95,0x34,0x74,0x94,0x48,0x24,0x34,0x25,0x34,0x14,0x24,0x34,0x24,0x44,
+  0x14,0x14,0x44,0x15,0x44,0x14,0x23,0x44,0x14,0x44,0x24,0x94,0x94,0x24,0x93,0xAE,
+  0x53,0xAE,0x45,0xF0,0x04,0x85,0xF0,0x04,0x85,0xF0,0x04,0x86,0xE4,0x86,0xE4,0x77,
+  0xE9,0x28,0xAC,0x14,0x14,0x6C,0x54,0x24,0x55,0x24,0x54,0x35,0xB4,0x45,0x44,0xB4,
+  0x35,0x55,0xA4,0x25,0x75,0x9A,0x96,0x79,0xB5,0x74,0x12,0xE3,0xF7,0x20,0xFC,0x34,
+  0xF0,0xC4,0xCB,0x54,0xCB,0x54,0xC4,0x2F,0x0A,0x14,0x2F,0x0A,0x14,0x24,0x44,0xE4,
+  0x24,0x44,0xE4,0x14,0x54,0x15,0x84,0x14,0x44,0x25,0x84,0x14,0x44,0x25,0x88,0x45,
+  0x25,0x88,0x44,0x35,0x88,0x44,0x35,0x84,0x14,0x24,0x45,0x84,0x14,0x2F,0x04,0x24,
+  0x24,0x1F,0x04,0x24,0x24,0x95,0x84,0x33,0x95,0x84,0x34,0x85,0x84,0x34,0x85,0x84,
+  0x34,0x85,0x84,0x3F,0x09,0x14,0x2F,0x0A,0x1A,0x95,0x89,0xA5,0x84,0xF0,0x05,0x84,
+  0xF0,0x05,0x84,0xF0,0x05,0x84,0xF0,0x05,0x84,0xF0,0x05,0xF7,0x80,0xFC,0x23,0x13,
+  0xF0,0x98,0x9D,0x24,0x14,0x8D,0x14,0x34,0xD3,0x54,0x34,0xD3,0x44,0x52,0x94,0x13,
+  0x3F,0x04,0x23,0x23,0x3F,0x04,0x23,0x23,0x25,0x53,0x84,0x23,0x16,0x53,0x84,0x2A,
+  0x53,0x84,0x23,0x16,0x53,0x83,0x33,0x43,0x53,0x8F,0x0F,0x2F,0x0F,0x74,0x43,0x53,
+  0xC5,0x43,0x53,0xC5,0x43,0x53,0xB6,0x43,0x53,0xB6,0x43,0x53,0xA7,0x4F,0x02,0x43,
+  0x13,0x4F,0x02,0x34,0x13,0x43,0x53,0x84,0x23,0x43,0x53,0x74,0x33,0x43,0x53,0x74,
+  0x33,0x43,0x53,0x82,0x43,0x43,0x53,0xE3,0x4F,0x03,0x64,0x4F,0x03,0x37,0x43,0xF0,
+  0x36,0x53,0xF8,0x00,0xFF,0x4F,0x0B,0x6F,0x0B,0xF0,0x24,0xF0,0xD4,0xF0,0x0F,0x0F,
+  0x2F,0x0F,0x24,0x94,0x94,0x24,0x94,0x94,0x2F,0x0F,0x2F,0x0F,0xF0,0x04,0xF0,0xD4,
+  0xF0,0x4F,0x07,0xAF,0x07,0xF0,0x44,0xF2,0x2F,0x0B,0x6F,0x0B,0xF0,0xD4,0xF0,0xD4,
+  0x6F,0x0B,0x6F,0x0B,0xF0,0xD4,0xF0,0xD4,0xF0,0xD4,0x5F,0x0C,0x5F,0x0C,0xF0,0xD4,
+  0xF9,0x40,0xFF,0x4F,0x0C,0x5F,0x0C,0x54,0x74,0x84,0x54,0x12,0x44,0x33,0x24,0x58,
+  0x34,0x34,0x14,0x54,0x14,0x24,0x24,0x24,0x54,0x15,0x14,0x15,0x24,0x54,0x24,0x14,
+  0x14,0x34,0x54,0x32,0x24,0x13,0x44,0x54,0x74,0x84,0x5F,0x0C,0x5F,0x0C,0x54,0x74,
+  0x84,0xF0,0x14,0xF0,0xD4,0xF0,0x1F,0x0D,0x4F,0x0D,0xF0,0x14,0xF0,0xD4,0xF0,0xD4,
+  0xEF,0x31,0xF1,0x43,0x43,0x43,0x53,0x65,0x24,0x35,0x35,0x54,0x35,0x34,0x45,0x35,
+  0x44,0x44,0x45,0x15,0x55,0x34,0x59,0x73,0x52,0x73,0xF7,0x20,
+};
+
+/* Sorted by index bytes; offset 0x8000: raw bits instead of runs */
+static const CH_CN_PACK Font24CNP_Index[] = {
+  {"A", 0x0000},
+  {"a", 0x003F},
+  {"b", 0x0072},
+  {"c", 0x00BA},
+  {"下", 0x00E5},
+  {"为", 0x0123},
+  {"体", 0x0172},
+  {"你", 0x01CA},
+  {"好", 0x022E},
+  {"子", 0x027F},
+  {"字", 0x02B7},
+  {"对", 0x02FB},
+  {"应", 0x0349},
+  {"微", 0x03A8},
+  {"树", 0x0421},
+  {"此", 0x0489},
+  {"派", 0x04E6},
+  {"点", 0x0553},
+  {"电", 0x05A8},
+  {"的", 0x05F7},
+  {"莓", 0x0655},
+  {"软", 0x069F},
+  {"阵", 0x06FE},
+  {"雅", 0x075D},
+  {"雪", 0x07C4},
+  {"黑", 0x0802},
+};
+
+cFONT Font24CNP = {
+  NULL,
+  sizeof(Font24CNP_Index)/sizeof(CH_CN_PACK),  /*size of table*/
+  24, /* ASCII Width */
+  32, /* Width */
+  41, /* Height */
+  NULL, /* index order */
+  Font24CNP_Index, /* packed glyphs */
+  Font24CNP_Data,
+};
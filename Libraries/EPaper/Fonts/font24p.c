@@ -0,0 +1,179 @@
+/* Generated by Misc/Python/epd_pack.py from font24.c, do not edit.
+   95 glyphs 17x24: 6840 -> 2570 bytes */
+#include <stddef.h>
+#include "fonts.h"
+
+static const uint8_t Font24P_Data[] = {
+  0xFF,0xF0,0xF7,0xB0,0xF1,0x93,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xE3,0xF0,0x01,
+  0xF0,0x11,0xF2,0x23,0xE3,0xF7,0x00,0xF2,0x83,0x23,0x93,0x23,0x93,0x23,0xA1,0x41,
+  0xB1,0x41,0xB1,0x41,0xB1,0x41,0xFE,0x50,0xF1,0x82,0x22,0xB2,0x22,0xB2,0x22,0xB2,
+  0x22,0xB2,0x22,0x8B,0x6B,0x92,0x22,0xA2,0x22,0x9B,0x6B,0x82,0x22,0xB2,0x22,0xB2,
+  0x22,0xB2,0x22,0xB2,0x22,0xF5,0xE0,0xF0,0x92,0xF0,0x02,0xD4,0x12,0x98,0x82,0x43,
+  0x82,0x43,0x83,0xF0,0x05,0xD6,0xE4,0x82,0x52,0x83,0x42,0x83,0x33,0x88,0x92,0x14,
+  0xE2,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF3,0xD0,0xF1,0x84,0xC6,0xA3,0x23,0x92,0x42,
+  0x92,0x42,0x93,0x23,0xA9,0x96,0x99,0xA3,0x23,0x92,0x42,0x92,0x42,0x93,0x23,0xA6,
+  0xC4,0xF6,0xE0,0xF3,0xB6,0xA7,0x92,0x32,0xA2,0xF0,0x02,0xF0,0x12,0xF0,0x03,0xD5,
+  0x23,0x63,0x17,0x62,0x34,0x82,0x43,0x9A,0x85,0x13,0xF6,0xB0,0xF2,0xA3,0xE3,0xE3,
+  0xF0,0x01,0xF0,0x11,0xF0,0x11,0xF0,0x11,0xFE,0x80,0xF1,0xE2,0xE3,0xD3,0xD4,0xD3,
+  0xE3,0xD3,0xE3,0xE3,0xE3,0xE3,0xE3,0xF0,0x03,0xE3,0xF0,0x03,0xE3,0xF0,0x03,0xF0,
+  0x02,0xF3,0x90,0xF1,0x62,0xF0,0x03,0xF0,0x03,0xE3,0xF0,0x03,0xE3,0xF0,0x03,0xE3,
+  0xE3,0xE3,0xE3,0xE3,0xD3,0xE3,0xD4,0xD3,0xD3,0xE2,0xF4,0x10,0xF1,0xA2,0xF0,0x02,
+  0xF0,0x02,0xB3,0x12,0x13,0x7A,0x96,0xC4,0xD4,0xC2,0x22,0xB2,0x22,0xFC,0x30,0xF3,
+  0xC2,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xAC,0x5C,0xA2,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xF8,0x10,0xFE,0x73,0xE2,0xE3,0xE2,0xF0,0x02,0xE2,0xF0,0x02,
+  0xF2,0xD0,0xF8,0xDA,0x7A,0xFD,0x20,0xFE,0x54,0xD4,0xD4,0xF6,0xF0,0xB2,0xF0,0x02,
+  0xE3,0xE2,0xE3,0xE2,0xF0,0x02,0xE2,0xF0,0x02,0xE2,0xF0,0x02,0xE2,0xF0,0x02,0xE2,
+  0xF0,0x02,0xE3,0xE2,0xE3,0xE2,0xF0,0x02,0xF4,0x10,0xF1,0x94,0xC6,0xA2,0x42,0x92,
+  0x42,0x82,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x82,
+  0x42,0x92,0x42,0xA6,0xC4,0xF6,0xF0,0xF1,0xB1,0xD4,0xB6,0xB3,0x12,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xBA,
+  0x7A,0xF6,0xC0,0xF1,0x85,0xA9,0x73,0x52,0x72,0x72,0x62,0x72,0xF0,0x02,0xE2,0xE2,
+  0xD3,0xD3,0xD2,0xE2,0xE2,0xEB,0x6B,0xF6,0xC0,0xF1,0x94,0xB7,0xA2,0x33,0xF0,0x02,
+  0xF0,0x02,0xE2,0xC4,0xD5,0xF0,0x03,0xF0,0x12,0xF0,0x02,0xF0,0x02,0x72,0x53,0x79,
+  0x96,0xF6,0xF0,0xF1,0xB3,0xD4,0xD4,0xC2,0x12,0xB2,0x22,0xB2,0x22,0xA2,0x32,0xA2,
+  0x32,0x92,0x42,0x82,0x52,0x8B,0x6B,0xD2,0xC7,0xA7,0xF6,0xC0,0xF1,0x69,0x89,0x82,
+  0xF0,0x02,0xF0,0x02,0xF0,0x02,0x14,0xA9,0x83,0x42,0xF0,0x12,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0x62,0x62,0x7A,0x96,0xF6,0xF0,0xF1,0xB5,0xA7,0x93,0xD3,0xE2,0xE2,0xF0,
+  0x02,0x14,0xA9,0x83,0x42,0x82,0x62,0x72,0x62,0x72,0x62,0x82,0x43,0x88,0xB5,0xF6,
+  0xE0,0xF1,0x6A,0x7A,0x72,0x62,0x72,0x53,0xE2,0xF0,0x02,0xE3,0xE2,0xF0,0x02,0xE3,
+  0xE2,0xF0,0x02,0xE3,0xE2,0xF0,0x02,0xF7,0x00,0xF1,0x86,0xA8,0x83,0x43,0x72,0x62,
+  0x72,0x62,0x82,0x42,0xA6,0xB6,0xA2,0x42,0x82,0x62,0x72,0x62,0x72,0x62,0x73,0x43,
+  0x88,0xA6,0xF6,0xE0,0xF1,0x85,0xB8,0x83,0x42,0x82,0x62,0x72,0x62,0x72,0x62,0x82,
+  0x43,0x89,0xA4,0x12,0xF0,0x02,0xE2,0xE3,0xD3,0x97,0xA5,0xF7,0x10,0xF5,0xD4,0xD4,
+  0xD4,0xF5,0x34,0xD4,0xD4,0xF6,0xF0,0xF5,0xF4,0xD4,0xD4,0xF4,0x23,0xD3,0xE2,0xF0,
+  0x02,0xE2,0xF0,0x01,0xF5,0x00,0xF4,0x03,0xD4,0xB4,0xB4,0xB4,0xB4,0xB4,0xF0,0x04,
+  0xF0,0x04,0xF0,0x04,0xF0,0x04,0xF0,0x04,0xE3,0xF6,0xB0,0xF6,0x9D,0x4D,0xF1,0x7D,
+  0x4D,0xFA,0xF0,0xF3,0x63,0xE4,0xF0,0x04,0xF0,0x04,0xF0,0x04,0xF0,0x04,0xF0,0x04,
+  0xB4,0xB4,0xB4,0xB4,0xB4,0xD3,0xF7,0x50,0xF2,0x95,0xB7,0x92,0x43,0x82,0x52,0x82,
+  0x52,0xE3,0xD3,0xC4,0xD3,0xE2,0xF2,0x13,0xE3,0xF7,0x10,0xF1,0x95,0xB7,0x93,0x33,
+  0x82,0x52,0x72,0x44,0x72,0x35,0x72,0x23,0x12,0x72,0x22,0x22,0x72,0x22,0x22,0x72,
+  0x22,0x22,0x72,0x35,0x72,0x44,0x72,0xF0,0x12,0xF0,0x03,0x42,0x98,0xA5,0xF4,0xC0,
+  0xF2,0x76,0xB7,0xE3,0xD2,0x12,0xC2,0x12,0xB2,0x32,0xA2,0x32,0x92,0x42,0x99,0x7A,
+  0x72,0x72,0x52,0x82,0x36,0x37,0x16,0x37,0xF6,0x90,0xF2,0x5A,0x7B,0x82,0x53,0x72,
+  0x62,0x72,0x62,0x72,0x53,0x79,0x8A,0x72,0x63,0x62,0x72,0x62,0x72,0x62,0x72,0x4C,
+  0x5B,0xF6,0xD0,0xF2,0xA5,0x12,0x7A,0x63,0x53,0x62,0x72,0x52,0x82,0x52,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x12,0x72,0x63,0x53,0x79,0xA6,0xF6,0xD0,0xF2,
+  0x59,0x8B,0x82,0x53,0x72,0x62,0x72,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,
+  0x62,0x72,0x62,0x62,0x72,0x53,0x5B,0x6A,0xF6,0xE0,0xF2,0x5C,0x5C,0x72,0x62,0x72,
+  0x62,0x72,0x22,0x22,0x72,0x22,0xB6,0xB6,0xB2,0x22,0xB2,0x22,0x22,0x72,0x62,0x72,
+  0x62,0x5C,0x5C,0xF6,0xC0,0xF2,0x6C,0x5C,0x72,0x62,0x72,0x62,0x72,0x22,0x22,0x72,
+  0x22,0xB6,0xB6,0xB2,0x22,0xB2,0x22,0xB2,0xF0,0x02,0xD8,0x98,0xF6,0xF0,0xF2,0xA5,
+  0x12,0x7A,0x63,0x53,0x62,0x72,0x52,0x82,0x52,0xF0,0x02,0xF0,0x02,0x47,0x42,0x47,
+  0x42,0x82,0x53,0x72,0x63,0x53,0x7A,0x96,0xF6,0xD0,0xF2,0x56,0x26,0x36,0x26,0x52,
+  0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x7A,0x7A,0x72,0x62,0x72,0x62,0x72,0x62,0x72,
+  0x62,0x56,0x26,0x36,0x26,0xF6,0xA0,0xF2,0x7A,0x7A,0xB2,0xF0,0x02,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xBA,0x7A,0xF6,
+  0xC0,0xF2,0x9A,0x7A,0xC2,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0x72,0x62,0x72,
+  0x62,0x72,0x62,0x72,0x62,0x72,0x52,0x89,0xA5,0xF7,0x00,0xF2,0x57,0x25,0x37,0x25,
+  0x52,0x52,0x82,0x42,0x92,0x32,0xA2,0x22,0xB2,0x13,0xB7,0xA3,0x23,0x92,0x43,0x82,
+  0x52,0x82,0x53,0x57,0x35,0x27,0x35,0xF6,0x90,0xF2,0x58,0x98,0xC2,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0x62,0x72,0x62,0x72,0x62,0x72,0x62,
+  0x4D,0x4D,0xF6,0xB0,0xF2,0x44,0x84,0x15,0x65,0x33,0x63,0x54,0x44,0x54,0x44,0x52,
+  0x12,0x22,0x12,0x52,0x12,0x22,0x12,0x52,0x24,0x22,0x52,0x24,0x22,0x52,0x32,0x32,
+  0x52,0x82,0x52,0x82,0x37,0x27,0x17,0x27,0xF6,0x90,0xF2,0x54,0x37,0x34,0x37,0x53,
+  0x52,0x74,0x42,0x75,0x32,0x72,0x12,0x32,0x72,0x13,0x22,0x72,0x23,0x12,0x72,0x32,
+  0x12,0x72,0x35,0x72,0x44,0x72,0x53,0x57,0x32,0x57,0x32,0xF6,0xC0,0xF2,0xA4,0xB8,
+  0x83,0x43,0x72,0x62,0x63,0x63,0x52,0x82,0x52,0x82,0x52,0x82,0x52,0x82,0x53,0x63,
+  0x62,0x62,0x73,0x43,0x88,0xB4,0xF6,0xF0,0xF2,0x6A,0x7B,0x82,0x53,0x72,0x62,0x72,
+  0x62,0x72,0x62,0x72,0x52,0x89,0x87,0xA2,0xF0,0x02,0xF0,0x02,0xD8,0x98,0xF6,0xF0,
+  0xF2,0xA4,0xB8,0x83,0x43,0x72,0x62,0x63,0x63,0x52,0x82,0x52,0x82,0x52,0x82,0x52,
+  0x82,0x53,0x63,0x62,0x62,0x73,0x43,0x88,0xA5,0xC5,0x22,0x7A,0x72,0x43,0xF3,0x90,
+  0xF2,0x5A,0x7B,0x82,0x53,0x72,0x62,0x72,0x62,0x72,0x53,0x79,0x87,0xA2,0x33,0x92,
+  0x43,0x82,0x52,0x82,0x53,0x57,0x34,0x37,0x43,0xF6,0xA0,0xF2,0x95,0x12,0x89,0x73,
+  0x43,0x72,0x62,0x72,0x62,0x74,0xE6,0xD6,0xE4,0x72,0x62,0x72,0x62,0x73,0x43,0x79,
+  0x82,0x15,0xF6,0xE0,0xF2,0x6C,0x5C,0x52,0x32,0x32,0x52,0x32,0x32,0x52,0x32,0x32,
+  0x52,0x32,0x32,0xA2,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xC8,0x98,
+  0xF6,0xD0,0xF2,0x56,0x26,0x36,0x26,0x52,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,
+  0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x82,0x42,0x98,0xB4,0xF6,0xF0,0xF2,
+  0x57,0x17,0x27,0x17,0x42,0x72,0x72,0x52,0x82,0x52,0x82,0x52,0x92,0x32,0xA2,0x32,
+  0xB2,0x12,0xC2,0x12,0xC2,0x12,0xD3,0xE3,0xF0,0x01,0xF7,0x00,0xF2,0x47,0x3E,0x37,
+  0x22,0x92,0x42,0x92,0x42,0x41,0x42,0x52,0x23,0x22,0x62,0x23,0x22,0x62,0x12,0x12,
+  0x12,0x62,0x12,0x12,0x12,0x64,0x25,0x73,0x33,0x83,0x33,0x82,0x52,0x82,0x52,0xF6,
+  0xC0,0xF2,0x56,0x26,0x36,0x26,0x52,0x62,0x82,0x42,0xA2,0x22,0xC4,0xE2,0xF0,0x02,
+  0xE4,0xC2,0x22,0xA2,0x42,0x82,0x62,0x56,0x26,0x36,0x26,0xF6,0xA0,0xF2,0x55,0x36,
+  0x35,0x36,0x52,0x62,0x82,0x42,0xA2,0x22,0xB2,0x22,0xC4,0xE2,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xC8,0x98,0xF6,0xD0,0xF2,0x7A,0x7A,0x72,0x62,0x72,0x52,0x82,
+  0x42,0x92,0x32,0xE2,0xE2,0xE2,0x42,0x82,0x52,0x72,0x62,0x62,0x72,0x6B,0x6B,0xF6,
+  0xC0,0xF1,0xA5,0xC5,0xC2,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,
+  0x05,0xC5,0xF3,0xA0,0x32,0xF0,0x02,0xF0,0x03,0xF0,0x02,0xF0,0x03,0xF0,0x02,0xF0,
+  0x02,0xF0,0x12,0xF0,0x02,0xF0,0x12,0xF0,0x02,0xF0,0x12,0xF0,0x02,0xF0,0x12,0xF0,
+  0x02,0xF0,0x03,0xF0,0x02,0xF0,0x03,0xF0,0x02,0xF0,0x02,0xF3,0x90,0xF1,0x75,0xC5,
+  0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xC5,0xC5,0xF3,0xD0,
+  0xF0,0xA1,0xF0,0x03,0xD5,0xB3,0x13,0xA2,0x32,0x92,0x52,0x72,0x72,0x61,0x91,0xFF,
+  0x30,0xFF,0xF0,0xF5,0x9F,0x01,0x1F,0x01,0x10,0xF0,0x82,0xF0,0x03,0xF0,0x13,0xF0,
+  0x02,0xFF,0xF0,0xF2,0xC0,0xF5,0xB6,0xA8,0xF0,0x12,0xF0,0x02,0xA7,0x89,0x73,0x52,
+  0x72,0x62,0x72,0x53,0x8B,0x75,0x14,0xF6,0xB0,0xF1,0x44,0xD4,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0x15,0x9A,0x73,0x52,0x72,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,
+  0x63,0x52,0x5C,0x54,0x15,0xF6,0xE0,0xF5,0xD5,0x12,0x7A,0x63,0x53,0x53,0x72,0x52,
+  0x82,0x52,0xF0,0x02,0xF0,0x03,0x72,0x63,0x53,0x79,0xA6,0xF6,0xD0,0xF1,0xC4,0xD4,
+  0xF0,0x02,0xF0,0x02,0x95,0x12,0x7A,0x72,0x53,0x62,0x72,0x62,0x72,0x62,0x72,0x62,
+  0x72,0x62,0x72,0x72,0x53,0x7C,0x75,0x14,0xF6,0xA0,0xF5,0xC6,0x9A,0x72,0x62,0x62,
+  0x82,0x5C,0x5C,0x52,0xF0,0x02,0xF0,0x12,0x72,0x6B,0x87,0xF6,0xD0,0xF1,0xA7,0x98,
+  0x82,0xF0,0x02,0xCB,0x6B,0x92,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0xCA,0x7A,0xF6,0xD0,0xF5,0xC5,0x14,0x5C,0x52,0x53,0x62,0x72,0x62,0x72,
+  0x62,0x72,0x62,0x72,0x62,0x72,0x72,0x53,0x7A,0x95,0x12,0xF0,0x02,0xF0,0x02,0xE3,
+  0x88,0x96,0xF1,0xA0,0xF1,0x44,0xD4,0xF0,0x02,0xF0,0x02,0xF0,0x02,0x15,0x99,0x83,
+  0x43,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x56,0x26,0x36,
+  0x26,0xF6,0xA0,0xF1,0xA2,0xF0,0x02,0xF1,0xE6,0xB6,0xF0,0x02,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xAC,0x5C,0xF6,0xB0,0xF1,0xB2,0xF0,0x02,
+  0xF1,0xD9,0x89,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xE3,0x88,0x96,0xF1,0xB0,0xF1,0x54,
+  0xD4,0xF0,0x02,0xF0,0x02,0xF0,0x02,0x25,0x82,0x25,0x82,0x22,0xB2,0x12,0xC5,0xC4,
+  0xD5,0xC2,0x13,0xB2,0x23,0x84,0x35,0x54,0x35,0xF6,0xB0,0xF1,0x66,0xB6,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xAC,0x5C,0xF6,0xB0,0xF5,0x74,0x13,0x14,0x4E,0x53,0x23,0x22,
+  0x52,0x32,0x32,0x52,0x32,0x32,0x52,0x32,0x32,0x52,0x32,0x32,0x52,0x32,0x32,0x52,
+  0x32,0x32,0x36,0x14,0x14,0x16,0x14,0x14,0xF6,0x90,0xF5,0x84,0x15,0x7B,0x83,0x43,
+  0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x56,0x26,0x36,0x26,
+  0xF6,0xA0,0xF5,0xD4,0xB8,0x83,0x43,0x63,0x63,0x52,0x82,0x52,0x82,0x52,0x82,0x53,
+  0x63,0x63,0x43,0x88,0xB4,0xF6,0xF0,0xF5,0x84,0x15,0x7C,0x73,0x52,0x72,0x72,0x62,
+  0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x63,0x52,0x7A,0x72,0x15,0x92,0xF0,0x02,0xF0,
+  0x02,0xD7,0xA7,0xF1,0xC0,0xF5,0xC5,0x14,0x5C,0x52,0x53,0x62,0x72,0x62,0x72,0x62,
+  0x72,0x62,0x72,0x62,0x72,0x72,0x53,0x7A,0x95,0x12,0xF0,0x02,0xF0,0x02,0xF0,0x02,
+  0xC7,0xA7,0xF1,0x50,0xF5,0x95,0x24,0x65,0x16,0x85,0x22,0x83,0xE2,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xF0,0x02,0xCA,0x7A,0xF6,0xD0,0xF5,0xC8,0x89,0x72,0x62,0x72,0x62,
+  0x76,0xC8,0xD5,0x72,0x62,0x72,0x53,0x79,0x88,0xF6,0xE0,0xF1,0x72,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xDA,0x7A,0x92,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0x53,0x89,0x96,0xF6,0xD0,0xF5,0x84,0x44,0x54,0x44,0x72,0x62,0x72,0x62,
+  0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x62,0x72,0x53,0x8B,0x75,0x14,0xF6,0xA0,0xF5,
+  0x85,0x45,0x35,0x45,0x52,0x62,0x72,0x62,0x82,0x42,0x92,0x42,0xA2,0x22,0xB2,0x22,
+  0xB6,0xC4,0xD4,0xF6,0xF0,0xF5,0x84,0x54,0x44,0x54,0x52,0x31,0x32,0x62,0x23,0x22,
+  0x62,0x23,0x22,0x72,0x11,0x11,0x12,0x84,0x14,0x84,0x14,0x83,0x32,0xA2,0x32,0xA2,
+  0x32,0xF6,0xE0,0xF5,0x95,0x25,0x55,0x25,0x72,0x42,0xA2,0x22,0xC4,0xE2,0xE4,0xC2,
+  0x22,0xA2,0x42,0x75,0x25,0x55,0x25,0xF6,0xB0,0xF5,0x86,0x45,0x26,0x45,0x42,0x72,
+  0x72,0x52,0x82,0x52,0x92,0x32,0xA2,0x32,0xB2,0x12,0xC5,0xD3,0xF0,0x02,0xE2,0xF0,
+  0x02,0xE2,0xB8,0x98,0xF1,0xA0,0xF5,0xAA,0x7A,0x72,0x52,0x82,0x42,0xE2,0xE2,0xE2,
+  0xE2,0x42,0x82,0x52,0x7A,0x7A,0xF6,0xC0,0xF1,0xB3,0xD4,0xD2,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xF0,0x02,0xE3,0xD3,0xF0,0x03,0xF0,0x02,0xF0,0x02,0xF0,0x02,
+  0xF0,0x02,0xF0,0x02,0xF0,0x04,0xE3,0xF3,0xB0,0xF1,0xA2,0xF0,0x02,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,
+  0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF3,0xD0,0xF1,
+  0x83,0xE4,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x03,
+  0xF0,0x03,0xD3,0xE2,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xF0,0x02,0xD4,0xD3,0xF3,0xE0,
+  0xF7,0xD3,0xD5,0x32,0x63,0x13,0x13,0x62,0x35,0xD3,0xFB,0x20,
+};
+
+/* Glyph offsets into Font24P_Data, 0x8000: raw bits instead of runs */
+static const uint16_t Font24P_Offset[] = {
+  0x0000,0x0004,0x0017,0x0028,0x0047,0x0069,0x0083,0x009C,
+  0x00AA,0x00C3,0x00DC,0x00EF,0x0106,0x0112,0x0117,0x011D,
+  0x013A,0x0157,0x0173,0x0189,0x01A3,0x01BC,0x01D8,0x01F1,
+  0x0209,0x0224,0x023D,0x0247,0x0256,0x026B,0x0273,0x0288,
+  0x029B,0x02C0,0x02DA,0x02F3,0x030F,0x032A,0x0345,0x035E,
+  0x037A,0x0397,0x03B1,0x03CB,0x03E9,0x0404,0x042A,0x044D,
+  0x0468,0x0480,0x04A0,0x04BB,0x04D4,0x04F2,0x050F,0x052C,
+  0x0551,0x056D,0x0588,0x05A1,0x05C4,0x05ED,0x0610,0x0621,
+  0x0629,0x0635,0x0649,0x0667,0x067D,0x069A,0x06AD,0x06C6,
+  0x06E4,0x0703,0x071C,0x073E,0x075B,0x0778,0x079A,0x07B2,
+  0x07C7,0x07E5,0x0804,0x0819,0x082B,0x0847,0x085F,0x0875,
+  0x0893,0x08A9,0x08C6,0x08D8,0x08F9,0x091F,0x0940,
+};
+
+sFONT Font24P = {
+  Font24P_Data,
+  17, /* Width */
+  24, /* Height */
+  Font24P_Offset, /* packed glyphs */
+};
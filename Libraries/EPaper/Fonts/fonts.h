@@ -29,6 +29,7 @@ typedef struct _tFont
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const uint16_t *offset;  /* packed glyph offsets into table (0x8000: raw bits), NULL: raw rows */
   
 } sFONT;
 
@@ -40,6 +41,13 @@ typedef struct
 } CH_CN;
 
 
+typedef struct
+{
+  unsigned char index[3];
+  uint16_t offset;         /* into cFONT.data, 0x8000: raw bits instead of runs */
+} CH_CN_PACK;
+
+
 typedef struct
 {    
   const CH_CN *table;
@@ -47,6 +55,9 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  const uint16_t *order;  /* table entries sorted by index bytes, NULL: unsorted */
+  const CH_CN_PACK *packed; /* sorted index of packed glyphs, used instead of table */
+  const uint8_t *data;
   
 } cFONT;
 
@@ -55,9 +66,12 @@ extern sFONT Font20;
 extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
+extern sFONT Font20P;
+extern sFONT Font24P;
 
 extern cFONT Font12CN;
 extern cFONT Font24CN;
+extern cFONT Font24CNP;
 
 #ifdef __cplusplus
 }
@@ -8,10 +8,36 @@
 *   Achieve display characters: Display a single character, string, number
 *   Achieve time display: adaptive size display time minutes and seconds
 *----------------
-* |	This version:   V3.1
-* | Date        :   2020-07-08
+* |	This version:   V3.2
+* | Date        :   2026-10-18
 * | Info        :
 * -----------------------------------------------------------------------------
+* V3.2(2026-10-18):
+* 1.add: Paint_BeginList(), Paint_RenderBands()
+*    Draw calls are recorded into a display list and replayed per horizontal
+*    band, so a panel larger than RAM is drawn through a small band buffer
+* 2.Change: Paint_SetPixel(), Paint_DrawBitMap()
+*    Clip to / read from the band being rendered
+* 3.add: Paint_FillRect()
+*    Clear windows, solid lines, points, filled rectangles and circles and
+*    glyph runs are written as masked byte runs instead of pixel by pixel
+* 4.add: Paint_DrawGlyph(), Paint_FindCN()
+*    Black and white glyphs are merged into the image a byte at a time in
+*    every rotation; CN fonts with an index order are binary searched
+* 5.add: Paint_DrawBitMapPacked(), Paint_DrawBitMapPacked_Paste()
+*    Fonts and bitmaps packed by Misc/Python/epd_pack.py (bit runs or
+*    PackBits) are decoded while they are drawn
+* 6.add: Paint_GetDirty(), Paint_ClearDirty(), Paint_Flush()
+*    Track the memory box drawn since the last flush and refresh only that
+*    window, with a full refresh first and after every N partials
+* 7.add: Paint_SelectPlane(), Paint_RenderPlanes()
+*    Display list entries carry a plane; each plane is rendered in bands
+*    on its own, so a tri-colour frame needs one band cache, not two images
+* 8.add: Paint_DrawDithered()
+*    Convert an RGB or grey picture to the panel palette with a 4x4 Bayer
+*    threshold; no state between pixels, so it works in any band
+*
+* -----------------------------------------------------------------------------
 * V3.1(2020-07-08):
 * 1.Change: Paint_SetScale(UBYTE scale)
 *		 Add scale 7 for 5.65f e-Parper
@@ -81,6 +107,601 @@
 
 PAINT Paint;
 
+/**
+ * Display list operations
+**/
+enum {
+    PAINT_OP_CLEAR = 0,
+    PAINT_OP_CLEAR_WINDOWS,
+    PAINT_OP_POINT,
+    PAINT_OP_LINE,
+    PAINT_OP_RECTANGLE,
+    PAINT_OP_CIRCLE,
+    PAINT_OP_CHAR,
+    PAINT_OP_STRING_EN,
+    PAINT_OP_STRING_CN,
+    PAINT_OP_NUM,
+    PAINT_OP_NUM_DECIMALS,
+    PAINT_OP_TIME,
+    PAINT_OP_BITMAP,
+    PAINT_OP_BITMAP_PASTE,
+    PAINT_OP_BITMAP_PACKED,
+    PAINT_OP_BITMAP_PASTE_PACKED,
+    PAINT_OP_DITHERED,
+};
+
+/**
+ * Packed data codecs, see Misc/Python/epd_pack.py
+**/
+enum {
+    PAINT_PACK_RUNS = 0,    // alternating clear/set runs, one nibble each
+    PAINT_PACK_BYTES,       // PackBits
+    PAINT_PACK_BITS,        // raw bits, glyphs only
+};
+#define PAINT_PACK_RAW_GLYPH    0x8000  // glyph offset flag: raw bits instead of runs
+
+/**
+ * Decoder state, kept between rows of one glyph or bitmap
+**/
+typedef struct {
+    const UBYTE *Src;
+    UDOUBLE Pos;        // nibble, bit or byte read position
+    UWORD Left;         // pixels or bytes left in the current run / packet
+    UBYTE Codec;
+    UBYTE Bit;          // value of the current run, or PackBits repeat
+} PAINT_UNPACK;
+
+static PAINT_CMD *Paint_List = NULL;
+static UWORD Paint_ListSize = 0;
+static UWORD Paint_ListLen = 0;
+static UBYTE Paint_Recording = 0;
+static UBYTE Paint_ListFull = 0;
+static UBYTE Paint_Plane = PAINT_PLANE_BLACK;   // plane of the commands being recorded
+
+// Memory box drawn since the last flush, empty while Paint_DirtyX0 > Paint_DirtyX1
+#define PAINT_NEED_FULL 0xFFFF
+static UWORD Paint_DirtyX0 = 0xFFFF, Paint_DirtyY0 = 0xFFFF, Paint_DirtyX1 = 0, Paint_DirtyY1 = 0;
+static UWORD Paint_Partials = PAINT_NEED_FULL;   // partial refreshes since the last full one
+
+/******************************************************************************
+function: Map a point from drawing to memory coordinates
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+    X, Y   : Memory column and row
+******************************************************************************/
+static UBYTE Paint_MapPoint(UWORD Xpoint, UWORD Ypoint, UWORD *X, UWORD *Y)
+{
+    switch(Paint.Rotate) {
+    case 0:
+        *X = Xpoint;
+        *Y = Ypoint;
+        break;
+    case 90:
+        *X = Paint.WidthMemory - Ypoint - 1;
+        *Y = Xpoint;
+        break;
+    case 180:
+        *X = Paint.WidthMemory - Xpoint - 1;
+        *Y = Paint.HeightMemory - Ypoint - 1;
+        break;
+    case 270:
+        *X = Ypoint;
+        *Y = Paint.HeightMemory - Xpoint - 1;
+        break;
+    default:
+        return 0;
+    }
+
+    switch(Paint.Mirror) {
+    case MIRROR_NONE:
+        break;
+    case MIRROR_HORIZONTAL:
+        *X = Paint.WidthMemory - *X - 1;
+        break;
+    case MIRROR_VERTICAL:
+        *Y = Paint.HeightMemory - *Y - 1;
+        break;
+    case MIRROR_ORIGIN:
+        *X = Paint.WidthMemory - *X - 1;
+        *Y = Paint.HeightMemory - *Y - 1;
+        break;
+    default:
+        return 0;
+    }
+    return 1;
+}
+
+/******************************************************************************
+function: Grow the dirty box by a memory rectangle (inclusive, any order)
+******************************************************************************/
+static void Paint_MarkDirty(UWORD X0, UWORD Y0, UWORD X1, UWORD Y1)
+{
+    UWORD T;
+
+    if (X0 > X1) {
+        T = X0; X0 = X1; X1 = T;
+    }
+    if (Y0 > Y1) {
+        T = Y0; Y0 = Y1; Y1 = T;
+    }
+    if (X0 < Paint_DirtyX0)
+        Paint_DirtyX0 = X0;
+    if (X1 > Paint_DirtyX1)
+        Paint_DirtyX1 = X1;
+    if (Y0 < Paint_DirtyY0)
+        Paint_DirtyY0 = Y0;
+    if (Y1 > Paint_DirtyY1)
+        Paint_DirtyY1 = Y1;
+}
+
+/******************************************************************************
+function: Mark the rows of the image held in memory (all of it, or the band)
+******************************************************************************/
+static void Paint_MarkAll(void)
+{
+    Paint_MarkDirty(0, Paint.BandStart, Paint.WidthMemory - 1, Paint.BandStart + Paint.HeightByte - 1);
+}
+
+/******************************************************************************
+function: Fill a rectangle of the drawing area
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point (exclusive)
+    Yend   : y end point (exclusive)
+    Color  : Painted colors
+info:
+    Rotation and mirroring turn a rectangle into a memory rectangle, so only
+    two corners are mapped. Each memory row is then one byte run with masked
+    ends, for 1, 2 and 4 bits per pixel. Clipped to the drawing area and band.
+******************************************************************************/
+static void Paint_FillRect(int Xstart, int Ystart, int Xend, int Yend, UWORD Color)
+{
+    UWORD X0, Y0, X1, Y1, T, Y;
+    UWORD Bpp, First, Last;
+    UBYTE Fill, Head, Tail;
+    UBYTE *Row;
+
+    if (Xstart < 0)
+        Xstart = 0;
+    if (Ystart < 0)
+        Ystart = 0;
+    if (Xend > Paint.Width)
+        Xend = Paint.Width;
+    if (Yend > Paint.Height)
+        Yend = Paint.Height;
+    if (Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    if (!Paint_MapPoint(Xstart, Ystart, &X0, &Y0) || !Paint_MapPoint(Xend - 1, Yend - 1, &X1, &Y1))
+        return;
+    if (X0 > X1) {
+        T = X0; X0 = X1; X1 = T;
+    }
+    if (Y0 > Y1) {
+        T = Y0; Y0 = Y1; Y1 = T;
+    }
+
+    // Only the rows held in Image (the band being rendered)
+    if (Y0 < Paint.BandStart)
+        Y0 = Paint.BandStart;
+    if (Y1 - Paint.BandStart >= Paint.HeightByte)
+        Y1 = Paint.BandStart + Paint.HeightByte - 1;
+    if (Y1 < Y0 || Y1 < Paint.BandStart)
+        return;
+    Paint_MarkDirty(X0, Y0, X1, Y1);
+
+    if (Paint.Scale == 2) {
+        Bpp = 1;
+        Fill = (Color == BLACK) ? 0x00 : 0xFF;
+    } else if (Paint.Scale == 4) {
+        Bpp = 2;
+        Fill = (Color % 4) * 0x55;
+    } else if (Paint.Scale == 7) {
+        Bpp = 4;
+        Fill = (Color & 0x0F) * 0x11;
+    } else {
+        return;
+    }
+
+    // Pixels are packed MSB first
+    First = X0 * Bpp / 8;
+    Last = X1 * Bpp / 8;
+    Head = 0xFF >> (X0 * Bpp % 8);
+    Tail = 0xFF << (8 - (X1 * Bpp % 8 + Bpp));
+    if (First == Last)
+        Head &= Tail;
+
+    Row = Paint.Image + (UDOUBLE)(Y0 - Paint.BandStart) * Paint.WidthByte;
+    for (Y = Y0; Y <= Y1; Y++, Row += Paint.WidthByte) {
+        Row[First] = (Row[First] & ~Head) | (Fill & Head);
+        if (First != Last) {
+            if (Last - First > 1)
+                memset(Row + First + 1, Fill, Last - First - 1);
+            Row[Last] = (Row[Last] & ~Tail) | (Fill & Tail);
+        }
+    }
+}
+
+/******************************************************************************
+function: Draw one glyph row of a 1-bit font as runs of equal color
+parameter:
+    Xpoint : x of the first pixel
+    Ypoint : y of the row
+    Ptr    : Glyph row, MSB first
+    Width  : Pixels in the row
+    Color_Foreground : Color of set bits
+    Color_Background : Color of clear bits, skipped if FONT_BACKGROUND
+******************************************************************************/
+static void Paint_GlyphRow(UWORD Xpoint, UWORD Ypoint, const unsigned char *Ptr, UWORD Width,
+                           UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Column = 0, Start;
+    UBYTE Bit;
+
+    while (Column < Width) {
+        Start = Column;
+        Bit = Ptr[Column / 8] & (0x80 >> (Column % 8));
+        do {
+            Column++;
+        } while (Column < Width && !(Ptr[Column / 8] & (0x80 >> (Column % 8))) == !Bit);
+
+        if (Bit)
+            Paint_FillRect(Xpoint + Start, Ypoint, Xpoint + Column, Ypoint + 1, Color_Foreground);
+        else if (FONT_BACKGROUND != Color_Background)
+            Paint_FillRect(Xpoint + Start, Ypoint, Xpoint + Column, Ypoint + 1, Color_Background);
+    }
+}
+
+/******************************************************************************
+function: Merge a line of 1-bit pixels into one image row
+parameter:
+    Dst    : Image byte holding the first pixel
+    Shift  : Bit position of the first pixel in Dst, 0 = MSB
+    Bits   : Pixels, MSB first
+    Len    : Number of pixels
+    Fg     : Byte fill of set bits
+    Bg     : Byte fill of clear bits
+    Opaque : 0 to leave the pixels of clear bits untouched
+******************************************************************************/
+static void Paint_BlitBits(UBYTE *Dst, UBYTE Shift, const UBYTE *Bits, UWORD Len,
+                           UBYTE Fg, UBYTE Bg, UBYTE Opaque)
+{
+    UBYTE Valid, Mask, Value, Spill;
+    UWORD i;
+
+    for (i = 0; Len; i++) {
+        Valid = (Len >= 8) ? 0xFF : (UBYTE)(0xFF << (8 - Len));
+        Value = (Bits[i] & Fg) | (~Bits[i] & Bg);
+        Mask = Opaque ? Valid : (Bits[i] & Valid);
+        Dst[i] = (Dst[i] & ~(Mask >> Shift)) | ((Value & Mask) >> Shift);
+        // Bits shifted past this byte land at the top of the next one
+        Spill = (UBYTE)(Mask << (8 - Shift));
+        if (Shift && Spill)
+            Dst[i + 1] = (Dst[i + 1] & ~Spill) | ((UBYTE)(Value << (8 - Shift)) & Spill);
+        Len = (Len >= 8) ? Len - 8 : 0;
+    }
+}
+
+/******************************************************************************
+function: Draw a 1-bit glyph
+parameter:
+    Xpoint : x of the top left corner
+    Ypoint : y of the top left corner
+    Ptr    : Glyph rows, MSB first, each padded to a whole byte
+    Width  : Glyph width
+    Height : Glyph height
+    Color_Foreground : Color of set bits
+    Color_Background : Color of clear bits, skipped if FONT_BACKGROUND
+info:
+    In black and white images every glyph row (rotate 0/180) or column
+    (rotate 90/270) is one run of an image row. When it runs left to right
+    the font bytes are merged directly, otherwise its pixels are first
+    gathered into a line in memory order. Glyphs crossing the edge of the
+    drawing area go row by row through Paint_GlyphRow().
+******************************************************************************/
+static void Paint_DrawGlyph(UWORD Xpoint, UWORD Ypoint, const unsigned char *Ptr, UWORD Width,
+                            UWORD Height, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD RowBytes = Width / 8 + (Width % 8 ? 1 : 0);
+    UWORD X, Y, Xn, Yn, Xd, Yd, Lines, Len, Line, k, p;
+    UBYTE Buf[8], Fg, Bg, Opaque, Across;
+    const UBYTE *Bits;
+    int Dir, Step, Left, Row;
+
+    if (Paint.Scale != 2 || Width < 2 || Height < 2
+        || Xpoint + Width > Paint.Width || Ypoint + Height > Paint.Height
+        || !Paint_MapPoint(Xpoint, Ypoint, &X, &Y)
+        || !Paint_MapPoint(Xpoint + 1, Ypoint, &Xn, &Yn)
+        || !Paint_MapPoint(Xpoint, Ypoint + 1, &Xd, &Yd)) {
+        Across = 2;
+    } else if (Yn == Y) {
+        // Glyph rows are image rows
+        Across = 1; Lines = Height; Len = Width;
+        Dir = (int)Xn - X; Step = (int)Yd - Y;
+    } else {
+        // Glyph columns are image rows
+        Across = 0; Lines = Width; Len = Height;
+        Dir = (int)Xd - X; Step = (int)Yn - Y;
+    }
+    if (Across == 2 || Len > 8 * sizeof(Buf)) {
+        for (Line = 0; Line < Height; Line++, Ptr += RowBytes)
+            Paint_GlyphRow(Xpoint, Ypoint + Line, Ptr, Width, Color_Foreground, Color_Background);
+        return;
+    }
+
+    Fg = (Color_Foreground == BLACK) ? 0x00 : 0xFF;
+    Bg = (Color_Background == BLACK) ? 0x00 : 0xFF;
+    Opaque = (FONT_BACKGROUND != Color_Background);
+    // Leftmost image column of the glyph
+    Left = (Dir > 0) ? X : (int)X - (Len - 1);
+    Paint_MarkDirty(Left, Y, Left + Len - 1, (int)Y + Step * (Lines - 1));
+
+    for (Line = 0; Line < Lines; Line++) {
+        Row = (int)Y + Step * Line - Paint.BandStart;
+        if (Row < 0 || Row >= Paint.HeightByte)
+            continue;
+        if (Across && Dir > 0) {
+            Bits = Ptr + Line * RowBytes;
+        } else {
+            memset(Buf, 0, sizeof(Buf));
+            for (k = 0; k < Len; k++) {
+                p = (Dir > 0) ? k : Len - 1 - k;
+                if (Across ? Ptr[Line * RowBytes + p / 8] & (0x80 >> (p % 8))
+                           : Ptr[p * RowBytes + Line / 8] & (0x80 >> (Line % 8)))
+                    Buf[k / 8] |= 0x80 >> (k % 8);
+            }
+            Bits = Buf;
+        }
+        Paint_BlitBits(Paint.Image + (UDOUBLE)Row * Paint.WidthByte + Left / 8, Left % 8,
+                       Bits, Len, Fg, Bg, Opaque);
+    }
+}
+
+/******************************************************************************
+function: Start decoding packed data
+parameter:
+    u      : Decoder state
+    Src    : First byte of packed data
+    Codec  : PAINT_PACK_RUNS, PAINT_PACK_BYTES or PAINT_PACK_BITS
+******************************************************************************/
+static void Paint_BeginUnpack(PAINT_UNPACK *u, const UBYTE *Src, UBYTE Codec)
+{
+    u->Src = Src;
+    u->Pos = 0;
+    u->Left = 0;
+    u->Codec = Codec;
+    u->Bit = 1;     // the first run is clear pixels
+}
+
+static UBYTE Paint_Nibble(PAINT_UNPACK *u)
+{
+    UBYTE Value = u->Src[u->Pos / 2];
+    return (u->Pos++ % 2) ? (Value & 0x0F) : (Value >> 4);
+}
+
+/******************************************************************************
+function: Set Len bits of Dst from bit Pos on, MSB first
+******************************************************************************/
+static void Paint_SetBits(UBYTE *Dst, UWORD Pos, UWORD Len)
+{
+    for (; Len && Pos % 8; Pos++, Len--)
+        Dst[Pos / 8] |= 0x80 >> (Pos % 8);
+    for (; Len >= 8; Pos += 8, Len -= 8)
+        Dst[Pos / 8] = 0xFF;
+    for (; Len; Pos++, Len--)
+        Dst[Pos / 8] |= 0x80 >> (Pos % 8);
+}
+
+/******************************************************************************
+function: Decode the next pixels of bit runs or raw bits
+parameter:
+    u      : Decoder state
+    Dst    : Pixels, MSB first, the last byte padded with clear bits
+    Count  : Number of pixels
+******************************************************************************/
+static void Paint_UnpackBits(PAINT_UNPACK *u, UBYTE *Dst, UWORD Count)
+{
+    UWORD Pos = 0, Len;
+
+    memset(Dst, 0, (Count + 7) / 8);
+    while (Pos < Count) {
+        if (u->Codec == PAINT_PACK_BITS) {
+            if (u->Src[u->Pos / 8] & (0x80 >> (u->Pos % 8)))
+                Dst[Pos / 8] |= 0x80 >> (Pos % 8);
+            u->Pos++;
+            Pos++;
+            continue;
+        }
+        // Runs alternate clear and set; nibble 15 is followed by a byte to add
+        while (u->Left == 0) {
+            u->Bit ^= 1;
+            u->Left = Paint_Nibble(u);
+            if (u->Left == 15) {
+                u->Left += Paint_Nibble(u) << 4;
+                u->Left += Paint_Nibble(u);
+            }
+        }
+        Len = (u->Left < Count - Pos) ? u->Left : Count - Pos;
+        if (u->Bit)
+            Paint_SetBits(Dst, Pos, Len);
+        Pos += Len;
+        u->Left -= Len;
+    }
+}
+
+/******************************************************************************
+function: Decode the next bytes of packed data
+parameter:
+    u      : Decoder state
+    Dst    : Output bytes
+    Count  : Number of bytes
+info:
+    PackBits: header n < 128 copies n + 1 bytes, n > 128 repeats the next
+    byte 257 - n times, 128 is skipped.
+******************************************************************************/
+static void Paint_Unpack(PAINT_UNPACK *u, UBYTE *Dst, UWORD Count)
+{
+    UBYTE Head;
+
+    if (u->Codec != PAINT_PACK_BYTES) {
+        Paint_UnpackBits(u, Dst, Count * 8);
+        return;
+    }
+    while (Count) {
+        if (u->Left == 0) {
+            Head = u->Src[u->Pos++];
+            if (Head == 128)
+                continue;
+            u->Bit = (Head > 128);
+            u->Left = u->Bit ? 257 - Head : Head + 1;
+        }
+        *Dst++ = u->Src[u->Pos];
+        Count--;
+        if (--u->Left == 0 || !u->Bit)
+            u->Pos++;
+    }
+}
+
+/******************************************************************************
+function: Draw a packed 1-bit glyph
+parameter:
+    Xpoint : x of the top left corner
+    Ypoint : y of the top left corner
+    Data   : Packed glyph data of the font
+    Offset : Glyph offset in Data, PAINT_PACK_RAW_GLYPH for raw bits
+    Width  : Glyph width
+    Height : Glyph height
+    Color_Foreground : Color of set bits
+    Color_Background : Color of clear bits, skipped if FONT_BACKGROUND
+info:
+    Rows are decoded into one glyph on the stack, then drawn as a raw glyph.
+******************************************************************************/
+static void Paint_DrawPacked(UWORD Xpoint, UWORD Ypoint, const UBYTE *Data, UWORD Offset,
+                             UWORD Width, UWORD Height, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UBYTE Glyph[MAX_HEIGHT_FONT * MAX_WIDTH_FONT / 8];
+    UWORD RowBytes = Width / 8 + (Width % 8 ? 1 : 0);
+    UWORD Row;
+    PAINT_UNPACK u;
+
+    if (RowBytes * Height > sizeof(Glyph))
+        return;
+    Paint_BeginUnpack(&u, Data + (Offset & ~PAINT_PACK_RAW_GLYPH),
+                      (Offset & PAINT_PACK_RAW_GLYPH) ? PAINT_PACK_BITS : PAINT_PACK_RUNS);
+    for (Row = 0; Row < Height; Row++)
+        Paint_UnpackBits(&u, Glyph + Row * RowBytes, Width);
+    Paint_DrawGlyph(Xpoint, Ypoint, Glyph, Width, Height, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function: Index bytes of the i-th entry of a CN font in search order
+******************************************************************************/
+static const unsigned char *Paint_CNIndex(cFONT *font, UWORD i)
+{
+    if (font->packed)
+        return font->packed[i].index;
+    return font->table[font->order ? font->order[i] : i].index;
+}
+
+/******************************************************************************
+function: Find the glyph of one character in a CN font
+parameter:
+    font   : Font to search
+    Code   : Character bytes, one for ASCII and up to three for UTF-8
+    Len    : Number of bytes in Code
+return:
+    Entry in font->packed or font->table, -1 if there is none
+info:
+    Packed fonts and fonts with an index order (stable sorted, so
+    duplicates keep the table order) are binary searched, others are
+    scanned.
+******************************************************************************/
+static int Paint_FindCN(cFONT *font, const char *Code, UWORD Len)
+{
+    unsigned char Key[3] = {0, 0, 0};
+    int Low = 0, High = font->size - 1, Mid;
+    UWORD i;
+
+    memcpy(Key, Code, Len);
+    if (font->packed == NULL && font->order == NULL) {
+        for (i = 0; i < font->size; i++) {
+            if (memcmp(font->table[i].index, Key, sizeof(Key)) == 0)
+                return i;
+        }
+        return -1;
+    }
+
+    // First match in order, i.e. the earliest entry, as the linear scan finds
+    while (Low < High) {
+        Mid = (Low + High) / 2;
+        if (memcmp(Paint_CNIndex(font, Mid), Key, sizeof(Key)) < 0)
+            Low = Mid + 1;
+        else
+            High = Mid;
+    }
+    if (font->size == 0 || memcmp(Paint_CNIndex(font, Low), Key, sizeof(Key)) != 0)
+        return -1;
+    return font->packed ? Low : font->order[Low];
+}
+
+/******************************************************************************
+function: Draw one entry of a CN font
+******************************************************************************/
+static void Paint_DrawCN(UWORD Xpoint, UWORD Ypoint, cFONT *font, int Entry,
+                         UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Entry < 0)
+        return;
+    if (font->packed)
+        Paint_DrawPacked(Xpoint, Ypoint, font->data, font->packed[Entry].offset, font->Width, font->Height,
+                         Color_Foreground, Color_Background);
+    else
+        Paint_DrawGlyph(Xpoint, Ypoint, (const unsigned char *)font->table[Entry].matrix, font->Width,
+                        font->Height, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function: Append a command to the display list
+parameter:
+    Op             : Operation
+    Xstart..Yend   : Drawing-coordinate box the command may touch (inclusive)
+******************************************************************************/
+static PAINT_CMD *Paint_Record(UBYTE Op, int Xstart, int Ystart, int Xend, int Yend)
+{
+    PAINT_CMD *cmd;
+    UWORD X, Y, i;
+    int Xc[2], Yc[2];
+
+    if (Paint_ListLen >= Paint_ListSize) {
+        Paint_ListFull = 1;
+        return NULL;
+    }
+    cmd = &Paint_List[Paint_ListLen++];
+    memset(cmd, 0, sizeof(PAINT_CMD));
+    cmd->Op = Op;
+    cmd->Plane = Paint_Plane;
+
+    // Clamp the box to the drawing area, then take the memory rows its corners map to
+    Xc[0] = Xstart < 0 ? 0 : (Xstart >= Paint.Width ? Paint.Width - 1 : Xstart);
+    Xc[1] = Xend < 0 ? 0 : (Xend >= Paint.Width ? Paint.Width - 1 : Xend);
+    Yc[0] = Ystart < 0 ? 0 : (Ystart >= Paint.Height ? Paint.Height - 1 : Ystart);
+    Yc[1] = Yend < 0 ? 0 : (Yend >= Paint.Height ? Paint.Height - 1 : Yend);
+    cmd->YMin = Paint.HeightMemory;
+    cmd->YMax = 0;
+    for (i = 0; i < 4; i++) {
+        if (!Paint_MapPoint(Xc[i & 1], Yc[i >> 1], &X, &Y)) {
+            Y = 0;
+        }
+        if (Y < cmd->YMin)
+            cmd->YMin = Y;
+        if (Y > cmd->YMax)
+            cmd->YMax = Y;
+    }
+    return cmd;
+}
+
 /******************************************************************************
 function: Create Image
 parameter:
@@ -106,6 +727,11 @@ void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
    
     Paint.Rotate = Rotate;
     Paint.Mirror = MIRROR_NONE;
+    Paint.BandStart = 0;
+
+    // A new image starts with a full refresh
+    Paint_ClearDirty();
+    Paint_Partials = PAINT_NEED_FULL;
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
         Paint.Width = Width;
@@ -189,48 +815,19 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
     }      
     UWORD X, Y;
 
-    switch(Paint.Rotate) {
-    case 0:
-        X = Xpoint;
-        Y = Ypoint;  
-        break;
-    case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
-        break;
-    case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
-        break;
-    case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
-        break;
-    default:
-        return;
-    }
-    
-    switch(Paint.Mirror) {
-    case MIRROR_NONE:
-        break;
-    case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
-        break;
-    case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    default:
+    if (!Paint_MapPoint(Xpoint, Ypoint, &X, &Y))
         return;
-    }
 
     if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
         EPD_Printf("Exceeding display boundaries\r\n");
         return;
     }
+
+    // Outside the rows held in Image (the band being rendered)
+    if(Y < Paint.BandStart || Y - Paint.BandStart >= Paint.HeightByte)
+        return;
+    Paint_MarkDirty(X, Y, X, Y);
+    Y -= Paint.BandStart;
     
     if(Paint.Scale == 2){
         UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
@@ -262,6 +859,14 @@ parameter:
 ******************************************************************************/
 void Paint_Clear(UWORD Color)
 {
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_CLEAR, 0, 0, Paint.Width - 1, Paint.Height - 1);
+        if (cmd)
+            cmd->Fg = Color;
+        return;
+    }
+
+	Paint_MarkAll();
 	if(Paint.Scale == 2) {
 		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
 			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
@@ -297,12 +902,15 @@ parameter:
 ******************************************************************************/
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
-    UWORD X, Y;
-    for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_CLEAR_WINDOWS, Xstart, Ystart, Xend - 1, Yend - 1);
+        if (cmd) {
+            cmd->X0 = Xstart; cmd->Y0 = Ystart; cmd->X1 = Xend; cmd->Y1 = Yend;
+            cmd->Fg = Color;
         }
+        return;
     }
+    Paint_FillRect(Xstart, Ystart, Xend, Yend, Color);
 }
 
 /******************************************************************************
@@ -317,6 +925,16 @@ parameter:
 void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
                      DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
 {
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_POINT, (int)Xpoint - Dot_Pixel, (int)Ypoint - Dot_Pixel,
+                                      (int)Xpoint + Dot_Pixel, (int)Ypoint + Dot_Pixel);
+        if (cmd) {
+            cmd->X0 = Xpoint; cmd->Y0 = Ypoint;
+            cmd->Fg = Color; cmd->A = Dot_Pixel; cmd->B = Dot_Style;
+        }
+        return;
+    }
+
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         EPD_Printf("Paint_DrawPoint Input exceeds the normal display range\r\n");
 				printf("Xpoint = %d , Paint.Width = %d  \r\n ",Xpoint,Paint.Width);
@@ -324,22 +942,12 @@ void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
         return;
     }
 
-    int16_t XDir_Num , YDir_Num;
     if (Dot_Style == DOT_FILL_AROUND) {
-        for (XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
-                if(Xpoint + XDir_Num - Dot_Pixel < 0 || Ypoint + YDir_Num - Dot_Pixel < 0)
-                    break;
-                // printf("x = %d, y = %d\r\n", Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel);
-                Paint_SetPixel(Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
-            }
-        }
+        Paint_FillRect((int)Xpoint - Dot_Pixel, (int)Ypoint - Dot_Pixel,
+                       (int)Xpoint + Dot_Pixel - 1, (int)Ypoint + Dot_Pixel - 1, Color);
     } else {
-        for (XDir_Num = 0; XDir_Num <  Dot_Pixel; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num <  Dot_Pixel; YDir_Num++) {
-                Paint_SetPixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
-            }
-        }
+        Paint_FillRect((int)Xpoint - 1, (int)Ypoint - 1,
+                       (int)Xpoint - 1 + Dot_Pixel, (int)Ypoint - 1 + Dot_Pixel, Color);
     }
 }
 
@@ -357,12 +965,35 @@ parameter:
 void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
                     UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
 {
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_LINE,
+                                      (int)(Xstart < Xend ? Xstart : Xend) - Line_width,
+                                      (int)(Ystart < Yend ? Ystart : Yend) - Line_width,
+                                      (int)(Xstart > Xend ? Xstart : Xend) + Line_width,
+                                      (int)(Ystart > Yend ? Ystart : Yend) + Line_width);
+        if (cmd) {
+            cmd->X0 = Xstart; cmd->Y0 = Ystart; cmd->X1 = Xend; cmd->Y1 = Yend;
+            cmd->Fg = Color; cmd->A = Line_width; cmd->B = Line_Style;
+        }
+        return;
+    }
+
     if (Xstart > Paint.Width || Ystart > Paint.Height ||
         Xend > Paint.Width || Yend > Paint.Height) {
         EPD_Printf("Paint_DrawLine Input exceeds the normal display range\r\n");
         return;
     }
 
+    // Solid horizontal and vertical lines: the points form one rectangle
+    if (Line_Style == LINE_STYLE_SOLID && (Xstart == Xend || Ystart == Yend)) {
+        int X0 = Xstart < Xend ? Xstart : Xend;
+        int Y0 = Ystart < Yend ? Ystart : Yend;
+        int X1 = Xstart < Xend ? Xend : Xstart;
+        int Y1 = Ystart < Yend ? Yend : Ystart;
+        Paint_FillRect(X0 - Line_width, Y0 - Line_width, X1 + Line_width - 1, Y1 + Line_width - 1, Color);
+        return;
+    }
+
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
     int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
@@ -415,6 +1046,19 @@ parameter:
 void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
                          UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_RECTANGLE,
+                                      (int)(Xstart < Xend ? Xstart : Xend) - Line_width,
+                                      (int)(Ystart < Yend ? Ystart : Yend) - Line_width,
+                                      (int)(Xstart > Xend ? Xstart : Xend) + Line_width,
+                                      (int)(Ystart > Yend ? Ystart : Yend) + Line_width);
+        if (cmd) {
+            cmd->X0 = Xstart; cmd->Y0 = Ystart; cmd->X1 = Xend; cmd->Y1 = Yend;
+            cmd->Fg = Color; cmd->A = Line_width; cmd->B = Draw_Fill;
+        }
+        return;
+    }
+
     if (Xstart > Paint.Width || Ystart > Paint.Height ||
         Xend > Paint.Width || Yend > Paint.Height) {
         EPD_Printf("Input exceeds the normal display range\r\n");
@@ -448,6 +1092,17 @@ parameter:
 void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
                       UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
+    if (Paint_Recording) {
+        int R = (int)Radius + Line_width;
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_CIRCLE, (int)X_Center - R, (int)Y_Center - R,
+                                      (int)X_Center + R, (int)Y_Center + R);
+        if (cmd) {
+            cmd->X0 = X_Center; cmd->Y0 = Y_Center; cmd->X1 = Radius;
+            cmd->Fg = Color; cmd->A = Line_width; cmd->B = Draw_Fill;
+        }
+        return;
+    }
+
     if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
         EPD_Printf("Paint_DrawCircle Input exceeds the normal display range\r\n");
         return;
@@ -461,19 +1116,19 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     //Cumulative error,judge the next point of the logo
     int16_t Esp = 3 - (Radius << 1 );
 
-    int16_t sCountY;
     if (Draw_Fill == DRAW_FILL_FULL) {
         while (XCurrent <= YCurrent ) { //Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY ++ ) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
+            // Each octant's points from XCurrent to YCurrent form one run;
+            // a DOT_PIXEL_1X1 point at (x, y) paints pixel (x - 1, y - 1)
+            int Xc = X_Center - 1, Yc = Y_Center - 1;
+            Paint_FillRect(Xc + XCurrent, Yc + XCurrent, Xc + XCurrent + 1, Yc + YCurrent + 1, Color);//1
+            Paint_FillRect(Xc - XCurrent, Yc + XCurrent, Xc - XCurrent + 1, Yc + YCurrent + 1, Color);//2
+            Paint_FillRect(Xc - YCurrent, Yc + XCurrent, Xc - XCurrent + 1, Yc + XCurrent + 1, Color);//3
+            Paint_FillRect(Xc - YCurrent, Yc - XCurrent, Xc - XCurrent + 1, Yc - XCurrent + 1, Color);//4
+            Paint_FillRect(Xc - XCurrent, Yc - YCurrent, Xc - XCurrent + 1, Yc - XCurrent + 1, Color);//5
+            Paint_FillRect(Xc + XCurrent, Yc - YCurrent, Xc + XCurrent + 1, Yc - XCurrent + 1, Color);//6
+            Paint_FillRect(Xc + XCurrent, Yc - XCurrent, Xc + YCurrent + 1, Yc - XCurrent + 1, Color);//7
+            Paint_FillRect(Xc + XCurrent, Yc + XCurrent, Xc + YCurrent + 1, Yc + XCurrent + 1, Color);//8
             if (Esp < 0 )
                 Esp += 4 * XCurrent + 6;
             else {
@@ -517,40 +1172,31 @@ parameter:
 void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
                     sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
-    UWORD Page, Column;
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_CHAR, Xpoint, Ypoint,
+                                      (int)Xpoint + Font->Width - 1, (int)Ypoint + Font->Height - 1);
+        if (cmd) {
+            cmd->X0 = Xpoint; cmd->Y0 = Ypoint; cmd->U.Ch = Acsii_Char; cmd->Font = Font;
+            cmd->Fg = Color_Foreground; cmd->Bg = Color_Background;
+        }
+        return;
+    }
 
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         EPD_Printf("Paint_DrawChar Input exceeds the normal display range\r\n");
         return;
     }
 
+    if (Font->offset) {
+        Paint_DrawPacked(Xpoint, Ypoint, Font->table, Font->offset[Acsii_Char - ' '], Font->Width, Font->Height,
+                         Color_Foreground, Color_Background);
+        return;
+    }
+
     uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
     const unsigned char *ptr = &Font->table[Char_Offset];
 
-    for (Page = 0; Page < Font->Height; Page ++ ) {
-        for (Column = 0; Column < Font->Width; Column ++ ) {
-
-            //To determine whether the font background color and screen background color is consistent
-            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                if (*ptr & (0x80 >> (Column % 8)))
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            } else {
-                if (*ptr & (0x80 >> (Column % 8))) {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                } else {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                }
-            }
-            //One pixel is 8 bits
-            if (Column % 8 == 7)
-                ptr++;
-        }// Write a line
-        if (Font->Width % 8 != 0)
-            ptr++;
-    }// Write all
+    Paint_DrawGlyph(Xpoint, Ypoint, ptr, Font->Width, Font->Height, Color_Foreground, Color_Background);
 }
 
 /******************************************************************************
@@ -569,6 +1215,16 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
 
+    // Long strings wrap below Ystart, over the full width
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_STRING_EN, 0, Ystart, Paint.Width - 1, Paint.Height - 1);
+        if (cmd) {
+            cmd->X0 = Xstart; cmd->Y0 = Ystart; cmd->U.Ptr = pString; cmd->Font = Font;
+            cmd->Fg = Color_Foreground; cmd->Bg = Color_Background;
+        }
+        return;
+    }
+
     if (Xstart > Paint.Width || Ystart > Paint.Height) {
         EPD_Printf("Paint_DrawString_EN Input exceeds the normal display range\r\n");
         return;
@@ -613,80 +1269,32 @@ void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT
 {
     const char* p_text = pString;
     int x = Xstart, y = Ystart;
-    int i, j,Num;
+    int Num;
+
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_STRING_CN, Xstart, Ystart,
+                                      Paint.Width - 1, (int)Ystart + font->Height - 1);
+        if (cmd) {
+            cmd->X0 = Xstart; cmd->Y0 = Ystart; cmd->U.Ptr = pString; cmd->Font = font;
+            cmd->Fg = Color_Foreground; cmd->Bg = Color_Background;
+        }
+        return;
+    }
 
     /* Send the string character by character on EPD */
     while (*p_text != 0) {
-        if(*p_text <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
+        if((UBYTE)*p_text <= 0x7F) {  //ASCII < 126
+            Paint_DrawCN(x, y, font, Paint_FindCN(font, p_text, 1), Color_Foreground, Color_Background);
             /* Point on the next character */
             p_text += 1;
             /* Decrement the column position by 16 */
             x += font->ASCII_Width;
-        } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if((*p_text== font->table[Num].index[0]) && (*(p_text+1) == font->table[Num].index[1])) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
+        } else {        //Chinese, three UTF-8 bytes
+            for (Num = 1; Num < 3 && p_text[Num] != 0; Num++)
+                ;
+            Paint_DrawCN(x, y, font, Paint_FindCN(font, p_text, Num), Color_Foreground, Color_Background);
             /* Point on the next character */
-            p_text += 3;
+            p_text += Num;
             /* Decrement the column position by 16 */
             x += font->Width;
         }
@@ -712,6 +1320,15 @@ void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
     uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
     uint8_t *pStr = Str_Array;
 
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_NUM, 0, Ypoint, Paint.Width - 1, Paint.Height - 1);
+        if (cmd) {
+            cmd->X0 = Xpoint; cmd->Y0 = Ypoint; cmd->U.Num = Nummber; cmd->Font = Font;
+            cmd->Fg = Color_Foreground; cmd->Bg = Color_Background;
+        }
+        return;
+    }
+
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         EPD_Printf("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
@@ -756,6 +1373,14 @@ void Paint_DrawNumDecimals(UWORD Xpoint, UWORD Ypoint, double Nummber,
 	int temp = Nummber;
 	float decimals;
 	uint8_t i;
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_NUM_DECIMALS, 0, Ypoint, Paint.Width - 1, Paint.Height - 1);
+        if (cmd) {
+            cmd->X0 = Xpoint; cmd->Y0 = Ypoint; cmd->U.Dec = Nummber; cmd->Font = Font;
+            cmd->A = Digit; cmd->Fg = Color_Foreground; cmd->Bg = Color_Background;
+        }
+        return;
+    }
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         EPD_Printf("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
@@ -813,6 +1438,16 @@ void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
 
     UWORD Dx = Font->Width;
 
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_TIME, Xstart, Ystart,
+                                      (int)Xstart + Dx * 7 - 1, (int)Ystart + Font->Height - 1);
+        if (cmd) {
+            cmd->X0 = Xstart; cmd->Y0 = Ystart; cmd->U.Ptr = pTime; cmd->Font = Font;
+            cmd->Fg = Color_Foreground; cmd->Bg = Color_Background;
+        }
+        return;
+    }
+
     //Write data into the cache
     Paint_DrawChar(Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
     Paint_DrawChar(Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
@@ -836,11 +1471,22 @@ void Paint_DrawBitMap(const unsigned char* image_buffer)
 {
     UWORD x, y;
     UDOUBLE Addr = 0;
+    const unsigned char *Src;
 
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_BITMAP, 0, 0, Paint.Width - 1, Paint.Height - 1);
+        if (cmd)
+            cmd->U.Ptr = image_buffer;
+        return;
+    }
+
+    // Start from the rows of the band being rendered
+    Src = image_buffer + (UDOUBLE)Paint.BandStart * Paint.WidthByte;
+    Paint_MarkAll();
     for (y = 0; y < Paint.HeightByte; y++) {
         for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
             Addr = x + y * Paint.WidthByte;
-            Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
+            Paint.Image[Addr] = (unsigned char)Src[Addr];
         }
     }
 }
@@ -862,6 +1508,16 @@ void Paint_DrawBitMap_Paste(const unsigned char* image_buffer, UWORD xStart, UWO
     UBYTE color, srcImage;
     UWORD x, y;
     UWORD width = (imageWidth%8==0 ? imageWidth/8 : imageWidth/8+1);
+
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_BITMAP_PASTE, xStart, yStart,
+                                      (int)xStart + imageWidth - 1, (int)yStart + imageHeight - 1);
+        if (cmd) {
+            cmd->X0 = xStart; cmd->Y0 = yStart; cmd->X1 = imageWidth; cmd->Y1 = imageHeight;
+            cmd->U.Ptr = image_buffer; cmd->A = flipColor;
+        }
+        return;
+    }
     
     for (y = 0; y < imageHeight; y++) {
         for (x = 0; x < imageWidth; x++) {
@@ -875,10 +1531,178 @@ void Paint_DrawBitMap_Paste(const unsigned char* image_buffer, UWORD xStart, UWO
     }
 }
 
+/******************************************************************************
+function:	Display a packed bitmap
+parameter:
+    image_buffer ：Codec byte and data from Misc/Python/epd_pack.py
+info:
+    Same as Paint_DrawBitMap(), decoded straight into the image. Rows above
+    the band being rendered are decoded into its first row and overwritten.
+******************************************************************************/
+void Paint_DrawBitMapPacked(const unsigned char* image_buffer)
+{
+    PAINT_UNPACK u;
+    UWORD y;
+
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_BITMAP_PACKED, 0, 0, Paint.Width - 1, Paint.Height - 1);
+        if (cmd)
+            cmd->U.Ptr = image_buffer;
+        return;
+    }
+
+    if (image_buffer[0] > PAINT_PACK_BYTES) {
+        EPD_Printf("Paint_DrawBitMapPacked: unknown codec %d\r\n", image_buffer[0]);
+        return;
+    }
+    Paint_MarkAll();
+    Paint_BeginUnpack(&u, image_buffer + 1, image_buffer[0]);
+    for (y = 0; y < Paint.BandStart + Paint.HeightByte; y++) {
+        Paint_Unpack(&u, Paint.Image + (UDOUBLE)(y < Paint.BandStart ? 0 : y - Paint.BandStart) * Paint.WidthByte,
+                     Paint.WidthByte);
+    }
+}
+
+/******************************************************************************
+function:	paste a packed monochrome bitmap to a frame buff
+parameter:
+    image_buffer ：Codec byte and data from Misc/Python/epd_pack.py
+    xStart: The starting x coordinate
+    yStart: The starting y coordinate
+    imageWidth: Original image width
+    imageHeight: Original image height
+    flipColor: Whether the color is reversed
+info:
+    Same as Paint_DrawBitMap_Paste(); each row is decoded 64 pixels at a
+    time and drawn as runs.
+******************************************************************************/
+void Paint_DrawBitMapPacked_Paste(const unsigned char* image_buffer, UWORD xStart, UWORD yStart, UWORD imageWidth, UWORD imageHeight, UBYTE flipColor)
+{
+    UBYTE Buf[8];
+    UWORD width = (imageWidth%8==0 ? imageWidth/8 : imageWidth/8+1);
+    UWORD x, y, n;
+    PAINT_UNPACK u;
+
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_BITMAP_PASTE_PACKED, xStart, yStart,
+                                      (int)xStart + imageWidth - 1, (int)yStart + imageHeight - 1);
+        if (cmd) {
+            cmd->X0 = xStart; cmd->Y0 = yStart; cmd->X1 = imageWidth; cmd->Y1 = imageHeight;
+            cmd->U.Ptr = image_buffer; cmd->A = flipColor;
+        }
+        return;
+    }
+
+    if (image_buffer[0] > PAINT_PACK_BYTES) {
+        EPD_Printf("Paint_DrawBitMapPacked_Paste: unknown codec %d\r\n", image_buffer[0]);
+        return;
+    }
+    Paint_BeginUnpack(&u, image_buffer + 1, image_buffer[0]);
+    for (y = 0; y < imageHeight; y++) {
+        for (x = 0; x < width; x += n) {
+            n = (width - x < sizeof(Buf)) ? width - x : sizeof(Buf);
+            Paint_Unpack(&u, Buf, n);
+            // Set bits are color 1, clear bits 0, swapped by flipColor
+            Paint_GlyphRow(xStart + x * 8, yStart + y, Buf,
+                           (imageWidth - x * 8 < n * 8) ? imageWidth - x * 8 : n * 8,
+                           flipColor ? 0 : 1, flipColor ? 1 : 0);
+        }
+    }
+}
+
+// Palettes for Paint_DrawDithered(), see GUI_Paint.h
+const UBYTE Paint_PaletteMono[2 * 3] = {
+    0x00, 0x00, 0x00,   0xFF, 0xFF, 0xFF,
+};
+const UBYTE Paint_PaletteGray4[4 * 3] = {
+    0xFF, 0xFF, 0xFF,   0xAA, 0xAA, 0xAA,   0x55, 0x55, 0x55,   0x00, 0x00, 0x00,
+};
+const UBYTE Paint_Palette4G[4 * 3] = {
+    0x00, 0x00, 0x00,   0xFF, 0xFF, 0xFF,   0xFF, 0xE0, 0x30,   0xC0, 0x10, 0x10,
+};
+const UBYTE Paint_Palette7F[7 * 3] = {
+    0x00, 0x00, 0x00,   0xFF, 0xFF, 0xFF,   0x40, 0x88, 0x30,   0x38, 0x40, 0xA0,
+    0xC0, 0x10, 0x10,   0xFF, 0xE0, 0x30,   0xE0, 0x78, 0x10,
+};
+
+/******************************************************************************
+function:	Draw an RGB or grey picture dithered to the panel colours
+parameter:
+    Xstart, Ystart : Top left corner of the picture
+    Width, Height  : Picture size
+    Dither         : Pixel source, palette and dither amplitude
+info:
+    Each pixel gets a 4x4 Bayer offset of +-Spread/2 on every channel and
+    takes the nearest palette colour, so no error rows are kept and any
+    band or rotation can be drawn on its own. A Spread of about the step
+    between neighbouring colours works best: 85 for four greys, 64 for
+    the colour panels. Pixel() is only called for pixels in the band.
+    The colour value is the palette index (BLACK/WHITE at scale 2).
+******************************************************************************/
+void Paint_DrawDithered(UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height, const PAINT_DITHER *Dither)
+{
+    static const UBYTE Bayer[16] = {
+        0, 8, 2, 10,   12, 4, 14, 6,   3, 11, 1, 9,   15, 7, 13, 5,
+    };
+    UWORD x, y, X, Y, Xend, Yend;
+    UBYTE i, Best;
+    int Off, R, G, B, d;
+    UDOUBLE Rgb, Dist, BestDist;
+    const UBYTE *p;
+
+    if (Paint_Recording) {
+        PAINT_CMD *cmd = Paint_Record(PAINT_OP_DITHERED, Xstart, Ystart,
+                                      (int)Xstart + Width - 1, (int)Ystart + Height - 1);
+        if (cmd) {
+            cmd->X0 = Xstart; cmd->Y0 = Ystart; cmd->X1 = Width; cmd->Y1 = Height;
+            cmd->U.Ptr = Dither;
+        }
+        return;
+    }
+
+    Xend = (Xstart + Width > Paint.Width) ? Paint.Width : Xstart + Width;
+    Yend = (Ystart + Height > Paint.Height) ? Paint.Height : Ystart + Height;
+    for (y = Ystart; y < Yend; y++) {
+        for (x = Xstart; x < Xend; x++) {
+            // Skip pixels outside the band before asking for their colour
+            if (!Paint_MapPoint(x, y, &X, &Y))
+                return;
+            if (Y < Paint.BandStart || Y - Paint.BandStart >= Paint.HeightByte)
+                continue;
+
+            Rgb = Dither->Pixel(x - Xstart, y - Ystart);
+            Off = ((int)Bayer[((y - Ystart) & 3) * 4 + ((x - Xstart) & 3)] * 2 - 15) * Dither->Spread / 32;
+            R = (int)((Rgb >> 16) & 0xFF) + Off;
+            G = (int)((Rgb >> 8) & 0xFF) + Off;
+            B = (int)(Rgb & 0xFF) + Off;
+
+            Best = 0;
+            BestDist = 0xFFFFFFFF;
+            for (i = 0, p = Dither->Palette; i < Dither->Colors; i++, p += 3) {
+                d = R - p[0];
+                Dist = (UDOUBLE)(d * d);
+                d = G - p[1];
+                Dist += (UDOUBLE)(d * d);
+                d = B - p[2];
+                Dist += (UDOUBLE)(d * d);
+                if (Dist < BestDist) {
+                    BestDist = Dist;
+                    Best = i;
+                }
+            }
+            if (Paint.Scale == 2)
+                Paint_SetPixel(x, y, Best ? WHITE : BLACK);
+            else
+                Paint_SetPixel(x, y, Best);
+        }
+    }
+}
+
 void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region)
 {
     UWORD x, y;
     UDOUBLE Addr = 0;
+		Paint_MarkAll();
 		for (y = 0; y < Paint.HeightByte; y++) {
 				for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
 						Addr = x + y * Paint.WidthByte ;
@@ -888,3 +1712,253 @@ void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region)
 		}
 }
 
+/******************************************************************************
+function:	Start recording draw calls into a display list
+parameter:
+    List : Caller-owned array of commands
+    Size : Number of entries in List
+info:
+    Call after Paint_NewImage() and Paint_SetRotate/Mirroring/Scale().
+    Until Paint_RenderBands(), the Paint_Clear/Draw functions only record
+    themselves; strings, bitmaps and times are kept by pointer and must stay
+    valid until the list has been rendered.
+******************************************************************************/
+void Paint_BeginList(PAINT_CMD *List, UWORD Size)
+{
+    Paint_List = List;
+    Paint_ListSize = Size;
+    Paint_ListLen = 0;
+    Paint_ListFull = 0;
+    Paint_Recording = 1;
+    Paint_Plane = PAINT_PLANE_BLACK;
+}
+
+/******************************************************************************
+function:	Choose the plane the following draw calls are recorded for
+parameter:
+    Plane : PAINT_PLANE_BLACK or PAINT_PLANE_RED
+info:
+    Draw in the red plane with RED (= BLACK) on WHITE, as with a separate
+    red image. Paint_BeginList() starts in the black plane.
+******************************************************************************/
+void Paint_SelectPlane(UBYTE Plane)
+{
+    Paint_Plane = Plane;
+}
+
+/******************************************************************************
+function:	Replay one display list entry into the current band
+******************************************************************************/
+static void Paint_Replay(const PAINT_CMD *cmd)
+{
+    switch(cmd->Op) {
+    case PAINT_OP_CLEAR:
+        Paint_Clear(cmd->Fg);
+        break;
+    case PAINT_OP_CLEAR_WINDOWS:
+        Paint_ClearWindows(cmd->X0, cmd->Y0, cmd->X1, cmd->Y1, cmd->Fg);
+        break;
+    case PAINT_OP_POINT:
+        Paint_DrawPoint(cmd->X0, cmd->Y0, cmd->Fg, (DOT_PIXEL)cmd->A, (DOT_STYLE)cmd->B);
+        break;
+    case PAINT_OP_LINE:
+        Paint_DrawLine(cmd->X0, cmd->Y0, cmd->X1, cmd->Y1, cmd->Fg, (DOT_PIXEL)cmd->A, (LINE_STYLE)cmd->B);
+        break;
+    case PAINT_OP_RECTANGLE:
+        Paint_DrawRectangle(cmd->X0, cmd->Y0, cmd->X1, cmd->Y1, cmd->Fg, (DOT_PIXEL)cmd->A, (DRAW_FILL)cmd->B);
+        break;
+    case PAINT_OP_CIRCLE:
+        Paint_DrawCircle(cmd->X0, cmd->Y0, cmd->X1, cmd->Fg, (DOT_PIXEL)cmd->A, (DRAW_FILL)cmd->B);
+        break;
+    case PAINT_OP_CHAR:
+        Paint_DrawChar(cmd->X0, cmd->Y0, cmd->U.Ch, (sFONT *)cmd->Font, cmd->Fg, cmd->Bg);
+        break;
+    case PAINT_OP_STRING_EN:
+        Paint_DrawString_EN(cmd->X0, cmd->Y0, (const char *)cmd->U.Ptr, (sFONT *)cmd->Font, cmd->Fg, cmd->Bg);
+        break;
+    case PAINT_OP_STRING_CN:
+        Paint_DrawString_CN(cmd->X0, cmd->Y0, (const char *)cmd->U.Ptr, (cFONT *)cmd->Font, cmd->Fg, cmd->Bg);
+        break;
+    case PAINT_OP_NUM:
+        Paint_DrawNum(cmd->X0, cmd->Y0, cmd->U.Num, (sFONT *)cmd->Font, cmd->Fg, cmd->Bg);
+        break;
+    case PAINT_OP_NUM_DECIMALS:
+        Paint_DrawNumDecimals(cmd->X0, cmd->Y0, cmd->U.Dec, (sFONT *)cmd->Font, cmd->A, cmd->Fg, cmd->Bg);
+        break;
+    case PAINT_OP_TIME:
+        Paint_DrawTime(cmd->X0, cmd->Y0, (PAINT_TIME *)cmd->U.Ptr, (sFONT *)cmd->Font, cmd->Fg, cmd->Bg);
+        break;
+    case PAINT_OP_BITMAP:
+        Paint_DrawBitMap((const unsigned char *)cmd->U.Ptr);
+        break;
+    case PAINT_OP_BITMAP_PASTE:
+        Paint_DrawBitMap_Paste((const unsigned char *)cmd->U.Ptr, cmd->X0, cmd->Y0, cmd->X1, cmd->Y1, cmd->A);
+        break;
+    case PAINT_OP_BITMAP_PACKED:
+        Paint_DrawBitMapPacked((const unsigned char *)cmd->U.Ptr);
+        break;
+    case PAINT_OP_BITMAP_PASTE_PACKED:
+        Paint_DrawBitMapPacked_Paste((const unsigned char *)cmd->U.Ptr, cmd->X0, cmd->Y0, cmd->X1, cmd->Y1, cmd->A);
+        break;
+    case PAINT_OP_DITHERED:
+        Paint_DrawDithered(cmd->X0, cmd->Y0, cmd->X1, cmd->Y1, (const PAINT_DITHER *)cmd->U.Ptr);
+        break;
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function:	Render the entries of one plane band by band
+parameter:
+    Rows       : Memory rows per band
+    Plane      : Plane to render, 0xFF for every entry
+    Flush      : Single-plane receiver, or NULL
+    PlaneFlush : Receiver told the plane, used when Flush is NULL
+******************************************************************************/
+static int Paint_RenderList(UWORD Rows, UBYTE Plane, PAINT_FLUSH Flush, PAINT_PLANE_FLUSH PlaneFlush)
+{
+    UWORD Ystart, i;
+    int Bands = 0;
+
+    for (Ystart = 0; Ystart < Paint.HeightMemory; Ystart += Rows) {
+        Paint.BandStart = Ystart;
+        Paint.HeightByte = (Paint.HeightMemory - Ystart < Rows) ? Paint.HeightMemory - Ystart : Rows;
+        Paint_Clear(Paint.Color);
+        for (i = 0; i < Paint_ListLen; i++) {
+            const PAINT_CMD *cmd = &Paint_List[i];
+            if (cmd->YMax < Ystart || cmd->YMin >= Ystart + Paint.HeightByte)
+                continue;
+            if (Plane != 0xFF && cmd->Plane != Plane)
+                continue;
+            Paint_Replay(cmd);
+        }
+        if (Flush)
+            Flush(Paint.Image, Ystart, Paint.HeightByte);
+        else
+            PlaneFlush(Paint.Image, Plane, Ystart, Paint.HeightByte);
+        Bands++;
+    }
+
+    // Leave direct drawing confined to the band-sized cache
+    Paint.BandStart = 0;
+    Paint.HeightByte = Rows < Paint.HeightMemory ? Rows : Paint.HeightMemory;
+    return Bands;
+}
+
+/******************************************************************************
+function:	Render the display list band by band
+parameter:
+    Rows  : Memory rows per band; the image cache holds Rows * WidthByte bytes
+    Flush : Called with each finished band, top to bottom
+return:
+    Number of bands sent, or -1 if there is no list or it overflowed
+info:
+    Each band is cleared to the Paint_NewImage() color, then only the
+    commands whose rows overlap it are replayed. The list is kept, so the
+    same frame can be rendered again until the next Paint_BeginList().
+    Planes are ignored: every entry is drawn into the one image.
+******************************************************************************/
+int Paint_RenderBands(UWORD Rows, PAINT_FLUSH Flush)
+{
+    Paint_Recording = 0;
+    if (Paint_List == NULL || Paint_ListFull || Rows == 0) {
+        EPD_Printf("Paint_RenderBands: no display list or list full\r\n");
+        return -1;
+    }
+    return Paint_RenderList(Rows, 0xFF, Flush, NULL);
+}
+
+/******************************************************************************
+function:	Render each plane of the display list band by band
+parameter:
+    Rows   : Memory rows per band; the image cache holds Rows * WidthByte bytes
+    Planes : Number of planes, 2 for black and red
+    Flush  : Called with each finished band: all of the black plane top to
+             bottom, then all of the red plane
+return:
+    Number of bands sent, or -1 if there is no list or it overflowed
+info:
+    The list is replayed once per plane, so the order suits panels that
+    take one whole plane per RAM write command (0x24/0x26, 0x10/0x13).
+******************************************************************************/
+int Paint_RenderPlanes(UWORD Rows, UBYTE Planes, PAINT_PLANE_FLUSH Flush)
+{
+    UBYTE Plane;
+    int Bands = 0;
+
+    Paint_Recording = 0;
+    if (Paint_List == NULL || Paint_ListFull || Rows == 0) {
+        EPD_Printf("Paint_RenderPlanes: no display list or list full\r\n");
+        return -1;
+    }
+    for (Plane = 0; Plane < Planes; Plane++)
+        Bands += Paint_RenderList(Rows, Plane, NULL, Flush);
+    return Bands;
+}
+
+/******************************************************************************
+function:	Get the memory box drawn since the last flush
+parameter:
+    Xstart, Ystart : First memory column and row
+    Xend, Yend     : Last memory column and row (inclusive)
+return:
+    0 if nothing was drawn
+info:
+    Memory coordinates are those of the image cache, i.e. of the panel RAM,
+    after rotation and mirroring.
+******************************************************************************/
+UBYTE Paint_GetDirty(UWORD *Xstart, UWORD *Ystart, UWORD *Xend, UWORD *Yend)
+{
+    if (Paint_DirtyX0 > Paint_DirtyX1)
+        return 0;
+    *Xstart = Paint_DirtyX0;
+    *Ystart = Paint_DirtyY0;
+    *Xend = Paint_DirtyX1;
+    *Yend = Paint_DirtyY1;
+    return 1;
+}
+
+/******************************************************************************
+function:	Forget what was drawn, e.g. after sending the image by other means
+******************************************************************************/
+void Paint_ClearDirty(void)
+{
+    Paint_DirtyX0 = 0xFFFF;
+    Paint_DirtyY0 = 0xFFFF;
+    Paint_DirtyX1 = 0;
+    Paint_DirtyY1 = 0;
+}
+
+/******************************************************************************
+function:	Refresh what was drawn since the last flush
+parameter:
+    Panel : Refresh functions of the panel and the full refresh interval
+return:
+    0 nothing to do, 1 partial refresh of the dirty window, 2 full refresh
+info:
+    The first flush after Paint_NewImage() is a full refresh, even of a
+    clean image, to load the panel with it. After that a whole-image change
+    or the FullEvery-th partial refresh in a row (to clear ghosting) is
+    sent in full, anything else as a window around the dirty box.
+******************************************************************************/
+int Paint_Flush(const PAINT_PANEL *Panel)
+{
+    UWORD X0 = 0, Y0 = 0, X1 = 0, Y1 = 0;
+    UBYTE Dirty = Paint_GetDirty(&X0, &Y0, &X1, &Y1);
+
+    if (!Dirty && Paint_Partials != PAINT_NEED_FULL)
+        return 0;
+    Paint_ClearDirty();
+
+    if (Paint_Partials == PAINT_NEED_FULL
+        || (Panel->FullEvery && Paint_Partials >= Panel->FullEvery)
+        || (X0 == 0 && Y0 == 0 && X1 == Paint.WidthMemory - 1 && Y1 == Paint.HeightMemory - 1)) {
+        Panel->Full(Paint.Image);
+        Paint_Partials = 0;
+        return 2;
+    }
+    Panel->Window(Paint.Image, X0, Y0, X1, Y1);
+    Paint_Partials++;
+    return 1;
+}
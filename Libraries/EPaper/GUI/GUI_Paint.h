@@ -8,10 +8,26 @@
 *   Achieve display characters: Display a single character, string, number
 *   Achieve time display: adaptive size display time minutes and seconds
 *----------------
-* |	This version:   V3.0
-* | Date        :   2019-04-18
+* |	This version:   V3.2
+* | Date        :   2026-10-18
 * | Info        :
 * -----------------------------------------------------------------------------
+* V3.2(2026-10-18):
+* 1.add: Paint_BeginList(), Paint_RenderBands()
+*    Record draw calls and render them band by band into a small buffer
+* 2.add: Paint_DrawBitMapPacked(), Paint_DrawBitMapPacked_Paste()
+*    Draw bitmaps packed by Misc/Python/epd_pack.py; packed fonts are drawn
+*    by the usual string functions
+* 3.add: Paint_GetDirty(), Paint_ClearDirty(), Paint_Flush()
+*    Refresh only the window drawn since the last flush, full every N times
+* 4.add: Paint_SelectPlane(), Paint_RenderPlanes()
+*    Record black and red drawing in one display list and render each
+*    plane band by band, for tri-colour panels without two full images
+* 5.add: Paint_DrawDithered()
+*    Ordered dithering of an RGB or grey picture into the panel palette,
+*    for the 4 and 7 colour panels and greys
+*
+* -----------------------------------------------------------------------------
 * V3.0(2019-04-18):
 * 1.Change: 
 *    Paint_DrawPoint(..., DOT_STYLE DOT_STYLE)
@@ -83,6 +99,7 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
+    UWORD BandStart;    // first memory row held in Image while banding
 } PAINT;
 extern PAINT Paint;
 
@@ -178,6 +195,71 @@ typedef struct {
 } PAINT_TIME;
 extern PAINT_TIME sPaint_time;
 
+/**
+ * Display list entry for banded rendering
+**/
+typedef struct {
+    UBYTE Op;
+    UBYTE A;            // Dot_Pixel / Line_width / Digit / flipColor
+    UBYTE B;            // Dot_Style / Line_Style / Draw_Fill
+    UBYTE Plane;        // PAINT_PLANE_BLACK / PAINT_PLANE_RED
+    UWORD X0, Y0, X1, Y1;
+    UWORD Fg, Bg;
+    UWORD YMin, YMax;   // memory rows touched, to skip bands
+    const void *Font;
+    union {
+        const void *Ptr; // string, bitmap or time: must outlive the render
+        int32_t Num;
+        double Dec;
+        char Ch;
+    } U;
+} PAINT_CMD;
+
+/**
+ * Receives each rendered band: Rows memory rows starting at row Ystart
+**/
+typedef void (*PAINT_FLUSH)(const UBYTE *Band, UWORD Ystart, UWORD Rows);
+
+/**
+ * Bit-planes of tri-colour panels; the red plane also carries yellow
+**/
+#define PAINT_PLANE_BLACK   0
+#define PAINT_PLANE_RED     1
+
+/**
+ * Receives each rendered band of one plane, all bands of a plane in turn
+**/
+typedef void (*PAINT_PLANE_FLUSH)(const UBYTE *Band, UBYTE Plane, UWORD Ystart, UWORD Rows);
+
+/**
+ * Panel refresh for Paint_Flush(), memory coordinates, inclusive
+**/
+typedef struct {
+    void (*Full)(UBYTE *Image);     // send the whole image, full refresh
+    void (*Window)(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+    UWORD FullEvery;                // partial refreshes between full ones, 0: only when needed
+} PAINT_PANEL;
+
+/**
+ * Picture for Paint_DrawDithered(): Pixel() returns 0xRRGGBB of picture
+ * pixel (X, Y), grey as level * 0x010101
+**/
+typedef UDOUBLE (*PAINT_PIXEL)(UWORD X, UWORD Y);
+typedef struct {
+    PAINT_PIXEL Pixel;
+    const UBYTE *Palette;   // R, G, B of each panel colour, by colour value
+    UBYTE Colors;           // palette entries
+    UBYTE Spread;           // dither amplitude per channel, 0: nearest colour
+} PAINT_DITHER;
+
+/**
+ * Palettes for PAINT_DITHER, as the panels look rather than pure RGB
+**/
+extern const UBYTE Paint_PaletteMono[2 * 3];    // scale 2: BLACK, WHITE
+extern const UBYTE Paint_PaletteGray4[4 * 3];   // scale 4: GRAY4 (white) .. GRAY1
+extern const UBYTE Paint_Palette4G[4 * 3];      // scale 4: EPD_3IN0G colours
+extern const UBYTE Paint_Palette7F[7 * 3];      // scale 7: EPD_5IN65F, EPD_7IN3F colours
+
 //init and Clear
 void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
 void Paint_SelectImage(UBYTE *image);
@@ -210,6 +292,20 @@ void Paint_DrawBitMap_Paste(const unsigned char* image_buffer, UWORD Xstart, UWO
 //void Paint_DrawBitMap_OneQuarter(const unsigned char* image_buffer, UBYTE Region);
 //void Paint_DrawBitMap_OneEighth(const unsigned char* image_buffer, UBYTE Region);
 void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region);
+void Paint_DrawBitMapPacked(const unsigned char* image_buffer);
+void Paint_DrawBitMapPacked_Paste(const unsigned char* image_buffer, UWORD Xstart, UWORD Ystart, UWORD imageWidth, UWORD imageHeight, UBYTE flipColor);
+void Paint_DrawDithered(UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height, const PAINT_DITHER *Dither);
+
+//banded rendering
+void Paint_BeginList(PAINT_CMD *List, UWORD Size);
+int Paint_RenderBands(UWORD Rows, PAINT_FLUSH Flush);
+void Paint_SelectPlane(UBYTE Plane);
+int Paint_RenderPlanes(UWORD Rows, UBYTE Planes, PAINT_PLANE_FLUSH Flush);
+
+//dirty window refresh
+UBYTE Paint_GetDirty(UWORD *Xstart, UWORD *Ystart, UWORD *Xend, UWORD *Yend);
+void Paint_ClearDirty(void);
+int Paint_Flush(const PAINT_PANEL *Panel);
 #endif
 
 
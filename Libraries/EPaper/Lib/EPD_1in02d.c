@@ -97,46 +97,16 @@ static void EPD_1IN02_Reset(void)
 	
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     command : Command register
-******************************************************************************/
-static void EPD_1IN02_SendCommand(UBYTE command)
-{
-	EPD_Digital_Write(EPD_CS_PIN, 0);
-	EPD_Digital_Write(EPD_DC_PIN, 0);// command write
-
-	EPD_SPI_WriteByte(command);
-	EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_1IN02_SendData(UBYTE Data)
-{
-	EPD_Digital_Write(EPD_CS_PIN, 0);
-	EPD_Digital_Write(EPD_DC_PIN, 1);	// command write
-	EPD_SPI_WriteByte(Data);
-	EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	LUT download
 ******************************************************************************/
 void EPD_1IN02_SetFulltReg(void)
 {
-	unsigned int count;
-	EPD_1IN02_SendCommand(0x23);
-	for(count=0;count<42;count++)	     
-	{EPD_1IN02_SendData(lut_w1[count]);}    
+	EPD_SendCommand(0x23);
+	EPD_SendDataArray(lut_w1, 42);    
 	
-	EPD_1IN02_SendCommand(0x24);
-	for(count=0;count<42;count++)	     
-	{EPD_1IN02_SendData(lut_b1[count]);}          
+	EPD_SendCommand(0x24);
+	EPD_SendDataArray(lut_b1, 42);          
 }
 
 /******************************************************************************
@@ -144,16 +114,11 @@ function :	LUT download
 ******************************************************************************/
 void EPD_1IN02_SetPartReg(void)
 {
-	unsigned int count;
-	EPD_1IN02_SendCommand(0x23);
-	for(count=0;count<42;count++){
-		EPD_1IN02_SendData(lut_w[count]);
-	}
+	EPD_SendCommand(0x23);
+	EPD_SendDataArray(lut_w, 42);
 	
-	EPD_1IN02_SendCommand(0x24);
-	for(count=0;count<42;count++){
-		EPD_1IN02_SendData(lut_b[count]);
-	}          
+	EPD_SendCommand(0x24);
+	EPD_SendDataArray(lut_b, 42);          
 }
 
 /******************************************************************************
@@ -164,7 +129,7 @@ void EPD_1IN02_WaitUntilIdle(void)
 	unsigned char busy;
 	do
 	{
-		EPD_1IN02_SendCommand(0x71);
+		EPD_SendCommand(0x71);
 		busy = EPD_Digital_Read(EPD_BUSY_PIN);
 		busy =!(busy & 0x01);        
 	}
@@ -178,12 +143,12 @@ function :	Turn On Display
 ******************************************************************************/
 void EPD_1IN02_TurnOnDisplay(void)
 {
-    // EPD_1IN02_SendCommand(0x04);  //power on
+    // EPD_SendCommand(0x04);  //power on
     // EPD_1IN02_WaitUntilIdle();
-    EPD_1IN02_SendCommand(0x12);  //Start refreshing the screen
+    EPD_SendCommand(0x12);  //Start refreshing the screen
     EPD_Delay_ms(10);
     EPD_1IN02_WaitUntilIdle();
-    // EPD_1IN02_SendCommand(0x02);
+    // EPD_SendCommand(0x02);
     // EPD_1IN02_WaitUntilIdle();    //power off
 }
 
@@ -194,45 +159,45 @@ UBYTE EPD_1IN02_Init(void)
 {
 	EPD_1IN02_Reset(); 
 	
-	EPD_1IN02_SendCommand(0xD2);			
-	EPD_1IN02_SendData(0x3F);
+	EPD_SendCommand(0xD2);			
+	EPD_SendData(0x3F);
 						 
-	EPD_1IN02_SendCommand(0x00);  			
-	EPD_1IN02_SendData (0x6F);  //from outside
-
-	EPD_1IN02_SendCommand(0x01);  //power setting
-	EPD_1IN02_SendData (0x03);	    
-	EPD_1IN02_SendData (0x00);
-	EPD_1IN02_SendData (0x2b);		
-	EPD_1IN02_SendData (0x2b); 
+	EPD_SendCommand(0x00);  			
+	EPD_SendData (0x6F);  //from outside
+
+	EPD_SendCommand(0x01);  //power setting
+	EPD_SendData (0x03);	    
+	EPD_SendData (0x00);
+	EPD_SendData (0x2b);		
+	EPD_SendData (0x2b); 
 	
-	EPD_1IN02_SendCommand(0x06);  //Configuring the charge pump
-	EPD_1IN02_SendData(0x3f);
+	EPD_SendCommand(0x06);  //Configuring the charge pump
+	EPD_SendData(0x3f);
 	
-	EPD_1IN02_SendCommand(0x2A);  //Setting XON and the options of LUT
-	EPD_1IN02_SendData(0x00); 
-	EPD_1IN02_SendData(0x00); 
+	EPD_SendCommand(0x2A);  //Setting XON and the options of LUT
+	EPD_SendData(0x00); 
+	EPD_SendData(0x00); 
 	
-	EPD_1IN02_SendCommand(0x30);  //Set the clock frequency
-	EPD_1IN02_SendData(0x17); //50Hz
+	EPD_SendCommand(0x30);  //Set the clock frequency
+	EPD_SendData(0x17); //50Hz
 
-	EPD_1IN02_SendCommand(0x50);  //Set VCOM and data output interval
-	EPD_1IN02_SendData(0x57);			
+	EPD_SendCommand(0x50);  //Set VCOM and data output interval
+	EPD_SendData(0x57);			
 
-	EPD_1IN02_SendCommand(0x60);  //Set The non-overlapping period of Gate and Source.
-	EPD_1IN02_SendData(0x22);
+	EPD_SendCommand(0x60);  //Set The non-overlapping period of Gate and Source.
+	EPD_SendData(0x22);
 
-    EPD_1IN02_SendCommand(0x61);  //resolution setting
-    EPD_1IN02_SendData (0x50);    //source 128 	 
-    EPD_1IN02_SendData (0x80);       
+    EPD_SendCommand(0x61);  //resolution setting
+    EPD_SendData (0x50);    //source 128 	 
+    EPD_SendData (0x80);       
 
-	EPD_1IN02_SendCommand(0x82);  //sets VCOM_DC value
-	EPD_1IN02_SendData(0x12);  //-1v
+	EPD_SendCommand(0x82);  //sets VCOM_DC value
+	EPD_SendData(0x12);  //-1v
 
-	EPD_1IN02_SendCommand(0xe3);//Set POWER SAVING
-	EPD_1IN02_SendData(0x33);
+	EPD_SendCommand(0xe3);//Set POWER SAVING
+	EPD_SendData(0x33);
 	EPD_1IN02_SetFulltReg();	
-    EPD_1IN02_SendCommand(0x04);     		//power on
+    EPD_SendCommand(0x04);     		//power on
     EPD_1IN02_WaitUntilIdle();
 	return 0;
 }
@@ -243,43 +208,43 @@ function :Partial refresh initialization e-paper
 void EPD_1IN02_Part_Init(void)
 {
 	EPD_1IN02_Reset();
-	EPD_1IN02_SendCommand(0xD2);			
-	EPD_1IN02_SendData(0x3F);
+	EPD_SendCommand(0xD2);			
+	EPD_SendData(0x3F);
 						 
-	EPD_1IN02_SendCommand(0x00);  			
-	EPD_1IN02_SendData (0x6F);  //from outside
+	EPD_SendCommand(0x00);  			
+	EPD_SendData (0x6F);  //from outside
     
-	EPD_1IN02_SendCommand(0x01);  //power setting
-	EPD_1IN02_SendData (0x03);
-	EPD_1IN02_SendData (0x00);
-	EPD_1IN02_SendData (0x2b);		
-	EPD_1IN02_SendData (0x2b);
+	EPD_SendCommand(0x01);  //power setting
+	EPD_SendData (0x03);
+	EPD_SendData (0x00);
+	EPD_SendData (0x2b);		
+	EPD_SendData (0x2b);
 	
-	EPD_1IN02_SendCommand(0x06);  //Configuring the charge pump
-	EPD_1IN02_SendData(0x3f);
+	EPD_SendCommand(0x06);  //Configuring the charge pump
+	EPD_SendData(0x3f);
 	
-	EPD_1IN02_SendCommand(0x2A);  //Setting XON and the options of LUT
-	EPD_1IN02_SendData(0x00);
-	EPD_1IN02_SendData(0x00);
+	EPD_SendCommand(0x2A);  //Setting XON and the options of LUT
+	EPD_SendData(0x00);
+	EPD_SendData(0x00);
 	
-	EPD_1IN02_SendCommand(0x30);  //Set the clock frequency
-	EPD_1IN02_SendData(0x17);
+	EPD_SendCommand(0x30);  //Set the clock frequency
+	EPD_SendData(0x17);
 				
-	EPD_1IN02_SendCommand(0x50);  //Set VCOM and data output interval
-	EPD_1IN02_SendData(0xf2);
+	EPD_SendCommand(0x50);  //Set VCOM and data output interval
+	EPD_SendData(0xf2);
 
-	EPD_1IN02_SendCommand(0x60);  //Set The non-overlapping period of Gate and Source.
-	EPD_1IN02_SendData(0x22);
+	EPD_SendCommand(0x60);  //Set The non-overlapping period of Gate and Source.
+	EPD_SendData(0x22);
 
-	EPD_1IN02_SendCommand(0x82);  //Set VCOM_DC value
-    EPD_1IN02_SendData(0x12);//-1v
+	EPD_SendCommand(0x82);  //Set VCOM_DC value
+    EPD_SendData(0x12);//-1v
 
-	EPD_1IN02_SendCommand(0xe3);//Set POWER SAVING
-	EPD_1IN02_SendData(0x33);
+	EPD_SendCommand(0xe3);//Set POWER SAVING
+	EPD_SendData(0x33);
 
 	EPD_1IN02_SetPartReg();	
     
-    EPD_1IN02_SendCommand(0x04);//Set POWER SAVING	
+    EPD_SendCommand(0x04);//Set POWER SAVING	
     
     EPD_1IN02_WaitUntilIdle();
 }
@@ -289,15 +254,10 @@ function :	Clear screen
 ******************************************************************************/
 void EPD_1IN02_Clear(void)
 { 
-	unsigned int i;
-	EPD_1IN02_SendCommand(0x10);
-	for(i=0;i<1280;i++){
-		EPD_1IN02_SendData(0X00);
-	}
-	EPD_1IN02_SendCommand(0x13);	       //Transfer new data
-	for(i=0;i<1280;i++){
-		EPD_1IN02_SendData(0xff);
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst(0X00, 1280);
+	EPD_SendCommand(0x13);	       //Transfer new data
+	EPD_SendDataBurst(0xff, 1280);
 	EPD_1IN02_TurnOnDisplay();
 }
 
@@ -313,19 +273,11 @@ void EPD_1IN02_Display(UBYTE *Image)
 	UWORD Width;
 	Width = (EPD_1IN02_WIDTH % 8 == 0)? (EPD_1IN02_WIDTH / 8 ): (EPD_1IN02_WIDTH / 8 + 1);
 	//EPD_1IN02_Init();
-	EPD_1IN02_SendCommand(0x10);
-	for (UWORD j = 0; j < EPD_1IN02_HEIGHT; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN02_SendData(0xff);
-        }
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst(0xff, (UDOUBLE)Width * EPD_1IN02_HEIGHT);
 
-	EPD_1IN02_SendCommand(0x13);
-	for (UWORD j = 0; j < EPD_1IN02_HEIGHT; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN02_SendData(Image[i + j * Width]);
-        }
-	}
+	EPD_SendCommand(0x13);
+	EPD_SendDataArray(Image, (UDOUBLE)Width * EPD_1IN02_HEIGHT);
 	EPD_1IN02_TurnOnDisplay();
 }
 
@@ -340,32 +292,24 @@ parameter:
 void EPD_1IN02_DisplayPartial(UBYTE *old_Image, UBYTE *Image)
 {
     /* Set partial Windows */
-    EPD_1IN02_SendCommand(0x91);		//This command makes the display enter partial mode
-    EPD_1IN02_SendCommand(0x90);		//resolution setting
-    EPD_1IN02_SendData(0);           //x-start
-    EPD_1IN02_SendData(79);       //x-end
+    EPD_SendCommand(0x91);		//This command makes the display enter partial mode
+    EPD_SendCommand(0x90);		//resolution setting
+    EPD_SendData(0);           //x-start
+    EPD_SendData(79);       //x-end
 
-    EPD_1IN02_SendData(0);
-    EPD_1IN02_SendData(127);  //y-end
-    EPD_1IN02_SendData(0x00);
+    EPD_SendData(0);
+    EPD_SendData(127);  //y-end
+    EPD_SendData(0x00);
 
     UWORD Width;
     Width = (EPD_1IN02_WIDTH % 8 == 0)? (EPD_1IN02_WIDTH / 8 ): (EPD_1IN02_WIDTH / 8 + 1);
 
     /* send data */
-    EPD_1IN02_SendCommand(0x10);
-    for (UWORD j = 0; j < EPD_1IN02_HEIGHT; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN02_SendData(old_Image[i + j * Width]);
-        }
-    }
-
-    EPD_1IN02_SendCommand(0x13);
-    for (UWORD j = 0; j < EPD_1IN02_HEIGHT; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN02_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(old_Image, (UDOUBLE)Width * EPD_1IN02_HEIGHT);
+
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * EPD_1IN02_HEIGHT);
 
     /* Set partial refresh */
     EPD_1IN02_TurnOnDisplay();
@@ -376,12 +320,12 @@ function :	Enter sleep mode
 ******************************************************************************/
 void EPD_1IN02_Sleep(void)
 {
-    EPD_1IN02_SendCommand(0X50);
-    EPD_1IN02_SendData(0xf7);
-    EPD_1IN02_SendCommand(0X02);  	//power off
+    EPD_SendCommand(0X50);
+    EPD_SendData(0xf7);
+    EPD_SendCommand(0X02);  	//power off
     EPD_1IN02_WaitUntilIdle();
-    EPD_1IN02_SendCommand(0X07);  	//deep sleep
-    EPD_1IN02_SendData(0xA5);
+    EPD_SendCommand(0X07);  	//deep sleep
+    EPD_SendData(0xA5);
     
     EPD_Delay_ms(200);
     printf("Turn off the power!!! \r\n");
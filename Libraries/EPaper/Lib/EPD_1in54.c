@@ -116,50 +116,6 @@ static void EPD_1IN54_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_1IN54_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Delay_ms(1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_1IN54_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_SPI_WriteByte(Data);
-    __NOP();
-}
-
-static void EPD_1IN54_SendDataArray(const UBYTE *Data, UWORD len)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    while (len--)
-    {
-        EPD_SPI_WriteByte(*Data++);
-        __NOP();
-    }
-}
-
-static void EPD_1IN54_SendDataBurst(const UBYTE Data, UWORD len)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    while (len--)
-    {
-        EPD_SPI_WriteByte(Data);
-        __NOP();
-    }
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -180,15 +136,15 @@ parameter:
 ******************************************************************************/
 static void EPD_1IN54_SetWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    EPD_1IN54_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_1IN54_SendData((Xstart >> 3) & 0xFF);
-    EPD_1IN54_SendData((Xend >> 3) & 0xFF);
+    EPD_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
+    EPD_SendData((Xstart >> 3) & 0xFF);
+    EPD_SendData((Xend >> 3) & 0xFF);
 
-    EPD_1IN54_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
-    EPD_1IN54_SendData(Ystart & 0xFF);
-    EPD_1IN54_SendData((Ystart >> 8) & 0xFF);
-    EPD_1IN54_SendData(Yend & 0xFF);
-    EPD_1IN54_SendData((Yend >> 8) & 0xFF);
+    EPD_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendData(Yend & 0xFF);
+    EPD_SendData((Yend >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -197,12 +153,12 @@ parameter:
 ******************************************************************************/
 static void EPD_1IN54_SetCursor(UWORD Xstart, UWORD Ystart)
 {
-    EPD_1IN54_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_1IN54_SendData((Xstart >> 3) & 0xFF);
+    EPD_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
+    EPD_SendData((Xstart >> 3) & 0xFF);
 
-    EPD_1IN54_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
-    EPD_1IN54_SendData(Ystart & 0xFF);
-    EPD_1IN54_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -211,10 +167,10 @@ parameter:
 ******************************************************************************/
 static void EPD_1IN54_TurnOnDisplay(void)
 {
-    EPD_1IN54_SendCommand(0x22); // DISPLAY_UPDATE_CONTROL_2
-    EPD_1IN54_SendData(0xC4);
-    EPD_1IN54_SendCommand(0x20); // MASTER_ACTIVATION
-    EPD_1IN54_SendCommand(0xFF); // TERMINATE_FRAME_READ_WRITE
+    EPD_SendCommand(0x22); // DISPLAY_UPDATE_CONTROL_2
+    EPD_SendData(0xC4);
+    EPD_SendCommand(0x20); // MASTER_ACTIVATION
+    EPD_SendCommand(0xFF); // TERMINATE_FRAME_READ_WRITE
 
     EPD_1IN54_ReadBusy();
 }
@@ -227,39 +183,37 @@ void EPD_1IN54_Init(UBYTE Mode)
 {
     EPD_1IN54_Reset();
 
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_1IN54_SendCommand(0x01); // DRIVER_OUTPUT_CONTROL
-    EPD_1IN54_SendData((EPD_1IN54_HEIGHT - 1) & 0xFF);
-    EPD_1IN54_SendData(((EPD_1IN54_HEIGHT - 1) >> 8) & 0xFF);
-    EPD_1IN54_SendData(0x00); // GD = 0; SM = 0; TB = 0;
+    EPD_SendCommand(0x01); // DRIVER_OUTPUT_CONTROL
+    EPD_SendData((EPD_1IN54_HEIGHT - 1) & 0xFF);
+    EPD_SendData(((EPD_1IN54_HEIGHT - 1) >> 8) & 0xFF);
+    EPD_SendData(0x00); // GD = 0; SM = 0; TB = 0;
 
-    EPD_1IN54_SendCommand(0x0C); // BOOSTER_SOFT_START_CONTROL
-    EPD_1IN54_SendData(0xD7);
-    EPD_1IN54_SendData(0xD6);
-    EPD_1IN54_SendData(0x9D);
+    EPD_SendCommand(0x0C); // BOOSTER_SOFT_START_CONTROL
+    EPD_SendData(0xD7);
+    EPD_SendData(0xD6);
+    EPD_SendData(0x9D);
 
-    EPD_1IN54_SendCommand(0x2C); // WRITE_VCOM_REGISTER
-    EPD_1IN54_SendData(0xA8); // VCOM 7C
+    EPD_SendCommand(0x2C); // WRITE_VCOM_REGISTER
+    EPD_SendData(0xA8); // VCOM 7C
 
-    EPD_1IN54_SendCommand(0x3A); // SET_DUMMY_LINE_PERIOD
-    EPD_1IN54_SendData(0x1A); // 4 dummy lines per gate
+    EPD_SendCommand(0x3A); // SET_DUMMY_LINE_PERIOD
+    EPD_SendData(0x1A); // 4 dummy lines per gate
 
-    EPD_1IN54_SendCommand(0x3B); // SET_GATE_TIME
-    EPD_1IN54_SendData(0x08); // 2us per line
+    EPD_SendCommand(0x3B); // SET_GATE_TIME
+    EPD_SendData(0x08); // 2us per line
 
-    EPD_1IN54_SendCommand(0x11);
-    EPD_1IN54_SendData(0x03);
+    EPD_SendCommand(0x11);
+    EPD_SendData(0x03);
 
     //set the look-up table register
-    EPD_1IN54_SendCommand(0x32);
+    EPD_SendCommand(0x32);
     if(Mode == EPD_1IN54_FULL){
-        EPD_1IN54_SendDataArray(EPD_1IN54_lut_full_update, 30);
+        EPD_SendDataArray(EPD_1IN54_lut_full_update, 30);
     }else if(Mode == EPD_1IN54_PART){
-        EPD_1IN54_SendDataArray(EPD_1IN54_lut_partial_update, 30);
+        EPD_SendDataArray(EPD_1IN54_lut_partial_update, 30);
     }else{
         EPD_Printf("error, the Mode is EPD_1IN54_FULL or EPD_1IN54_PART");
     }
-    EPD_Digital_Write(EPD_CS_PIN, 1);
 }
 
 /******************************************************************************
@@ -271,15 +225,13 @@ void EPD_1IN54_Clear(void)
     UWORD Width, Height;
     Width = (EPD_1IN54_WIDTH % 8 == 0)? (EPD_1IN54_WIDTH / 8 ): (EPD_1IN54_WIDTH / 8 + 1);
     Height = EPD_1IN54_HEIGHT;
-    EPD_Digital_Write(EPD_CS_PIN, 0);
     EPD_1IN54_SetWindow(0, 0, EPD_1IN54_WIDTH, EPD_1IN54_HEIGHT);
     for (UWORD j = 0; j < Height; j++) {
         EPD_1IN54_SetCursor(0, j);
-        EPD_1IN54_SendCommand(0x24);
-        EPD_1IN54_SendDataBurst(0xFF, Width);
+        EPD_SendCommand(0x24);
+        EPD_SendDataBurst(0xFF, Width);
     }
     EPD_1IN54_TurnOnDisplay();
-    EPD_Digital_Write(EPD_CS_PIN, 1);
 }
 
 /******************************************************************************
@@ -292,20 +244,18 @@ void EPD_1IN54_Display(UBYTE *Image)
     Width = (EPD_1IN54_WIDTH % 8 == 0)? (EPD_1IN54_WIDTH / 8 ): (EPD_1IN54_WIDTH / 8 + 1);
     Height = EPD_1IN54_HEIGHT;
 
-    EPD_Digital_Write(EPD_CS_PIN, 0);
     // UDOUBLE Offset = ImageName;
     EPD_1IN54_SetWindow(0, 0, EPD_1IN54_WIDTH, EPD_1IN54_HEIGHT);
     for (UWORD j = 0; j < Height; j++) {
         EPD_1IN54_SetCursor(0, j);
-        EPD_1IN54_SendCommand(0x24);
-        EPD_1IN54_SendDataArray(Image + (j * Width), Width);
+        EPD_SendCommand(0x24);
+        EPD_SendDataArray(Image + (j * Width), Width);
         // for (UWORD i = 0; i < Width; i++) {
         //     Addr = i + j * Width;
-        //     EPD_1IN54_SendData(Image[Addr]);
+        //     EPD_SendData(Image[Addr]);
         // }
     }
     EPD_1IN54_TurnOnDisplay();
-    EPD_Digital_Write(EPD_CS_PIN, 1);
 }
 
 /******************************************************************************
@@ -314,10 +264,8 @@ parameter:
 ******************************************************************************/
 void EPD_1IN54_Sleep(void)
 {
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_1IN54_SendCommand(0x10);
-    EPD_1IN54_SendData(0x01);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
+    EPD_SendCommand(0x10);
+    EPD_SendData(0x01);
 }
 
 #endif
@@ -7,6 +7,9 @@
 * |	This version:   V1.0
 * | Date        :   2019-06-11
 * | Info        :
+* 1.add(2026-10-18):
+*   EPD_1IN54_V2_DisplayAsync(), EPD_1IN54_V2_RefreshWindowAsync(); the
+*   blocking calls wait through EPD_BusyWait()
 #
 # Permission is hereby granted, free of charge, to any person obtaining a copy
 # of this software and associated documnetation files (the "Software"), to deal
@@ -32,7 +35,7 @@
 #ifdef EPD_1IN54_V2
 
 // waveform full refresh
-unsigned char WF_Full_1IN54[159] =
+static const UBYTE WF_Full_1IN54[159] =
 {											
 0x80,	0x48,	0x40,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,
 0x40,	0x48,	0x80,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,
@@ -56,7 +59,7 @@ unsigned char WF_Full_1IN54[159] =
 };
 
 // waveform partial refresh(fast)
-unsigned char WF_PARTIAL_1IN54_0[159] =
+static const UBYTE WF_PARTIAL_1IN54_0[159] =
 {
 0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
 0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
@@ -79,6 +82,44 @@ unsigned char WF_PARTIAL_1IN54_0[159] =
 0x02,0x17,0x41,0xB0,0x32,0x28,
 };
 
+static const UBYTE EPD_1IN54_V2_InitScript[] = {
+    EPD_OP_RESET, 200, 2,
+    EPD_OP_WAIT,
+    0, 0x12,                        // SWRESET
+    EPD_OP_WAIT,
+    3, 0x01, 0xC7, 0x00, 0x01,      // Driver output control
+    1, 0x11, 0x01,                  // data entry mode
+    2, 0x44, 0x00, 0x18,            // RAM X start/end: 0..199
+    4, 0x45, 0xC7, 0x00, 0x00, 0x00, // RAM Y start/end: 199..0
+    1, 0x3C, 0x01,                  // BorderWavefrom
+    1, 0x18, 0x80,
+    1, 0x22, 0xB1,                  // Load Temperature and waveform setting.
+    0, 0x20,
+    1, 0x4E, 0x00,                  // RAM X counter
+    2, 0x4F, 0xC7, 0x00,            // RAM Y counter
+    EPD_OP_WAIT,
+    EPD_OP_LUT,
+    EPD_OP_END
+};
+
+static const UBYTE EPD_1IN54_V2_RefreshScript[] = {
+    1, 0x22, 0xc7,
+    0, 0x20,
+    EPD_OP_END
+};
+
+static const UBYTE EPD_1IN54_V2_SleepScript[] = {
+    1, 0x10, 0x01,                  // enter deep sleep
+    EPD_OP_DELAY, 100,
+    EPD_OP_END
+};
+
+const EPD_PANEL EPD_1IN54_V2_Panel = {
+    EPD_1IN54_V2_WIDTH, EPD_1IN54_V2_HEIGHT,
+    1, 0, {0x24, 0}, WF_Full_1IN54,
+    EPD_1IN54_V2_InitScript, EPD_1IN54_V2_RefreshScript, EPD_1IN54_V2_SleepScript
+};
+
 /******************************************************************************
 function :	Software reset
 parameter:
@@ -93,55 +134,16 @@ static void EPD_1IN54_V2_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_1IN54_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_1IN54_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	Wait until the busy_pin goes LOW
-parameter:
-******************************************************************************/
-static void EPD_1IN54_V2_ReadBusy(void)
-{
-    EPD_Printf("e-Paper busy\r\n");
-    while(EPD_Digital_Read(EPD_BUSY_PIN) == 1) {      //LOW: idle, HIGH: busy
-        EPD_Delay_ms(10);
-    }
-    EPD_Printf("e-Paper busy release\r\n");
-}
-
 /******************************************************************************
 function :	Turn On Display full
 parameter:
 ******************************************************************************/
 static void EPD_1IN54_V2_TurnOnDisplay(void)
 {
-    EPD_1IN54_V2_SendCommand(0x22);
-    EPD_1IN54_V2_SendData(0xc7);
-    EPD_1IN54_V2_SendCommand(0x20);
-    EPD_1IN54_V2_ReadBusy();
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xc7);
+    EPD_SendCommand(0x20);
+    EPD_Panel_Wait(&EPD_1IN54_V2_Panel);
 }
 
 /******************************************************************************
@@ -150,60 +152,33 @@ parameter:
 ******************************************************************************/
 static void EPD_1IN54_V2_TurnOnDisplayPart(void)
 {
-    EPD_1IN54_V2_SendCommand(0x22);
-    EPD_1IN54_V2_SendData(0xcF);
-    EPD_1IN54_V2_SendCommand(0x20);
-    EPD_1IN54_V2_ReadBusy();
-}
-
-static void EPD_1IN54_V2_Lut(UBYTE *lut)
-{
-	EPD_1IN54_V2_SendCommand(0x32);
-	for(UBYTE i=0; i<153; i++)
-		EPD_1IN54_V2_SendData(lut[i]);
-	EPD_1IN54_V2_ReadBusy();
-}
-
-static void EPD_1IN54_V2_SetLut(UBYTE *lut)
-{
-	EPD_1IN54_V2_Lut(lut);
-	
-    EPD_1IN54_V2_SendCommand(0x3f);
-    EPD_1IN54_V2_SendData(lut[153]);
-	
-    EPD_1IN54_V2_SendCommand(0x03);
-    EPD_1IN54_V2_SendData(lut[154]);
-	
-    EPD_1IN54_V2_SendCommand(0x04);
-    EPD_1IN54_V2_SendData(lut[155]);
-	EPD_1IN54_V2_SendData(lut[156]);
-	EPD_1IN54_V2_SendData(lut[157]);
-	
-	EPD_1IN54_V2_SendCommand(0x2c);
-    EPD_1IN54_V2_SendData(lut[158]);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xcF);
+    EPD_SendCommand(0x20);
+    EPD_Panel_Wait(&EPD_1IN54_V2_Panel);
 }
 
 static void EPD_1IN54_V2_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    EPD_1IN54_V2_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_1IN54_V2_SendData((Xstart>>3) & 0xFF);
-    EPD_1IN54_V2_SendData((Xend>>3) & 0xFF);
+    EPD_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
+    EPD_SendData((Xstart>>3) & 0xFF);
+    EPD_SendData((Xend>>3) & 0xFF);
 	
-    EPD_1IN54_V2_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
-    EPD_1IN54_V2_SendData(Ystart & 0xFF);
-    EPD_1IN54_V2_SendData((Ystart >> 8) & 0xFF);
-    EPD_1IN54_V2_SendData(Yend & 0xFF);
-    EPD_1IN54_V2_SendData((Yend >> 8) & 0xFF);
+    EPD_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendData(Yend & 0xFF);
+    EPD_SendData((Yend >> 8) & 0xFF);
 }
 
 static void EPD_1IN54_V2_SetCursor(UWORD Xstart, UWORD Ystart)
 {
-    EPD_1IN54_V2_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_1IN54_V2_SendData(Xstart & 0xFF);
+    EPD_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
+    EPD_SendData(Xstart & 0xFF);
 
-    EPD_1IN54_V2_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
-    EPD_1IN54_V2_SendData(Ystart & 0xFF);
-    EPD_1IN54_V2_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -212,36 +187,7 @@ parameter:
 ******************************************************************************/
 void EPD_1IN54_V2_Init(void)
 {
-    EPD_1IN54_V2_Reset();
-
-    EPD_1IN54_V2_ReadBusy();
-    EPD_1IN54_V2_SendCommand(0x12);  //SWRESET
-    EPD_1IN54_V2_ReadBusy();
-
-    EPD_1IN54_V2_SendCommand(0x01); //Driver output control
-    EPD_1IN54_V2_SendData(0xC7);
-    EPD_1IN54_V2_SendData(0x00);
-    EPD_1IN54_V2_SendData(0x01);
-
-    EPD_1IN54_V2_SendCommand(0x11); //data entry mode
-    EPD_1IN54_V2_SendData(0x01);
-
-    EPD_1IN54_V2_SetWindows(0, EPD_1IN54_V2_HEIGHT-1, EPD_1IN54_V2_WIDTH-1, 0);
-
-    EPD_1IN54_V2_SendCommand(0x3C); //BorderWavefrom
-    EPD_1IN54_V2_SendData(0x01);
-
-    EPD_1IN54_V2_SendCommand(0x18);
-    EPD_1IN54_V2_SendData(0x80);
-
-    EPD_1IN54_V2_SendCommand(0x22); // //Load Temperature and waveform setting.
-    EPD_1IN54_V2_SendData(0XB1);
-    EPD_1IN54_V2_SendCommand(0x20);
-
-    EPD_1IN54_V2_SetCursor(0, EPD_1IN54_V2_HEIGHT-1);
-    EPD_1IN54_V2_ReadBusy();
-
-    EPD_1IN54_V2_SetLut(WF_Full_1IN54);
+    EPD_Panel_Init(&EPD_1IN54_V2_Panel);
 }
 
 /******************************************************************************
@@ -251,28 +197,28 @@ parameter:
 void EPD_1IN54_V2_Init_Partial(void)
 {
 	EPD_1IN54_V2_Reset();
-	EPD_1IN54_V2_ReadBusy();
+	EPD_Panel_Wait(&EPD_1IN54_V2_Panel);
 	
-	EPD_1IN54_V2_SetLut(WF_PARTIAL_1IN54_0);
-	EPD_1IN54_V2_SendCommand(0x37); 
-	EPD_1IN54_V2_SendData(0x00);  
-	EPD_1IN54_V2_SendData(0x00);  
-	EPD_1IN54_V2_SendData(0x00);  
-	EPD_1IN54_V2_SendData(0x00); 
-	EPD_1IN54_V2_SendData(0x00);  	
-	EPD_1IN54_V2_SendData(0x40);  
-	EPD_1IN54_V2_SendData(0x00);  
-	EPD_1IN54_V2_SendData(0x00);   
-	EPD_1IN54_V2_SendData(0x00);  
-	EPD_1IN54_V2_SendData(0x00);
-
-	EPD_1IN54_V2_SendCommand(0x3C); //BorderWavefrom
-	EPD_1IN54_V2_SendData(0x80);
+	EPD_Panel_SetLut(&EPD_1IN54_V2_Panel, WF_PARTIAL_1IN54_0);
+	EPD_SendCommand(0x37); 
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00); 
+	EPD_SendData(0x00);  	
+	EPD_SendData(0x40);  
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);   
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);
+
+	EPD_SendCommand(0x3C); //BorderWavefrom
+	EPD_SendData(0x80);
 	
-	EPD_1IN54_V2_SendCommand(0x22); 
-	EPD_1IN54_V2_SendData(0xc0); 
-	EPD_1IN54_V2_SendCommand(0x20); 
-	EPD_1IN54_V2_ReadBusy();
+	EPD_SendCommand(0x22); 
+	EPD_SendData(0xc0); 
+	EPD_SendCommand(0x20); 
+	EPD_Panel_Wait(&EPD_1IN54_V2_Panel);
 }
 
 /******************************************************************************
@@ -281,23 +227,10 @@ parameter:
 ******************************************************************************/
 void EPD_1IN54_V2_Clear(void)
 {
-    UWORD Width, Height;
-    Width = (EPD_1IN54_V2_WIDTH % 8 == 0)? (EPD_1IN54_V2_WIDTH / 8 ): (EPD_1IN54_V2_WIDTH / 8 + 1);
-    Height = EPD_1IN54_V2_HEIGHT;
-
-    EPD_1IN54_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN54_V2_SendData(0XFF);
-        }
-    }
-    EPD_1IN54_V2_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN54_V2_SendData(0XFF);
-        }
-    }
-    EPD_1IN54_V2_TurnOnDisplay();
+    // The previous-image RAM too, it is the base for partial refresh
+    EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)(EPD_1IN54_V2_WIDTH / 8) * EPD_1IN54_V2_HEIGHT);
+    EPD_Panel_Clear(&EPD_1IN54_V2_Panel);
 }
 
 /******************************************************************************
@@ -306,19 +239,42 @@ parameter:
 ******************************************************************************/
 void EPD_1IN54_V2_Display(UBYTE *Image)
 {
-    UWORD Width, Height;
-    Width = (EPD_1IN54_V2_WIDTH % 8 == 0)? (EPD_1IN54_V2_WIDTH / 8 ): (EPD_1IN54_V2_WIDTH / 8 + 1);
-    Height = EPD_1IN54_V2_HEIGHT;
+    EPD_1IN54_V2_DisplayAsync(Image, NULL);
+    EPD_BusyWait();
+}
+
+/******************************************************************************
+function :	Sends the image and starts the refresh without waiting for it
+parameter:
+    Image  : Whole image
+    Done   : Called from EPD_BusyPoll() once the refresh is over, or NULL
+info:
+    Returns while the panel is still busy; poll EPD_BusyPoll() from the main
+    loop. Any earlier refresh is waited for first.
+******************************************************************************/
+void EPD_1IN54_V2_DisplayAsync(UBYTE *Image, EPD_DONE Done)
+{
+    EPD_Panel_DisplayAsync(&EPD_1IN54_V2_Panel, Image, NULL, Done);
+}
 
-    UDOUBLE Addr = 0;
-    EPD_1IN54_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            Addr = i + j * Width;
-            EPD_1IN54_V2_SendData(Image[Addr]);
-        }
+/******************************************************************************
+function :	Sends one band of the image to the RAM, refreshing after the last
+parameter:
+    Band   : Rows lines of the image, as filled by Paint_RenderBands()
+    Ystart : First line of the band
+    Rows   : Number of lines in the band
+info:
+    A partial refresh leaves the RAM window narrowed to its rectangle, so
+    the first band puts back the full window and cursor of the init script.
+******************************************************************************/
+void EPD_1IN54_V2_DisplayBand(const UBYTE *Band, UWORD Ystart, UWORD Rows)
+{
+    if (Ystart == 0) {
+        EPD_BusyWait();
+        EPD_1IN54_V2_SetWindows(0, EPD_1IN54_V2_HEIGHT-1, EPD_1IN54_V2_WIDTH-1, 0);
+        EPD_1IN54_V2_SetCursor(0, EPD_1IN54_V2_HEIGHT-1);
     }
-    EPD_1IN54_V2_TurnOnDisplay();
+    EPD_Panel_DisplayBand(&EPD_1IN54_V2_Panel, 0, Band, Ystart, Rows);
 }
 
 /******************************************************************************
@@ -332,21 +288,10 @@ void EPD_1IN54_V2_DisplayPartBaseImage(UBYTE *Image)
     Width = (EPD_1IN54_V2_WIDTH % 8 == 0)? (EPD_1IN54_V2_WIDTH / 8 ): (EPD_1IN54_V2_WIDTH / 8 + 1);
     Height = EPD_1IN54_V2_HEIGHT;
 
-    UDOUBLE Addr = 0;
-    EPD_1IN54_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            Addr = i + j * Width;
-            EPD_1IN54_V2_SendData(Image[Addr]);
-        }
-    }
-    EPD_1IN54_V2_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            Addr = i + j * Width;
-            EPD_1IN54_V2_SendData(Image[Addr]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x26);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
     EPD_1IN54_V2_TurnOnDisplayPart();
 }
 
@@ -360,25 +305,146 @@ void EPD_1IN54_V2_DisplayPart(UBYTE *Image)
     Width = (EPD_1IN54_V2_WIDTH % 8 == 0)? (EPD_1IN54_V2_WIDTH / 8 ): (EPD_1IN54_V2_WIDTH / 8 + 1);
     Height = EPD_1IN54_V2_HEIGHT;
 	
-    UDOUBLE Addr = 0;
-    EPD_1IN54_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            Addr = i + j * Width;
-            EPD_1IN54_V2_SendData(Image[Addr]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
     EPD_1IN54_V2_TurnOnDisplayPart();
 }
+
+/******************************************************************************
+function :	Sends a window of the image to one RAM
+parameter:
+    Ram    : 0x24 (new image) or 0x26 (previous image)
+    Image  : Whole image, EPD_1IN54_V2_WIDTH / 8 bytes per line
+    Xstart..Yend : Window in image pixels, inclusive; X is widened to bytes
+info:
+    Uses the addressing of EPD_1IN54_V2_Init() (X up, Y down from the last
+    RAM line), which is how the full frames were written.
+******************************************************************************/
+static void EPD_1IN54_V2_SendWindow(UBYTE Ram, const UBYTE *Image,
+                                    UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UWORD Width, y;
+    Width = (EPD_1IN54_V2_WIDTH % 8 == 0)? (EPD_1IN54_V2_WIDTH / 8 ): (EPD_1IN54_V2_WIDTH / 8 + 1);
+
+    EPD_SendCommand(0x11); //data entry mode
+    EPD_SendData(0x01);
+    EPD_1IN54_V2_SetWindows(Xstart, EPD_1IN54_V2_HEIGHT-1 - Ystart, Xend, EPD_1IN54_V2_HEIGHT-1 - Yend);
+    EPD_1IN54_V2_SetCursor(Xstart >> 3, EPD_1IN54_V2_HEIGHT-1 - Ystart);
+
+    EPD_SendCommand(Ram);
+    for (y = Ystart; y <= Yend; y++)
+        EPD_SendDataArray(Image + (UDOUBLE)y * Width + (Xstart >> 3), (Xend >> 3) - (Xstart >> 3) + 1);
+}
+
+/******************************************************************************
+function :	Full refresh that also loads the base image for partial refresh
+parameter:
+    Image  : Whole image
+info:
+    For Paint_Flush(): both RAMs get the image, then the partial waveform is
+    loaded without a reset, so EPD_1IN54_V2_RefreshWindow() can follow.
+******************************************************************************/
+void EPD_1IN54_V2_RefreshFull(UBYTE *Image)
+{
+    UWORD Width, Height;
+    Width = (EPD_1IN54_V2_WIDTH % 8 == 0)? (EPD_1IN54_V2_WIDTH / 8 ): (EPD_1IN54_V2_WIDTH / 8 + 1);
+    Height = EPD_1IN54_V2_HEIGHT;
+
+    EPD_1IN54_V2_Init();
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x26);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
+    EPD_1IN54_V2_TurnOnDisplay();
+
+    EPD_Panel_SetLut(&EPD_1IN54_V2_Panel, WF_PARTIAL_1IN54_0);
+    EPD_SendCommand(0x37); // no RAM ping-pong: 0x26 keeps the previous image
+    EPD_SendDataBurst(0x00, 10);
+    EPD_SendCommand(0x3C); //BorderWavefrom
+    EPD_SendData(0x80);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xc0);
+    EPD_SendCommand(0x20);
+    EPD_Panel_Wait(&EPD_1IN54_V2_Panel);
+}
+
+/******************************************************************************
+function :	Partial refresh of one window of the image
+parameter:
+    Image  : Whole image
+    Xstart..Yend : Window in image pixels, inclusive
+info:
+    For Paint_Flush(), after EPD_1IN54_V2_RefreshFull(). Only the window
+    goes over SPI: to 0x24 before the refresh and to 0x26 after it, so the
+    next partial refresh compares against this image.
+******************************************************************************/
+void EPD_1IN54_V2_RefreshWindow(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    EPD_1IN54_V2_RefreshWindowAsync(Image, Xstart, Ystart, Xend, Yend, NULL);
+    EPD_BusyWait();
+}
+
+static struct {
+    const UBYTE *Image;
+    UWORD Xstart, Ystart, Xend, Yend;
+    EPD_DONE Done;
+} EPD_1IN54_V2_Window;
+
+static void EPD_1IN54_V2_WindowDone(void)
+{
+    EPD_DONE Done = EPD_1IN54_V2_Window.Done;
+
+    EPD_1IN54_V2_SendWindow(0x26, EPD_1IN54_V2_Window.Image,
+                            EPD_1IN54_V2_Window.Xstart, EPD_1IN54_V2_Window.Ystart,
+                            EPD_1IN54_V2_Window.Xend, EPD_1IN54_V2_Window.Yend);
+    if (Done)
+        Done();
+}
+
+/******************************************************************************
+function :	Partial refresh of one window without waiting for it
+parameter:
+    Image  : Whole image, left alone until Done
+    Xstart..Yend : Window in image pixels, inclusive
+    Done   : Called from EPD_BusyPoll() once the refresh is over, or NULL
+info:
+    The window is copied to 0x26 when EPD_BusyPoll() sees the panel idle,
+    just before Done, so the image must not change until then.
+******************************************************************************/
+void EPD_1IN54_V2_RefreshWindowAsync(const UBYTE *Image, UWORD Xstart, UWORD Ystart,
+                                     UWORD Xend, UWORD Yend, EPD_DONE Done)
+{
+    EPD_BusyWait();
+    if (Xend >= EPD_1IN54_V2_WIDTH)
+        Xend = EPD_1IN54_V2_WIDTH - 1;
+    if (Yend >= EPD_1IN54_V2_HEIGHT)
+        Yend = EPD_1IN54_V2_HEIGHT - 1;
+    if (Xstart > Xend || Ystart > Yend) {
+        if (Done)
+            Done();
+        return;
+    }
+
+    EPD_1IN54_V2_SendWindow(0x24, Image, Xstart, Ystart, Xend, Yend);
+    EPD_1IN54_V2_Window.Image = Image;
+    EPD_1IN54_V2_Window.Xstart = Xstart;
+    EPD_1IN54_V2_Window.Ystart = Ystart;
+    EPD_1IN54_V2_Window.Xend = Xend;
+    EPD_1IN54_V2_Window.Yend = Yend;
+    EPD_1IN54_V2_Window.Done = Done;
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xcF);
+    EPD_SendCommand(0x20);
+    EPD_BusyStart(1, EPD_1IN54_V2_WindowDone);
+}
+
 /******************************************************************************
 function :	Enter sleep mode
 parameter:
 ******************************************************************************/
 void EPD_1IN54_V2_Sleep(void)
 {
-    EPD_1IN54_V2_SendCommand(0x10); //enter deep sleep
-    EPD_1IN54_V2_SendData(0x01);
-    EPD_Delay_ms(100);
+    EPD_Panel_Sleep(&EPD_1IN54_V2_Panel);
 }
 
 #endif
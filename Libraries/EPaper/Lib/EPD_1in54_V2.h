@@ -30,18 +30,26 @@
 #ifndef __EPD_1IN54_V2_H_
 #define __EPD_1IN54_V2_H_
 
-#include "EPD_Common.h"
+#include "EPD_Panel.h"
 
 // Display resolution
 #define EPD_1IN54_V2_WIDTH       200
 #define EPD_1IN54_V2_HEIGHT      200
 
+extern const EPD_PANEL EPD_1IN54_V2_Panel;
+
 void EPD_1IN54_V2_Init(void);
 void EPD_1IN54_V2_Init_Partial(void);
 void EPD_1IN54_V2_Clear(void);
 void EPD_1IN54_V2_Display(UBYTE *Image);
+void EPD_1IN54_V2_DisplayAsync(UBYTE *Image, EPD_DONE Done);
+void EPD_1IN54_V2_DisplayBand(const UBYTE *Band, UWORD Ystart, UWORD Rows);
 void EPD_1IN54_V2_DisplayPartBaseImage(UBYTE *Image);
 void EPD_1IN54_V2_DisplayPart(UBYTE *Image);
+void EPD_1IN54_V2_RefreshFull(UBYTE *Image);
+void EPD_1IN54_V2_RefreshWindow(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void EPD_1IN54_V2_RefreshWindowAsync(const UBYTE *Image, UWORD Xstart, UWORD Ystart,
+                                     UWORD Xend, UWORD Yend, EPD_DONE Done);
 void EPD_1IN54_V2_Sleep(void);
 
 #endif
@@ -118,32 +118,6 @@ static void EPD_1IN54B_Reset(void)
     EPD_Delay_ms(100);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_1IN54B_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_1IN54B_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -165,27 +139,16 @@ parameter:
 ******************************************************************************/
 static void EPD_1IN54B_SetLutBw(void)
 {
-    UWORD count;
-    EPD_1IN54B_SendCommand(0x20);// g vcom
-    for(count = 0; count < 15; count++) {
-        EPD_1IN54B_SendData(EPD_1IN54B_lut_vcom0[count]);
-    }
-    EPD_1IN54B_SendCommand(0x21);// g ww --
-    for(count = 0; count < 15; count++) {
-        EPD_1IN54B_SendData(EPD_1IN54B_lut_w[count]);
-    }
-    EPD_1IN54B_SendCommand(0x22);// g bw r
-    for(count = 0; count < 15; count++) {
-        EPD_1IN54B_SendData(EPD_1IN54B_lut_b[count]);
-    }
-    EPD_1IN54B_SendCommand(0x23);// g wb w
-    for(count = 0; count < 15; count++) {
-        EPD_1IN54B_SendData(EPD_1IN54B_lut_g1[count]);
-    }
-    EPD_1IN54B_SendCommand(0x24);// g bb b
-    for(count = 0; count < 15; count++) {
-        EPD_1IN54B_SendData(EPD_1IN54B_lut_g2[count]);
-    }
+    EPD_SendCommand(0x20);// g vcom
+    EPD_SendDataArray(EPD_1IN54B_lut_vcom0, 15);
+    EPD_SendCommand(0x21);// g ww --
+    EPD_SendDataArray(EPD_1IN54B_lut_w, 15);
+    EPD_SendCommand(0x22);// g bw r
+    EPD_SendDataArray(EPD_1IN54B_lut_b, 15);
+    EPD_SendCommand(0x23);// g wb w
+    EPD_SendDataArray(EPD_1IN54B_lut_g1, 15);
+    EPD_SendCommand(0x24);// g bb b
+    EPD_SendDataArray(EPD_1IN54B_lut_g2, 15);
 }
 
 /******************************************************************************
@@ -194,19 +157,12 @@ parameter:
 ******************************************************************************/
 static void EPD_1IN54B_SetLutRed(void)
 {
-    UWORD count;
-    EPD_1IN54B_SendCommand(0x25);
-    for(count = 0; count < 15; count++) {
-        EPD_1IN54B_SendData(EPD_1IN54B_lut_vcom1[count]);
-    }
-    EPD_1IN54B_SendCommand(0x26);
-    for(count = 0; count < 15; count++) {
-        EPD_1IN54B_SendData(EPD_1IN54B_lut_red0[count]);
-    }
-    EPD_1IN54B_SendCommand(0x27);
-    for(count = 0; count < 15; count++) {
-        EPD_1IN54B_SendData(EPD_1IN54B_lut_red1[count]);
-    }
+    EPD_SendCommand(0x25);
+    EPD_SendDataArray(EPD_1IN54B_lut_vcom1, 15);
+    EPD_SendCommand(0x26);
+    EPD_SendDataArray(EPD_1IN54B_lut_red0, 15);
+    EPD_SendCommand(0x27);
+    EPD_SendDataArray(EPD_1IN54B_lut_red1, 15);
 }
 
 /******************************************************************************
@@ -217,31 +173,31 @@ void EPD_1IN54B_Init(void)
 {
     EPD_1IN54B_Reset();
 
-    EPD_1IN54B_SendCommand(0x01);// POWER_SETTING
-    EPD_1IN54B_SendData(0x07);
-    EPD_1IN54B_SendData(0x00);
-    EPD_1IN54B_SendData(0x08);
-    EPD_1IN54B_SendData(0x00);
-    EPD_1IN54B_SendCommand(0x06);// BOOSTER_SOFT_START
-    EPD_1IN54B_SendData(0x07);
-    EPD_1IN54B_SendData(0x07);
-    EPD_1IN54B_SendData(0x07);
-    EPD_1IN54B_SendCommand(0x04);// POWER_ON
+    EPD_SendCommand(0x01);// POWER_SETTING
+    EPD_SendData(0x07);
+    EPD_SendData(0x00);
+    EPD_SendData(0x08);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x06);// BOOSTER_SOFT_START
+    EPD_SendData(0x07);
+    EPD_SendData(0x07);
+    EPD_SendData(0x07);
+    EPD_SendCommand(0x04);// POWER_ON
 
     EPD_1IN54B_ReadBusy();
 
-    EPD_1IN54B_SendCommand(0X00);// PANEL_SETTING
-    EPD_1IN54B_SendData(0xcf);
-    EPD_1IN54B_SendCommand(0X50);// VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_1IN54B_SendData(0x37);// 0xF0
-    EPD_1IN54B_SendCommand(0x30);// PLL_CONTROL
-    EPD_1IN54B_SendData(0x39);
-    EPD_1IN54B_SendCommand(0x61);// TCON_RESOLUTION set x and y
-    EPD_1IN54B_SendData(0xC8);// 200
-    EPD_1IN54B_SendData(0x00);// y High eight: 0
-    EPD_1IN54B_SendData(0xC8);// y Low eight: 200
-    EPD_1IN54B_SendCommand(0x82);// VCM_DC_SETTING_REGISTER
-    EPD_1IN54B_SendData(0x0E);
+    EPD_SendCommand(0X00);// PANEL_SETTING
+    EPD_SendData(0xcf);
+    EPD_SendCommand(0X50);// VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SendData(0x37);// 0xF0
+    EPD_SendCommand(0x30);// PLL_CONTROL
+    EPD_SendData(0x39);
+    EPD_SendCommand(0x61);// TCON_RESOLUTION set x and y
+    EPD_SendData(0xC8);// 200
+    EPD_SendData(0x00);// y High eight: 0
+    EPD_SendData(0xC8);// y Low eight: 200
+    EPD_SendCommand(0x82);// VCM_DC_SETTING_REGISTER
+    EPD_SendData(0x0E);
 
     EPD_1IN54B_SetLutBw();
     EPD_1IN54B_SetLutRed();
@@ -258,27 +214,23 @@ void EPD_1IN54B_Clear(void)
     Height = EPD_1IN54B_HEIGHT;
 
     //send black data
-    EPD_1IN54B_SendCommand(0x10);// DATA_START_TRANSMISSION_1
+    EPD_SendCommand(0x10);// DATA_START_TRANSMISSION_1
     EPD_Delay_ms(2);
     for(UWORD i = 0; i < Height; i++) {
         for(UWORD i = 0; i < Width; i++) {
-            EPD_1IN54B_SendData(0xFF);
-            EPD_1IN54B_SendData(0xFF);
+            EPD_SendData(0xFF);
+            EPD_SendData(0xFF);
         }
     }
     EPD_Delay_ms(2);
 
     //send red data
-    EPD_1IN54B_SendCommand(0x13);// DATA_START_TRANSMISSION_2
+    EPD_SendCommand(0x13);// DATA_START_TRANSMISSION_2
     EPD_Delay_ms(2);
-    for(UWORD i = 0; i < Height; i++) {
-        for(UWORD i = 0; i < Width; i++) {
-            EPD_1IN54B_SendData(0xFF);
-        }
-    }
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
     EPD_Delay_ms(2);
 
-    EPD_1IN54B_SendCommand(0x12);// DISPLAY_REFRESH
+    EPD_SendCommand(0x12);// DISPLAY_REFRESH
     EPD_1IN54B_ReadBusy();
 }
 
@@ -293,7 +245,7 @@ void EPD_1IN54B_Display(const UBYTE *blackimage, const UBYTE *redimage)
     Width = (EPD_1IN54B_WIDTH % 8 == 0)? (EPD_1IN54B_WIDTH / 8 ): (EPD_1IN54B_WIDTH / 8 + 1);
     Height = EPD_1IN54B_HEIGHT;
 
-    EPD_1IN54B_SendCommand(0x10);// DATA_START_TRANSMISSION_1
+    EPD_SendCommand(0x10);// DATA_START_TRANSMISSION_1
     for (UWORD j = 0; j < Height; j++) {
         for (UWORD i = 0; i < Width; i++) {
             Temp = 0x00;
@@ -302,28 +254,24 @@ void EPD_1IN54B_Display(const UBYTE *blackimage, const UBYTE *redimage)
                     Temp |= 0xC0 >> (bit * 2);
                 }
             }
-            EPD_1IN54B_SendData(Temp);
+            EPD_SendData(Temp);
             Temp = 0x00;
             for (int bit = 4; bit < 8; bit++) {
                 if ((blackimage[i + j * Width] & (0x80 >> bit)) != 0) {
                     Temp |= 0xC0 >> ((bit - 4) * 2);
                 }
             }
-            EPD_1IN54B_SendData(Temp);
+            EPD_SendData(Temp);
         }
     }
     EPD_Delay_ms(2);
 
-    EPD_1IN54B_SendCommand(0x13);// DATA_START_TRANSMISSION_2
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN54B_SendData(redimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x13);// DATA_START_TRANSMISSION_2
+    EPD_SendDataArray(redimage, (UDOUBLE)Width * Height);
     EPD_Delay_ms(2);
 
     //Display refresh
-    EPD_1IN54B_SendCommand(0x12);// DISPLAY_REFRESH
+    EPD_SendCommand(0x12);// DISPLAY_REFRESH
     EPD_1IN54B_ReadBusy();
 }
 
@@ -333,19 +281,19 @@ parameter:
 ******************************************************************************/
 void EPD_1IN54B_Sleep(void)
 {
-    EPD_1IN54B_SendCommand(0x50);// VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_1IN54B_SendData(0x17);
-    EPD_1IN54B_SendCommand(0x82);// VCM_DC_SETTING_REGISTER
-    EPD_1IN54B_SendData(0x00);
-    EPD_1IN54B_SendCommand(0x01);// POWER_SETTING
-    EPD_1IN54B_SendData(0x02);
-    EPD_1IN54B_SendData(0x00);
-    EPD_1IN54B_SendData(0x00);
-    EPD_1IN54B_SendData(0x00);
+    EPD_SendCommand(0x50);// VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SendData(0x17);
+    EPD_SendCommand(0x82);// VCM_DC_SETTING_REGISTER
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x01);// POWER_SETTING
+    EPD_SendData(0x02);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
     EPD_1IN54B_ReadBusy();
     EPD_Delay_ms(1000);
 	
-    EPD_1IN54B_SendCommand(0x02);// POWER_OFF
+    EPD_SendCommand(0x02);// POWER_OFF
 }
 
 #endif
@@ -46,32 +46,6 @@ static void EPD_1IN54B_V2_Reset(void)
     EPD_Delay_ms(100);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_1IN54B_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_1IN54B_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -97,38 +71,38 @@ void EPD_1IN54B_V2_Init(void)
     EPD_1IN54B_V2_Reset();
 
     EPD_1IN54B_V2_ReadBusy();   
-    EPD_1IN54B_V2_SendCommand(0x12);  //SWRESET
+    EPD_SendCommand(0x12);  //SWRESET
     EPD_1IN54B_V2_ReadBusy();   
 
-    EPD_1IN54B_V2_SendCommand(0x01); //Driver output control      
-    EPD_1IN54B_V2_SendData(0xC7);
-    EPD_1IN54B_V2_SendData(0x00);
-    EPD_1IN54B_V2_SendData(0x01);
+    EPD_SendCommand(0x01); //Driver output control      
+    EPD_SendData(0xC7);
+    EPD_SendData(0x00);
+    EPD_SendData(0x01);
 
-    EPD_1IN54B_V2_SendCommand(0x11); //data entry mode       
-    EPD_1IN54B_V2_SendData(0x01);
+    EPD_SendCommand(0x11); //data entry mode       
+    EPD_SendData(0x01);
 
-    EPD_1IN54B_V2_SendCommand(0x44); //set Ram-X address start/end position   
-    EPD_1IN54B_V2_SendData(0x00);
-    EPD_1IN54B_V2_SendData(0x18);    //0x18-->(24+1)*8=200
+    EPD_SendCommand(0x44); //set Ram-X address start/end position   
+    EPD_SendData(0x00);
+    EPD_SendData(0x18);    //0x18-->(24+1)*8=200
 
-    EPD_1IN54B_V2_SendCommand(0x45); //set Ram-Y address start/end position          
-    EPD_1IN54B_V2_SendData(0xC7);    //0xC7-->(199+1)=200
-    EPD_1IN54B_V2_SendData(0x00);
-    EPD_1IN54B_V2_SendData(0x00);
-    EPD_1IN54B_V2_SendData(0x00); 
+    EPD_SendCommand(0x45); //set Ram-Y address start/end position          
+    EPD_SendData(0xC7);    //0xC7-->(199+1)=200
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00); 
 
-    EPD_1IN54B_V2_SendCommand(0x3C); //BorderWavefrom
-    EPD_1IN54B_V2_SendData(0x05);
+    EPD_SendCommand(0x3C); //BorderWavefrom
+    EPD_SendData(0x05);
 
-    EPD_1IN54B_V2_SendCommand(0x18); //Read built-in temperature sensor
-    EPD_1IN54B_V2_SendData(0x80);
+    EPD_SendCommand(0x18); //Read built-in temperature sensor
+    EPD_SendData(0x80);
 
-    EPD_1IN54B_V2_SendCommand(0x4E);   // set RAM x address count to 0;
-    EPD_1IN54B_V2_SendData(0x00);
-    EPD_1IN54B_V2_SendCommand(0x4F);   // set RAM y address count to 0X199;    
-    EPD_1IN54B_V2_SendData(0xC7);
-    EPD_1IN54B_V2_SendData(0x00);
+    EPD_SendCommand(0x4E);   // set RAM x address count to 0;
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x4F);   // set RAM y address count to 0X199;    
+    EPD_SendData(0xC7);
+    EPD_SendData(0x00);
     EPD_1IN54B_V2_ReadBusy();
 }
 
@@ -139,20 +113,13 @@ parameter:
 void EPD_1IN54B_V2_Clear(void)
 {
     
-    unsigned int i;	
-    EPD_1IN54B_V2_SendCommand(0x24);   //write RAM for black(0)/white (1)
-    for(i=0;i<5000;i++)
-    {               
-        EPD_1IN54B_V2_SendData(0xff);
-    }
-    EPD_1IN54B_V2_SendCommand(0x26);   //write RAM for black(0)/white (1)
-    for(i=0;i<5000;i++)
-    {               
-        EPD_1IN54B_V2_SendData(0x00);
-    }
-    EPD_1IN54B_V2_SendCommand(0x22); //Display Update Control
-    EPD_1IN54B_V2_SendData(0xF7);   
-    EPD_1IN54B_V2_SendCommand(0x20);  //Activate Display Update Sequence
+    EPD_SendCommand(0x24);   //write RAM for black(0)/white (1)
+    EPD_SendDataBurst(0xff, 5000);
+    EPD_SendCommand(0x26);   //write RAM for black(0)/white (1)
+    EPD_SendDataBurst(0x00, 5000);
+    EPD_SendCommand(0x22); //Display Update Control
+    EPD_SendData(0xF7);   
+    EPD_SendCommand(0x20);  //Activate Display Update Sequence
     EPD_1IN54B_V2_ReadBusy();   
 }
 
@@ -167,19 +134,16 @@ void EPD_1IN54B_V2_Display(const UBYTE *blackimage, const UBYTE *redimage)
     Height = EPD_1IN54B_V2_HEIGHT;
 
      unsigned int i;	
-    EPD_1IN54B_V2_SendCommand(0x24);   //write RAM for black(0)/white (1)
-    for(i=0;i<Width * Height;i++)
-    {               
-        EPD_1IN54B_V2_SendData(blackimage[i]);
-    }
-    EPD_1IN54B_V2_SendCommand(0x26);   //write RAM for black(0)/white (1)
+    EPD_SendCommand(0x24);   //write RAM for black(0)/white (1)
+    EPD_SendDataArray(blackimage, Width * Height);
+    EPD_SendCommand(0x26);   //write RAM for black(0)/white (1)
     for(i=0;i<Width * Height;i++)
     {               
-        EPD_1IN54B_V2_SendData(~redimage[i]);
+        EPD_SendData(~redimage[i]);
     }
-    EPD_1IN54B_V2_SendCommand(0x22); //Display Update Control
-    EPD_1IN54B_V2_SendData(0xF7);   
-    EPD_1IN54B_V2_SendCommand(0x20);  //Activate Display Update Sequence
+    EPD_SendCommand(0x22); //Display Update Control
+    EPD_SendData(0xF7);   
+    EPD_SendCommand(0x20);  //Activate Display Update Sequence
     EPD_1IN54B_V2_ReadBusy();   
 }
 
@@ -189,8 +153,8 @@ parameter:
 ******************************************************************************/
 void EPD_1IN54B_V2_Sleep(void)
 {
-    EPD_1IN54B_V2_SendCommand(0x10); //enter deep sleep
-    EPD_1IN54B_V2_SendData(0x01); 
+    EPD_SendCommand(0x10); //enter deep sleep
+    EPD_SendData(0x01); 
     EPD_Delay_ms(100);
 }
 
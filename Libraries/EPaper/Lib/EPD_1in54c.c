@@ -96,32 +96,6 @@ static void EPD_1IN54C_Reset(void)
     EPD_Delay_ms(100);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_1IN54C_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_1IN54C_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -130,7 +104,7 @@ static void EPD_1IN54C_ReadBusy(void)
 {
     unsigned char busy;
     do {
-        EPD_1IN54C_SendCommand(0x71);
+        EPD_SendCommand(0x71);
         busy = EPD_Digital_Read(EPD_BUSY_PIN);
         busy =!(busy & 0x01);
     }	while(busy);
@@ -145,25 +119,25 @@ void EPD_1IN54C_Init(void)
 {
     EPD_1IN54C_Reset();
 
-    EPD_1IN54C_SendCommand(0x06); //boost soft start
-    EPD_1IN54C_SendData(0x17);
-    EPD_1IN54C_SendData(0x17);
-    EPD_1IN54C_SendData(0x17);
-    EPD_1IN54C_SendCommand(0x04);
+    EPD_SendCommand(0x06); //boost soft start
+    EPD_SendData(0x17);
+    EPD_SendData(0x17);
+    EPD_SendData(0x17);
+    EPD_SendCommand(0x04);
 
     EPD_1IN54C_ReadBusy();
 
-    EPD_1IN54C_SendCommand(0x00); //panel setting
-    EPD_1IN54C_SendData(0x0f); //LUT from OTP��160x296
-    EPD_1IN54C_SendData(0x0d); //VCOM to 0V fast
+    EPD_SendCommand(0x00); //panel setting
+    EPD_SendData(0x0f); //LUT from OTP��160x296
+    EPD_SendData(0x0d); //VCOM to 0V fast
 
-    EPD_1IN54C_SendCommand(0x61); //resolution setting
-    EPD_1IN54C_SendData(0x98); //152
-    EPD_1IN54C_SendData(0x00); //152
-    EPD_1IN54C_SendData(0x98);
+    EPD_SendCommand(0x61); //resolution setting
+    EPD_SendData(0x98); //152
+    EPD_SendData(0x00); //152
+    EPD_SendData(0x98);
 
-    EPD_1IN54C_SendCommand(0X50); //VCOM AND DATA INTERVAL SETTING
-    EPD_1IN54C_SendData(0x77); //WBmode:VBDF 17|D7 VBDW 97 VBDB 57		WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+    EPD_SendCommand(0X50); //VCOM AND DATA INTERVAL SETTING
+    EPD_SendData(0x77); //WBmode:VBDF 17|D7 VBDW 97 VBDB 57		WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
 }
 
 /******************************************************************************
@@ -177,23 +151,15 @@ void EPD_1IN54C_Clear(void)
     Height = EPD_1IN54C_HEIGHT;
 
     //send black data
-    EPD_1IN54C_SendCommand(0x10);
-    for(UWORD i = 0; i < Height; i++) {
-        for(UWORD i = 0; i < Width; i++) {
-            EPD_1IN54C_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
 
     //send red data
-    EPD_1IN54C_SendCommand(0x13);
-    for(UWORD i = 0; i < Height; i++) {
-        for(UWORD i = 0; i < Width; i++) {
-            EPD_1IN54C_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
 
     //Display refresh
-    EPD_1IN54C_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_1IN54C_ReadBusy();
 }
 
@@ -208,23 +174,15 @@ void EPD_1IN54C_Display(const UBYTE *blackimage, const UBYTE *redimage)
     Height = EPD_1IN54C_HEIGHT;
 
     //send black data
-    EPD_1IN54C_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN54C_SendData(blackimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * Height);
 
     //send red data
-    EPD_1IN54C_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN54C_SendData(redimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(redimage, (UDOUBLE)Width * Height);
 
     //Display refresh
-    EPD_1IN54C_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_1IN54C_ReadBusy();
 }
 
@@ -234,10 +192,10 @@ parameter:
 ******************************************************************************/
 void EPD_1IN54C_Sleep(void)
 {
-    EPD_1IN54C_SendCommand(0X02);  	//power off
+    EPD_SendCommand(0X02);  	//power off
     EPD_1IN54C_ReadBusy();
-    EPD_1IN54C_SendCommand(0X07);  	//deep sleep
-    EPD_1IN54C_SendData(0xA5);
+    EPD_SendCommand(0X07);  	//deep sleep
+    EPD_SendData(0xA5);
 }
 
 #endif
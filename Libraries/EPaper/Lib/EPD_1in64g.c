@@ -46,32 +46,6 @@ static void EPD_1IN64G_Reset(void)
     EPD_Delay_ms(20);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_1IN64G_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_1IN64G_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -91,12 +65,12 @@ parameter:
 ******************************************************************************/
 static void EPD_1IN64G_TurnOnDisplay(void)
 {
-    EPD_1IN64G_SendCommand(0x12); // DISPLAY_REFRESH
-    EPD_1IN64G_SendData(0x01);
+    EPD_SendCommand(0x12); // DISPLAY_REFRESH
+    EPD_SendData(0x01);
     EPD_1IN64G_ReadBusyH();
 
-    EPD_1IN64G_SendCommand(0x02); // POWER_OFF
-    EPD_1IN64G_SendData(0X00);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
     EPD_1IN64G_ReadBusyH();
 }
 
@@ -108,57 +82,57 @@ void EPD_1IN64G_Init(void)
 {
     EPD_1IN64G_Reset();
 
-    EPD_1IN64G_SendCommand(0x66);
-    EPD_1IN64G_SendData(0x49);
-    EPD_1IN64G_SendData(0x55);
-    EPD_1IN64G_SendData(0x13);
-    EPD_1IN64G_SendData(0x5D);
+    EPD_SendCommand(0x66);
+    EPD_SendData(0x49);
+    EPD_SendData(0x55);
+    EPD_SendData(0x13);
+    EPD_SendData(0x5D);
 
-    EPD_1IN64G_SendCommand(0x66);
-    EPD_1IN64G_SendData(0x49);
-    EPD_1IN64G_SendData(0x55);
+    EPD_SendCommand(0x66);
+    EPD_SendData(0x49);
+    EPD_SendData(0x55);
 
-    EPD_1IN64G_SendCommand(0xB0);
-    EPD_1IN64G_SendData(0x03);//1 boost 20211113
+    EPD_SendCommand(0xB0);
+    EPD_SendData(0x03);//1 boost 20211113
 
 
-    EPD_1IN64G_SendCommand(0x00);
-    EPD_1IN64G_SendData(0x4F);
-    EPD_1IN64G_SendData(0x6B);
+    EPD_SendCommand(0x00);
+    EPD_SendData(0x4F);
+    EPD_SendData(0x6B);
 
-    EPD_1IN64G_SendCommand(0x03);
-    EPD_1IN64G_SendData(0x00);
+    EPD_SendCommand(0x03);
+    EPD_SendData(0x00);
 
-    EPD_1IN64G_SendCommand(0xF0);
-    EPD_1IN64G_SendData(0xF6);
-    EPD_1IN64G_SendData(0x0D);
-    EPD_1IN64G_SendData(0x00);
-    EPD_1IN64G_SendData(0x00);
-    EPD_1IN64G_SendData(0x00);
+    EPD_SendCommand(0xF0);
+    EPD_SendData(0xF6);
+    EPD_SendData(0x0D);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
 
     //20220303
-    EPD_1IN64G_SendCommand(0x06);
-    EPD_1IN64G_SendData(0xCF);
-    EPD_1IN64G_SendData(0xDF);
-    EPD_1IN64G_SendData(0x0F);
+    EPD_SendCommand(0x06);
+    EPD_SendData(0xCF);
+    EPD_SendData(0xDF);
+    EPD_SendData(0x0F);
 
-    EPD_1IN64G_SendCommand(0x41);
-    EPD_1IN64G_SendData(0x00);
+    EPD_SendCommand(0x41);
+    EPD_SendData(0x00);
 
-    EPD_1IN64G_SendCommand(0x50);
-    EPD_1IN64G_SendData(0x30);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x30);
 
-    EPD_1IN64G_SendCommand(0x60);
-    EPD_1IN64G_SendData(0x0C); 
-    EPD_1IN64G_SendData(0x05);
+    EPD_SendCommand(0x60);
+    EPD_SendData(0x0C); 
+    EPD_SendData(0x05);
 
-    EPD_1IN64G_SendCommand(0x61);
-    EPD_1IN64G_SendData(0xA8);
-    EPD_1IN64G_SendData(0x00); 
-    EPD_1IN64G_SendData(0xA8); 
+    EPD_SendCommand(0x61);
+    EPD_SendData(0xA8);
+    EPD_SendData(0x00); 
+    EPD_SendData(0xA8); 
 
-    EPD_1IN64G_SendCommand(0x84);
-    EPD_1IN64G_SendData(0x01);
+    EPD_SendCommand(0x84);
+    EPD_SendData(0x01);
 
 }
 
@@ -172,21 +146,17 @@ void EPD_1IN64G_Clear(UBYTE color)
     Width = (EPD_1IN64G_WIDTH % 4 == 0)? (EPD_1IN64G_WIDTH / 4 ): (EPD_1IN64G_WIDTH / 4 + 1);
     Height = EPD_1IN64G_HEIGHT;
 
-    EPD_1IN64G_SendCommand(0x68);
-    EPD_1IN64G_SendData(0x01);
+    EPD_SendCommand(0x68);
+    EPD_SendData(0x01);
     
-    EPD_1IN64G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_1IN64G_ReadBusyH();
 
-    EPD_1IN64G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN64G_SendData((color << 6) | (color << 4) | (color << 2) | color);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst((color << 6) | (color << 4) | (color << 2) | color, (UDOUBLE)Width * Height);
 
-    EPD_1IN64G_SendCommand(0x68);
-    EPD_1IN64G_SendData(0x00);
+    EPD_SendCommand(0x68);
+    EPD_SendData(0x00);
 
     EPD_1IN64G_TurnOnDisplay();
 }
@@ -201,21 +171,17 @@ void EPD_1IN64G_Display(UBYTE *Image)
     Width = (EPD_1IN64G_WIDTH % 4 == 0)? (EPD_1IN64G_WIDTH / 4 ): (EPD_1IN64G_WIDTH / 4 + 1);
     Height = EPD_1IN64G_HEIGHT;
 
-    EPD_1IN64G_SendCommand(0x68);
-    EPD_1IN64G_SendData(0x01);
+    EPD_SendCommand(0x68);
+    EPD_SendData(0x01);
     
-    EPD_1IN64G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_1IN64G_ReadBusyH();
 
-    EPD_1IN64G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_1IN64G_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 
-    EPD_1IN64G_SendCommand(0x68);
-    EPD_1IN64G_SendData(0x00);
+    EPD_SendCommand(0x68);
+    EPD_SendData(0x00);
 
     EPD_1IN64G_TurnOnDisplay();
 }
@@ -226,10 +192,10 @@ parameter:
 ******************************************************************************/
 void EPD_1IN64G_Sleep(void)
 {
-    EPD_1IN64G_SendCommand(0x02); // POWER_OFF
-    EPD_1IN64G_SendData(0X00);
-    EPD_1IN64G_SendCommand(0x07); // DEEP_SLEEP
-    EPD_1IN64G_SendData(0XA5);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
@@ -79,32 +79,6 @@ static void EPD_2IN13_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN13_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN13_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -124,35 +98,35 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN13_TurnOnDisplay(void)
 {
-    EPD_2IN13_SendCommand(0x22); // DISPLAY_UPDATE_CONTROL_2
-    EPD_2IN13_SendData(0xC4);
-    EPD_2IN13_SendCommand(0X20);	// MASTER_ACTIVATION
-    EPD_2IN13_SendCommand(0xFF);	// TERMINATE_FRAME_READ_WRITE
+    EPD_SendCommand(0x22); // DISPLAY_UPDATE_CONTROL_2
+    EPD_SendData(0xC4);
+    EPD_SendCommand(0X20);	// MASTER_ACTIVATION
+    EPD_SendCommand(0xFF);	// TERMINATE_FRAME_READ_WRITE
 
     EPD_2IN13_ReadBusy();
 }
 
 static void EPD_2IN13_SetWindows(int x_start, int y_start, int x_end, int y_end)
 {
-    EPD_2IN13_SendCommand(0x44);
+    EPD_SendCommand(0x44);
     /* x point must be the multiple of 8 or the last 3 bits will be ignored */
-    EPD_2IN13_SendData((x_start >> 3) & 0xFF);
-    EPD_2IN13_SendData((x_end >> 3) & 0xFF);
-    EPD_2IN13_SendCommand(0x45);
-    EPD_2IN13_SendData(y_start & 0xFF);
-    EPD_2IN13_SendData((y_start >> 8) & 0xFF);
-    EPD_2IN13_SendData(y_end & 0xFF);
-    EPD_2IN13_SendData((y_end >> 8) & 0xFF);
+    EPD_SendData((x_start >> 3) & 0xFF);
+    EPD_SendData((x_end >> 3) & 0xFF);
+    EPD_SendCommand(0x45);
+    EPD_SendData(y_start & 0xFF);
+    EPD_SendData((y_start >> 8) & 0xFF);
+    EPD_SendData(y_end & 0xFF);
+    EPD_SendData((y_end >> 8) & 0xFF);
 }
 
 static void EPD_2IN13_SetCursor(int x, int y)
 {
-    EPD_2IN13_SendCommand(0x4E);
+    EPD_SendCommand(0x4E);
     /* x point must be the multiple of 8 or the last 3 bits will be ignored */
-    EPD_2IN13_SendData((x >> 3) & 0xFF);
-    EPD_2IN13_SendCommand(0x4F);
-    EPD_2IN13_SendData(y & 0xFF);
-    EPD_2IN13_SendData((y >> 8) & 0xFF);
+    EPD_SendData((x >> 3) & 0xFF);
+    EPD_SendCommand(0x4F);
+    EPD_SendData(y & 0xFF);
+    EPD_SendData((y >> 8) & 0xFF);
 //    EPD_2IN13_ReadBusy();
 }
 
@@ -164,41 +138,37 @@ void EPD_2IN13_Init(UBYTE Mode)
 {
     EPD_2IN13_Reset();
 
-    EPD_2IN13_SendCommand(0x01); // DRIVER_OUTPUT_CONTROL
-    EPD_2IN13_SendData((EPD_2IN13_HEIGHT - 1) & 0xFF);
-    EPD_2IN13_SendData(((EPD_2IN13_HEIGHT - 1) >> 8) & 0xFF);
-    EPD_2IN13_SendData(0x00);			// GD = 0; SM = 0; TB = 0;
+    EPD_SendCommand(0x01); // DRIVER_OUTPUT_CONTROL
+    EPD_SendData((EPD_2IN13_HEIGHT - 1) & 0xFF);
+    EPD_SendData(((EPD_2IN13_HEIGHT - 1) >> 8) & 0xFF);
+    EPD_SendData(0x00);			// GD = 0; SM = 0; TB = 0;
 
-    EPD_2IN13_SendCommand(0x0C);	// BOOSTER_SOFT_START_CONTROL
-    EPD_2IN13_SendData(0xD7);
-    EPD_2IN13_SendData(0xD6);
-    EPD_2IN13_SendData(0x9D);
+    EPD_SendCommand(0x0C);	// BOOSTER_SOFT_START_CONTROL
+    EPD_SendData(0xD7);
+    EPD_SendData(0xD6);
+    EPD_SendData(0x9D);
 
-    EPD_2IN13_SendCommand(0x2C);	// WRITE_VCOM_REGISTER
-    EPD_2IN13_SendData(0xA8);     // VCOM 7C
+    EPD_SendCommand(0x2C);	// WRITE_VCOM_REGISTER
+    EPD_SendData(0xA8);     // VCOM 7C
 
-    EPD_2IN13_SendCommand(0x3A);	// SET_DUMMY_LINE_PERIOD
-    EPD_2IN13_SendData(0x1A);			// 4 dummy lines per gate
+    EPD_SendCommand(0x3A);	// SET_DUMMY_LINE_PERIOD
+    EPD_SendData(0x1A);			// 4 dummy lines per gate
 
-    EPD_2IN13_SendCommand(0x3B);	// SET_GATE_TIME
-    EPD_2IN13_SendData(0x08);			// 2us per line
+    EPD_SendCommand(0x3B);	// SET_GATE_TIME
+    EPD_SendData(0x08);			// 2us per line
 
-    EPD_2IN13_SendCommand(0X3C);	// BORDER_WAVEFORM_CONTROL
-    EPD_2IN13_SendData(0x03);
+    EPD_SendCommand(0X3C);	// BORDER_WAVEFORM_CONTROL
+    EPD_SendData(0x03);
 
-    EPD_2IN13_SendCommand(0X11);	// DATA_ENTRY_MODE_SETTING
-    EPD_2IN13_SendData(0x03);			// X increment; Y increment
+    EPD_SendCommand(0X11);	// DATA_ENTRY_MODE_SETTING
+    EPD_SendData(0x03);			// X increment; Y increment
 
     //set the look-up table register
-    EPD_2IN13_SendCommand(0x32);
+    EPD_SendCommand(0x32);
     if(Mode == EPD_2IN13_FULL) {
-        for (UWORD i = 0; i < 30; i++) {
-            EPD_2IN13_SendData(EPD_2IN13_lut_full_update[i]);
-        }
+        EPD_SendDataArray(EPD_2IN13_lut_full_update, 30);
     } else if(Mode == EPD_2IN13_PART) {
-        for (UWORD i = 0; i < 30; i++) {
-            EPD_2IN13_SendData(EPD_2IN13_lut_partial_update[i]);
-        }
+        EPD_SendDataArray(EPD_2IN13_lut_partial_update, 30);
     } else {
         EPD_Printf("error, the Mode is EPD_2IN13_FULL or EPD_2IN13_PART");
     }
@@ -216,10 +186,8 @@ void EPD_2IN13_Clear(void)
     EPD_2IN13_SetWindows(0, 0, EPD_2IN13_WIDTH, EPD_2IN13_HEIGHT);
     for (UWORD j = 0; j < Height; j++) {
         EPD_2IN13_SetCursor(0, j);
-        EPD_2IN13_SendCommand(0x24);
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13_SendData(0Xff);
-        }
+        EPD_SendCommand(0x24);
+        EPD_SendDataBurst(0Xff, Width);
     }
     EPD_2IN13_TurnOnDisplay();
 }
@@ -237,10 +205,8 @@ void EPD_2IN13_Display(UBYTE *Image)
     EPD_2IN13_SetWindows(0, 0, EPD_2IN13_WIDTH, EPD_2IN13_HEIGHT);
     for (UWORD j = 0; j < Height; j++) {
         EPD_2IN13_SetCursor(0, j);
-        EPD_2IN13_SendCommand(0x24);
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13_SendData(Image[i + j * Width]);
-        }
+        EPD_SendCommand(0x24);
+        EPD_SendDataArray(Image + j * Width, Width);
     }
     EPD_2IN13_TurnOnDisplay();
 }
@@ -251,8 +217,8 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13_Sleep(void)
 {
-    EPD_2IN13_SendCommand(0x10); //DEEP_SLEEP_MODE
-    EPD_2IN13_SendData(0x01);
+    EPD_SendCommand(0x10); //DEEP_SLEEP_MODE
+    EPD_SendData(0x01);
 }
 
 #endif
@@ -103,32 +103,6 @@ static void EPD_2IN13_V2_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN13_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN13_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -148,9 +122,9 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN13_V2_TurnOnDisplay(void)
 {
-    EPD_2IN13_V2_SendCommand(0x22);
-    EPD_2IN13_V2_SendData(0xC7);
-    EPD_2IN13_V2_SendCommand(0x20);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xC7);
+    EPD_SendCommand(0x20);
     EPD_2IN13_V2_ReadBusy();
 }
 
@@ -160,9 +134,9 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN13_V2_TurnOnDisplayPart(void)
 {
-    EPD_2IN13_V2_SendCommand(0x22);
-    EPD_2IN13_V2_SendData(0x0C);
-    EPD_2IN13_V2_SendCommand(0x20);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0x0C);
+    EPD_SendCommand(0x20);
     EPD_2IN13_V2_ReadBusy();
 }
 /******************************************************************************
@@ -171,95 +145,90 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13_V2_Init(UBYTE Mode)
 {
-    UBYTE count;
     EPD_2IN13_V2_Reset();
 
     if(Mode == EPD_2IN13_V2_FULL) {
         EPD_2IN13_V2_ReadBusy();
-        EPD_2IN13_V2_SendCommand(0x12); // soft reset
+        EPD_SendCommand(0x12); // soft reset
         EPD_2IN13_V2_ReadBusy();
 
-        EPD_2IN13_V2_SendCommand(0x74); //set analog block control
-        EPD_2IN13_V2_SendData(0x54);
-        EPD_2IN13_V2_SendCommand(0x7E); //set digital block control
-        EPD_2IN13_V2_SendData(0x3B);
-
-        EPD_2IN13_V2_SendCommand(0x01); //Driver output control
-        EPD_2IN13_V2_SendData(0xF9);
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x00);
-
-        EPD_2IN13_V2_SendCommand(0x11); //data entry mode
-        EPD_2IN13_V2_SendData(0x01);
-
-        EPD_2IN13_V2_SendCommand(0x44); //set Ram-X address start/end position
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x0F);    //0x0C-->(15+1)*8=128
-
-        EPD_2IN13_V2_SendCommand(0x45); //set Ram-Y address start/end position
-        EPD_2IN13_V2_SendData(0xF9);   //0xF9-->(249+1)=250
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x00);
-
-        EPD_2IN13_V2_SendCommand(0x3C); //BorderWavefrom
-        EPD_2IN13_V2_SendData(0x03);
-
-        EPD_2IN13_V2_SendCommand(0x2C); //VCOM Voltage
-        EPD_2IN13_V2_SendData(0x55); //
-
-        EPD_2IN13_V2_SendCommand(0x03);
-        EPD_2IN13_V2_SendData(EPD_2IN13_V2_lut_full_update[70]);
-
-        EPD_2IN13_V2_SendCommand(0x04); //
-        EPD_2IN13_V2_SendData(EPD_2IN13_V2_lut_full_update[71]);
-        EPD_2IN13_V2_SendData(EPD_2IN13_V2_lut_full_update[72]);
-        EPD_2IN13_V2_SendData(EPD_2IN13_V2_lut_full_update[73]);
-
-        EPD_2IN13_V2_SendCommand(0x3A);     //Dummy Line
-        EPD_2IN13_V2_SendData(EPD_2IN13_V2_lut_full_update[74]);
-        EPD_2IN13_V2_SendCommand(0x3B);     //Gate time
-        EPD_2IN13_V2_SendData(EPD_2IN13_V2_lut_full_update[75]);
-
-        EPD_2IN13_V2_SendCommand(0x32);
-        for(count = 0; count < 70; count++) {
-            EPD_2IN13_V2_SendData(EPD_2IN13_V2_lut_full_update[count]);
-        }
-
-        EPD_2IN13_V2_SendCommand(0x4E);   // set RAM x address count to 0;
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendCommand(0x4F);   // set RAM y address count to 0X127;
-        EPD_2IN13_V2_SendData(0xF9);
-        EPD_2IN13_V2_SendData(0x00);
+        EPD_SendCommand(0x74); //set analog block control
+        EPD_SendData(0x54);
+        EPD_SendCommand(0x7E); //set digital block control
+        EPD_SendData(0x3B);
+
+        EPD_SendCommand(0x01); //Driver output control
+        EPD_SendData(0xF9);
+        EPD_SendData(0x00);
+        EPD_SendData(0x00);
+
+        EPD_SendCommand(0x11); //data entry mode
+        EPD_SendData(0x01);
+
+        EPD_SendCommand(0x44); //set Ram-X address start/end position
+        EPD_SendData(0x00);
+        EPD_SendData(0x0F);    //0x0C-->(15+1)*8=128
+
+        EPD_SendCommand(0x45); //set Ram-Y address start/end position
+        EPD_SendData(0xF9);   //0xF9-->(249+1)=250
+        EPD_SendData(0x00);
+        EPD_SendData(0x00);
+        EPD_SendData(0x00);
+
+        EPD_SendCommand(0x3C); //BorderWavefrom
+        EPD_SendData(0x03);
+
+        EPD_SendCommand(0x2C); //VCOM Voltage
+        EPD_SendData(0x55); //
+
+        EPD_SendCommand(0x03);
+        EPD_SendData(EPD_2IN13_V2_lut_full_update[70]);
+
+        EPD_SendCommand(0x04); //
+        EPD_SendData(EPD_2IN13_V2_lut_full_update[71]);
+        EPD_SendData(EPD_2IN13_V2_lut_full_update[72]);
+        EPD_SendData(EPD_2IN13_V2_lut_full_update[73]);
+
+        EPD_SendCommand(0x3A);     //Dummy Line
+        EPD_SendData(EPD_2IN13_V2_lut_full_update[74]);
+        EPD_SendCommand(0x3B);     //Gate time
+        EPD_SendData(EPD_2IN13_V2_lut_full_update[75]);
+
+        EPD_SendCommand(0x32);
+        EPD_SendDataArray(EPD_2IN13_V2_lut_full_update, 70);
+
+        EPD_SendCommand(0x4E);   // set RAM x address count to 0;
+        EPD_SendData(0x00);
+        EPD_SendCommand(0x4F);   // set RAM y address count to 0X127;
+        EPD_SendData(0xF9);
+        EPD_SendData(0x00);
         EPD_2IN13_V2_ReadBusy();
     } else if(Mode == EPD_2IN13_V2_PART) {
-        EPD_2IN13_V2_SendCommand(0x2C);     //VCOM Voltage
-        EPD_2IN13_V2_SendData(0x26);
+        EPD_SendCommand(0x2C);     //VCOM Voltage
+        EPD_SendData(0x26);
 
         EPD_2IN13_V2_ReadBusy();
 
-        EPD_2IN13_V2_SendCommand(0x32);
-        for(count = 0; count < 70; count++) {
-            EPD_2IN13_V2_SendData(EPD_2IN13_V2_lut_partial_update[count]);
-        }
+        EPD_SendCommand(0x32);
+        EPD_SendDataArray(EPD_2IN13_V2_lut_partial_update, 70);
 
-        EPD_2IN13_V2_SendCommand(0x37);
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x40);
-        EPD_2IN13_V2_SendData(0x00);
-        EPD_2IN13_V2_SendData(0x00);
+        EPD_SendCommand(0x37);
+        EPD_SendData(0x00);
+        EPD_SendData(0x00);
+        EPD_SendData(0x00);
+        EPD_SendData(0x00);
+        EPD_SendData(0x40);
+        EPD_SendData(0x00);
+        EPD_SendData(0x00);
 
-        EPD_2IN13_V2_SendCommand(0x22);
-        EPD_2IN13_V2_SendData(0xC0);
+        EPD_SendCommand(0x22);
+        EPD_SendData(0xC0);
 
-        EPD_2IN13_V2_SendCommand(0x20);
+        EPD_SendCommand(0x20);
         EPD_2IN13_V2_ReadBusy();
 
-        EPD_2IN13_V2_SendCommand(0x3C); //BorderWavefrom
-        EPD_2IN13_V2_SendData(0x01);
+        EPD_SendCommand(0x3C); //BorderWavefrom
+        EPD_SendData(0x01);
     } else {
         EPD_Printf("error, the Mode is EPD_2IN13_FULL or EPD_2IN13_PART");
     }
@@ -275,12 +244,8 @@ void EPD_2IN13_V2_Clear(void)
     Width = (EPD_2IN13_V2_WIDTH % 8 == 0)? (EPD_2IN13_V2_WIDTH / 8 ): (EPD_2IN13_V2_WIDTH / 8 + 1);
     Height = EPD_2IN13_V2_HEIGHT;
 
-    EPD_2IN13_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13_V2_SendData(0XFF);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0XFF, (UDOUBLE)Width * Height);
 
     EPD_2IN13_V2_TurnOnDisplay();
 }
@@ -295,12 +260,8 @@ void EPD_2IN13_V2_Display(UBYTE *Image)
     Width = (EPD_2IN13_V2_WIDTH % 8 == 0)? (EPD_2IN13_V2_WIDTH / 8 ): (EPD_2IN13_V2_WIDTH / 8 + 1);
     Height = EPD_2IN13_V2_HEIGHT;
 
-    EPD_2IN13_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13_V2_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
     EPD_2IN13_V2_TurnOnDisplay();
 }
 
@@ -315,21 +276,10 @@ void EPD_2IN13_V2_DisplayPartBaseImage(UBYTE *Image)
     Width = (EPD_2IN13_V2_WIDTH % 8 == 0)? (EPD_2IN13_V2_WIDTH / 8 ): (EPD_2IN13_V2_WIDTH / 8 + 1);
     Height = EPD_2IN13_V2_HEIGHT;
 
-    UDOUBLE Addr = 0;
-    EPD_2IN13_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            Addr = i + j * Width;
-            EPD_2IN13_V2_SendData(Image[Addr]);
-        }
-    }
-    EPD_2IN13_V2_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            Addr = i + j * Width;
-            EPD_2IN13_V2_SendData(Image[Addr]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x26);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
     EPD_2IN13_V2_TurnOnDisplay();
 }
 
@@ -339,12 +289,8 @@ void EPD_2IN13_V2_DisplayPart(UBYTE *Image)
     UWORD Width, Height;
     Width = (EPD_2IN13_V2_WIDTH % 8 == 0)? (EPD_2IN13_V2_WIDTH / 8 ): (EPD_2IN13_V2_WIDTH / 8 + 1);
     Height = EPD_2IN13_V2_HEIGHT;
-    EPD_2IN13_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13_V2_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 
     EPD_2IN13_V2_TurnOnDisplayPart();
 }
@@ -355,12 +301,12 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13_V2_Sleep(void)
 {
-    EPD_2IN13_V2_SendCommand(0x22); //POWER OFF
-    EPD_2IN13_V2_SendData(0xC3);
-    EPD_2IN13_V2_SendCommand(0x20);
+    EPD_SendCommand(0x22); //POWER OFF
+    EPD_SendData(0xC3);
+    EPD_SendCommand(0x20);
 
-    EPD_2IN13_V2_SendCommand(0x10); //enter deep sleep
-    EPD_2IN13_V2_SendData(0x01);
+    EPD_SendCommand(0x10); //enter deep sleep
+    EPD_SendData(0x01);
     EPD_Delay_ms(100);
 }
 
@@ -32,7 +32,7 @@
 
 #ifdef EPD_2IN13_V3
 
-UBYTE WF_PARTIAL_2IN13_V3[159] =
+static const UBYTE WF_PARTIAL_2IN13_V3[159] =
 {
 	0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
 	0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
@@ -55,7 +55,7 @@ UBYTE WF_PARTIAL_2IN13_V3[159] =
 	0x22,0x17,0x41,0x00,0x32,0x36,
 };
 
-UBYTE WS_20_30_2IN13_V3[159] =
+static const UBYTE WS_20_30_2IN13_V3[159] =
 {											
 	0x80,	0x4A,	0x40,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,
 	0x40,	0x4A,	0x80,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,
@@ -78,62 +78,43 @@ UBYTE WS_20_30_2IN13_V3[159] =
 	0x22,	0x17,	0x41,	0x0,	0x32,	0x36						
 };
 
-/******************************************************************************
-function :	Software reset
-parameter:
-******************************************************************************/
-static void EPD_2in13_V3_Reset(void)
-{
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(20);
-    EPD_Digital_Write(EPD_RST_PIN, 0);
-    EPD_Delay_ms(2);
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(20);
-}
+static const UBYTE EPD_2in13_V3_InitScript[] = {
+    EPD_OP_RESET, 20, 2,
+    EPD_OP_DELAY, 100,
+    EPD_OP_WAIT,
+    0, 0x12,                        // SWRESET
+    EPD_OP_WAIT,
+    3, 0x01, 0xf9, 0x00, 0x00,      // Driver output control
+    1, 0x11, 0x03,                  // data entry mode
+    2, 0x44, 0x00, 0x0f,            // RAM X start/end: 0..121
+    4, 0x45, 0x00, 0x00, 0xf9, 0x00, // RAM Y start/end: 0..249
+    1, 0x4E, 0x00,                  // RAM X counter
+    2, 0x4F, 0x00, 0x00,            // RAM Y counter
+    1, 0x3C, 0x05,                  // BorderWavefrom
+    2, 0x21, 0x00, 0x80,            // Display update control
+    1, 0x18, 0x80,                  // Read built-in temperature sensor
+    EPD_OP_WAIT,
+    EPD_OP_LUT,
+    EPD_OP_END
+};
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2in13_V3_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
+static const UBYTE EPD_2in13_V3_RefreshScript[] = {
+    1, 0x22, 0xc7,                  // Display Update Control
+    0, 0x20,                        // Activate Display Update Sequence
+    EPD_OP_END
+};
 
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2in13_V3_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
+static const UBYTE EPD_2in13_V3_SleepScript[] = {
+    1, 0x10, 0x01,                  // enter deep sleep
+    EPD_OP_DELAY, 100,
+    EPD_OP_END
+};
 
-/******************************************************************************
-function :	Wait until the busy_pin goes LOW
-parameter:
-******************************************************************************/
-void EPD_2in13_V3_ReadBusy(void)
-{
-    EPD_Printf("e-Paper busy\r\n");
-	while(1)
-	{	 //=1 BUSY
-		if(EPD_Digital_Read(EPD_BUSY_PIN)==0) 
-			break;
-		EPD_Delay_ms(10);
-	}
-	EPD_Delay_ms(10);
-    EPD_Printf("e-Paper busy release\r\n");
-}
+const EPD_PANEL EPD_2in13_V3_Panel = {
+    EPD_2in13_V3_WIDTH, EPD_2in13_V3_HEIGHT,
+    1, 0, {0x24, 0}, WS_20_30_2IN13_V3,
+    EPD_2in13_V3_InitScript, EPD_2in13_V3_RefreshScript, EPD_2in13_V3_SleepScript
+};
 
 /******************************************************************************
 function :	Turn On Display
@@ -141,10 +122,10 @@ parameter:
 ******************************************************************************/
 static void EPD_2in13_V3_TurnOnDisplay(void)
 {
-	EPD_2in13_V3_SendCommand(0x22); // Display Update Control
-	EPD_2in13_V3_SendData(0xc7);
-	EPD_2in13_V3_SendCommand(0x20); // Activate Display Update Sequence
-	EPD_2in13_V3_ReadBusy();
+	EPD_SendCommand(0x22); // Display Update Control
+	EPD_SendData(0xc7);
+	EPD_SendCommand(0x20); // Activate Display Update Sequence
+	EPD_Panel_Wait(&EPD_2in13_V3_Panel);
 }
 
 /******************************************************************************
@@ -153,44 +134,10 @@ parameter:
 ******************************************************************************/
 static void EPD_2in13_V3_TurnOnDisplay_Partial(void)
 {
-	EPD_2in13_V3_SendCommand(0x22); // Display Update Control
-	EPD_2in13_V3_SendData(0x0f);	// fast:0x0c, quality:0x0f, 0xcf
-	EPD_2in13_V3_SendCommand(0x20); // Activate Display Update Sequence
-	EPD_2in13_V3_ReadBusy();
-}
-
-/******************************************************************************
-function :	Set lut
-parameter:	
-    lut :   lut data
-******************************************************************************/
-static void EPD_2IN13_V3_LUT(UBYTE *lut)
-{
-	UBYTE count;
-	EPD_2in13_V3_SendCommand(0x32);
-	for(count=0; count<153; count++) 
-		EPD_2in13_V3_SendData(lut[count]); 
-	EPD_2in13_V3_ReadBusy();
-}
-
-/******************************************************************************
-function :	Send lut data and configuration
-parameter:	
-    lut :   lut data
-******************************************************************************/
-static void EPD_2IN13_V2_LUT_by_host(UBYTE *lut)
-{
-	EPD_2IN13_V3_LUT((UBYTE *)lut);			//lut
-	EPD_2in13_V3_SendCommand(0x3f);
-	EPD_2in13_V3_SendData(*(lut+153));
-	EPD_2in13_V3_SendCommand(0x03);	// gate voltage
-	EPD_2in13_V3_SendData(*(lut+154));
-	EPD_2in13_V3_SendCommand(0x04);	// source voltage
-	EPD_2in13_V3_SendData(*(lut+155));	// VSH
-	EPD_2in13_V3_SendData(*(lut+156));	// VSH2
-	EPD_2in13_V3_SendData(*(lut+157));	// VSL
-	EPD_2in13_V3_SendCommand(0x2c);		// VCOM
-	EPD_2in13_V3_SendData(*(lut+158));
+	EPD_SendCommand(0x22); // Display Update Control
+	EPD_SendData(0x0f);	// fast:0x0c, quality:0x0f, 0xcf
+	EPD_SendCommand(0x20); // Activate Display Update Sequence
+	EPD_Panel_Wait(&EPD_2in13_V3_Panel);
 }
 
 /******************************************************************************
@@ -203,15 +150,15 @@ parameter:
 ******************************************************************************/
 static void EPD_2in13_V3_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    EPD_2in13_V3_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_2in13_V3_SendData((Xstart>>3) & 0xFF);
-    EPD_2in13_V3_SendData((Xend>>3) & 0xFF);
+    EPD_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
+    EPD_SendData((Xstart>>3) & 0xFF);
+    EPD_SendData((Xend>>3) & 0xFF);
 	
-    EPD_2in13_V3_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
-    EPD_2in13_V3_SendData(Ystart & 0xFF);
-    EPD_2in13_V3_SendData((Ystart >> 8) & 0xFF);
-    EPD_2in13_V3_SendData(Yend & 0xFF);
-    EPD_2in13_V3_SendData((Yend >> 8) & 0xFF);
+    EPD_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendData(Yend & 0xFF);
+    EPD_SendData((Yend >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -222,12 +169,12 @@ parameter:
 ******************************************************************************/
 static void EPD_2in13_V3_SetCursor(UWORD Xstart, UWORD Ystart)
 {
-    EPD_2in13_V3_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_2in13_V3_SendData(Xstart & 0xFF);
+    EPD_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
+    EPD_SendData(Xstart & 0xFF);
 
-    EPD_2in13_V3_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
-    EPD_2in13_V3_SendData(Ystart & 0xFF);
-    EPD_2in13_V3_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -236,36 +183,7 @@ parameter:
 ******************************************************************************/
 void EPD_2in13_V3_Init(void)
 {
-	EPD_2in13_V3_Reset();
-	EPD_Delay_ms(100);
-
-	EPD_2in13_V3_ReadBusy();   
-	EPD_2in13_V3_SendCommand(0x12);  //SWRESET
-	EPD_2in13_V3_ReadBusy();   
-
-	EPD_2in13_V3_SendCommand(0x01); //Driver output control      
-	EPD_2in13_V3_SendData(0xf9);
-	EPD_2in13_V3_SendData(0x00);
-	EPD_2in13_V3_SendData(0x00);
-
-	EPD_2in13_V3_SendCommand(0x11); //data entry mode       
-	EPD_2in13_V3_SendData(0x03);
-
-	EPD_2in13_V3_SetWindows(0, 0, EPD_2in13_V3_WIDTH-1, EPD_2in13_V3_HEIGHT-1);
-	EPD_2in13_V3_SetCursor(0, 0);
-	
-	EPD_2in13_V3_SendCommand(0x3C); //BorderWavefrom
-	EPD_2in13_V3_SendData(0x05);	
-
-	EPD_2in13_V3_SendCommand(0x21); //  Display update control
-	EPD_2in13_V3_SendData(0x00);
-	EPD_2in13_V3_SendData(0x80);	
-
-	EPD_2in13_V3_SendCommand(0x18); //Read built-in temperature sensor
-	EPD_2in13_V3_SendData(0x80);	
-
-	EPD_2in13_V3_ReadBusy();
-	EPD_2IN13_V2_LUT_by_host(WS_20_30_2IN13_V3);
+    EPD_Panel_Init(&EPD_2in13_V3_Panel);
 }
 
 /******************************************************************************
@@ -274,39 +192,16 @@ parameter:
 ******************************************************************************/
 void EPD_2in13_V3_Clear(void)
 {
-	UWORD Width, Height;
-    Width = (EPD_2in13_V3_WIDTH % 8 == 0)? (EPD_2in13_V3_WIDTH / 8 ): (EPD_2in13_V3_WIDTH / 8 + 1);
-    Height = EPD_2in13_V3_HEIGHT;
-	
-    EPD_2in13_V3_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2in13_V3_SendData(0XFF);
-        }
-    }	
-
-	EPD_2in13_V3_TurnOnDisplay();
+    EPD_Panel_Clear(&EPD_2in13_V3_Panel);
 }
 
 /******************************************************************************
 function :	Sends the image buffer in RAM to e-Paper and displays
 parameter:
-	image : Image data
 ******************************************************************************/
 void EPD_2in13_V3_Display(UBYTE *Image)
 {
-	UWORD Width, Height;
-    Width = (EPD_2in13_V3_WIDTH % 8 == 0)? (EPD_2in13_V3_WIDTH / 8 ): (EPD_2in13_V3_WIDTH / 8 + 1);
-    Height = EPD_2in13_V3_HEIGHT;
-	
-    EPD_2in13_V3_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2in13_V3_SendData(Image[i + j * Width]);
-        }
-    }	
-	
-	EPD_2in13_V3_TurnOnDisplay();	
+    EPD_Panel_Display(&EPD_2in13_V3_Panel, Image, NULL);
 }
 
 /******************************************************************************
@@ -320,18 +215,10 @@ void EPD_2in13_V3_Display_Base(UBYTE *Image)
     Width = (EPD_2in13_V3_WIDTH % 8 == 0)? (EPD_2in13_V3_WIDTH / 8 ): (EPD_2in13_V3_WIDTH / 8 + 1);
     Height = EPD_2in13_V3_HEIGHT;
 	
-	EPD_2in13_V3_SendCommand(0x24);   //Write Black and White image to RAM
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {        
-			EPD_2in13_V3_SendData(Image[i + j * Width]);
-		}
-	}
-	EPD_2in13_V3_SendCommand(0x26);   //Write Black and White image to RAM
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-			EPD_2in13_V3_SendData(Image[i + j * Width]);
-		}
-	}
+	EPD_SendCommand(0x24);   //Write Black and White image to RAM
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
+	EPD_SendCommand(0x26);   //Write Black and White image to RAM
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 	EPD_2in13_V3_TurnOnDisplay();	
 }
 
@@ -351,37 +238,33 @@ void EPD_2in13_V3_Display_Partial(UBYTE *Image)
     EPD_Delay_ms(1);
     EPD_Digital_Write(EPD_RST_PIN, 1);
 
-	EPD_2IN13_V2_LUT_by_host(WF_PARTIAL_2IN13_V3);
-
-	EPD_2in13_V3_SendCommand(0x37); 
-	EPD_2in13_V3_SendData(0x00);  
-	EPD_2in13_V3_SendData(0x00);  
-	EPD_2in13_V3_SendData(0x00);  
-	EPD_2in13_V3_SendData(0x00); 
-	EPD_2in13_V3_SendData(0x00);  
-	EPD_2in13_V3_SendData(0x40);  ///RAM Ping-Pong enable 
-	EPD_2in13_V3_SendData(0x00);  
-	EPD_2in13_V3_SendData(0x00);   
-	EPD_2in13_V3_SendData(0x00);  
-	EPD_2in13_V3_SendData(0x00);
-
-	EPD_2in13_V3_SendCommand(0x3C); //BorderWavefrom
-	EPD_2in13_V3_SendData(0x80);	
-
-	EPD_2in13_V3_SendCommand(0x22); //Display Update Sequence Option
-	EPD_2in13_V3_SendData(0xC0);    // Enable clock and  Enable analog
-	EPD_2in13_V3_SendCommand(0x20);  //Activate Display Update Sequence
-	EPD_2in13_V3_ReadBusy();  
+	EPD_Panel_SetLut(&EPD_2in13_V3_Panel, WF_PARTIAL_2IN13_V3);
+
+	EPD_SendCommand(0x37); 
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00); 
+	EPD_SendData(0x00);  
+	EPD_SendData(0x40);  ///RAM Ping-Pong enable 
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);   
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);
+
+	EPD_SendCommand(0x3C); //BorderWavefrom
+	EPD_SendData(0x80);	
+
+	EPD_SendCommand(0x22); //Display Update Sequence Option
+	EPD_SendData(0xC0);    // Enable clock and  Enable analog
+	EPD_SendCommand(0x20);  //Activate Display Update Sequence
+	EPD_Panel_Wait(&EPD_2in13_V3_Panel);  
 	
 	EPD_2in13_V3_SetWindows(0, 0, EPD_2in13_V3_WIDTH-1, EPD_2in13_V3_HEIGHT-1);
 	EPD_2in13_V3_SetCursor(0, 0);
 
-	EPD_2in13_V3_SendCommand(0x24);   //Write Black and White image to RAM
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-			EPD_2in13_V3_SendData(Image[i + j * Width]);
-		}
-	}
+	EPD_SendCommand(0x24);   //Write Black and White image to RAM
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 	EPD_2in13_V3_TurnOnDisplay_Partial();
 }
 
@@ -391,9 +274,7 @@ parameter:
 ******************************************************************************/
 void EPD_2in13_V3_Sleep(void)
 {
-	EPD_2in13_V3_SendCommand(0x10); //enter deep sleep
-	EPD_2in13_V3_SendData(0x01); 
-	EPD_Delay_ms(100);
+    EPD_Panel_Sleep(&EPD_2in13_V3_Panel);
 }
 
 #endif
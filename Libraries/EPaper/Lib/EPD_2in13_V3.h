@@ -31,12 +31,14 @@
 #ifndef __EPD_2in13_V3_H_
 #define __EPD_2in13_V3_H_
 
-#include "EPD_Common.h"
+#include "EPD_Panel.h"
 
 // Display resolution
 #define EPD_2in13_V3_WIDTH       122
 #define EPD_2in13_V3_HEIGHT      250
 
+extern const EPD_PANEL EPD_2in13_V3_Panel;
+
 void EPD_2in13_V3_Init(void);
 void EPD_2in13_V3_Clear(void);
 void EPD_2in13_V3_Display(UBYTE *Image);
@@ -48,33 +48,6 @@ static void EPD_2IN13B_V3_Reset(void)
     EPD_Delay_ms(10);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN13B_V3_SendCommand(UBYTE Reg)
-{
-    
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN13B_V3_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -84,7 +57,7 @@ void EPD_2IN13B_V3_ReadBusy(void)
     UBYTE busy;
     EPD_Printf("e-Paper busy\r\n");
     do{
-        EPD_2IN13B_V3_SendCommand(0x71);
+        EPD_SendCommand(0x71);
         busy = EPD_Digital_Read(EPD_BUSY_PIN);
         busy =!(busy & 0x01);
     }while(busy);
@@ -98,7 +71,7 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN13B_V3_TurnOnDisplay(void)
 {
-    EPD_2IN13B_V3_SendCommand(0x12);		 //DISPLAY REFRESH
+    EPD_SendCommand(0x12);		 //DISPLAY REFRESH
     EPD_Delay_ms(100);
     EPD_2IN13B_V3_ReadBusy();
 }
@@ -112,20 +85,20 @@ void EPD_2IN13B_V3_Init(void)
     EPD_2IN13B_V3_Reset();
     EPD_Delay_ms(10);
     
-    EPD_2IN13B_V3_SendCommand(0x04);  
+    EPD_SendCommand(0x04);  
     EPD_2IN13B_V3_ReadBusy();//waiting for the electronic paper IC to release the idle signal
 
-    EPD_2IN13B_V3_SendCommand(0x00);//panel setting
-    EPD_2IN13B_V3_SendData(0x0f);//LUT from OTP，128x296
-    EPD_2IN13B_V3_SendData(0x89);//Temperature sensor, boost and other related timing settings
+    EPD_SendCommand(0x00);//panel setting
+    EPD_SendData(0x0f);//LUT from OTP，128x296
+    EPD_SendData(0x89);//Temperature sensor, boost and other related timing settings
 
-    EPD_2IN13B_V3_SendCommand(0x61);//resolution setting
-    EPD_2IN13B_V3_SendData (0x68);
-    EPD_2IN13B_V3_SendData (0x00);
-    EPD_2IN13B_V3_SendData (0xD4);
+    EPD_SendCommand(0x61);//resolution setting
+    EPD_SendData (0x68);
+    EPD_SendData (0x00);
+    EPD_SendData (0xD4);
 
-    EPD_2IN13B_V3_SendCommand(0X50);//VCOM AND DATA INTERVAL SETTING
-    EPD_2IN13B_V3_SendData(0x77);//WBmode:VBDF 17|D7 VBDW 97 VBDB 57
+    EPD_SendCommand(0X50);//VCOM AND DATA INTERVAL SETTING
+    EPD_SendData(0x77);//WBmode:VBDF 17|D7 VBDW 97 VBDB 57
                                  //WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7;
 }
 
@@ -139,20 +112,12 @@ void EPD_2IN13B_V3_Clear(void)
     UWORD Height = EPD_2IN13B_V3_HEIGHT;
     
     //send black data
-    EPD_2IN13B_V3_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13B_V3_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
 
     //send red data
-    EPD_2IN13B_V3_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13B_V3_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
     EPD_2IN13B_V3_TurnOnDisplay();
 }
 
@@ -166,19 +131,11 @@ void EPD_2IN13B_V3_Display(const UBYTE *blackimage, const UBYTE *ryimage)
     Width = (EPD_2IN13B_V3_WIDTH % 8 == 0)? (EPD_2IN13B_V3_WIDTH / 8 ): (EPD_2IN13B_V3_WIDTH / 8 + 1);
     Height = EPD_2IN13B_V3_HEIGHT;
     
-    EPD_2IN13B_V3_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13B_V3_SendData(blackimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * Height);
     
-    EPD_2IN13B_V3_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13B_V3_SendData(ryimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(ryimage, (UDOUBLE)Width * Height);
     EPD_2IN13B_V3_TurnOnDisplay();
 }
 
@@ -188,13 +145,13 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13B_V3_Sleep(void)
 {
-    EPD_2IN13B_V3_SendCommand(0X50);
-    EPD_2IN13B_V3_SendData(0xf7);	
+    EPD_SendCommand(0X50);
+    EPD_SendData(0xf7);	
 
-    EPD_2IN13B_V3_SendCommand(0X02);  	//power off
+    EPD_SendCommand(0X02);  	//power off
     EPD_2IN13B_V3_ReadBusy();          //waiting for the electronic paper IC to release the idle signal
-    EPD_2IN13B_V3_SendCommand(0X07);  	//deep sleep
-    EPD_2IN13B_V3_SendData(0xA5);
+    EPD_SendCommand(0X07);  	//deep sleep
+    EPD_SendData(0xA5);
 }
 
 #endif
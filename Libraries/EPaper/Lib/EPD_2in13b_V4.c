@@ -32,103 +32,40 @@
 
 #ifdef EPD_2IN13B_V4
 
-/******************************************************************************
-function :	Software reset
-parameter:
-******************************************************************************/
-static void EPD_2IN13B_V4_Reset(void)
-{
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(20);
-    EPD_Digital_Write(EPD_RST_PIN, 0);
-    EPD_Delay_ms(2);
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(20);
-}
-
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN13B_V4_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN13B_V4_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	Wait until the busy_pin goes LOW
-parameter:
-******************************************************************************/
-void EPD_2IN13B_V4_ReadBusy(void)
-{
-    EPD_Printf("e-Paper busy\r\n");
-	while(1)
-	{	 //=1 BUSY
-		if(EPD_Digital_Read(EPD_BUSY_PIN)==0) 
-			break;
-		EPD_Delay_ms(20);
-	}
-	EPD_Delay_ms(20);
-    EPD_Printf("e-Paper busy release\r\n");
-}
-
-/******************************************************************************
-function :	Turn On Display
-parameter:
-******************************************************************************/
-static void EPD_2IN13B_V4_TurnOnDisplay(void)
-{
-	EPD_2IN13B_V4_SendCommand(0x20); // Activate Display Update Sequence
-	EPD_2IN13B_V4_ReadBusy();
-}
-
-/******************************************************************************
-function :	Setting the display window
-parameter:
-******************************************************************************/
-static void EPD_2IN13B_V4_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
-{
-    EPD_2IN13B_V4_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_2IN13B_V4_SendData((Xstart>>3) & 0xFF);
-    EPD_2IN13B_V4_SendData((Xend>>3) & 0xFF);
-	
-    EPD_2IN13B_V4_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
-    EPD_2IN13B_V4_SendData(Ystart & 0xFF);
-    EPD_2IN13B_V4_SendData((Ystart >> 8) & 0xFF);
-    EPD_2IN13B_V4_SendData(Yend & 0xFF);
-    EPD_2IN13B_V4_SendData((Yend >> 8) & 0xFF);
-}
-
-/******************************************************************************
-function :	Set Cursor
-parameter:
-******************************************************************************/
-static void EPD_2IN13B_V4_SetCursor(UWORD Xstart, UWORD Ystart)
-{
-    EPD_2IN13B_V4_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_2IN13B_V4_SendData(Xstart & 0xFF);
-
-    EPD_2IN13B_V4_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
-    EPD_2IN13B_V4_SendData(Ystart & 0xFF);
-    EPD_2IN13B_V4_SendData((Ystart >> 8) & 0xFF);
-}
+static const UBYTE EPD_2IN13B_V4_InitScript[] = {
+    EPD_OP_RESET, 20, 2,
+    EPD_OP_WAIT,
+    0, 0x12,                        // SWRESET
+    EPD_OP_WAIT,
+    3, 0x01, 0xf9, 0x00, 0x00,      // Driver output control
+    1, 0x11, 0x03,                  // data entry mode
+    2, 0x44, 0x00, 0x0f,            // RAM X start/end: 0..121
+    4, 0x45, 0x00, 0x00, 0xf9, 0x00, // RAM Y start/end: 0..249
+    1, 0x4E, 0x00,                  // RAM X counter
+    2, 0x4F, 0x00, 0x00,            // RAM Y counter
+    1, 0x3C, 0x05,                  // BorderWavefrom
+    1, 0x18, 0x80,                  // Read built-in temperature sensor
+    2, 0x21, 0x80, 0x80,            // Display update control
+    EPD_OP_WAIT,
+    EPD_OP_END
+};
+
+static const UBYTE EPD_2IN13B_V4_RefreshScript[] = {
+    0, 0x20,                        // Activate Display Update Sequence
+    EPD_OP_END
+};
+
+static const UBYTE EPD_2IN13B_V4_SleepScript[] = {
+    1, 0x10, 0x01,                  // enter deep sleep
+    EPD_OP_DELAY, 100,
+    EPD_OP_END
+};
+
+const EPD_PANEL EPD_2IN13B_V4_Panel = {
+    EPD_2IN13B_V4_WIDTH, EPD_2IN13B_V4_HEIGHT,
+    1, 0, {0x24, 0x26}, NULL,
+    EPD_2IN13B_V4_InitScript, EPD_2IN13B_V4_RefreshScript, EPD_2IN13B_V4_SleepScript
+};
 
 /******************************************************************************
 function :	Initialize the e-Paper register
@@ -136,35 +73,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13B_V4_Init(void)
 {
-	EPD_2IN13B_V4_Reset();
-
-	EPD_2IN13B_V4_ReadBusy();   
-	EPD_2IN13B_V4_SendCommand(0x12);  //SWRESET
-	EPD_2IN13B_V4_ReadBusy();   
-
-	EPD_2IN13B_V4_SendCommand(0x01); //Driver output control      
-	EPD_2IN13B_V4_SendData(0xf9);
-	EPD_2IN13B_V4_SendData(0x00);
-	EPD_2IN13B_V4_SendData(0x00);
-
-	EPD_2IN13B_V4_SendCommand(0x11); //data entry mode       
-	EPD_2IN13B_V4_SendData(0x03);
-
-	EPD_2IN13B_V4_SetWindows(0, 0, EPD_2IN13B_V4_WIDTH-1, EPD_2IN13B_V4_HEIGHT-1);
-	EPD_2IN13B_V4_SetCursor(0, 0);
-
-	EPD_2IN13B_V4_SendCommand(0x3C); //BorderWavefrom
-	EPD_2IN13B_V4_SendData(0x05);	
-
-	EPD_2IN13B_V4_SendCommand(0x18); //Read built-in temperature sensor
-	EPD_2IN13B_V4_SendData(0x80);	
-
-	EPD_2IN13B_V4_SendCommand(0x21); //  Display update control
-	EPD_2IN13B_V4_SendData(0x80);	
-	EPD_2IN13B_V4_SendData(0x80);
-
-	EPD_2IN13B_V4_ReadBusy();
-
+    EPD_Panel_Init(&EPD_2IN13B_V4_Panel);
 }
 
 /******************************************************************************
@@ -173,23 +82,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13B_V4_Clear(void)
 {
-	UWORD Width, Height;
-    Width = (EPD_2IN13B_V4_WIDTH % 8 == 0)? (EPD_2IN13B_V4_WIDTH / 8 ): (EPD_2IN13B_V4_WIDTH / 8 + 1);
-    Height = EPD_2IN13B_V4_HEIGHT;
-	
-    EPD_2IN13B_V4_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13B_V4_SendData(0XFF);
-        }
-    }	
-    EPD_2IN13B_V4_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13B_V4_SendData(0XFF);
-        }
-    }
-	EPD_2IN13B_V4_TurnOnDisplay();
+    EPD_Panel_Clear(&EPD_2IN13B_V4_Panel);
 }
 
 /******************************************************************************
@@ -198,23 +91,20 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13B_V4_Display(const UBYTE *blackImage, const UBYTE *redImage)
 {
-	UWORD Width, Height;
-    Width = (EPD_2IN13B_V4_WIDTH % 8 == 0)? (EPD_2IN13B_V4_WIDTH / 8 ): (EPD_2IN13B_V4_WIDTH / 8 + 1);
-    Height = EPD_2IN13B_V4_HEIGHT;
-	
-    EPD_2IN13B_V4_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13B_V4_SendData(blackImage[i + j * Width]);
-        }
-    }	
-	EPD_2IN13B_V4_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13B_V4_SendData(redImage[i + j * Width]);
-        }
-    }	
-	EPD_2IN13B_V4_TurnOnDisplay();	
+    EPD_Panel_Display(&EPD_2IN13B_V4_Panel, blackImage, redImage);
+}
+
+/******************************************************************************
+function :	Sends one band of one plane, refreshing after the last red band
+parameter:
+    Band   : Rows lines of the plane, as rendered by Paint_RenderPlanes()
+    Plane  : PAINT_PLANE_BLACK (0) or PAINT_PLANE_RED (1)
+    Ystart : First line of the band
+    Rows   : Number of lines in the band
+******************************************************************************/
+void EPD_2IN13B_V4_DisplayBand(const UBYTE *Band, UBYTE Plane, UWORD Ystart, UWORD Rows)
+{
+    EPD_Panel_DisplayBand(&EPD_2IN13B_V4_Panel, Plane, Band, Ystart, Rows);
 }
 
 /******************************************************************************
@@ -223,9 +113,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13B_V4_Sleep(void)
 {
-	EPD_2IN13B_V4_SendCommand(0x10); //enter deep sleep
-	EPD_2IN13B_V4_SendData(0x01); 
-	EPD_Delay_ms(100);
+    EPD_Panel_Sleep(&EPD_2IN13B_V4_Panel);
 }
 
 #endif
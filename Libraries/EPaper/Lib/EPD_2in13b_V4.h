@@ -31,15 +31,18 @@
 #ifndef __EPD_2IN13B_V4_H_
 #define __EPD_2IN13B_V4_H_
 
-#include "EPD_Common.h"
+#include "EPD_Panel.h"
 
 // Display resolution
 #define EPD_2IN13B_V4_WIDTH       122
 #define EPD_2IN13B_V4_HEIGHT      250
 
+extern const EPD_PANEL EPD_2IN13B_V4_Panel;
+
 void EPD_2IN13B_V4_Init(void);
 void EPD_2IN13B_V4_Clear(void);
 void EPD_2IN13B_V4_Display(const UBYTE *blackImage, const UBYTE *redImage);
+void EPD_2IN13B_V4_DisplayBand(const UBYTE *Band, UBYTE Plane, UWORD Ystart, UWORD Rows);
 void EPD_2IN13B_V4_Sleep(void);
 
 #endif
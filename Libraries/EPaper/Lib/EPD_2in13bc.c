@@ -98,32 +98,6 @@ static void EPD_2IN13BC_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN13BC_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN13BC_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -143,7 +117,7 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN13BC_TurnOnDisplay(void)
 {
-    EPD_2IN13BC_SendCommand(0x12);		 //DISPLAY REFRESH
+    EPD_SendCommand(0x12);		 //DISPLAY REFRESH
     EPD_Delay_ms(10);
 
     EPD_2IN13BC_ReadBusy();
@@ -157,23 +131,23 @@ void EPD_2IN13BC_Init(void)
 {
     EPD_2IN13BC_Reset();
 
-    EPD_2IN13BC_SendCommand(0x06); // BOOSTER_SOFT_START
-    EPD_2IN13BC_SendData(0x17);
-    EPD_2IN13BC_SendData(0x17);
-    EPD_2IN13BC_SendData(0x17);
+    EPD_SendCommand(0x06); // BOOSTER_SOFT_START
+    EPD_SendData(0x17);
+    EPD_SendData(0x17);
+    EPD_SendData(0x17);
 	
-    EPD_2IN13BC_SendCommand(0x04); // POWER_ON
+    EPD_SendCommand(0x04); // POWER_ON
     EPD_2IN13BC_ReadBusy();
 	
-    EPD_2IN13BC_SendCommand(0x00); // PANEL_SETTING
-    EPD_2IN13BC_SendData(0x8F);
+    EPD_SendCommand(0x00); // PANEL_SETTING
+    EPD_SendData(0x8F);
 	
-    EPD_2IN13BC_SendCommand(0x50); // VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_2IN13BC_SendData(0xF0);
-    EPD_2IN13BC_SendCommand(0x61); // RESOLUTION_SETTING
-    EPD_2IN13BC_SendData(EPD_2IN13BC_WIDTH); // width: 104
-    EPD_2IN13BC_SendData(EPD_2IN13BC_HEIGHT >> 8); // height: 212
-    EPD_2IN13BC_SendData(EPD_2IN13BC_HEIGHT & 0xFF);
+    EPD_SendCommand(0x50); // VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SendData(0xF0);
+    EPD_SendCommand(0x61); // RESOLUTION_SETTING
+    EPD_SendData(EPD_2IN13BC_WIDTH); // width: 104
+    EPD_SendData(EPD_2IN13BC_HEIGHT >> 8); // height: 212
+    EPD_SendData(EPD_2IN13BC_HEIGHT & 0xFF);
 }
 
 /******************************************************************************
@@ -186,22 +160,14 @@ void EPD_2IN13BC_Clear(void)
     UWORD Height = EPD_2IN13BC_HEIGHT;
     
     //send black data
-    EPD_2IN13BC_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13BC_SendData(0xFF);
-        }
-    }
-    EPD_2IN13BC_SendCommand(0x92); 
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x92); 
 
     //send red data
-    EPD_2IN13BC_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13BC_SendData(0xFF);
-        }
-    }
-    EPD_2IN13BC_SendCommand(0x92); 
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x92); 
     
     EPD_2IN13BC_TurnOnDisplay();
 }
@@ -216,21 +182,13 @@ void EPD_2IN13BC_Display(const UBYTE *blackimage, const UBYTE *ryimage)
     Width = (EPD_2IN13BC_WIDTH % 8 == 0)? (EPD_2IN13BC_WIDTH / 8 ): (EPD_2IN13BC_WIDTH / 8 + 1);
     Height = EPD_2IN13BC_HEIGHT;
     
-    EPD_2IN13BC_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13BC_SendData(blackimage[i + j * Width]);
-        }
-    }
-    EPD_2IN13BC_SendCommand(0x92); 
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x92); 
     
-    EPD_2IN13BC_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN13BC_SendData(ryimage[i + j * Width]);
-        }
-    }
-    EPD_2IN13BC_SendCommand(0x92); 
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(ryimage, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x92); 
     
     EPD_2IN13BC_TurnOnDisplay();
 }
@@ -241,10 +199,10 @@ parameter:
 ******************************************************************************/
 void EPD_2IN13BC_Sleep(void)
 {
-    EPD_2IN13BC_SendCommand(0x02); // POWER_OFF
+    EPD_SendCommand(0x02); // POWER_OFF
     EPD_2IN13BC_ReadBusy();
-    EPD_2IN13BC_SendCommand(0x07); // DEEP_SLEEP
-    EPD_2IN13BC_SendData(0xA5); // check code
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0xA5); // check code
 }
 
 #endif
@@ -46,32 +46,6 @@ static void EPD_2IN36G_Reset(void)
     EPD_Delay_ms(20);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN36G_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN36G_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -91,12 +65,12 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN36G_TurnOnDisplay(void)
 {
-    EPD_2IN36G_SendCommand(0x12); // DISPLAY_REFRESH
-    EPD_2IN36G_SendData(0x01);
+    EPD_SendCommand(0x12); // DISPLAY_REFRESH
+    EPD_SendData(0x01);
     EPD_2IN36G_ReadBusyH();
 
-    EPD_2IN36G_SendCommand(0x02); // POWER_OFF
-    EPD_2IN36G_SendData(0X00);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
     EPD_2IN36G_ReadBusyH();
 }
 
@@ -108,55 +82,55 @@ void EPD_2IN36G_Init(void)
 {
     EPD_2IN36G_Reset();
 
-    EPD_2IN36G_SendCommand(0x66);
-    EPD_2IN36G_SendData(0x49);
-    EPD_2IN36G_SendData(0x55);
-    EPD_2IN36G_SendData(0x13);
-    EPD_2IN36G_SendData(0x5D);
+    EPD_SendCommand(0x66);
+    EPD_SendData(0x49);
+    EPD_SendData(0x55);
+    EPD_SendData(0x13);
+    EPD_SendData(0x5D);
 
-    EPD_2IN36G_SendCommand(0x66);
-    EPD_2IN36G_SendData(0x49);
-    EPD_2IN36G_SendData(0x55);
+    EPD_SendCommand(0x66);
+    EPD_SendData(0x49);
+    EPD_SendData(0x55);
 
-    EPD_2IN36G_SendCommand(0xB0);
-    EPD_2IN36G_SendData(0x03);//1 boost 20211113
+    EPD_SendCommand(0xB0);
+    EPD_SendData(0x03);//1 boost 20211113
 
-    EPD_2IN36G_SendCommand(0x00);
-    EPD_2IN36G_SendData(0x4F);
-    EPD_2IN36G_SendData(0x69);
+    EPD_SendCommand(0x00);
+    EPD_SendData(0x4F);
+    EPD_SendData(0x69);
 
-    EPD_2IN36G_SendCommand(0x03);
-    EPD_2IN36G_SendData(0x00);
+    EPD_SendCommand(0x03);
+    EPD_SendData(0x00);
 
-    EPD_2IN36G_SendCommand(0xF0);
-    EPD_2IN36G_SendData(0xF6);
-    EPD_2IN36G_SendData(0x0D);
-    EPD_2IN36G_SendData(0x00);
-    EPD_2IN36G_SendData(0x00);
-    EPD_2IN36G_SendData(0x00);
+    EPD_SendCommand(0xF0);
+    EPD_SendData(0xF6);
+    EPD_SendData(0x0D);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
 
-    EPD_2IN36G_SendCommand(0x06); //20211113
-    EPD_2IN36G_SendData(0xCF);
-    EPD_2IN36G_SendData(0xDE);
-    EPD_2IN36G_SendData(0x0F);
+    EPD_SendCommand(0x06); //20211113
+    EPD_SendData(0xCF);
+    EPD_SendData(0xDE);
+    EPD_SendData(0x0F);
 
-    EPD_2IN36G_SendCommand(0x41);
-    EPD_2IN36G_SendData(0x00);
+    EPD_SendCommand(0x41);
+    EPD_SendData(0x00);
 
-    EPD_2IN36G_SendCommand(0x50);
-    EPD_2IN36G_SendData(0x30);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x30);
 
-    EPD_2IN36G_SendCommand(0x60);
-    EPD_2IN36G_SendData(0x0C); 
-    EPD_2IN36G_SendData(0x05);
+    EPD_SendCommand(0x60);
+    EPD_SendData(0x0C); 
+    EPD_SendData(0x05);
 
-    EPD_2IN36G_SendCommand(0x61);
-    EPD_2IN36G_SendData(0xA8);
-    EPD_2IN36G_SendData(0x01); 
-    EPD_2IN36G_SendData(0x28); 
+    EPD_SendCommand(0x61);
+    EPD_SendData(0xA8);
+    EPD_SendData(0x01); 
+    EPD_SendData(0x28); 
 
-    EPD_2IN36G_SendCommand(0x84);
-    EPD_2IN36G_SendData(0x01);
+    EPD_SendCommand(0x84);
+    EPD_SendData(0x01);
 }
 
 /******************************************************************************
@@ -169,21 +143,17 @@ void EPD_2IN36G_Clear(UBYTE color)
     Width = (EPD_2IN36G_WIDTH % 4 == 0)? (EPD_2IN36G_WIDTH / 4 ): (EPD_2IN36G_WIDTH / 4 + 1);
     Height = EPD_2IN36G_HEIGHT;
 
-    EPD_2IN36G_SendCommand(0x68);
-    EPD_2IN36G_SendData(0x01);
+    EPD_SendCommand(0x68);
+    EPD_SendData(0x01);
     
-    EPD_2IN36G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_2IN36G_ReadBusyH();
 
-    EPD_2IN36G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-                EPD_2IN36G_SendData((color << 6) | (color << 4) | (color << 2) | color);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst((color << 6) | (color << 4) | (color << 2) | color, (UDOUBLE)Width * Height);
 
-    EPD_2IN36G_SendCommand(0x68);
-    EPD_2IN36G_SendData(0x00);
+    EPD_SendCommand(0x68);
+    EPD_SendData(0x00);
 
     EPD_2IN36G_TurnOnDisplay();
 }
@@ -198,21 +168,17 @@ void EPD_2IN36G_Display(UBYTE *Image)
     Width = (EPD_2IN36G_WIDTH % 4 == 0)? (EPD_2IN36G_WIDTH / 4 ): (EPD_2IN36G_WIDTH / 4 + 1);
     Height = EPD_2IN36G_HEIGHT;
 
-    EPD_2IN36G_SendCommand(0x68);
-    EPD_2IN36G_SendData(0x01);
+    EPD_SendCommand(0x68);
+    EPD_SendData(0x01);
     
-    EPD_2IN36G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_2IN36G_ReadBusyH();
 
-    EPD_2IN36G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN36G_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 		
-    EPD_2IN36G_SendCommand(0x68);
-    EPD_2IN36G_SendData(0x00);
+    EPD_SendCommand(0x68);
+    EPD_SendData(0x00);
 		
     EPD_2IN36G_TurnOnDisplay();
 }
@@ -223,10 +189,10 @@ parameter:
 ******************************************************************************/
 void EPD_2IN36G_Sleep(void)
 {
-    EPD_2IN36G_SendCommand(0x02); // POWER_OFF
-    EPD_2IN36G_SendData(0X00);
-    EPD_2IN36G_SendCommand(0x07); // DEEP_SLEEP
-    EPD_2IN36G_SendData(0XA5);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
@@ -65,32 +65,6 @@ static void EPD_2IN66_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN66_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN66_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -113,7 +87,7 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN66_TurnOnDisplay(void)
 {
-    EPD_2IN66_SendCommand(0x20);
+    EPD_SendCommand(0x20);
     EPD_2IN66_ReadBusy();
 
 }
@@ -124,11 +98,8 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN66_SetLUA(void)
 {
-    UWORD count;
-    EPD_2IN66_SendCommand(0x32);
-    for(count=0;count<153;count++){
-        EPD_2IN66_SendData(WF_PARTIAL[count]);
-    }    
+    EPD_SendCommand(0x32);
+    EPD_SendDataArray(WF_PARTIAL, 153);    
     EPD_2IN66_ReadBusy();
 }
 
@@ -140,21 +111,21 @@ void EPD_2IN66_Init(void)
 {
     EPD_2IN66_Reset();
     EPD_2IN66_ReadBusy();
-    EPD_2IN66_SendCommand(0x12);//soft  reset
+    EPD_SendCommand(0x12);//soft  reset
     EPD_2IN66_ReadBusy();
 	/*	Y increment, X increment	*/
-	EPD_2IN66_SendCommand(0x11);
-	EPD_2IN66_SendData(0x03);
+	EPD_SendCommand(0x11);
+	EPD_SendData(0x03);
 	/*	Set RamX-address Start/End position	*/
-	EPD_2IN66_SendCommand(0x44);
-	EPD_2IN66_SendData(0x01);	
-	EPD_2IN66_SendData((EPD_2IN66_WIDTH % 8 == 0)? (EPD_2IN66_WIDTH / 8 ): (EPD_2IN66_WIDTH / 8 + 1) );
+	EPD_SendCommand(0x44);
+	EPD_SendData(0x01);	
+	EPD_SendData((EPD_2IN66_WIDTH % 8 == 0)? (EPD_2IN66_WIDTH / 8 ): (EPD_2IN66_WIDTH / 8 + 1) );
 	/*	Set RamY-address Start/End position	*/
-	EPD_2IN66_SendCommand(0x45);
-	EPD_2IN66_SendData(0);
-	EPD_2IN66_SendData(0);
-	EPD_2IN66_SendData((EPD_2IN66_HEIGHT&0xff));
-	EPD_2IN66_SendData((EPD_2IN66_HEIGHT&0x100)>>8);
+	EPD_SendCommand(0x45);
+	EPD_SendData(0);
+	EPD_SendData(0);
+	EPD_SendData((EPD_2IN66_HEIGHT&0xff));
+	EPD_SendData((EPD_2IN66_HEIGHT&0x100)>>8);
 	
 
 	EPD_2IN66_ReadBusy();
@@ -168,42 +139,42 @@ void EPD_2IN66_Init_Partial(void)
 {
     EPD_2IN66_Reset();
     EPD_2IN66_ReadBusy();
-    EPD_2IN66_SendCommand(0x12);//soft  reset
+    EPD_SendCommand(0x12);//soft  reset
     EPD_2IN66_ReadBusy();
    
     EPD_2IN66_SetLUA();
-    EPD_2IN66_SendCommand(0x37); 
-    EPD_2IN66_SendData(0x00);  
-    EPD_2IN66_SendData(0x00);  
-    EPD_2IN66_SendData(0x00);  
-    EPD_2IN66_SendData(0x00); 
-    EPD_2IN66_SendData(0x00);  	
-    EPD_2IN66_SendData(0x40);  
-    EPD_2IN66_SendData(0x00);  
-    EPD_2IN66_SendData(0x00);   
-    EPD_2IN66_SendData(0x00);  
-    EPD_2IN66_SendData(0x00);
+    EPD_SendCommand(0x37); 
+    EPD_SendData(0x00);  
+    EPD_SendData(0x00);  
+    EPD_SendData(0x00);  
+    EPD_SendData(0x00); 
+    EPD_SendData(0x00);  	
+    EPD_SendData(0x40);  
+    EPD_SendData(0x00);  
+    EPD_SendData(0x00);   
+    EPD_SendData(0x00);  
+    EPD_SendData(0x00);
 
 	/* Y increment, X increment */
-    EPD_2IN66_SendCommand(0x11);
-    EPD_2IN66_SendData(0x03);
+    EPD_SendCommand(0x11);
+    EPD_SendData(0x03);
     /*	Set RamX-address Start/End position	*/
-    EPD_2IN66_SendCommand(0x44);
-    EPD_2IN66_SendData(0x01); 
-    EPD_2IN66_SendData((EPD_2IN66_WIDTH % 8 == 0)? (EPD_2IN66_WIDTH / 8 ): (EPD_2IN66_WIDTH / 8 + 1) );
+    EPD_SendCommand(0x44);
+    EPD_SendData(0x01); 
+    EPD_SendData((EPD_2IN66_WIDTH % 8 == 0)? (EPD_2IN66_WIDTH / 8 ): (EPD_2IN66_WIDTH / 8 + 1) );
     /*	Set RamY-address Start/End position	*/
-    EPD_2IN66_SendCommand(0x45);
-    EPD_2IN66_SendData(0);
-    EPD_2IN66_SendData(0);
-    EPD_2IN66_SendData((EPD_2IN66_HEIGHT&0xff));
-    EPD_2IN66_SendData((EPD_2IN66_HEIGHT&0x100)>>8);
-
-    EPD_2IN66_SendCommand(0x3C); 
-    EPD_2IN66_SendData(0x80);   
-
-    EPD_2IN66_SendCommand(0x22); 
-    EPD_2IN66_SendData(0xcf); 
-    EPD_2IN66_SendCommand(0x20); 
+    EPD_SendCommand(0x45);
+    EPD_SendData(0);
+    EPD_SendData(0);
+    EPD_SendData((EPD_2IN66_HEIGHT&0xff));
+    EPD_SendData((EPD_2IN66_HEIGHT&0x100)>>8);
+
+    EPD_SendCommand(0x3C); 
+    EPD_SendData(0x80);   
+
+    EPD_SendCommand(0x22); 
+    EPD_SendData(0xcf); 
+    EPD_SendCommand(0x20); 
     EPD_2IN66_ReadBusy();
 }
 
@@ -216,12 +187,8 @@ void EPD_2IN66_Clear(void)
     UWORD Width, Height;
     Width = (EPD_2IN66_WIDTH % 8 == 0)? (EPD_2IN66_WIDTH / 8 ): (EPD_2IN66_WIDTH / 8 + 1);
     Height = EPD_2IN66_HEIGHT;
-    EPD_2IN66_SendCommand(0x24);
-    for (UWORD j = 0; j <=Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN66_SendData(0xff);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0xff, (UDOUBLE)Width * (Height + 1));
     EPD_2IN66_TurnOnDisplay();
 }
 
@@ -235,16 +202,10 @@ void EPD_2IN66_Display(UBYTE *Image)
     Width = (EPD_2IN66_WIDTH % 8 == 0)? (EPD_2IN66_WIDTH / 8 ): (EPD_2IN66_WIDTH / 8 + 1);
     Height = EPD_2IN66_HEIGHT;
 
-    UDOUBLE Addr = 0;
 	
     // UDOUBLE Offset = ImageName;
-    EPD_2IN66_SendCommand(0x24);
-    for (UWORD j = 0; j <Height; j++) {
-        for (UWORD i = 0; i <Width; i++) {
-            Addr = i + j * Width;
-            EPD_2IN66_SendData(Image[Addr]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
     EPD_2IN66_TurnOnDisplay();
 }
 
@@ -254,8 +215,8 @@ parameter:
 ******************************************************************************/
 void EPD_2IN66_Sleep(void)
 {
-    EPD_2IN66_SendCommand(0x10);
-    EPD_2IN66_SendData(0x01); 
+    EPD_SendCommand(0x10);
+    EPD_SendData(0x01); 
     //EPD_2IN66_ReadBusy();
 }
 
@@ -45,32 +45,6 @@ static void EPD_2IN66B_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN66B_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN66B_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -92,7 +66,7 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN66B_TurnOnDisplay(void)
 {
-    EPD_2IN66B_SendCommand(0x20);
+    EPD_SendCommand(0x20);
     EPD_2IN66B_ReadBusy();
 }
 
@@ -102,15 +76,15 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN66B_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    EPD_2IN66B_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_2IN66B_SendData((Xstart>>3) & 0x1F);
-    EPD_2IN66B_SendData((Xend>>3) & 0x1F);
+    EPD_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
+    EPD_SendData((Xstart>>3) & 0x1F);
+    EPD_SendData((Xend>>3) & 0x1F);
 	
-    EPD_2IN66B_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
-    EPD_2IN66B_SendData(Ystart & 0xFF);
-    EPD_2IN66B_SendData((Ystart >> 8) & 0x01);
-    EPD_2IN66B_SendData(Yend & 0xFF);
-    EPD_2IN66B_SendData((Yend >> 8) & 0x01);
+    EPD_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0x01);
+    EPD_SendData(Yend & 0xFF);
+    EPD_SendData((Yend >> 8) & 0x01);
 }
 
 /******************************************************************************
@@ -119,12 +93,12 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN66B_SetCursor(UWORD Xstart, UWORD Ystart)
 {
-    EPD_2IN66B_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_2IN66B_SendData(Xstart & 0x1F);
+    EPD_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
+    EPD_SendData(Xstart & 0x1F);
 
-    EPD_2IN66B_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
-    EPD_2IN66B_SendData(Ystart & 0xFF);
-    EPD_2IN66B_SendData((Ystart >> 8) & 0x01);
+    EPD_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0x01);
 }
 
 /******************************************************************************
@@ -135,17 +109,17 @@ void EPD_2IN66B_Init(void)
 {
     EPD_2IN66B_Reset();
     EPD_2IN66B_ReadBusy();
-    EPD_2IN66B_SendCommand(0x12);//soft  reset
+    EPD_SendCommand(0x12);//soft  reset
     EPD_2IN66B_ReadBusy();
 
-	EPD_2IN66B_SendCommand(0x11); //data entry mode       
-	EPD_2IN66B_SendData(0x03);
+	EPD_SendCommand(0x11); //data entry mode       
+	EPD_SendData(0x03);
 
 	EPD_2IN66B_SetWindows(0, 0, EPD_2IN66B_WIDTH-1, EPD_2IN66B_HEIGHT-1);
 	
-	EPD_2IN66B_SendCommand(0x21); //  Display update control
-	EPD_2IN66B_SendData(0x00);
-	EPD_2IN66B_SendData(0x80);	
+	EPD_SendCommand(0x21); //  Display update control
+	EPD_SendData(0x00);
+	EPD_SendData(0x80);	
 
 	EPD_2IN66B_SetCursor(0, 0);
 	EPD_2IN66B_ReadBusy();
@@ -161,17 +135,13 @@ void EPD_2IN66B_Display(UBYTE *ImageBlack, UBYTE*ImageRed)
     Width = (EPD_2IN66B_WIDTH % 8 == 0)? (EPD_2IN66B_WIDTH / 8 ): (EPD_2IN66B_WIDTH / 8 + 1);
     Height = EPD_2IN66B_HEIGHT;
 
-    EPD_2IN66B_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN66B_SendData(ImageBlack[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(ImageBlack, (UDOUBLE)Width * Height);
 	
-    EPD_2IN66B_SendCommand(0x26);
+    EPD_SendCommand(0x26);
     for (UWORD j = 0; j < Height; j++) {
         for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN66B_SendData(~ImageRed[i + j * Width]);
+            EPD_SendData(~ImageRed[i + j * Width]);
         }
     }
 
@@ -188,18 +158,10 @@ void EPD_2IN66B_Clear(void)
     Width = (EPD_2IN66B_WIDTH % 8 == 0)? (EPD_2IN66B_WIDTH / 8 ): (EPD_2IN66B_WIDTH / 8 + 1);
     Height = EPD_2IN66B_HEIGHT;
 
-    EPD_2IN66B_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN66B_SendData(0xff);
-        }
-    }
-	EPD_2IN66B_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN66B_SendData(0x00);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0xff, (UDOUBLE)Width * Height);
+	EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0x00, (UDOUBLE)Width * Height);
     EPD_2IN66B_TurnOnDisplay();
 }
 
@@ -209,8 +171,8 @@ parameter:
 ******************************************************************************/
 void EPD_2IN66B_Sleep(void)
 {
-    EPD_2IN66B_SendCommand(0x10);
-    EPD_2IN66B_SendData(0x01); 
+    EPD_SendCommand(0x10);
+    EPD_SendData(0x01); 
 }
 
 #endif
@@ -208,32 +208,6 @@ static void EPD_2in7_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2in7_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2in7_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -243,7 +217,7 @@ static void EPD_2in7_ReadBusy(void)
     EPD_Printf("e-Paper busy\r\n");
     UBYTE busy;
     do {
-        EPD_2in7_SendCommand(0x71);
+        EPD_SendCommand(0x71);
         busy = EPD_Digital_Read(EPD_BUSY_PIN);
         busy =!(busy & 0x01);
     } while(busy);
@@ -257,59 +231,41 @@ parameter:
 ******************************************************************************/
 static void EPD_2in7_SetLut(void)
 {
-    unsigned int count;
-    EPD_2in7_SendCommand(0x20); //vcom
-    for(count = 0; count < 44; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_vcom_dc[count]);
-    }
+    EPD_SendCommand(0x20); //vcom
+    EPD_SendDataArray(EPD_2in7_lut_vcom_dc, 44);
 
-    EPD_2in7_SendCommand(0x21); //ww --
-    for(count = 0; count < 42; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_ww[count]);
-    }
+    EPD_SendCommand(0x21); //ww --
+    EPD_SendDataArray(EPD_2in7_lut_ww, 42);
 
-    EPD_2in7_SendCommand(0x22); //bw r
-    for(count = 0; count < 42; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_bw[count]);
-    }
+    EPD_SendCommand(0x22); //bw r
+    EPD_SendDataArray(EPD_2in7_lut_bw, 42);
 
-    EPD_2in7_SendCommand(0x23); //wb w
-    for(count = 0; count < 42; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_bb[count]);
-    }
+    EPD_SendCommand(0x23); //wb w
+    EPD_SendDataArray(EPD_2in7_lut_bb, 42);
 
-    EPD_2in7_SendCommand(0x24); //bb b
-    for(count = 0; count < 42; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_wb[count]);
-    }
+    EPD_SendCommand(0x24); //bb b
+    EPD_SendDataArray(EPD_2in7_lut_wb, 42);
 }
 
 void EPD_2in7_gray_SetLut(void)
 {
-	unsigned int count;	 
-    EPD_2in7_SendCommand(0x20);							//vcom
-    for(count=0;count<44;count++)
-        {EPD_2in7_SendData(EPD_2in7_gray_lut_vcom[count]);}
+    EPD_SendCommand(0x20);							//vcom
+    EPD_SendDataArray(EPD_2in7_gray_lut_vcom, 44);
 		
-	EPD_2in7_SendCommand(0x21);							//red not use
-	for(count=0;count<42;count++)
-        {EPD_2in7_SendData(EPD_2in7_gray_lut_ww[count]);}
+	EPD_SendCommand(0x21);							//red not use
+	EPD_SendDataArray(EPD_2in7_gray_lut_ww, 42);
 
-    EPD_2in7_SendCommand(0x22);							//bw r
-    for(count=0;count<42;count++)
-        {EPD_2in7_SendData(EPD_2in7_gray_lut_bw[count]);}
+    EPD_SendCommand(0x22);							//bw r
+    EPD_SendDataArray(EPD_2in7_gray_lut_bw, 42);
 
-    EPD_2in7_SendCommand(0x23);							//wb w
-    for(count=0;count<42;count++)
-        {EPD_2in7_SendData(EPD_2in7_gray_lut_wb[count]);}
+    EPD_SendCommand(0x23);							//wb w
+    EPD_SendDataArray(EPD_2in7_gray_lut_wb, 42);
 
-    EPD_2in7_SendCommand(0x24);							//bb b
-    for(count=0;count<42;count++)
-        {EPD_2in7_SendData(EPD_2in7_gray_lut_bb[count]);}
+    EPD_SendCommand(0x24);							//bb b
+    EPD_SendDataArray(EPD_2in7_gray_lut_bb, 42);
 
-    EPD_2in7_SendCommand(0x25);							//vcom
-    for(count=0;count<42;count++)
-        {EPD_2in7_SendData(EPD_2in7_gray_lut_ww[count]);}
+    EPD_SendCommand(0x25);							//vcom
+    EPD_SendDataArray(EPD_2in7_gray_lut_ww, 42);
          
 }
 
@@ -321,65 +277,65 @@ void EPD_2IN7_Init(void)
 {
     EPD_2in7_Reset();
 
-    EPD_2in7_SendCommand(0x01); // POWER_SETTING
-    EPD_2in7_SendData(0x03); // VDS_EN, VDG_EN
-    EPD_2in7_SendData(0x00); // VCOM_HV, VGHL_LV[1], VGHL_LV[0]
-    EPD_2in7_SendData(0x2b); // VDH
-    EPD_2in7_SendData(0x2b); // VDL
-    EPD_2in7_SendData(0x09); // VDHR
+    EPD_SendCommand(0x01); // POWER_SETTING
+    EPD_SendData(0x03); // VDS_EN, VDG_EN
+    EPD_SendData(0x00); // VCOM_HV, VGHL_LV[1], VGHL_LV[0]
+    EPD_SendData(0x2b); // VDH
+    EPD_SendData(0x2b); // VDL
+    EPD_SendData(0x09); // VDHR
 	
-    EPD_2in7_SendCommand(0x06);  // BOOSTER_SOFT_START
-    EPD_2in7_SendData(0x07);
-    EPD_2in7_SendData(0x07);
-    EPD_2in7_SendData(0x17);
+    EPD_SendCommand(0x06);  // BOOSTER_SOFT_START
+    EPD_SendData(0x07);
+    EPD_SendData(0x07);
+    EPD_SendData(0x17);
 	
     // Power optimization
-    EPD_2in7_SendCommand(0xF8);
-    EPD_2in7_SendData(0x60);
-    EPD_2in7_SendData(0xA5);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x60);
+    EPD_SendData(0xA5);
 	
     // Power optimization
-    EPD_2in7_SendCommand(0xF8);
-    EPD_2in7_SendData(0x89);
-    EPD_2in7_SendData(0xA5);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x89);
+    EPD_SendData(0xA5);
 		
     // Power optimization
-    EPD_2in7_SendCommand(0xF8);
-    EPD_2in7_SendData(0x90);
-    EPD_2in7_SendData(0x00);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x90);
+    EPD_SendData(0x00);
 		
     // Power optimization
-    EPD_2in7_SendCommand(0xF8);
-    EPD_2in7_SendData(0x93);
-    EPD_2in7_SendData(0x2A);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x93);
+    EPD_SendData(0x2A);
 		
     // Power optimization
-    EPD_2in7_SendCommand(0xF8);
-    EPD_2in7_SendData(0xA0);
-    EPD_2in7_SendData(0xA5);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0xA0);
+    EPD_SendData(0xA5);
 		
     // Power optimization
-    EPD_2in7_SendCommand(0xF8);
-    EPD_2in7_SendData(0xA1);
-    EPD_2in7_SendData(0x00);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0xA1);
+    EPD_SendData(0x00);
 		
     // Power optimization
-    EPD_2in7_SendCommand(0xF8);
-    EPD_2in7_SendData(0x73);
-    EPD_2in7_SendData(0x41);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x73);
+    EPD_SendData(0x41);
 		
-    EPD_2in7_SendCommand(0x16); // PARTIAL_DISPLAY_REFRESH
-    EPD_2in7_SendData(0x00);
+    EPD_SendCommand(0x16); // PARTIAL_DISPLAY_REFRESH
+    EPD_SendData(0x00);
 		
-    EPD_2in7_SendCommand(0x04); // POWER_ON
+    EPD_SendCommand(0x04); // POWER_ON
     EPD_2in7_ReadBusy();
 
-    EPD_2in7_SendCommand(0x00); // PANEL_SETTING
-    EPD_2in7_SendData(0xAF); // KW-BF   KWR-AF    BWROTP 0f
-    EPD_2in7_SendCommand(0x30); // PLL_CONTROL
-    EPD_2in7_SendData(0x3A); // 3A 100HZ   29 150Hz 39 200HZ    31 171HZ
-    EPD_2in7_SendCommand(0x82);  // VCM_DC_SETTING_REGISTER
-    EPD_2in7_SendData(0x12);
+    EPD_SendCommand(0x00); // PANEL_SETTING
+    EPD_SendData(0xAF); // KW-BF   KWR-AF    BWROTP 0f
+    EPD_SendCommand(0x30); // PLL_CONTROL
+    EPD_SendData(0x3A); // 3A 100HZ   29 150Hz 39 200HZ    31 171HZ
+    EPD_SendCommand(0x82);  // VCM_DC_SETTING_REGISTER
+    EPD_SendData(0x12);
 
     EPD_2in7_SetLut();
 }
@@ -387,69 +343,69 @@ void EPD_2IN7_Init(void)
 void EPD_2IN7_Init_4Gray(void)
 {
     EPD_2in7_Reset();
-    EPD_2in7_SendCommand(0x01);			//POWER SETTING
-    EPD_2in7_SendData (0x03);
-    EPD_2in7_SendData (0x00);    
-    EPD_2in7_SendData (0x2b);															 
-    EPD_2in7_SendData (0x2b);		
+    EPD_SendCommand(0x01);			//POWER SETTING
+    EPD_SendData (0x03);
+    EPD_SendData (0x00);    
+    EPD_SendData (0x2b);															 
+    EPD_SendData (0x2b);		
 
 
-    EPD_2in7_SendCommand(0x06);         //booster soft start
-    EPD_2in7_SendData (0x07);		//A
-    EPD_2in7_SendData (0x07);		//B
-    EPD_2in7_SendData (0x17);		//C 
+    EPD_SendCommand(0x06);         //booster soft start
+    EPD_SendData (0x07);		//A
+    EPD_SendData (0x07);		//B
+    EPD_SendData (0x17);		//C 
 
-    EPD_2in7_SendCommand(0xF8);         //boost??
-    EPD_2in7_SendData (0x60);
-    EPD_2in7_SendData (0xA5);
+    EPD_SendCommand(0xF8);         //boost??
+    EPD_SendData (0x60);
+    EPD_SendData (0xA5);
 
-    EPD_2in7_SendCommand(0xF8);         //boost??
-    EPD_2in7_SendData (0x89);
-    EPD_2in7_SendData (0xA5);
+    EPD_SendCommand(0xF8);         //boost??
+    EPD_SendData (0x89);
+    EPD_SendData (0xA5);
 
-    EPD_2in7_SendCommand(0xF8);         //boost??
-    EPD_2in7_SendData (0x90);
-    EPD_2in7_SendData (0x00);
+    EPD_SendCommand(0xF8);         //boost??
+    EPD_SendData (0x90);
+    EPD_SendData (0x00);
 
-    EPD_2in7_SendCommand(0xF8);         //boost??
-    EPD_2in7_SendData (0x93);
-    EPD_2in7_SendData (0x2A);
+    EPD_SendCommand(0xF8);         //boost??
+    EPD_SendData (0x93);
+    EPD_SendData (0x2A);
 
-    EPD_2in7_SendCommand(0xF8);         //boost??
-    EPD_2in7_SendData (0xa0);
-    EPD_2in7_SendData (0xa5);
+    EPD_SendCommand(0xF8);         //boost??
+    EPD_SendData (0xa0);
+    EPD_SendData (0xa5);
 
-    EPD_2in7_SendCommand(0xF8);         //boost??
-    EPD_2in7_SendData (0xa1);
-    EPD_2in7_SendData (0x00);
+    EPD_SendCommand(0xF8);         //boost??
+    EPD_SendData (0xa1);
+    EPD_SendData (0x00);
 
-    EPD_2in7_SendCommand(0xF8);         //boost??
-    EPD_2in7_SendData (0x73);
-    EPD_2in7_SendData (0x41);
+    EPD_SendCommand(0xF8);         //boost??
+    EPD_SendData (0x73);
+    EPD_SendData (0x41);
 
-    EPD_2in7_SendCommand(0x16);
-    EPD_2in7_SendData(0x00);	
+    EPD_SendCommand(0x16);
+    EPD_SendData(0x00);	
 
-    EPD_2in7_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_2in7_ReadBusy();
 
-    EPD_2in7_SendCommand(0x00);			//panel setting
-    EPD_2in7_SendData(0xbf);		//KW-BF   KWR-AF	BWROTP 0f
+    EPD_SendCommand(0x00);			//panel setting
+    EPD_SendData(0xbf);		//KW-BF   KWR-AF	BWROTP 0f
 
-    EPD_2in7_SendCommand(0x30);			//PLL setting
-    EPD_2in7_SendData (0x90);      	//100hz 
+    EPD_SendCommand(0x30);			//PLL setting
+    EPD_SendData (0x90);      	//100hz 
 
-    EPD_2in7_SendCommand(0x61);			//resolution setting
-    EPD_2in7_SendData (0x00);		//176
-    EPD_2in7_SendData (0xb0);     	 
-    EPD_2in7_SendData (0x01);		//264
-    EPD_2in7_SendData (0x08);
+    EPD_SendCommand(0x61);			//resolution setting
+    EPD_SendData (0x00);		//176
+    EPD_SendData (0xb0);     	 
+    EPD_SendData (0x01);		//264
+    EPD_SendData (0x08);
 
-    EPD_2in7_SendCommand(0x82);			//vcom_DC setting
-    EPD_2in7_SendData (0x12);
+    EPD_SendCommand(0x82);			//vcom_DC setting
+    EPD_SendData (0x12);
 
-    EPD_2in7_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING			
-    EPD_2in7_SendData(0x97);
+    EPD_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING			
+    EPD_SendData(0x97);
 }
 
 
@@ -464,21 +420,13 @@ void EPD_2IN7_Clear(void)
     Width = (EPD_2IN7_WIDTH % 8 == 0)? (EPD_2IN7_WIDTH / 8 ): (EPD_2IN7_WIDTH / 8 + 1);
     Height = EPD_2IN7_HEIGHT;
 
-    EPD_2in7_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2in7_SendData(0XFF);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0XFF, (UDOUBLE)Width * Height);
 
-    EPD_2in7_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2in7_SendData(0XFF);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0XFF, (UDOUBLE)Width * Height);
 		
-    EPD_2in7_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_2in7_ReadBusy();
 }
 
@@ -492,20 +440,12 @@ void EPD_2IN7_Display(const UBYTE *Image)
     Width = (EPD_2IN7_WIDTH % 8 == 0)? (EPD_2IN7_WIDTH / 8 ): (EPD_2IN7_WIDTH / 8 + 1);
     Height = EPD_2IN7_HEIGHT;
 
-    EPD_2in7_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2in7_SendData(0XFF);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0XFF, (UDOUBLE)Width * Height);
 
-    EPD_2in7_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2in7_SendData(Image[i + j * Width]);
-        }
-    }
-    EPD_2in7_SendCommand(0x12);
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x12);
     EPD_2in7_ReadBusy();
 }
 
@@ -514,7 +454,7 @@ void EPD_2IN7_4GrayDisplay(const UBYTE *Image)
     UDOUBLE i,j,k;
     UBYTE temp1,temp2,temp3;
 
-    EPD_2in7_SendCommand(0x10);	       
+    EPD_SendCommand(0x10);	       
     for(i=0;i<5808;i++)	               //5808*4  46464
     {
         temp3=0;
@@ -551,10 +491,10 @@ void EPD_2IN7_4GrayDisplay(const UBYTE *Image)
             }
             
          }
-        EPD_2in7_SendData(temp3);			
+        EPD_SendData(temp3);			
     }
     // new  data
-    EPD_2in7_SendCommand(0x13);	       
+    EPD_SendCommand(0x13);	       
     for(i=0;i<5808;i++)	               //5808*4  46464
     {
         temp3=0;
@@ -591,11 +531,11 @@ void EPD_2IN7_4GrayDisplay(const UBYTE *Image)
             }
             
          }
-        EPD_2in7_SendData(temp3);	
+        EPD_SendData(temp3);	
     }
     
     EPD_2in7_gray_SetLut();
-    EPD_2in7_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_Delay_ms(200);
     EPD_2in7_ReadBusy();
 }
@@ -607,11 +547,11 @@ parameter:
 ******************************************************************************/
 void EPD_2IN7_Sleep(void)
 {
-    EPD_2in7_SendCommand(0X50);
-    EPD_2in7_SendData(0xf7);
-    EPD_2in7_SendCommand(0X02);  	//power off
-    EPD_2in7_SendCommand(0X07);  	//deep sleep
-    EPD_2in7_SendData(0xA5);
+    EPD_SendCommand(0X50);
+    EPD_SendData(0xf7);
+    EPD_SendCommand(0X02);  	//power off
+    EPD_SendCommand(0X07);  	//deep sleep
+    EPD_SendData(0xA5);
 }
 
 #endif
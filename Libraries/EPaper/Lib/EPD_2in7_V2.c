@@ -69,32 +69,6 @@ static void EPD_2IN7_V2_Reset(void)
     EPD_Delay_ms(20);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN7_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN7_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -116,33 +90,33 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN7_V2_TurnOnDisplay(void)
 {
-	EPD_2IN7_V2_SendCommand(0x22); //Display Update Control
-	EPD_2IN7_V2_SendData(0xF7);
-	EPD_2IN7_V2_SendCommand(0x20); //Activate Display Update Sequence
+	EPD_SendCommand(0x22); //Display Update Control
+	EPD_SendData(0xF7);
+	EPD_SendCommand(0x20); //Activate Display Update Sequence
 	EPD_2IN7_V2_ReadBusy();
 }
 
 static void EPD_2IN7_V2_TurnOnDisplay_Fast(void)
 {
-	EPD_2IN7_V2_SendCommand(0x22); //Display Update Control
-	EPD_2IN7_V2_SendData(0xC7);
-	EPD_2IN7_V2_SendCommand(0x20); //Activate Display Update Sequence
+	EPD_SendCommand(0x22); //Display Update Control
+	EPD_SendData(0xC7);
+	EPD_SendCommand(0x20); //Activate Display Update Sequence
 	EPD_2IN7_V2_ReadBusy();
 }
 
 static void EPD_2IN7_V2_TurnOnDisplay_Partial(void)
 {
-	EPD_2IN7_V2_SendCommand(0x22);
-	EPD_2IN7_V2_SendData(0xFF);
-	EPD_2IN7_V2_SendCommand(0x20);
+	EPD_SendCommand(0x22);
+	EPD_SendData(0xFF);
+	EPD_SendCommand(0x20);
 	EPD_2IN7_V2_ReadBusy();
 }
 
 static void EPD_2IN7_V2_TurnOnDisplay_4GRAY(void)
 {
-	EPD_2IN7_V2_SendCommand(0x22);
-	EPD_2IN7_V2_SendData(0xC7);
-	EPD_2IN7_V2_SendCommand(0x20);
+	EPD_SendCommand(0x22);
+	EPD_SendData(0xC7);
+	EPD_SendCommand(0x20);
 	EPD_2IN7_V2_ReadBusy();
 }
 /******************************************************************************
@@ -151,11 +125,8 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN7_V2_Lut(void)
 {
-    unsigned int count;
-    EPD_2IN7_V2_SendCommand(0x32); //vcom
-    for(count = 0; count < 153; count++) {
-        EPD_2IN7_V2_SendData(LUT_DATA_4Gray[count]);
-    }
+    EPD_SendCommand(0x32); //vcom
+    EPD_SendDataArray(LUT_DATA_4Gray, 153);
 }
 
 
@@ -168,21 +139,21 @@ void EPD_2IN7_V2_Init(void)
     EPD_2IN7_V2_Reset();
     EPD_2IN7_V2_ReadBusy();
 
-    EPD_2IN7_V2_SendCommand(0x12); //SWRESET
+    EPD_SendCommand(0x12); //SWRESET
     EPD_2IN7_V2_ReadBusy();
 
-    EPD_2IN7_V2_SendCommand(0x45); //set Ram-Y address start/end position          
-    EPD_2IN7_V2_SendData(0x00);
-    EPD_2IN7_V2_SendData(0x00);
-    EPD_2IN7_V2_SendData(0x07); //0x0107-->(263+1)=264
-    EPD_2IN7_V2_SendData(0x01);
+    EPD_SendCommand(0x45); //set Ram-Y address start/end position          
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x07); //0x0107-->(263+1)=264
+    EPD_SendData(0x01);
 
-    EPD_2IN7_V2_SendCommand(0x4F);   // set RAM y address count to 0;    
-    EPD_2IN7_V2_SendData(0x00);
-    EPD_2IN7_V2_SendData(0x00);
+    EPD_SendCommand(0x4F);   // set RAM y address count to 0;    
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
 
-    EPD_2IN7_V2_SendCommand(0x11);   // data entry mode
-    EPD_2IN7_V2_SendData(0x03);
+    EPD_SendCommand(0x11);   // data entry mode
+    EPD_SendData(0x03);
 
 }
 void EPD_2IN7_V2_Init_Fast(void)
@@ -190,37 +161,37 @@ void EPD_2IN7_V2_Init_Fast(void)
 	EPD_2IN7_V2_Reset();
 	EPD_2IN7_V2_ReadBusy();
 
-	EPD_2IN7_V2_SendCommand(0x12); //SWRESET
+	EPD_SendCommand(0x12); //SWRESET
 	EPD_2IN7_V2_ReadBusy();
 
-	EPD_2IN7_V2_SendCommand(0x18); //Read built-in temperature sensor
-	EPD_2IN7_V2_SendData(0x80);	
+	EPD_SendCommand(0x18); //Read built-in temperature sensor
+	EPD_SendData(0x80);	
 
-	EPD_2IN7_V2_SendCommand(0x22); // Load temperature value
-	EPD_2IN7_V2_SendData(0xB1);		
-	EPD_2IN7_V2_SendCommand(0x20);	
+	EPD_SendCommand(0x22); // Load temperature value
+	EPD_SendData(0xB1);		
+	EPD_SendCommand(0x20);	
 	EPD_2IN7_V2_ReadBusy();
 
-	EPD_2IN7_V2_SendCommand(0x1A); // Write to temperature register
-	EPD_2IN7_V2_SendData(0x64);		
-	EPD_2IN7_V2_SendData(0x00);	
+	EPD_SendCommand(0x1A); // Write to temperature register
+	EPD_SendData(0x64);		
+	EPD_SendData(0x00);	
 
-	EPD_2IN7_V2_SendCommand(0x45); //set Ram-Y address start/end position          
-	EPD_2IN7_V2_SendData(0x00);   
-	EPD_2IN7_V2_SendData(0x00);
-	EPD_2IN7_V2_SendData(0x07); //0x0107-->(263+1)=264
-	EPD_2IN7_V2_SendData(0x01);
+	EPD_SendCommand(0x45); //set Ram-Y address start/end position          
+	EPD_SendData(0x00);   
+	EPD_SendData(0x00);
+	EPD_SendData(0x07); //0x0107-->(263+1)=264
+	EPD_SendData(0x01);
 
-	EPD_2IN7_V2_SendCommand(0x4F);   // set RAM y address count to 0;    
-	EPD_2IN7_V2_SendData(0x00);
-	EPD_2IN7_V2_SendData(0x00);
+	EPD_SendCommand(0x4F);   // set RAM y address count to 0;    
+	EPD_SendData(0x00);
+	EPD_SendData(0x00);
 
-	EPD_2IN7_V2_SendCommand(0x11);   // data entry mode      
-	EPD_2IN7_V2_SendData(0x03);
+	EPD_SendCommand(0x11);   // data entry mode      
+	EPD_SendData(0x03);
 							
-	EPD_2IN7_V2_SendCommand(0x22); // Load temperature value
-	EPD_2IN7_V2_SendData(0x91);		
-	EPD_2IN7_V2_SendCommand(0x20);	
+	EPD_SendCommand(0x22); // Load temperature value
+	EPD_SendData(0x91);		
+	EPD_SendCommand(0x20);	
 	EPD_2IN7_V2_ReadBusy(); 
 }
 void EPD_2IN7_V2_Init_4GRAY(void)
@@ -228,60 +199,60 @@ void EPD_2IN7_V2_Init_4GRAY(void)
 	EPD_2IN7_V2_Reset();
 
 	EPD_2IN7_V2_ReadBusy();
-	EPD_2IN7_V2_SendCommand(0x12); // soft reset
+	EPD_SendCommand(0x12); // soft reset
 	EPD_2IN7_V2_ReadBusy();
 
-	EPD_2IN7_V2_SendCommand(0x74); //set analog block control       
-	EPD_2IN7_V2_SendData(0x54);
-	EPD_2IN7_V2_SendCommand(0x7E); //set digital block control          
-	EPD_2IN7_V2_SendData(0x3B);
+	EPD_SendCommand(0x74); //set analog block control       
+	EPD_SendData(0x54);
+	EPD_SendCommand(0x7E); //set digital block control          
+	EPD_SendData(0x3B);
 
-	EPD_2IN7_V2_SendCommand(0x01); //Driver output control      
-	EPD_2IN7_V2_SendData(0x07);
-	EPD_2IN7_V2_SendData(0x01);
-	EPD_2IN7_V2_SendData(0x00);
+	EPD_SendCommand(0x01); //Driver output control      
+	EPD_SendData(0x07);
+	EPD_SendData(0x01);
+	EPD_SendData(0x00);
 
-	EPD_2IN7_V2_SendCommand(0x11); //data entry mode       
-	EPD_2IN7_V2_SendData(0x03);
+	EPD_SendCommand(0x11); //data entry mode       
+	EPD_SendData(0x03);
 
-	EPD_2IN7_V2_SendCommand(0x44); //set Ram-X address start/end position   
-	EPD_2IN7_V2_SendData(0x00);
-	EPD_2IN7_V2_SendData(0x15);    //0x15-->(21+1)*8=176
+	EPD_SendCommand(0x44); //set Ram-X address start/end position   
+	EPD_SendData(0x00);
+	EPD_SendData(0x15);    //0x15-->(21+1)*8=176
 
-	EPD_2IN7_V2_SendCommand(0x45); //set Ram-Y address start/end position          
-	EPD_2IN7_V2_SendData(0x00);
-	EPD_2IN7_V2_SendData(0x00);
-	EPD_2IN7_V2_SendData(0x07);//0x0107-->(263+1)=264
-	EPD_2IN7_V2_SendData(0x01);
+	EPD_SendCommand(0x45); //set Ram-Y address start/end position          
+	EPD_SendData(0x00);
+	EPD_SendData(0x00);
+	EPD_SendData(0x07);//0x0107-->(263+1)=264
+	EPD_SendData(0x01);
 
 
-	EPD_2IN7_V2_SendCommand(0x3C); //BorderWavefrom
-	EPD_2IN7_V2_SendData(0x00);	
+	EPD_SendCommand(0x3C); //BorderWavefrom
+	EPD_SendData(0x00);	
 
 
-	EPD_2IN7_V2_SendCommand(0x2C);     //VCOM Voltage
-	EPD_2IN7_V2_SendData(LUT_DATA_4Gray[158]);    //0x1C
+	EPD_SendCommand(0x2C);     //VCOM Voltage
+	EPD_SendData(LUT_DATA_4Gray[158]);    //0x1C
 
 
-	EPD_2IN7_V2_SendCommand(0x3F); //EOPQ    
-	EPD_2IN7_V2_SendData(LUT_DATA_4Gray[153]);
+	EPD_SendCommand(0x3F); //EOPQ    
+	EPD_SendData(LUT_DATA_4Gray[153]);
 	
-	EPD_2IN7_V2_SendCommand(0x03); //VGH      
-	EPD_2IN7_V2_SendData(LUT_DATA_4Gray[154]);
+	EPD_SendCommand(0x03); //VGH      
+	EPD_SendData(LUT_DATA_4Gray[154]);
 
-	EPD_2IN7_V2_SendCommand(0x04); //      
-	EPD_2IN7_V2_SendData(LUT_DATA_4Gray[155]); //VSH1   
-	EPD_2IN7_V2_SendData(LUT_DATA_4Gray[156]); //VSH2   
-	EPD_2IN7_V2_SendData(LUT_DATA_4Gray[157]); //VSL   
+	EPD_SendCommand(0x04); //      
+	EPD_SendData(LUT_DATA_4Gray[155]); //VSH1   
+	EPD_SendData(LUT_DATA_4Gray[156]); //VSH2   
+	EPD_SendData(LUT_DATA_4Gray[157]); //VSL   
    
 	EPD_2IN7_V2_Lut(); //LUT
 
 	
-	EPD_2IN7_V2_SendCommand(0x4E);   // set RAM x address count to 0;
-	EPD_2IN7_V2_SendData(0x00);
-	EPD_2IN7_V2_SendCommand(0x4F);   // set RAM y address count to 0X199;    
-	EPD_2IN7_V2_SendData(0x00);
-	EPD_2IN7_V2_SendData(0x00);
+	EPD_SendCommand(0x4E);   // set RAM x address count to 0;
+	EPD_SendData(0x00);
+	EPD_SendCommand(0x4F);   // set RAM y address count to 0X199;    
+	EPD_SendData(0x00);
+	EPD_SendData(0x00);
   EPD_2IN7_V2_ReadBusy();
 }
 
@@ -295,12 +266,8 @@ void EPD_2IN7_V2_Clear(void)
     Width = (EPD_2IN7_V2_WIDTH % 8 == 0)? (EPD_2IN7_V2_WIDTH / 8 ): (EPD_2IN7_V2_WIDTH / 8 + 1);
     Height = EPD_2IN7_V2_HEIGHT;
 
-    EPD_2IN7_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7_V2_SendData(0XFF);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0XFF, (UDOUBLE)Width * Height);
 
 	EPD_2IN7_V2_TurnOnDisplay();
 }
@@ -315,12 +282,8 @@ void EPD_2IN7_V2_Display(UBYTE *Image)
 	Width = (EPD_2IN7_V2_WIDTH % 8 == 0)? (EPD_2IN7_V2_WIDTH / 8 ): (EPD_2IN7_V2_WIDTH / 8 + 1);
 	Height = EPD_2IN7_V2_HEIGHT;
 
-	EPD_2IN7_V2_SendCommand(0x24);
-	for (UWORD j = 0; j < Height; j++) {
-			for (UWORD i = 0; i < Width; i++) {
-					EPD_2IN7_V2_SendData(Image[i + j * Width]);
-			}
-	}
+	EPD_SendCommand(0x24);
+	EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 
 	EPD_2IN7_V2_TurnOnDisplay();
 }
@@ -331,12 +294,8 @@ void EPD_2IN7_V2_Display_Fast(UBYTE *Image)
 	Width = (EPD_2IN7_V2_WIDTH % 8 == 0)? (EPD_2IN7_V2_WIDTH / 8 ): (EPD_2IN7_V2_WIDTH / 8 + 1);
 	Height = EPD_2IN7_V2_HEIGHT;
 
-	EPD_2IN7_V2_SendCommand(0x24);
-	for (UWORD j = 0; j < Height; j++) {
-			for (UWORD i = 0; i < Width; i++) {
-					EPD_2IN7_V2_SendData(Image[i + j * Width]);
-			}
-	}
+	EPD_SendCommand(0x24);
+	EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 	EPD_2IN7_V2_TurnOnDisplay_Fast();
 }
 
@@ -346,18 +305,10 @@ void EPD_2IN7_V2_Display_Base(UBYTE *Image)
 	Width = (EPD_2IN7_V2_WIDTH % 8 == 0)? (EPD_2IN7_V2_WIDTH / 8 ): (EPD_2IN7_V2_WIDTH / 8 + 1);
 	Height = EPD_2IN7_V2_HEIGHT;
 
-	EPD_2IN7_V2_SendCommand(0x24);   //Write Black and White image to RAM
-	for (UWORD j = 0; j < Height; j++) {
-			for (UWORD i = 0; i < Width; i++) {
-					EPD_2IN7_V2_SendData(Image[i + j * Width]);
-			}
-	}
-	EPD_2IN7_V2_SendCommand(0x26);   //Write Black and White image to RAM
-	for (UWORD j = 0; j < Height; j++) {
-			for (UWORD i = 0; i < Width; i++) {
-					EPD_2IN7_V2_SendData(Image[i + j * Width]);
-			}
-	}
+	EPD_SendCommand(0x24);   //Write Black and White image to RAM
+	EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
+	EPD_SendCommand(0x26);   //Write Black and White image to RAM
+	EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 	EPD_2IN7_V2_TurnOnDisplay();	
 }
 
@@ -367,18 +318,10 @@ void EPD_2IN7_V2_Display_Base_color(UBYTE color)
 	Width = (EPD_2IN7_V2_WIDTH % 8 == 0)? (EPD_2IN7_V2_WIDTH / 8 ): (EPD_2IN7_V2_WIDTH / 8 + 1);
 	Height = EPD_2IN7_V2_HEIGHT;
 
-	EPD_2IN7_V2_SendCommand(0x24);   //Write Black and White image to RAM
-	for (UWORD j = 0; j < Height; j++) {
-			for (UWORD i = 0; i < Width; i++) {
-					EPD_2IN7_V2_SendData(color);
-			}
-	}
-	EPD_2IN7_V2_SendCommand(0x26);   //Write Black and White image to RAM
-	for (UWORD j = 0; j < Height; j++) {
-			for (UWORD i = 0; i < Width; i++) {
-					EPD_2IN7_V2_SendData(color);
-			}
-	}
+	EPD_SendCommand(0x24);   //Write Black and White image to RAM
+	EPD_SendDataBurst(color, (UDOUBLE)Width * Height);
+	EPD_SendCommand(0x26);   //Write Black and White image to RAM
+	EPD_SendDataBurst(color, (UDOUBLE)Width * Height);
 	// EPD_2IN7_V2_TurnOnDisplay();	
 }
 
@@ -396,7 +339,7 @@ void EPD_2IN7_V2_Display_Partial(const UBYTE *Image, UWORD Xstart, UWORD Ystart,
 	}
 
 
-	UWORD i, Width;
+	UWORD Width;
 	Width = Xend -  Xstart;
 	UWORD IMAGE_COUNTER = Width * (Yend-Ystart);
 
@@ -405,29 +348,27 @@ void EPD_2IN7_V2_Display_Partial(const UBYTE *Image, UWORD Xstart, UWORD Ystart,
 	//Reset
 	EPD_2IN7_V2_Reset();
 
-	EPD_2IN7_V2_SendCommand(0x3C); //BorderWavefrom
-	EPD_2IN7_V2_SendData(0x80);	
+	EPD_SendCommand(0x3C); //BorderWavefrom
+	EPD_SendData(0x80);	
 	//	
-	EPD_2IN7_V2_SendCommand(0x44);       // set RAM x address start/end, in page 35
-	EPD_2IN7_V2_SendData(Xstart & 0xff);    // RAM x address start at 00h;
-	EPD_2IN7_V2_SendData(Xend & 0xff);    // RAM x address end at 0fh(15+1)*8->128 
-	EPD_2IN7_V2_SendCommand(0x45);       // set RAM y address start/end, in page 35
-	EPD_2IN7_V2_SendData(Ystart & 0xff);    // RAM y address start at 0127h;
-	EPD_2IN7_V2_SendData((Ystart>>8) & 0x01);    // RAM y address start at 0127h;
-	EPD_2IN7_V2_SendData(Yend & 0xff);    // RAM y address end at 00h;
-	EPD_2IN7_V2_SendData((Yend>>8) & 0x01); 
-
-	EPD_2IN7_V2_SendCommand(0x4E);   // set RAM x address count to 0;
-	EPD_2IN7_V2_SendData(Xstart & 0xff); 
-	EPD_2IN7_V2_SendCommand(0x4F);   // set RAM y address count to 0X127;    
-	EPD_2IN7_V2_SendData(Ystart & 0xff);
-	EPD_2IN7_V2_SendData((Ystart>>8) & 0x01);
-
-
-	EPD_2IN7_V2_SendCommand(0x24);   //Write Black and White image to RAM
-	for (i = 0; i < IMAGE_COUNTER; i++) {
-		EPD_2IN7_V2_SendData(Image[i]);
-	}
+	EPD_SendCommand(0x44);       // set RAM x address start/end, in page 35
+	EPD_SendData(Xstart & 0xff);    // RAM x address start at 00h;
+	EPD_SendData(Xend & 0xff);    // RAM x address end at 0fh(15+1)*8->128 
+	EPD_SendCommand(0x45);       // set RAM y address start/end, in page 35
+	EPD_SendData(Ystart & 0xff);    // RAM y address start at 0127h;
+	EPD_SendData((Ystart>>8) & 0x01);    // RAM y address start at 0127h;
+	EPD_SendData(Yend & 0xff);    // RAM y address end at 00h;
+	EPD_SendData((Yend>>8) & 0x01); 
+
+	EPD_SendCommand(0x4E);   // set RAM x address count to 0;
+	EPD_SendData(Xstart & 0xff); 
+	EPD_SendCommand(0x4F);   // set RAM y address count to 0X127;    
+	EPD_SendData(Ystart & 0xff);
+	EPD_SendData((Ystart>>8) & 0x01);
+
+
+	EPD_SendCommand(0x24);   //Write Black and White image to RAM
+	EPD_SendDataArray(Image, IMAGE_COUNTER);
 	EPD_2IN7_V2_TurnOnDisplay_Partial();
 }
 
@@ -438,7 +379,7 @@ void EPD_2IN7_V2_4GrayDisplay(UBYTE *Image)
     UBYTE temp1,temp2,temp3;
 
     // old  data
-    EPD_2IN7_V2_SendCommand(0x24);
+    EPD_SendCommand(0x24);
     for(i=0; i<5808; i++) {             //5808*4  46464
         temp3=0;
         for(j=0; j<2; j++) {
@@ -472,11 +413,11 @@ void EPD_2IN7_V2_4GrayDisplay(UBYTE *Image)
             }
 
         }
-        EPD_2IN7_V2_SendData(temp3);
+        EPD_SendData(temp3);
         // printf("%x",temp3);
     }
 
-    EPD_2IN7_V2_SendCommand(0x26);   //write RAM for black(0)/white (1)
+    EPD_SendCommand(0x26);   //write RAM for black(0)/white (1)
     for(i=0; i<5808; i++) {             //5808*4  46464
         temp3=0;
         for(j=0; j<2; j++) {
@@ -509,7 +450,7 @@ void EPD_2IN7_V2_4GrayDisplay(UBYTE *Image)
                 temp1 <<= 2;
             }
         }
-        EPD_2IN7_V2_SendData(temp3);
+        EPD_SendData(temp3);
         // printf("%x",temp3);
     }
 
@@ -522,8 +463,8 @@ parameter:
 ******************************************************************************/
 void EPD_2IN7_V2_Sleep(void)
 {
-    EPD_2IN7_V2_SendCommand(0X10);
-    EPD_2IN7_V2_SendData(0x01);
+    EPD_SendCommand(0X10);
+    EPD_SendData(0x01);
 }
 
 #endif
@@ -159,32 +159,6 @@ static void EPD_2IN7B_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN7B_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN7B_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -204,31 +178,20 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN7B_SetLut(void)
 {
-    unsigned int count;     
-    EPD_2IN7B_SendCommand(0x20); //vcom
-    for(count = 0; count < 44; count++) {
-        EPD_2IN7B_SendData(EPD_2IN7B_lut_vcom_dc[count]);
-    }
+    EPD_SendCommand(0x20); //vcom
+    EPD_SendDataArray(EPD_2IN7B_lut_vcom_dc, 44);
     
-    EPD_2IN7B_SendCommand(0x21); //ww --
-    for(count = 0; count < 42; count++) {
-        EPD_2IN7B_SendData(EPD_2IN7B_lut_ww[count]);
-    }   
+    EPD_SendCommand(0x21); //ww --
+    EPD_SendDataArray(EPD_2IN7B_lut_ww, 42);   
     
-    EPD_2IN7B_SendCommand(0x22); //bw r
-    for(count = 0; count < 42; count++) {
-        EPD_2IN7B_SendData(EPD_2IN7B_lut_bw[count]);
-    } 
+    EPD_SendCommand(0x22); //bw r
+    EPD_SendDataArray(EPD_2IN7B_lut_bw, 42); 
 
-    EPD_2IN7B_SendCommand(0x23); //wb w
-    for(count = 0; count < 42; count++) {
-        EPD_2IN7B_SendData(EPD_2IN7B_lut_bb[count]);
-    } 
+    EPD_SendCommand(0x23); //wb w
+    EPD_SendDataArray(EPD_2IN7B_lut_bb, 42); 
 
-    EPD_2IN7B_SendCommand(0x24); //bb b
-    for(count = 0; count < 42; count++) {
-        EPD_2IN7B_SendData(EPD_2IN7B_lut_wb[count]);
-    } 
+    EPD_SendCommand(0x24); //bb b
+    EPD_SendDataArray(EPD_2IN7B_lut_wb, 42); 
 }
 
 /******************************************************************************
@@ -239,61 +202,61 @@ void EPD_2IN7B_Init(void)
 {
     EPD_2IN7B_Reset();
 
-    EPD_2IN7B_SendCommand(0x04); // POWER_ON
+    EPD_SendCommand(0x04); // POWER_ON
     EPD_2IN7B_ReadBusy();
 
-    EPD_2IN7B_SendCommand(0x00); // PANEL_SETTING
-    EPD_2IN7B_SendData(0xaf); // KW-BF   KWR-AF BWROTP 0f
+    EPD_SendCommand(0x00); // PANEL_SETTING
+    EPD_SendData(0xaf); // KW-BF   KWR-AF BWROTP 0f
 
-    EPD_2IN7B_SendCommand(0x30); // PLL_CONTROL
-    EPD_2IN7B_SendData(0x3a); //3A 100HZ   29 150Hz 39 200HZ    31 171HZ
+    EPD_SendCommand(0x30); // PLL_CONTROL
+    EPD_SendData(0x3a); //3A 100HZ   29 150Hz 39 200HZ    31 171HZ
 
-    EPD_2IN7B_SendCommand(0x01); // PANEL_SETTING
-    EPD_2IN7B_SendData(0x03); // VDS_EN, VDG_EN
-    EPD_2IN7B_SendData(0x00); // VCOM_HV, VGHL_LV[1], VGHL_LV[0]
-    EPD_2IN7B_SendData(0x2b); // VDH
-    EPD_2IN7B_SendData(0x2b); // VDL
-    EPD_2IN7B_SendData(0x09); // VDHR
+    EPD_SendCommand(0x01); // PANEL_SETTING
+    EPD_SendData(0x03); // VDS_EN, VDG_EN
+    EPD_SendData(0x00); // VCOM_HV, VGHL_LV[1], VGHL_LV[0]
+    EPD_SendData(0x2b); // VDH
+    EPD_SendData(0x2b); // VDL
+    EPD_SendData(0x09); // VDHR
 
-    EPD_2IN7B_SendCommand(0x06);  // BOOSTER_SOFT_START
-    EPD_2IN7B_SendData(0x07);
-    EPD_2IN7B_SendData(0x07);
-    EPD_2IN7B_SendData(0x17);
+    EPD_SendCommand(0x06);  // BOOSTER_SOFT_START
+    EPD_SendData(0x07);
+    EPD_SendData(0x07);
+    EPD_SendData(0x17);
 
     // Power optimization
-    EPD_2IN7B_SendCommand(0xF8);
-    EPD_2IN7B_SendData(0x60);
-    EPD_2IN7B_SendData(0xA5);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x60);
+    EPD_SendData(0xA5);
 
     // Power optimization
-    EPD_2IN7B_SendCommand(0xF8);
-    EPD_2IN7B_SendData(0x89);
-    EPD_2IN7B_SendData(0xA5);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x89);
+    EPD_SendData(0xA5);
 
     // Power optimization
-    EPD_2IN7B_SendCommand(0xF8);
-    EPD_2IN7B_SendData(0x90);
-    EPD_2IN7B_SendData(0x00);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x90);
+    EPD_SendData(0x00);
 
     // Power optimization
-    EPD_2IN7B_SendCommand(0xF8);
-    EPD_2IN7B_SendData(0x93);
-    EPD_2IN7B_SendData(0x2A);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x93);
+    EPD_SendData(0x2A);
 
     // Power optimization
-    EPD_2IN7B_SendCommand(0xF8);
-    EPD_2IN7B_SendData(0x73);
-    EPD_2IN7B_SendData(0x41);
+    EPD_SendCommand(0xF8);
+    EPD_SendData(0x73);
+    EPD_SendData(0x41);
 
-    EPD_2IN7B_SendCommand(0x82); // VCM_DC_SETTING_REGISTER
-    EPD_2IN7B_SendData(0x12);
-    EPD_2IN7B_SendCommand(0x50); // VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_2IN7B_SendData(0x87); // define by OTP
+    EPD_SendCommand(0x82); // VCM_DC_SETTING_REGISTER
+    EPD_SendData(0x12);
+    EPD_SendCommand(0x50); // VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SendData(0x87); // define by OTP
 
     EPD_2IN7B_SetLut();
 
-    EPD_2IN7B_SendCommand(0x16); // PARTIAL_DISPLAY_REFRESH
-    EPD_2IN7B_SendData(0x00);
+    EPD_SendCommand(0x16); // PARTIAL_DISPLAY_REFRESH
+    EPD_SendData(0x00);
 }
 
 /******************************************************************************
@@ -306,23 +269,15 @@ void EPD_2IN7B_Clear(void)
     Width = (EPD_2IN7B_WIDTH % 8 == 0)? (EPD_2IN7B_WIDTH / 8 ): (EPD_2IN7B_WIDTH / 8 + 1);
     Height = EPD_2IN7B_HEIGHT;
 
-    EPD_2IN7B_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7B_SendData(0X00);
-        }
-    }
-    EPD_2IN7B_SendCommand(0x11); // DATA_STOP
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0X00, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x11); // DATA_STOP
 
-    EPD_2IN7B_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7B_SendData(0X00);
-        }
-    }
-    EPD_2IN7B_SendCommand(0x11); // DATA_STOP
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0X00, (UDOUBLE)Width * Height);
+    EPD_SendCommand(0x11); // DATA_STOP
     
-    EPD_2IN7B_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_2IN7B_ReadBusy();
 }
 
@@ -336,23 +291,23 @@ void EPD_2IN7B_Display(UBYTE *Imageblack, UBYTE *Imagered)
     Width = (EPD_2IN7B_WIDTH % 8 == 0)? (EPD_2IN7B_WIDTH / 8 ): (EPD_2IN7B_WIDTH / 8 + 1);
     Height = EPD_2IN7B_HEIGHT;
     
-    EPD_2IN7B_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (UWORD j = 0; j < Height; j++) {
         for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7B_SendData(~Imageblack[i + j * Width]);
+            EPD_SendData(~Imageblack[i + j * Width]);
         }
     }
-    EPD_2IN7B_SendCommand(0x11); // DATA_STOP
+    EPD_SendCommand(0x11); // DATA_STOP
     
-    EPD_2IN7B_SendCommand(0x13);
+    EPD_SendCommand(0x13);
     for (UWORD j = 0; j < Height; j++) {
         for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7B_SendData(~Imagered[i + j * Width]);
+            EPD_SendData(~Imagered[i + j * Width]);
         }
     }
-    EPD_2IN7B_SendCommand(0x11); // DATA_STOP
+    EPD_SendCommand(0x11); // DATA_STOP
     
-    EPD_2IN7B_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_2IN7B_ReadBusy();
 }
 
@@ -362,11 +317,11 @@ parameter:
 ******************************************************************************/
 void EPD_2IN7B_Sleep(void)
 {
-    EPD_2IN7B_SendCommand(0X50);
-    EPD_2IN7B_SendData(0xf7);
-    EPD_2IN7B_SendCommand(0X02); //power off
-    EPD_2IN7B_SendCommand(0X07); //deep sleep
-    EPD_2IN7B_SendData(0xA5);
+    EPD_SendCommand(0X50);
+    EPD_SendData(0xf7);
+    EPD_SendCommand(0X02); //power off
+    EPD_SendCommand(0X07); //deep sleep
+    EPD_SendData(0xA5);
 }
 
 #endif
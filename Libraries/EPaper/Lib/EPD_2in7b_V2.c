@@ -46,32 +46,6 @@ static void EPD_2IN7B_V2_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN7B_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN7B_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -87,7 +61,7 @@ static void EPD_2IN7B_V2_ReadBusy(void)
 
 static void EPD_2IN7B_V2_TurnOnDisplay(void)
 {
-	EPD_2IN7B_V2_SendCommand(0x20); 
+	EPD_SendCommand(0x20); 
 	EPD_2IN7B_V2_ReadBusy();
 }
 
@@ -97,15 +71,15 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN7B_V2_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    EPD_2IN7B_V2_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_2IN7B_V2_SendData((Xstart>>3) & 0xFF);
-    EPD_2IN7B_V2_SendData((Xend>>3) & 0xFF);
+    EPD_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
+    EPD_SendData((Xstart>>3) & 0xFF);
+    EPD_SendData((Xend>>3) & 0xFF);
 	
-    EPD_2IN7B_V2_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
-    EPD_2IN7B_V2_SendData(Ystart & 0xFF);
-    EPD_2IN7B_V2_SendData((Ystart >> 8) & 0xFF);
-    EPD_2IN7B_V2_SendData(Yend & 0xFF);
-    EPD_2IN7B_V2_SendData((Yend >> 8) & 0xFF);
+    EPD_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendData(Yend & 0xFF);
+    EPD_SendData((Yend >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -114,12 +88,12 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN7B_V2_SetCursor(UWORD Xstart, UWORD Ystart)
 {
-    EPD_2IN7B_V2_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_2IN7B_V2_SendData(Xstart & 0xFF);
+    EPD_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
+    EPD_SendData(Xstart & 0xFF);
 
-    EPD_2IN7B_V2_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
-    EPD_2IN7B_V2_SendData(Ystart & 0xFF);
-    EPD_2IN7B_V2_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -131,16 +105,16 @@ void EPD_2IN7B_V2_Init(void)
 	EPD_2IN7B_V2_Reset();
 
 	EPD_2IN7B_V2_ReadBusy();
-	EPD_2IN7B_V2_SendCommand(0x12);    
+	EPD_SendCommand(0x12);    
 	EPD_2IN7B_V2_ReadBusy();
 	
-	EPD_2IN7B_V2_SendCommand(0x00);    
-	EPD_2IN7B_V2_SendData(0x27);
-	EPD_2IN7B_V2_SendData(0x01);
-	EPD_2IN7B_V2_SendData(0x00);
+	EPD_SendCommand(0x00);    
+	EPD_SendData(0x27);
+	EPD_SendData(0x01);
+	EPD_SendData(0x00);
 	
-	EPD_2IN7B_V2_SendCommand(0x11);    
-	EPD_2IN7B_V2_SendData(0x03);
+	EPD_SendCommand(0x11);    
+	EPD_SendData(0x03);
 
 	EPD_2IN7B_V2_SetWindows(0, 0, EPD_2IN7B_V2_WIDTH-1, EPD_2IN7B_V2_HEIGHT-1);
 	EPD_2IN7B_V2_SetCursor(0, 0);
@@ -156,19 +130,11 @@ void EPD_2IN7B_V2_Clear(void)
     Width = (EPD_2IN7B_V2_WIDTH % 8 == 0)? (EPD_2IN7B_V2_WIDTH / 8 ): (EPD_2IN7B_V2_WIDTH / 8 + 1);
     Height = EPD_2IN7B_V2_HEIGHT;
 
-    EPD_2IN7B_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7B_V2_SendData(0Xff);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0Xff, (UDOUBLE)Width * Height);
 
-    EPD_2IN7B_V2_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7B_V2_SendData(0X00);
-        }
-    }
+    EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0X00, (UDOUBLE)Width * Height);
 
 	EPD_2IN7B_V2_TurnOnDisplay();
 }
@@ -183,17 +149,13 @@ void EPD_2IN7B_V2_Display(UBYTE *Imageblack, UBYTE *Imagered)
     Width = (EPD_2IN7B_V2_WIDTH % 8 == 0)? (EPD_2IN7B_V2_WIDTH / 8 ): (EPD_2IN7B_V2_WIDTH / 8 + 1);
     Height = EPD_2IN7B_V2_HEIGHT;
 
-    EPD_2IN7B_V2_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7B_V2_SendData(Imageblack[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(Imageblack, (UDOUBLE)Width * Height);
     
-    EPD_2IN7B_V2_SendCommand(0x26);
+    EPD_SendCommand(0x26);
     for (UWORD j = 0; j < Height; j++) {
         for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN7B_V2_SendData(~Imagered[i + j * Width]);
+            EPD_SendData(~Imagered[i + j * Width]);
         }
     }
 
@@ -206,8 +168,8 @@ parameter:
 ******************************************************************************/
 void EPD_2IN7B_V2_Sleep(void)
 {
-  	EPD_2IN7B_V2_SendCommand(0x10);  // Deep sleep
-  	EPD_2IN7B_V2_SendData(0x01);
+  	EPD_SendCommand(0x10);  // Deep sleep
+  	EPD_SendData(0x01);
 }
 
 #endif
@@ -110,32 +110,6 @@ static void EPD_2IN9_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN9_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN9_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -155,15 +129,15 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN9_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    EPD_2IN9_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_2IN9_SendData((Xstart >> 3) & 0xFF);
-    EPD_2IN9_SendData((Xend >> 3) & 0xFF);
+    EPD_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
+    EPD_SendData((Xstart >> 3) & 0xFF);
+    EPD_SendData((Xend >> 3) & 0xFF);
 
-    EPD_2IN9_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
-    EPD_2IN9_SendData(Ystart & 0xFF);
-    EPD_2IN9_SendData((Ystart >> 8) & 0xFF);
-    EPD_2IN9_SendData(Yend & 0xFF);
-    EPD_2IN9_SendData((Yend >> 8) & 0xFF);
+    EPD_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendData(Yend & 0xFF);
+    EPD_SendData((Yend >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -172,12 +146,12 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN9_SetCursor(UWORD Xstart, UWORD Ystart)
 {
-    EPD_2IN9_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_2IN9_SendData((Xstart >> 3) & 0xFF);
+    EPD_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
+    EPD_SendData((Xstart >> 3) & 0xFF);
 
-    EPD_2IN9_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
-    EPD_2IN9_SendData(Ystart & 0xFF);
-    EPD_2IN9_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -186,10 +160,10 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN9_TurnOnDisplay(void)
 {
-    EPD_2IN9_SendCommand(0x22); // DISPLAY_UPDATE_CONTROL_2
-    EPD_2IN9_SendData(0xC4);
-    EPD_2IN9_SendCommand(0x20); // MASTER_ACTIVATION
-    EPD_2IN9_SendCommand(0xFF); // TERMINATE_FRAME_READ_WRITE
+    EPD_SendCommand(0x22); // DISPLAY_UPDATE_CONTROL_2
+    EPD_SendData(0xC4);
+    EPD_SendCommand(0x20); // MASTER_ACTIVATION
+    EPD_SendCommand(0xFF); // TERMINATE_FRAME_READ_WRITE
 
     EPD_2IN9_ReadBusy();
 }
@@ -202,40 +176,36 @@ void EPD_2IN9_Init(UBYTE Mode)
 {
     EPD_2IN9_Reset();
 
-    EPD_2IN9_SendCommand(0x01); // DRIVER_OUTPUT_CONTROL
-    EPD_2IN9_SendData((EPD_2IN9_HEIGHT - 1) & 0xFF);
-    EPD_2IN9_SendData(((EPD_2IN9_HEIGHT - 1) >> 8) & 0xFF);
-    EPD_2IN9_SendData(0x00); // GD = 0; SM = 0; TB = 0;
+    EPD_SendCommand(0x01); // DRIVER_OUTPUT_CONTROL
+    EPD_SendData((EPD_2IN9_HEIGHT - 1) & 0xFF);
+    EPD_SendData(((EPD_2IN9_HEIGHT - 1) >> 8) & 0xFF);
+    EPD_SendData(0x00); // GD = 0; SM = 0; TB = 0;
 	
-    EPD_2IN9_SendCommand(0x0C); // BOOSTER_SOFT_START_CONTROL
-    EPD_2IN9_SendData(0xD7);
-    EPD_2IN9_SendData(0xD6);
-    EPD_2IN9_SendData(0x9D);
+    EPD_SendCommand(0x0C); // BOOSTER_SOFT_START_CONTROL
+    EPD_SendData(0xD7);
+    EPD_SendData(0xD6);
+    EPD_SendData(0x9D);
 	
-    EPD_2IN9_SendCommand(0x2C); // WRITE_VCOM_REGISTER
-    EPD_2IN9_SendData(0xA8); // VCOM 7C
+    EPD_SendCommand(0x2C); // WRITE_VCOM_REGISTER
+    EPD_SendData(0xA8); // VCOM 7C
 	
-    EPD_2IN9_SendCommand(0x3A); // SET_DUMMY_LINE_PERIOD
-    EPD_2IN9_SendData(0x1A); // 4 dummy lines per gate
+    EPD_SendCommand(0x3A); // SET_DUMMY_LINE_PERIOD
+    EPD_SendData(0x1A); // 4 dummy lines per gate
 	
-    EPD_2IN9_SendCommand(0x3B); // SET_GATE_TIME
-    EPD_2IN9_SendData(0x08); // 2us per line
+    EPD_SendCommand(0x3B); // SET_GATE_TIME
+    EPD_SendData(0x08); // 2us per line
 	
-    EPD_2IN9_SendCommand(0x3C); // BORDER_WAVEFORM_CONTROL
-    EPD_2IN9_SendData(0x03);                     
-    EPD_2IN9_SendCommand(0x11); // DATA_ENTRY_MODE_SETTING
-    EPD_2IN9_SendData(0x03);
+    EPD_SendCommand(0x3C); // BORDER_WAVEFORM_CONTROL
+    EPD_SendData(0x03);                     
+    EPD_SendCommand(0x11); // DATA_ENTRY_MODE_SETTING
+    EPD_SendData(0x03);
 
     //set the look-up table register
-    EPD_2IN9_SendCommand(0x32); // WRITE_LUT_REGISTER
+    EPD_SendCommand(0x32); // WRITE_LUT_REGISTER
     if(Mode == EPD_2IN9_FULL){
-        for (UWORD i = 0; i < 30; i++) {
-                EPD_2IN9_SendData(EPD_2IN9_lut_full_update[i]);
-        }
+        EPD_SendDataArray(EPD_2IN9_lut_full_update, 30);
     }else if(Mode == EPD_2IN9_PART){
-        for (UWORD i = 0; i < 30; i++) {
-                EPD_2IN9_SendData(EPD_2IN9_lut_partial_update[i]);
-        }
+        EPD_SendDataArray(EPD_2IN9_lut_partial_update, 30);
     }else{
         EPD_Printf("error, the Mode is EPD_2IN9_FULL or EPD_2IN9_PART");
     }
@@ -253,10 +223,8 @@ void EPD_2IN9_Clear(void)
     EPD_2IN9_SetWindows(0, 0, EPD_2IN9_WIDTH, EPD_2IN9_HEIGHT);
     for (UWORD j = 0; j < Height; j++) {
         EPD_2IN9_SetCursor(0, j);
-        EPD_2IN9_SendCommand(0x24);
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9_SendData(0XFF);
-        }
+        EPD_SendCommand(0x24);
+        EPD_SendDataBurst(0XFF, Width);
     }
     EPD_2IN9_TurnOnDisplay();
 }
@@ -271,16 +239,12 @@ void EPD_2IN9_Display(UBYTE *Image)
     Width = (EPD_2IN9_WIDTH % 8 == 0)? (EPD_2IN9_WIDTH / 8 ): (EPD_2IN9_WIDTH / 8 + 1);
     Height = EPD_2IN9_HEIGHT;
 
-    UDOUBLE Addr = 0;
     // UDOUBLE Offset = ImageName;
     EPD_2IN9_SetWindows(0, 0, EPD_2IN9_WIDTH, EPD_2IN9_HEIGHT);
     for (UWORD j = 0; j < Height; j++) {
         EPD_2IN9_SetCursor(0, j);
-        EPD_2IN9_SendCommand(0x24);
-        for (UWORD i = 0; i < Width; i++) {
-            Addr = i + j * Width;
-            EPD_2IN9_SendData(Image[Addr]);
-        }
+        EPD_SendCommand(0x24);
+        EPD_SendDataArray(Image + j * Width, Width);
     }
     EPD_2IN9_TurnOnDisplay();
 }
@@ -291,8 +255,8 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9_Sleep(void)
 {
-    EPD_2IN9_SendCommand(0x10);
-    EPD_2IN9_SendData(0x01);
+    EPD_SendCommand(0x10);
+    EPD_SendData(0x01);
     // EPD_2IN9_ReadBusy();
 }
 
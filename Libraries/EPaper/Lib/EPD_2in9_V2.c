@@ -32,7 +32,7 @@
 
 #ifdef EPD_2IN9_V2
 
-UBYTE _WF_PARTIAL_2IN9[159] =
+static const UBYTE _WF_PARTIAL_2IN9[159] =
 {
 0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
 0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
@@ -55,7 +55,7 @@ UBYTE _WF_PARTIAL_2IN9[159] =
 0x22,0x17,0x41,0xB0,0x32,0x36,
 };
 
-UBYTE WS_20_30[159] =
+static const UBYTE WS_20_30[159] =
 {											
 0x80,	0x66,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x40,	0x0,	0x0,	0x0,
 0x10,	0x66,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x20,	0x0,	0x0,	0x0,
@@ -78,86 +78,47 @@ UBYTE WS_20_30[159] =
 0x22,	0x17,	0x41,	0x0,	0x32,	0x36
 };	
 
-/******************************************************************************
-function :	Software reset
-parameter:
-******************************************************************************/
-static void EPD_2IN9_V2_Reset(void)
-{
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(100);
-    EPD_Digital_Write(EPD_RST_PIN, 0);
-    EPD_Delay_ms(2);
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(100);
-}
+static const UBYTE EPD_2IN9_V2_InitScript[] = {
+    EPD_OP_RESET, 100, 2,
+    EPD_OP_DELAY, 100,
+    EPD_OP_WAIT,
+    0, 0x12,                        // SWRESET
+    EPD_OP_WAIT,
+    3, 0x01, 0x27, 0x01, 0x00,      // Driver output control
+    1, 0x11, 0x03,                  // data entry mode
+    2, 0x44, 0x00, 0x0f,            // RAM X start/end: 0..127
+    4, 0x45, 0x00, 0x00, 0x27, 0x01, // RAM Y start/end: 0..295
+    2, 0x21, 0x00, 0x80,            // Display update control
+    1, 0x4E, 0x00,                  // RAM X counter
+    2, 0x4F, 0x00, 0x00,            // RAM Y counter
+    EPD_OP_WAIT,
+    EPD_OP_LUT,
+    EPD_OP_END
+};
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN9_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
+static const UBYTE EPD_2IN9_V2_RefreshScript[] = {
+    1, 0x22, 0xc7,                  // Display Update Control
+    0, 0x20,                        // Activate Display Update Sequence
+    EPD_OP_END
+};
 
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN9_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
+static const UBYTE EPD_2IN9_V2_SleepScript[] = {
+    1, 0x10, 0x01,                  // enter deep sleep
+    EPD_OP_DELAY, 100,
+    EPD_OP_END
+};
 
-/******************************************************************************
-function :	Wait until the busy_pin goes LOW
-parameter:
-******************************************************************************/
-void EPD_2IN9_V2_ReadBusy(void)
-{
-    EPD_Printf("e-Paper busy\r\n");
-	while(1)
-	{	 //=1 BUSY
-		if(EPD_Digital_Read(EPD_BUSY_PIN)==0) 
-			break;
-		EPD_Delay_ms(50);
-	}
-	EPD_Delay_ms(50);
-    EPD_Printf("e-Paper busy release\r\n");
-}
+const EPD_PANEL EPD_2IN9_V2_Panel = {
+    EPD_2IN9_V2_WIDTH, EPD_2IN9_V2_HEIGHT,
+    1, 0, {0x24, 0}, WS_20_30,
+    EPD_2IN9_V2_InitScript, EPD_2IN9_V2_RefreshScript, EPD_2IN9_V2_SleepScript
+};
 
-static void EPD_2IN9_V2_LUT(UBYTE *lut)
+static void EPD_2IN9_V2_LUT(const UBYTE *lut)
 {       
-	UBYTE count;
-	EPD_2IN9_V2_SendCommand(0x32);
-	for(count=0; count<153; count++) 
-		EPD_2IN9_V2_SendData(lut[count]); 
-	EPD_2IN9_V2_ReadBusy();
-}
-
-static void EPD_2IN9_V2_LUT_by_host(UBYTE *lut)
-{
-	EPD_2IN9_V2_LUT((UBYTE *)lut);			//lut
-	EPD_2IN9_V2_SendCommand(0x3f);
-	EPD_2IN9_V2_SendData(*(lut+153));
-	EPD_2IN9_V2_SendCommand(0x03);	// gate voltage
-	EPD_2IN9_V2_SendData(*(lut+154));
-	EPD_2IN9_V2_SendCommand(0x04);	// source voltage
-	EPD_2IN9_V2_SendData(*(lut+155));	// VSH
-	EPD_2IN9_V2_SendData(*(lut+156));	// VSH2
-	EPD_2IN9_V2_SendData(*(lut+157));	// VSL
-	EPD_2IN9_V2_SendCommand(0x2c);		// VCOM
-	EPD_2IN9_V2_SendData(*(lut+158));
-	
+	EPD_SendCommand(0x32);
+	EPD_SendDataArray(lut, 153); 
+	EPD_Panel_Wait(&EPD_2IN9_V2_Panel);
 }
 
 /******************************************************************************
@@ -166,18 +127,18 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN9_V2_TurnOnDisplay(void)
 {
-	EPD_2IN9_V2_SendCommand(0x22); //Display Update Control
-	EPD_2IN9_V2_SendData(0xc7);
-	EPD_2IN9_V2_SendCommand(0x20); //Activate Display Update Sequence
-	EPD_2IN9_V2_ReadBusy();
+	EPD_SendCommand(0x22); //Display Update Control
+	EPD_SendData(0xc7);
+	EPD_SendCommand(0x20); //Activate Display Update Sequence
+	EPD_Panel_Wait(&EPD_2IN9_V2_Panel);
 }
 
 static void EPD_2IN9_V2_TurnOnDisplay_Partial(void)
 {
-	EPD_2IN9_V2_SendCommand(0x22); //Display Update Control
-	EPD_2IN9_V2_SendData(0x0F);   
-	EPD_2IN9_V2_SendCommand(0x20); //Activate Display Update Sequence
-	EPD_2IN9_V2_ReadBusy();
+	EPD_SendCommand(0x22); //Display Update Control
+	EPD_SendData(0x0F);   
+	EPD_SendCommand(0x20); //Activate Display Update Sequence
+	EPD_Panel_Wait(&EPD_2IN9_V2_Panel);
 }
 
 /******************************************************************************
@@ -186,15 +147,15 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN9_V2_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    EPD_2IN9_V2_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_2IN9_V2_SendData((Xstart>>3) & 0xFF);
-    EPD_2IN9_V2_SendData((Xend>>3) & 0xFF);
+    EPD_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
+    EPD_SendData((Xstart>>3) & 0xFF);
+    EPD_SendData((Xend>>3) & 0xFF);
 	
-    EPD_2IN9_V2_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
-    EPD_2IN9_V2_SendData(Ystart & 0xFF);
-    EPD_2IN9_V2_SendData((Ystart >> 8) & 0xFF);
-    EPD_2IN9_V2_SendData(Yend & 0xFF);
-    EPD_2IN9_V2_SendData((Yend >> 8) & 0xFF);
+    EPD_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendData(Yend & 0xFF);
+    EPD_SendData((Yend >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -203,12 +164,12 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN9_V2_SetCursor(UWORD Xstart, UWORD Ystart)
 {
-    EPD_2IN9_V2_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_2IN9_V2_SendData(Xstart & 0xFF);
+    EPD_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
+    EPD_SendData(Xstart & 0xFF);
 
-    EPD_2IN9_V2_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
-    EPD_2IN9_V2_SendData(Ystart & 0xFF);
-    EPD_2IN9_V2_SendData((Ystart >> 8) & 0xFF);
+    EPD_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
+    EPD_SendData(Ystart & 0xFF);
+    EPD_SendData((Ystart >> 8) & 0xFF);
 }
 
 /******************************************************************************
@@ -217,37 +178,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9_V2_Init(void)
 {
-	EPD_2IN9_V2_Reset();
-	EPD_Delay_ms(100);
-
-	EPD_2IN9_V2_ReadBusy();   
-	EPD_2IN9_V2_SendCommand(0x12);  //SWRESET
-	EPD_2IN9_V2_ReadBusy();   
-
-	EPD_2IN9_V2_SendCommand(0x01); //Driver output control      
-	EPD_2IN9_V2_SendData(0x27);
-	EPD_2IN9_V2_SendData(0x01);
-	EPD_2IN9_V2_SendData(0x00);
-
-	EPD_2IN9_V2_SendCommand(0x11); //data entry mode       
-	EPD_2IN9_V2_SendData(0x03);
-
-	EPD_2IN9_V2_SetWindows(0, 0, EPD_2IN9_V2_WIDTH-1, EPD_2IN9_V2_HEIGHT-1);
-
-	// EPD_2IN9_V2_SendCommand(0x3C); //BorderWavefrom
-	// EPD_2IN9_V2_SendData(0x05);	
-
-	EPD_2IN9_V2_SendCommand(0x21); //  Display update control
-	EPD_2IN9_V2_SendData(0x00);
-	EPD_2IN9_V2_SendData(0x80);	
-
-	// EPD_2IN9_V2_SendCommand(0x18); //Read built-in temperature sensor
-	// EPD_2IN9_V2_SendData(0x80);	
-
-	EPD_2IN9_V2_SetCursor(0, 0);
-	EPD_2IN9_V2_ReadBusy();
-
-	EPD_2IN9_V2_LUT_by_host(WS_20_30);
+    EPD_Panel_Init(&EPD_2IN9_V2_Panel);
 }
 
 /******************************************************************************
@@ -256,13 +187,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9_V2_Clear(void)
 {
-	UWORD i;
-	EPD_2IN9_V2_SendCommand(0x24);   //write RAM for black(0)/white (1)
-	for(i=0;i<4736;i++)
-	{
-		EPD_2IN9_V2_SendData(0xff);
-	}
-	EPD_2IN9_V2_TurnOnDisplay();
+    EPD_Panel_Clear(&EPD_2IN9_V2_Panel);
 }
 
 /******************************************************************************
@@ -271,35 +196,21 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9_V2_Display(UBYTE *Image)
 {
-	UWORD i;	
-	EPD_2IN9_V2_SendCommand(0x24);   //write RAM for black(0)/white (1)
-	for(i=0;i<4736;i++)
-	{
-		EPD_2IN9_V2_SendData(Image[i]);
-	}
-	EPD_2IN9_V2_TurnOnDisplay();	
+    EPD_Panel_Display(&EPD_2IN9_V2_Panel, Image, NULL);
 }
 
 void EPD_2IN9_V2_Display_Base(UBYTE *Image)
 {
-	UWORD i;   
 
-	EPD_2IN9_V2_SendCommand(0x24);   //Write Black and White image to RAM
-	for(i=0;i<4736;i++)
-	{               
-		EPD_2IN9_V2_SendData(Image[i]);
-	}
-	EPD_2IN9_V2_SendCommand(0x26);   //Write Black and White image to RAM
-	for(i=0;i<4736;i++)
-	{               
-		EPD_2IN9_V2_SendData(Image[i]);
-	}
+	EPD_SendCommand(0x24);   //Write Black and White image to RAM
+	EPD_SendDataArray(Image, 4736);
+	EPD_SendCommand(0x26);   //Write Black and White image to RAM
+	EPD_SendDataArray(Image, 4736);
 	EPD_2IN9_V2_TurnOnDisplay();	
 }
 
 void EPD_2IN9_V2_Display_Partial(UBYTE *Image)
 {
-	UWORD i;
 
 //Reset
     EPD_Digital_Write(EPD_RST_PIN, 0);
@@ -308,34 +219,31 @@ void EPD_2IN9_V2_Display_Partial(UBYTE *Image)
     EPD_Delay_ms(2);
 
 	EPD_2IN9_V2_LUT(_WF_PARTIAL_2IN9);
-	EPD_2IN9_V2_SendCommand(0x37); 
-	EPD_2IN9_V2_SendData(0x00);  
-	EPD_2IN9_V2_SendData(0x00);  
-	EPD_2IN9_V2_SendData(0x00);  
-	EPD_2IN9_V2_SendData(0x00); 
-	EPD_2IN9_V2_SendData(0x00);  	
-	EPD_2IN9_V2_SendData(0x40);  
-	EPD_2IN9_V2_SendData(0x00);  
-	EPD_2IN9_V2_SendData(0x00);   
-	EPD_2IN9_V2_SendData(0x00);  
-	EPD_2IN9_V2_SendData(0x00);
-
-	EPD_2IN9_V2_SendCommand(0x3C); //BorderWavefrom
-	EPD_2IN9_V2_SendData(0x80);	
-
-	EPD_2IN9_V2_SendCommand(0x22); 
-	EPD_2IN9_V2_SendData(0xC0);   
-	EPD_2IN9_V2_SendCommand(0x20); 
-	EPD_2IN9_V2_ReadBusy();  
+	EPD_SendCommand(0x37); 
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00); 
+	EPD_SendData(0x00);  	
+	EPD_SendData(0x40);  
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);   
+	EPD_SendData(0x00);  
+	EPD_SendData(0x00);
+
+	EPD_SendCommand(0x3C); //BorderWavefrom
+	EPD_SendData(0x80);	
+
+	EPD_SendCommand(0x22); 
+	EPD_SendData(0xC0);   
+	EPD_SendCommand(0x20); 
+	EPD_Panel_Wait(&EPD_2IN9_V2_Panel);  
 	
 	EPD_2IN9_V2_SetWindows(0, 0, EPD_2IN9_V2_WIDTH-1, EPD_2IN9_V2_HEIGHT-1);
 	EPD_2IN9_V2_SetCursor(0, 0);
 
-	EPD_2IN9_V2_SendCommand(0x24);   //Write Black and White image to RAM
-	for(i=0;i<4736;i++)
-	{
-		EPD_2IN9_V2_SendData(Image[i]);
-	} 
+	EPD_SendCommand(0x24);   //Write Black and White image to RAM
+	EPD_SendDataArray(Image, 4736); 
 	EPD_2IN9_V2_TurnOnDisplay_Partial();
 }
 
@@ -345,9 +253,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9_V2_Sleep(void)
 {
-	EPD_2IN9_V2_SendCommand(0x10); //enter deep sleep
-	EPD_2IN9_V2_SendData(0x01); 
-	EPD_Delay_ms(100);
+    EPD_Panel_Sleep(&EPD_2IN9_V2_Panel);
 }
 
 #endif
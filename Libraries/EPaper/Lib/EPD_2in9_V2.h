@@ -31,12 +31,14 @@
 #ifndef __EPD_2IN9_V2_H_
 #define __EPD_2IN9_V2_H_
 
-#include "EPD_Common.h"
+#include "EPD_Panel.h"
 
 // Display resolution
 #define EPD_2IN9_V2_WIDTH       128
 #define EPD_2IN9_V2_HEIGHT      296
 
+extern const EPD_PANEL EPD_2IN9_V2_Panel;
+
 void EPD_2IN9_V2_Init(void);
 void EPD_2IN9_V2_Clear(void);
 void EPD_2IN9_V2_Display(UBYTE *Image);
@@ -32,64 +32,36 @@
 
 #ifdef EPD_2IN9B_V3
 
-/******************************************************************************
-function :	Software reset
-parameter:
-******************************************************************************/
-static void EPD_2IN9B_V3_Reset(void)
-{
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(200);
-    EPD_Digital_Write(EPD_RST_PIN, 0);
-    EPD_Delay_ms(5);
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(200);
-}
-
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN9B_V3_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN9B_V3_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	Wait until the busy_pin goes LOW
-parameter:
-******************************************************************************/
-void EPD_2IN9B_V3_ReadBusy(void)
-{
-    EPD_Printf("e-Paper busy\r\n");
-    UBYTE busy;
-	do
-	{
-		EPD_2IN9B_V3_SendCommand(0x71);
-		busy = EPD_Digital_Read(EPD_BUSY_PIN);
-		busy =!(busy & 0x01);        
-	}
-	while(busy); 
-    EPD_Printf("e-Paper busy release\r\n");
-    EPD_Delay_ms(200);
-}
+static const UBYTE EPD_2IN9B_V3_InitScript[] = {
+    EPD_OP_RESET, 200, 5,
+    0, 0x04,                        // power on
+    EPD_OP_WAIT,
+    EPD_OP_DELAY, 200,
+    2, 0x00, 0x0f, 0x89,            // panel setting: LUT from OTP, 128x296
+    3, 0x61, 0x80, 0x01, 0x28,      // resolution setting
+    1, 0x50, 0x77,                  // VCOM AND DATA INTERVAL SETTING
+    EPD_OP_END
+};
+
+static const UBYTE EPD_2IN9B_V3_RefreshScript[] = {
+    0, 0x92,                        // partial out
+    0, 0x12,                        // DISPLAY_REFRESH
+    EPD_OP_END
+};
+
+static const UBYTE EPD_2IN9B_V3_SleepScript[] = {
+    0, 0x02,                        // POWER_OFF
+    EPD_OP_WAIT,
+    EPD_OP_DELAY, 200,
+    1, 0x07, 0xA5,                  // DEEP_SLEEP, check code
+    EPD_OP_END
+};
+
+const EPD_PANEL EPD_2IN9B_V3_Panel = {
+    EPD_2IN9B_V3_WIDTH, EPD_2IN9B_V3_HEIGHT,
+    0, 0x71, {0x10, 0x13}, NULL,
+    EPD_2IN9B_V3_InitScript, EPD_2IN9B_V3_RefreshScript, EPD_2IN9B_V3_SleepScript
+};
 
 /******************************************************************************
 function :	Initialize the e-Paper register
@@ -97,23 +69,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9B_V3_Init(void)
 {
-    EPD_2IN9B_V3_Reset();
-
-    EPD_2IN9B_V3_SendCommand(0x04);  
-    EPD_2IN9B_V3_ReadBusy();//waiting for the electronic paper IC to release the idle signal
-
-    EPD_2IN9B_V3_SendCommand(0x00);//panel setting
-    EPD_2IN9B_V3_SendData(0x0f);//LUT from OTP，128x296
-    EPD_2IN9B_V3_SendData(0x89);//Temperature sensor, boost and other related timing settings
-
-    EPD_2IN9B_V3_SendCommand(0x61);//resolution setting
-    EPD_2IN9B_V3_SendData (0x80);
-    EPD_2IN9B_V3_SendData (0x01);
-    EPD_2IN9B_V3_SendData (0x28);
-
-    EPD_2IN9B_V3_SendCommand(0X50);//VCOM AND DATA INTERVAL SETTING			
-    EPD_2IN9B_V3_SendData(0x77);//WBmode:VBDF 17|D7 VBDW 97 VBDB 57		
-                            //WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+    EPD_Panel_Init(&EPD_2IN9B_V3_Panel);
 }
 
 /******************************************************************************
@@ -122,27 +78,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9B_V3_Clear(void)
 {
-    UWORD Width = (EPD_2IN9B_V3_WIDTH % 8 == 0)? (EPD_2IN9B_V3_WIDTH / 8 ): (EPD_2IN9B_V3_WIDTH / 8 + 1);
-    UWORD Height = EPD_2IN9B_V3_HEIGHT;
-
-    //send black data
-    EPD_2IN9B_V3_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9B_V3_SendData(0xFF);
-        }
-    }
-
-    //send red data
-    EPD_2IN9B_V3_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9B_V3_SendData(0xFF);
-        }
-    }
-    
-    EPD_2IN9B_V3_SendCommand(0x12);
-    EPD_2IN9B_V3_ReadBusy();
+    EPD_Panel_Clear(&EPD_2IN9B_V3_Panel);
 }
 
 /******************************************************************************
@@ -151,30 +87,20 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9B_V3_Display(const UBYTE *blackimage, const UBYTE *ryimage)
 {
-    UWORD Width, Height;
-    Width = (EPD_2IN9B_V3_WIDTH % 8 == 0)? (EPD_2IN9B_V3_WIDTH / 8 ): (EPD_2IN9B_V3_WIDTH / 8 + 1);
-    Height = EPD_2IN9B_V3_HEIGHT;
-
-	//send black data
-    EPD_2IN9B_V3_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9B_V3_SendData(blackimage[i + j * Width]);
-        }
-    }
-    EPD_2IN9B_V3_SendCommand(0x92);
-    
-	//send red data
-    EPD_2IN9B_V3_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9B_V3_SendData(ryimage[i + j * Width]);
-        }
-    }
-    EPD_2IN9B_V3_SendCommand(0x92);
+    EPD_Panel_Display(&EPD_2IN9B_V3_Panel, blackimage, ryimage);
+}
 
-    EPD_2IN9B_V3_SendCommand(0x12);
-    EPD_2IN9B_V3_ReadBusy();
+/******************************************************************************
+function :	Sends one band of one plane, refreshing after the last red band
+parameter:
+    Band   : Rows lines of the plane, as rendered by Paint_RenderPlanes()
+    Plane  : PAINT_PLANE_BLACK (0) or PAINT_PLANE_RED (1)
+    Ystart : First line of the band
+    Rows   : Number of lines in the band
+******************************************************************************/
+void EPD_2IN9B_V3_DisplayBand(const UBYTE *Band, UBYTE Plane, UWORD Ystart, UWORD Rows)
+{
+    EPD_Panel_DisplayBand(&EPD_2IN9B_V3_Panel, Plane, Band, Ystart, Rows);
 }
 
 /******************************************************************************
@@ -183,10 +109,7 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9B_V3_Sleep(void)
 {
-    EPD_2IN9B_V3_SendCommand(0x02); // POWER_OFF
-    EPD_2IN9B_V3_ReadBusy();
-    EPD_2IN9B_V3_SendCommand(0x07); // DEEP_SLEEP
-    EPD_2IN9B_V3_SendData(0xA5); // check code
+    EPD_Panel_Sleep(&EPD_2IN9B_V3_Panel);
 }
 
 #endif
@@ -31,15 +31,18 @@
 #ifndef __EPD_2IN9B_V3_H_
 #define __EPD_2IN9B_V3_H_
 
-#include "EPD_Common.h"
+#include "EPD_Panel.h"
 
 // Display resolution
 #define EPD_2IN9B_V3_WIDTH       128
 #define EPD_2IN9B_V3_HEIGHT      296
 
+extern const EPD_PANEL EPD_2IN9B_V3_Panel;
+
 void EPD_2IN9B_V3_Init(void);
 void EPD_2IN9B_V3_Clear(void);
 void EPD_2IN9B_V3_Display(const UBYTE *blackimage, const UBYTE *ryimage);
+void EPD_2IN9B_V3_DisplayBand(const UBYTE *Band, UBYTE Plane, UWORD Ystart, UWORD Rows);
 void EPD_2IN9B_V3_Sleep(void);
 
 #endif
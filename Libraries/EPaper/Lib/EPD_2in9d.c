@@ -128,32 +128,6 @@ static void EPD_2IN9D_Reset(void)
     EPD_Delay_ms(20);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_2IN9D_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_2IN9D_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -163,7 +137,7 @@ void EPD_2IN9D_ReadBusy(void)
     EPD_Printf("e-Paper busy\r\n");
     UBYTE busy;
     do {
-        EPD_2IN9D_SendCommand(0x71);
+        EPD_SendCommand(0x71);
         busy = EPD_Digital_Read(EPD_BUSY_PIN);
         busy =!(busy & 0x01);
     } while(busy);
@@ -178,63 +152,52 @@ parameter:
 static void EPD_2IN9D_SetPartReg(void)
 {
 	
-    EPD_2IN9D_SendCommand(0x01);	//POWER SETTING
-    EPD_2IN9D_SendData(0x03);
-    EPD_2IN9D_SendData(0x00);
-    EPD_2IN9D_SendData(0x2b);
-    EPD_2IN9D_SendData(0x2b);
-    EPD_2IN9D_SendData(0x03);
-
-    EPD_2IN9D_SendCommand(0x06);	//boost soft start
-    EPD_2IN9D_SendData(0x17);     //A
-    EPD_2IN9D_SendData(0x17);     //B
-    EPD_2IN9D_SendData(0x17);     //C
-
-    EPD_2IN9D_SendCommand(0x04);
+    EPD_SendCommand(0x01);	//POWER SETTING
+    EPD_SendData(0x03);
+    EPD_SendData(0x00);
+    EPD_SendData(0x2b);
+    EPD_SendData(0x2b);
+    EPD_SendData(0x03);
+
+    EPD_SendCommand(0x06);	//boost soft start
+    EPD_SendData(0x17);     //A
+    EPD_SendData(0x17);     //B
+    EPD_SendData(0x17);     //C
+
+    EPD_SendCommand(0x04);
     EPD_2IN9D_ReadBusy();
 
-    EPD_2IN9D_SendCommand(0x00);	//panel setting
-    EPD_2IN9D_SendData(0xbf);     //LUT from OTP，128x296
+    EPD_SendCommand(0x00);	//panel setting
+    EPD_SendData(0xbf);     //LUT from OTP，128x296
 
-    EPD_2IN9D_SendCommand(0x30);	//PLL setting
-    EPD_2IN9D_SendData(0x3a);     // 3a 100HZ   29 150Hz 39 200HZ	31 171HZ
+    EPD_SendCommand(0x30);	//PLL setting
+    EPD_SendData(0x3a);     // 3a 100HZ   29 150Hz 39 200HZ	31 171HZ
 
-    EPD_2IN9D_SendCommand(0x61);	//resolution setting
-    EPD_2IN9D_SendData(EPD_2IN9D_WIDTH);
-    EPD_2IN9D_SendData((EPD_2IN9D_HEIGHT >> 8) & 0xff);
-    EPD_2IN9D_SendData(EPD_2IN9D_HEIGHT & 0xff);
+    EPD_SendCommand(0x61);	//resolution setting
+    EPD_SendData(EPD_2IN9D_WIDTH);
+    EPD_SendData((EPD_2IN9D_HEIGHT >> 8) & 0xff);
+    EPD_SendData(EPD_2IN9D_HEIGHT & 0xff);
 
-    EPD_2IN9D_SendCommand(0x82);	//vcom_DC setting
-    EPD_2IN9D_SendData(0x12);
+    EPD_SendCommand(0x82);	//vcom_DC setting
+    EPD_SendData(0x12);
 	
-    EPD_2IN9D_SendCommand(0X50);
-    EPD_2IN9D_SendData(0x97);
+    EPD_SendCommand(0X50);
+    EPD_SendData(0x97);
 	
-    unsigned int count;
-    EPD_2IN9D_SendCommand(0x20);
-    for(count=0; count<44; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_vcom1[count]);
-    }
-
-    EPD_2IN9D_SendCommand(0x21);
-    for(count=0; count<42; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_ww1[count]);
-    }
-
-    EPD_2IN9D_SendCommand(0x22);
-    for(count=0; count<42; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_bw1[count]);
-    }
-
-    EPD_2IN9D_SendCommand(0x23);
-    for(count=0; count<42; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_wb1[count]);
-    }
-
-    EPD_2IN9D_SendCommand(0x24);
-    for(count=0; count<42; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_bb1[count]);
-    }
+    EPD_SendCommand(0x20);
+    EPD_SendDataArray(EPD_2IN9D_lut_vcom1, 44);
+
+    EPD_SendCommand(0x21);
+    EPD_SendDataArray(EPD_2IN9D_lut_ww1, 42);
+
+    EPD_SendCommand(0x22);
+    EPD_SendDataArray(EPD_2IN9D_lut_bw1, 42);
+
+    EPD_SendCommand(0x23);
+    EPD_SendDataArray(EPD_2IN9D_lut_wb1, 42);
+
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(EPD_2IN9D_lut_bb1, 42);
 }
 
 /******************************************************************************
@@ -243,7 +206,7 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN9D_TurnOnDisplay(void)
 {
-    EPD_2IN9D_SendCommand(0x12);		 //DISPLAY REFRESH
+    EPD_SendCommand(0x12);		 //DISPLAY REFRESH
     EPD_Delay_ms(10);     //!!!The delay here is necessary, 200uS at least!!!
 
     EPD_2IN9D_ReadBusy();
@@ -257,19 +220,19 @@ void EPD_2IN9D_Init(void)
 {
     EPD_2IN9D_Reset();
 	
-	EPD_2IN9D_SendCommand(0x04);  
+	EPD_SendCommand(0x04);  
 	EPD_2IN9D_ReadBusy();//waiting for the electronic paper IC to release the idle signal
 
-	EPD_2IN9D_SendCommand(0x00);			//panel setting
-	EPD_2IN9D_SendData(0x1f);		//LUT from OTP，KW-BF   KWR-AF	BWROTP 0f	BWOTP 1f
+	EPD_SendCommand(0x00);			//panel setting
+	EPD_SendData(0x1f);		//LUT from OTP，KW-BF   KWR-AF	BWROTP 0f	BWOTP 1f
 
-	EPD_2IN9D_SendCommand(0x61);			//resolution setting
-	EPD_2IN9D_SendData (0x80);        	 
-	EPD_2IN9D_SendData (0x01);		
-	EPD_2IN9D_SendData (0x28);	
+	EPD_SendCommand(0x61);			//resolution setting
+	EPD_SendData (0x80);        	 
+	EPD_SendData (0x01);		
+	EPD_SendData (0x28);	
 
-	EPD_2IN9D_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING			
-	EPD_2IN9D_SendData(0x97);		//WBmode:VBDF 17|D7 VBDW 97 VBDB 57		WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+	EPD_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING			
+	EPD_SendData(0x97);		//WBmode:VBDF 17|D7 VBDW 97 VBDB 57		WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
 }
 
 /******************************************************************************
@@ -282,19 +245,11 @@ void EPD_2IN9D_Clear(void)
     Width = (EPD_2IN9D_WIDTH % 8 == 0)? (EPD_2IN9D_WIDTH / 8 ): (EPD_2IN9D_WIDTH / 8 + 1);
     Height = EPD_2IN9D_HEIGHT;
 
-    EPD_2IN9D_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9D_SendData(0x00);
-        }
-    }
-
-    EPD_2IN9D_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9D_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0x00, (UDOUBLE)Width * Height);
+
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
     EPD_2IN9D_TurnOnDisplay();
 }
 
@@ -308,19 +263,11 @@ void EPD_2IN9D_Display(UBYTE *Image)
     Width = (EPD_2IN9D_WIDTH % 8 == 0)? (EPD_2IN9D_WIDTH / 8 ): (EPD_2IN9D_WIDTH / 8 + 1);
     Height = EPD_2IN9D_HEIGHT;
 
-    EPD_2IN9D_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9D_SendData(0x00);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0x00, (UDOUBLE)Width * Height);
 
-    EPD_2IN9D_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9D_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 
     EPD_2IN9D_TurnOnDisplay();
 }
@@ -333,27 +280,23 @@ void EPD_2IN9D_DisplayPart(UBYTE *Image)
 {
     /* Set partial Windows */
     EPD_2IN9D_SetPartReg();
-    EPD_2IN9D_SendCommand(0x91);		//This command makes the display enter partial mode
-    EPD_2IN9D_SendCommand(0x90);		//resolution setting
-    EPD_2IN9D_SendData(0);           //x-start
-    EPD_2IN9D_SendData(EPD_2IN9D_WIDTH - 1);       //x-end
+    EPD_SendCommand(0x91);		//This command makes the display enter partial mode
+    EPD_SendCommand(0x90);		//resolution setting
+    EPD_SendData(0);           //x-start
+    EPD_SendData(EPD_2IN9D_WIDTH - 1);       //x-end
 
-    EPD_2IN9D_SendData(0);
-    EPD_2IN9D_SendData(0);     //y-start
-    EPD_2IN9D_SendData(EPD_2IN9D_HEIGHT / 256);
-    EPD_2IN9D_SendData(EPD_2IN9D_HEIGHT % 256 - 1);  //y-end
-    EPD_2IN9D_SendData(0x28);
+    EPD_SendData(0);
+    EPD_SendData(0);     //y-start
+    EPD_SendData(EPD_2IN9D_HEIGHT / 256);
+    EPD_SendData(EPD_2IN9D_HEIGHT % 256 - 1);  //y-end
+    EPD_SendData(0x28);
 
     UWORD Width;
     Width = (EPD_2IN9D_WIDTH % 8 == 0)? (EPD_2IN9D_WIDTH / 8 ): (EPD_2IN9D_WIDTH / 8 + 1);
     
     /* send data */
-    EPD_2IN9D_SendCommand(0x13);
-    for (UWORD j = 0; j < EPD_2IN9D_HEIGHT; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_2IN9D_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * EPD_2IN9D_HEIGHT);
 
     /* Set partial refresh */    
     EPD_2IN9D_TurnOnDisplay();
@@ -365,12 +308,12 @@ parameter:
 ******************************************************************************/
 void EPD_2IN9D_Sleep(void)
 {
-    EPD_2IN9D_SendCommand(0X50);
-    EPD_2IN9D_SendData(0xf7);
-    EPD_2IN9D_SendCommand(0X02);  	//power off
+    EPD_SendCommand(0X50);
+    EPD_SendData(0xf7);
+    EPD_SendCommand(0X02);  	//power off
     EPD_2IN9D_ReadBusy();
-    EPD_2IN9D_SendCommand(0X07);  	//deep sleep
-    EPD_2IN9D_SendData(0xA5);
+    EPD_SendCommand(0X07);  	//deep sleep
+    EPD_SendData(0xA5);
 }
 
 #endif
@@ -46,32 +46,6 @@ static void EPD_3IN0G_Reset(void)
     EPD_Delay_ms(20);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_3IN0G_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_3IN0G_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -91,12 +65,12 @@ parameter:
 ******************************************************************************/
 static void EPD_3IN0G_TurnOnDisplay(void)
 {
-    EPD_3IN0G_SendCommand(0x12); // DISPLAY_REFRESH
-    EPD_3IN0G_SendData(0x00);
+    EPD_SendCommand(0x12); // DISPLAY_REFRESH
+    EPD_SendData(0x00);
     EPD_3IN0G_ReadBusyH();
 
-    EPD_3IN0G_SendCommand(0x02); // POWER_OFF
-    EPD_3IN0G_SendData(0X00);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
     EPD_3IN0G_ReadBusyH();
 }
 
@@ -108,50 +82,50 @@ void EPD_3IN0G_Init(void)
 {
     EPD_3IN0G_Reset();
 
-    EPD_3IN0G_SendCommand(0x66);
-    EPD_3IN0G_SendData(0x49);
-    EPD_3IN0G_SendData(0x55);
-    EPD_3IN0G_SendData(0x13);
-    EPD_3IN0G_SendData(0x5D);
-    EPD_3IN0G_SendData(0x05);
-    EPD_3IN0G_SendData(0x10);
+    EPD_SendCommand(0x66);
+    EPD_SendData(0x49);
+    EPD_SendData(0x55);
+    EPD_SendData(0x13);
+    EPD_SendData(0x5D);
+    EPD_SendData(0x05);
+    EPD_SendData(0x10);
 
-    EPD_3IN0G_SendCommand(0xB0);
-    EPD_3IN0G_SendData(0x00);//1 boost
+    EPD_SendCommand(0xB0);
+    EPD_SendData(0x00);//1 boost
 
-    EPD_3IN0G_SendCommand(0x01);
-    EPD_3IN0G_SendData(0x0F);
-    EPD_3IN0G_SendData(0x00);
+    EPD_SendCommand(0x01);
+    EPD_SendData(0x0F);
+    EPD_SendData(0x00);
 
-    EPD_3IN0G_SendCommand(0x00);
-    EPD_3IN0G_SendData(0x4F);
-    EPD_3IN0G_SendData(0x6B);
+    EPD_SendCommand(0x00);
+    EPD_SendData(0x4F);
+    EPD_SendData(0x6B);
 
 
-    EPD_3IN0G_SendCommand(0x06);
-    EPD_3IN0G_SendData(0xD7);
-    EPD_3IN0G_SendData(0xDE);
-    EPD_3IN0G_SendData(0x12);
+    EPD_SendCommand(0x06);
+    EPD_SendData(0xD7);
+    EPD_SendData(0xDE);
+    EPD_SendData(0x12);
 
 
-    EPD_3IN0G_SendCommand(0x61);
-    EPD_3IN0G_SendData(0x00);
-    EPD_3IN0G_SendData(0xA8);
-    EPD_3IN0G_SendData(0x01); 
-    EPD_3IN0G_SendData(0x90); 
+    EPD_SendCommand(0x61);
+    EPD_SendData(0x00);
+    EPD_SendData(0xA8);
+    EPD_SendData(0x01); 
+    EPD_SendData(0x90); 
 
-    EPD_3IN0G_SendCommand(0x50);
-    EPD_3IN0G_SendData(0x37);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x37);
 
-    EPD_3IN0G_SendCommand(0x60);
-    EPD_3IN0G_SendData(0x0C); 
-    EPD_3IN0G_SendData(0x05);
+    EPD_SendCommand(0x60);
+    EPD_SendData(0x0C); 
+    EPD_SendData(0x05);
 
-    EPD_3IN0G_SendCommand(0xE3);
-    EPD_3IN0G_SendData(0xFF);
+    EPD_SendCommand(0xE3);
+    EPD_SendData(0xFF);
 
-    EPD_3IN0G_SendCommand(0x84);
-    EPD_3IN0G_SendData(0x00);
+    EPD_SendCommand(0x84);
+    EPD_SendData(0x00);
 }
 
 /******************************************************************************
@@ -164,15 +138,11 @@ void EPD_3IN0G_Clear(UBYTE color)
     Width = (EPD_3IN0G_WIDTH % 4 == 0)? (EPD_3IN0G_WIDTH / 4 ): (EPD_3IN0G_WIDTH / 4 + 1);
     Height = EPD_3IN0G_HEIGHT;
     
-    EPD_3IN0G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_3IN0G_ReadBusyH();
 
-    EPD_3IN0G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_3IN0G_SendData((color << 6) | (color << 4) | (color << 2) | color);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst((color << 6) | (color << 4) | (color << 2) | color, (UDOUBLE)Width * Height);
 
     EPD_3IN0G_TurnOnDisplay();
 }
@@ -187,28 +157,46 @@ void EPD_3IN0G_Display(UBYTE *Image)
     Width = (EPD_3IN0G_WIDTH % 4 == 0)? (EPD_3IN0G_WIDTH / 4 ): (EPD_3IN0G_WIDTH / 4 + 1);
     Height = EPD_3IN0G_HEIGHT;
     
-    EPD_3IN0G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_3IN0G_ReadBusyH();
 
-    EPD_3IN0G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_3IN0G_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
     EPD_3IN0G_TurnOnDisplay();
 }
 
+/******************************************************************************
+function :	Sends one band of the image to the RAM, refreshing after the last
+parameter:
+    Band   : Rows lines of the image, as filled by Paint_RenderBands()
+    Ystart : First line of the band
+    Rows   : Number of lines in the band
+******************************************************************************/
+void EPD_3IN0G_DisplayBand(const UBYTE *Band, UWORD Ystart, UWORD Rows)
+{
+    UWORD Width;
+    Width = (EPD_3IN0G_WIDTH % 4 == 0)? (EPD_3IN0G_WIDTH / 4 ): (EPD_3IN0G_WIDTH / 4 + 1);
+
+    if (Ystart == 0) {
+        EPD_SendCommand(0x04);
+        EPD_3IN0G_ReadBusyH();
+        EPD_SendCommand(0x10);
+    }
+    EPD_SendDataArray(Band, (UDOUBLE)Rows * Width);
+    if (Ystart + Rows >= EPD_3IN0G_HEIGHT)
+        EPD_3IN0G_TurnOnDisplay();
+}
+
 /******************************************************************************
 function :	Enter sleep mode
 parameter:
 ******************************************************************************/
 void EPD_3IN0G_Sleep(void)
 {
-    EPD_3IN0G_SendCommand(0x02); // POWER_OFF
-    EPD_3IN0G_SendData(0X00);
-    EPD_3IN0G_SendCommand(0x07); // DEEP_SLEEP
-    EPD_3IN0G_SendData(0XA5);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
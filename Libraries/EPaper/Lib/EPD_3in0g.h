@@ -27,6 +27,7 @@
 void EPD_3IN0G_Init(void);
 void EPD_3IN0G_Clear(UBYTE color);
 void EPD_3IN0G_Display(UBYTE *Image);
+void EPD_3IN0G_DisplayBand(const UBYTE *Band, UWORD Ystart, UWORD Rows);
 void EPD_3IN0G_Sleep(void);
 
 #endif
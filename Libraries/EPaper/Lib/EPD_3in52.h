@@ -54,8 +54,6 @@
 
 extern unsigned char EPD_3IN52_Flag;
 
-void EPD_3IN52_SendCommand(UBYTE Reg);
-void EPD_3IN52_SendData(UBYTE Data);
 void EPD_3IN52_refresh(void);
 void EPD_3IN52_lut_GC(void);
 void EPD_3IN52_lut_DU(void);
@@ -106,32 +106,6 @@ static void EPD_3IN7_Reset(void)
     EPD_Delay_ms(300);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_3IN7_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_3IN7_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 static void EPD_3IN7_ReadBusy_HIGH(void)
 {
     EPD_Printf("e-Paper busy\r\n");
@@ -150,17 +124,17 @@ parameter:
 void EPD_3IN7_Load_LUT(UBYTE lut)
 {
   UWORD i;
-  EPD_3IN7_SendCommand(0x32);
+  EPD_SendCommand(0x32);
   for (i = 0; i < 105; i++)
   {
     if(lut == 0)
-        EPD_3IN7_SendData(lut_4Gray_GC[i]);
+        EPD_SendData(lut_4Gray_GC[i]);
     else if(lut == 1)
-        EPD_3IN7_SendData(lut_1Gray_GC[i]);
+        EPD_SendData(lut_1Gray_GC[i]);
     else if(lut == 2)
-        EPD_3IN7_SendData(lut_1Gray_DU[i]);
+        EPD_SendData(lut_1Gray_DU[i]);
     else if(lut == 3)
-        EPD_3IN7_SendData(lut_1Gray_A2[i]);  
+        EPD_SendData(lut_1Gray_A2[i]);  
     else
         EPD_Printf("There is no such lut \r\n");
   }
@@ -174,74 +148,74 @@ void EPD_3IN7_4Gray_Init(void)
 {
     EPD_3IN7_Reset();
     
-    EPD_3IN7_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_Delay_ms(300);
     
-    EPD_3IN7_SendCommand(0x46); 
-    EPD_3IN7_SendData(0xF7);
+    EPD_SendCommand(0x46); 
+    EPD_SendData(0xF7);
     EPD_3IN7_ReadBusy_HIGH();
-    EPD_3IN7_SendCommand(0x47);
-    EPD_3IN7_SendData(0xF7);
+    EPD_SendCommand(0x47);
+    EPD_SendData(0xF7);
     EPD_3IN7_ReadBusy_HIGH(); 
     
-    EPD_3IN7_SendCommand(0x01); // setting gaet number
-    EPD_3IN7_SendData(0xDF);
-    EPD_3IN7_SendData(0x01);
-    EPD_3IN7_SendData(0x00);
-
-    EPD_3IN7_SendCommand(0x03); // set gate voltage
-    EPD_3IN7_SendData(0x00);
-
-    EPD_3IN7_SendCommand(0x04); // set source voltage
-    EPD_3IN7_SendData(0x41);
-    EPD_3IN7_SendData(0xA8);
-    EPD_3IN7_SendData(0x32);
-
-    EPD_3IN7_SendCommand(0x11); // set data entry sequence
-    EPD_3IN7_SendData(0x03);
-
-    EPD_3IN7_SendCommand(0x3C); // set border 
-    EPD_3IN7_SendData(0x00);
-
-    EPD_3IN7_SendCommand(0x0C); // set booster strength
-    EPD_3IN7_SendData(0xAE);
-    EPD_3IN7_SendData(0xC7);
-    EPD_3IN7_SendData(0xC3);
-    EPD_3IN7_SendData(0xC0);
-    EPD_3IN7_SendData(0xC0);  
-
-    EPD_3IN7_SendCommand(0x18); // set internal sensor on
-    EPD_3IN7_SendData(0x80);
+    EPD_SendCommand(0x01); // setting gaet number
+    EPD_SendData(0xDF);
+    EPD_SendData(0x01);
+    EPD_SendData(0x00);
+
+    EPD_SendCommand(0x03); // set gate voltage
+    EPD_SendData(0x00);
+
+    EPD_SendCommand(0x04); // set source voltage
+    EPD_SendData(0x41);
+    EPD_SendData(0xA8);
+    EPD_SendData(0x32);
+
+    EPD_SendCommand(0x11); // set data entry sequence
+    EPD_SendData(0x03);
+
+    EPD_SendCommand(0x3C); // set border 
+    EPD_SendData(0x00);
+
+    EPD_SendCommand(0x0C); // set booster strength
+    EPD_SendData(0xAE);
+    EPD_SendData(0xC7);
+    EPD_SendData(0xC3);
+    EPD_SendData(0xC0);
+    EPD_SendData(0xC0);  
+
+    EPD_SendCommand(0x18); // set internal sensor on
+    EPD_SendData(0x80);
      
-    EPD_3IN7_SendCommand(0x2C); // set vcom value
-    EPD_3IN7_SendData(0x44);
+    EPD_SendCommand(0x2C); // set vcom value
+    EPD_SendData(0x44);
     
-    EPD_3IN7_SendCommand(0x37); // set display option, these setting turn on previous function
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);  
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);  
-
-    EPD_3IN7_SendCommand(0x44); // setting X direction start/end position of RAM
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x17);
-    EPD_3IN7_SendData(0x01);
-
-    EPD_3IN7_SendCommand(0x45); // setting Y direction start/end position of RAM
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0xDF);
-    EPD_3IN7_SendData(0x01);
-
-    EPD_3IN7_SendCommand(0x22); // Display Update Control 2
-    EPD_3IN7_SendData(0xCF);
+    EPD_SendCommand(0x37); // set display option, these setting turn on previous function
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);  
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);  
+
+    EPD_SendCommand(0x44); // setting X direction start/end position of RAM
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x17);
+    EPD_SendData(0x01);
+
+    EPD_SendCommand(0x45); // setting Y direction start/end position of RAM
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0xDF);
+    EPD_SendData(0x01);
+
+    EPD_SendCommand(0x22); // Display Update Control 2
+    EPD_SendData(0xCF);
 }
 
 /******************************************************************************
@@ -252,74 +226,74 @@ void EPD_3IN7_1Gray_Init(void)
 {
     EPD_3IN7_Reset();
     
-    EPD_3IN7_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_Delay_ms(300);
     
-    EPD_3IN7_SendCommand(0x46); 
-    EPD_3IN7_SendData(0xF7);
+    EPD_SendCommand(0x46); 
+    EPD_SendData(0xF7);
     EPD_3IN7_ReadBusy_HIGH();
-    EPD_3IN7_SendCommand(0x47);
-    EPD_3IN7_SendData(0xF7);
+    EPD_SendCommand(0x47);
+    EPD_SendData(0xF7);
     EPD_3IN7_ReadBusy_HIGH(); 
     
-    EPD_3IN7_SendCommand(0x01); // setting gaet number
-    EPD_3IN7_SendData(0xDF);
-    EPD_3IN7_SendData(0x01);
-    EPD_3IN7_SendData(0x00);
-
-    EPD_3IN7_SendCommand(0x03); // set gate voltage
-    EPD_3IN7_SendData(0x00);
-
-    EPD_3IN7_SendCommand(0x04); // set source voltage
-    EPD_3IN7_SendData(0x41);
-    EPD_3IN7_SendData(0xA8);
-    EPD_3IN7_SendData(0x32);
-
-    EPD_3IN7_SendCommand(0x11); // set data entry sequence
-    EPD_3IN7_SendData(0x03);
-
-    EPD_3IN7_SendCommand(0x3C); // set border 
-    EPD_3IN7_SendData(0x00);
-
-    EPD_3IN7_SendCommand(0x0C); // set booster strength
-    EPD_3IN7_SendData(0xAE);
-    EPD_3IN7_SendData(0xC7);
-    EPD_3IN7_SendData(0xC3);
-    EPD_3IN7_SendData(0xC0);
-    EPD_3IN7_SendData(0xC0);  
-
-    EPD_3IN7_SendCommand(0x18); // set internal sensor on
-    EPD_3IN7_SendData(0x80);
+    EPD_SendCommand(0x01); // setting gaet number
+    EPD_SendData(0xDF);
+    EPD_SendData(0x01);
+    EPD_SendData(0x00);
+
+    EPD_SendCommand(0x03); // set gate voltage
+    EPD_SendData(0x00);
+
+    EPD_SendCommand(0x04); // set source voltage
+    EPD_SendData(0x41);
+    EPD_SendData(0xA8);
+    EPD_SendData(0x32);
+
+    EPD_SendCommand(0x11); // set data entry sequence
+    EPD_SendData(0x03);
+
+    EPD_SendCommand(0x3C); // set border 
+    EPD_SendData(0x00);
+
+    EPD_SendCommand(0x0C); // set booster strength
+    EPD_SendData(0xAE);
+    EPD_SendData(0xC7);
+    EPD_SendData(0xC3);
+    EPD_SendData(0xC0);
+    EPD_SendData(0xC0);  
+
+    EPD_SendCommand(0x18); // set internal sensor on
+    EPD_SendData(0x80);
      
-    EPD_3IN7_SendCommand(0x2C); // set vcom value
-    EPD_3IN7_SendData(0x44);
+    EPD_SendCommand(0x2C); // set vcom value
+    EPD_SendData(0x44);
     
-    EPD_3IN7_SendCommand(0x37); // set display option, these setting turn on previous function
-    EPD_3IN7_SendData(0x00);     //can switch 1 gray or 4 gray
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);  
-    EPD_3IN7_SendData(0x4F);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);  
-
-    EPD_3IN7_SendCommand(0x44); // setting X direction start/end position of RAM
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x17);
-    EPD_3IN7_SendData(0x01);
-
-    EPD_3IN7_SendCommand(0x45); // setting Y direction start/end position of RAM
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0xDF);
-    EPD_3IN7_SendData(0x01);
-
-    EPD_3IN7_SendCommand(0x22); // Display Update Control 2
-    EPD_3IN7_SendData(0xCF);
+    EPD_SendCommand(0x37); // set display option, these setting turn on previous function
+    EPD_SendData(0x00);     //can switch 1 gray or 4 gray
+    EPD_SendData(0xFF);
+    EPD_SendData(0xFF);
+    EPD_SendData(0xFF);
+    EPD_SendData(0xFF);  
+    EPD_SendData(0x4F);
+    EPD_SendData(0xFF);
+    EPD_SendData(0xFF);
+    EPD_SendData(0xFF);
+    EPD_SendData(0xFF);  
+
+    EPD_SendCommand(0x44); // setting X direction start/end position of RAM
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0x17);
+    EPD_SendData(0x01);
+
+    EPD_SendCommand(0x45); // setting Y direction start/end position of RAM
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendData(0xDF);
+    EPD_SendData(0x01);
+
+    EPD_SendCommand(0x22); // Display Update Control 2
+    EPD_SendData(0xCF);
 }
 
 /******************************************************************************
@@ -332,42 +306,34 @@ void EPD_3IN7_4Gray_Clear(void)
     Width = (EPD_3IN7_WIDTH % 8 == 0)? (EPD_3IN7_WIDTH / 8 ): (EPD_3IN7_WIDTH / 8 + 1);
     Height = EPD_3IN7_HEIGHT;
 
-    EPD_3IN7_SendCommand(0x49);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendCommand(0x4E);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendCommand(0x4F);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
+    EPD_SendCommand(0x49);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x4E);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x4F);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
     
-    EPD_3IN7_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-       for (UWORD i = 0; i < Width; i++) {
-           EPD_3IN7_SendData(0xff);
-       }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0xff, (UDOUBLE)Width * Height);
     
-    EPD_3IN7_SendCommand(0x4E);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
+    EPD_SendCommand(0x4E);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
      
-    EPD_3IN7_SendCommand(0x4F);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
+    EPD_SendCommand(0x4F);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
     
-    EPD_3IN7_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-       for (UWORD i = 0; i < Width; i++) {
-           EPD_3IN7_SendData(0xff);
-       }
-    }
+    EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0xff, (UDOUBLE)Width * Height);
       
     EPD_3IN7_Load_LUT(0);
-    EPD_3IN7_SendCommand(0x22);
-    EPD_3IN7_SendData(0xC7);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xC7);
 
-    EPD_3IN7_SendCommand(0x20);
+    EPD_SendCommand(0x20);
     EPD_3IN7_ReadBusy_HIGH();     
 }
 
@@ -377,25 +343,21 @@ parameter:
 ******************************************************************************/
 void EPD_3IN7_1Gray_Clear(void)
 {
-  UWORD i;
   UWORD IMAGE_COUNTER = EPD_3IN7_WIDTH * EPD_3IN7_HEIGHT / 8;
 
-  EPD_3IN7_SendCommand(0x4E);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendCommand(0x4F);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendData(0x00);
+  EPD_SendCommand(0x4E);
+  EPD_SendData(0x00);
+  EPD_SendData(0x00);
+  EPD_SendCommand(0x4F);
+  EPD_SendData(0x00);
+  EPD_SendData(0x00);
 
-  EPD_3IN7_SendCommand(0x24);
-  for (i = 0; i < IMAGE_COUNTER; i++)
-  {
-    EPD_3IN7_SendData(0xff);
-  }
+  EPD_SendCommand(0x24);
+  EPD_SendDataBurst(0xff, IMAGE_COUNTER);
   
   EPD_3IN7_Load_LUT(2);
   
-  EPD_3IN7_SendCommand(0x20);
+  EPD_SendCommand(0x20);
   EPD_3IN7_ReadBusy_HIGH();    
 }
 
@@ -408,20 +370,20 @@ void EPD_3IN7_4Gray_Display(const UBYTE *Image)
     UDOUBLE i,j,k;
     UBYTE temp1,temp2,temp3;
     
-    EPD_3IN7_SendCommand(0x49);
-    EPD_3IN7_SendData(0x00);
+    EPD_SendCommand(0x49);
+    EPD_SendData(0x00);
 
     
-    EPD_3IN7_SendCommand(0x4E);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
+    EPD_SendCommand(0x4E);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
     
     
-    EPD_3IN7_SendCommand(0x4F);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
+    EPD_SendCommand(0x4F);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
     
-    EPD_3IN7_SendCommand(0x24);
+    EPD_SendCommand(0x24);
     for(i=0;i<16800;i++){
         temp3=0;
         for(j=0; j<2; j++) {
@@ -455,19 +417,19 @@ void EPD_3IN7_4Gray_Display(const UBYTE *Image)
             }
 
         }
-        EPD_3IN7_SendData(temp3);
+        EPD_SendData(temp3);
     }
     // new  data
-    EPD_3IN7_SendCommand(0x4E);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
+    EPD_SendCommand(0x4E);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
      
     
-    EPD_3IN7_SendCommand(0x4F);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
+    EPD_SendCommand(0x4F);
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
     
-    EPD_3IN7_SendCommand(0x26);
+    EPD_SendCommand(0x26);
     for(i=0; i<16800; i++) {
         temp3=0;
         for(j=0; j<2; j++) {
@@ -500,15 +462,15 @@ void EPD_3IN7_4Gray_Display(const UBYTE *Image)
                 temp1 <<= 2;
             }
         }
-        EPD_3IN7_SendData(temp3);
+        EPD_SendData(temp3);
     }
 
     EPD_3IN7_Load_LUT(0);
     
-    EPD_3IN7_SendCommand(0x22);
-    EPD_3IN7_SendData(0xC7);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xC7);
     
-    EPD_3IN7_SendCommand(0x20);
+    EPD_SendCommand(0x20);
     
     EPD_3IN7_ReadBusy_HIGH(); 
 }
@@ -519,24 +481,20 @@ parameter:
 ******************************************************************************/
 void EPD_3IN7_1Gray_Display(const UBYTE *Image)
 {
-  UWORD i;
   UWORD IMAGE_COUNTER = EPD_3IN7_WIDTH * EPD_3IN7_HEIGHT / 8;
 
-  EPD_3IN7_SendCommand(0x4E);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendCommand(0x4F);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendData(0x00);
+  EPD_SendCommand(0x4E);
+  EPD_SendData(0x00);
+  EPD_SendData(0x00);
+  EPD_SendCommand(0x4F);
+  EPD_SendData(0x00);
+  EPD_SendData(0x00);
 
-  EPD_3IN7_SendCommand(0x24);
-  for (i = 0; i < IMAGE_COUNTER; i++)
-  {
-    EPD_3IN7_SendData(Image[i]);
-  }
+  EPD_SendCommand(0x24);
+  EPD_SendDataArray(Image, IMAGE_COUNTER);
 
   EPD_3IN7_Load_LUT(2);
-  EPD_3IN7_SendCommand(0x20);
+  EPD_SendCommand(0x20);
   EPD_3IN7_ReadBusy_HIGH();  
 }
 
@@ -546,29 +504,26 @@ parameter:
 ******************************************************************************/
 void EPD_3IN7_1Gray_Display_Part(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-  UWORD i, Width;
+  UWORD Width;
   Width = (Xend-Xstart)%8 == 0 ? (Xend-Xstart)/8 : (Xend-Xstart)/8+1;
   UWORD IMAGE_COUNTER = Width * (Yend-Ystart);
 
-  EPD_3IN7_SendCommand(0x44);
-  EPD_3IN7_SendData(Xstart & 0xff);
-  EPD_3IN7_SendData((Xstart>>8) & 0x03);
-  EPD_3IN7_SendData(Xend & 0xff);
-  EPD_3IN7_SendData((Xend>>8) & 0x03);
-  EPD_3IN7_SendCommand(0x45);
-  EPD_3IN7_SendData(Ystart & 0xff);
-  EPD_3IN7_SendData((Ystart>>8) & 0x03);
-  EPD_3IN7_SendData(Yend & 0xff);
-  EPD_3IN7_SendData((Yend>>8) & 0x03);
-
-  EPD_3IN7_SendCommand(0x24);
-  for (i = 0; i < IMAGE_COUNTER; i++)
-  {
-    EPD_3IN7_SendData(Image[i]);
-  }
+  EPD_SendCommand(0x44);
+  EPD_SendData(Xstart & 0xff);
+  EPD_SendData((Xstart>>8) & 0x03);
+  EPD_SendData(Xend & 0xff);
+  EPD_SendData((Xend>>8) & 0x03);
+  EPD_SendCommand(0x45);
+  EPD_SendData(Ystart & 0xff);
+  EPD_SendData((Ystart>>8) & 0x03);
+  EPD_SendData(Yend & 0xff);
+  EPD_SendData((Yend>>8) & 0x03);
+
+  EPD_SendCommand(0x24);
+  EPD_SendDataArray(Image, IMAGE_COUNTER);
   
   EPD_3IN7_Load_LUT(2);
-  EPD_3IN7_SendCommand(0x20);
+  EPD_SendCommand(0x20);
   EPD_3IN7_ReadBusy_HIGH();    
 }
 
@@ -578,8 +533,8 @@ parameter:
 ******************************************************************************/
 void EPD_3IN7_Sleep(void)
 {
-    EPD_3IN7_SendCommand(0X10);  	//deep sleep
-    EPD_3IN7_SendData(0x03);
+    EPD_SendCommand(0X10);  	//deep sleep
+    EPD_SendData(0x03);
 }
 
 #endif
@@ -46,33 +46,6 @@ static void EPD_4IN01F_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_4IN01F_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_4IN01F_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-
 static void EPD_4IN01F_BusyHigh(void)// If BUSYN=0 then waiting
 {
     while(!(EPD_Digital_Read(EPD_BUSY_PIN)));
@@ -91,33 +64,33 @@ void EPD_4IN01F_Init(void)
 {
 	EPD_4IN01F_Reset();
     EPD_4IN01F_BusyHigh();
-    EPD_4IN01F_SendCommand(0x00);
-    EPD_4IN01F_SendData(0x2f);
-    EPD_4IN01F_SendData(0x00);
-    EPD_4IN01F_SendCommand(0x01);
-    EPD_4IN01F_SendData(0x37);
-    EPD_4IN01F_SendData(0x00);
-    EPD_4IN01F_SendData(0x05);
-    EPD_4IN01F_SendData(0x05);
-    EPD_4IN01F_SendCommand(0x03);
-    EPD_4IN01F_SendData(0x00);
-    EPD_4IN01F_SendCommand(0x06);
-    EPD_4IN01F_SendData(0xC7);
-    EPD_4IN01F_SendData(0xC7);
-    EPD_4IN01F_SendData(0x1D);
-    EPD_4IN01F_SendCommand(0x41);
-    EPD_4IN01F_SendData(0x00);
-    EPD_4IN01F_SendCommand(0x50);
-    EPD_4IN01F_SendData(0x37);
-    EPD_4IN01F_SendCommand(0x60);
-    EPD_4IN01F_SendData(0x22);
-    EPD_4IN01F_SendCommand(0x61);
-    EPD_4IN01F_SendData(0x02);
-    EPD_4IN01F_SendData(0x80);
-    EPD_4IN01F_SendData(0x01);
-    EPD_4IN01F_SendData(0x90);
-    EPD_4IN01F_SendCommand(0xE3);
-    EPD_4IN01F_SendData(0xAA);
+    EPD_SendCommand(0x00);
+    EPD_SendData(0x2f);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x01);
+    EPD_SendData(0x37);
+    EPD_SendData(0x00);
+    EPD_SendData(0x05);
+    EPD_SendData(0x05);
+    EPD_SendCommand(0x03);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x06);
+    EPD_SendData(0xC7);
+    EPD_SendData(0xC7);
+    EPD_SendData(0x1D);
+    EPD_SendCommand(0x41);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x37);
+    EPD_SendCommand(0x60);
+    EPD_SendData(0x22);
+    EPD_SendCommand(0x61);
+    EPD_SendData(0x02);
+    EPD_SendData(0x80);
+    EPD_SendData(0x01);
+    EPD_SendData(0x90);
+    EPD_SendCommand(0xE3);
+    EPD_SendData(0xAA);
 }
 
 /******************************************************************************
@@ -126,21 +99,18 @@ parameter:
 ******************************************************************************/
 void EPD_4IN01F_Clear(UBYTE color)
 {
-    EPD_4IN01F_SendCommand(0x61);//Set Resolution setting
-    EPD_4IN01F_SendData(0x02);
-    EPD_4IN01F_SendData(0x80);
-    EPD_4IN01F_SendData(0x01);
-    EPD_4IN01F_SendData(0x90);
-    EPD_4IN01F_SendCommand(0x10);
-    for(int i=0; i<EPD_4IN01F_WIDTH/2; i++) {
-        for(int j=0; j<EPD_4IN01F_HEIGHT; j++)
-            EPD_4IN01F_SendData((color<<4)|color);
-    }
-    EPD_4IN01F_SendCommand(0x04);//0x04
+    EPD_SendCommand(0x61);//Set Resolution setting
+    EPD_SendData(0x02);
+    EPD_SendData(0x80);
+    EPD_SendData(0x01);
+    EPD_SendData(0x90);
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst((color<<4)|color, (UDOUBLE)EPD_4IN01F_HEIGHT * (EPD_4IN01F_WIDTH/2));
+    EPD_SendCommand(0x04);//0x04
     EPD_4IN01F_BusyHigh();
-    EPD_4IN01F_SendCommand(0x12);//0x12
+    EPD_SendCommand(0x12);//0x12
     EPD_4IN01F_BusyHigh();
-    EPD_4IN01F_SendCommand(0x02);  //0x02
+    EPD_SendCommand(0x02);  //0x02
     EPD_4IN01F_BusyLow();
     EPD_Delay_ms(500);
 }
@@ -151,22 +121,18 @@ parameter:
 ******************************************************************************/
 void EPD_4IN01F_Display(const UBYTE *image)
 {
-    unsigned long i,j;
-    EPD_4IN01F_SendCommand(0x61);//Set Resolution setting
-    EPD_4IN01F_SendData(0x02);
-    EPD_4IN01F_SendData(0x80);
-    EPD_4IN01F_SendData(0x01);
-    EPD_4IN01F_SendData(0x90);
-    EPD_4IN01F_SendCommand(0x10);
-    for(i=0; i<EPD_4IN01F_HEIGHT; i++) {
-        for(j=0; j<EPD_4IN01F_WIDTH/2; j++)
-            EPD_4IN01F_SendData(image[j+((EPD_4IN01F_WIDTH/2)*i)]);
-    }
-    EPD_4IN01F_SendCommand(0x04);//0x04
+    EPD_SendCommand(0x61);//Set Resolution setting
+    EPD_SendData(0x02);
+    EPD_SendData(0x80);
+    EPD_SendData(0x01);
+    EPD_SendData(0x90);
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(image, (UDOUBLE)EPD_4IN01F_WIDTH / 2 * EPD_4IN01F_HEIGHT);
+    EPD_SendCommand(0x04);//0x04
     EPD_4IN01F_BusyHigh();
-    EPD_4IN01F_SendCommand(0x12);//0x12
+    EPD_SendCommand(0x12);//0x12
     EPD_4IN01F_BusyHigh();
-    EPD_4IN01F_SendCommand(0x02);  //0x02
+    EPD_SendCommand(0x02);  //0x02
     EPD_4IN01F_BusyLow();
 	EPD_Delay_ms(200);
 	
@@ -180,27 +146,27 @@ void EPD_4IN01F_Display_part(const UBYTE *image, UWORD xstart, UWORD ystart,
 								UWORD image_width, UWORD image_heigh)
 {
     unsigned long i,j;
-    EPD_4IN01F_SendCommand(0x61);//Set Resolution setting
-    EPD_4IN01F_SendData(0x02);
-    EPD_4IN01F_SendData(0x80);
-    EPD_4IN01F_SendData(0x01);
-    EPD_4IN01F_SendData(0x90);
-    EPD_4IN01F_SendCommand(0x10);
+    EPD_SendCommand(0x61);//Set Resolution setting
+    EPD_SendData(0x02);
+    EPD_SendData(0x80);
+    EPD_SendData(0x01);
+    EPD_SendData(0x90);
+    EPD_SendCommand(0x10);
     for(i=0; i<EPD_4IN01F_HEIGHT; i++) {
         for(j=0; j< EPD_4IN01F_WIDTH/2; j++) {
 			if(i<image_heigh+ystart && i>=ystart && j<(image_width+xstart)/2 && j>=xstart/2) {
-				EPD_4IN01F_SendData(image[(j-xstart/2) + (image_width/2*(i-ystart))]);
+				EPD_SendData(image[(j-xstart/2) + (image_width/2*(i-ystart))]);
 			}
 			else {
-				EPD_4IN01F_SendData(0x11);
+				EPD_SendData(0x11);
 			}
 		}
     }
-    EPD_4IN01F_SendCommand(0x04);//0x04
+    EPD_SendCommand(0x04);//0x04
     EPD_4IN01F_BusyHigh();
-    EPD_4IN01F_SendCommand(0x12);//0x12
+    EPD_SendCommand(0x12);//0x12
     EPD_4IN01F_BusyHigh();
-    EPD_4IN01F_SendCommand(0x02);  //0x02
+    EPD_SendCommand(0x02);  //0x02
     EPD_4IN01F_BusyLow();
 	EPD_Delay_ms(200);
 }
@@ -212,8 +178,8 @@ parameter:
 void EPD_4IN01F_Sleep(void)
 {
     EPD_Delay_ms(100);
-    EPD_4IN01F_SendCommand(0x07);
-    EPD_4IN01F_SendData(0xA5);
+    EPD_SendCommand(0x07);
+    EPD_SendData(0xA5);
 }
 
 #endif
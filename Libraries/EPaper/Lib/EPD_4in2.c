@@ -294,32 +294,6 @@ static void EPD_4IN2_Reset(void)
     EPD_Delay_ms(10);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_4IN2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_4IN2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -327,9 +301,9 @@ parameter:
 void EPD_4IN2_ReadBusy(void)
 {
     EPD_Printf("e-Paper busy\r\n");
-	EPD_4IN2_SendCommand(0x71);
+	EPD_SendCommand(0x71);
     while(EPD_Digital_Read(EPD_BUSY_PIN) == 0) {      //LOW: idle, HIGH: busy
-		EPD_4IN2_SendCommand(0x71);
+		EPD_SendCommand(0x71);
         EPD_Delay_ms(100);
     }
     EPD_Printf("e-Paper busy release\r\n");
@@ -341,7 +315,7 @@ parameter:
 ******************************************************************************/
 static void EPD_4IN2_TurnOnDisplay(void)
 {
-    EPD_4IN2_SendCommand(0x12);
+    EPD_SendCommand(0x12);
     EPD_Delay_ms(100);
     EPD_4IN2_ReadBusy();
 }
@@ -352,80 +326,61 @@ parameter:
 ******************************************************************************/
 static void EPD_4IN2_Partial_SetLut(void)
 {
-	unsigned int count;
-	EPD_4IN2_SendCommand(0x20);
-	for(count=0;count<44;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_vcom1[count]);}
-
-	EPD_4IN2_SendCommand(0x21);
-	for(count=0;count<42;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_ww1[count]);}   
+	EPD_SendCommand(0x20);
+	EPD_SendDataArray(EPD_4IN2_Partial_lut_vcom1, 44);
+
+	EPD_SendCommand(0x21);
+	EPD_SendDataArray(EPD_4IN2_Partial_lut_ww1, 42);   
 	
-	EPD_4IN2_SendCommand(0x22);
-	for(count=0;count<42;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_bw1[count]);} 
+	EPD_SendCommand(0x22);
+	EPD_SendDataArray(EPD_4IN2_Partial_lut_bw1, 42); 
 
-	EPD_4IN2_SendCommand(0x23);
-	for(count=0;count<42;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_wb1[count]);} 
+	EPD_SendCommand(0x23);
+	EPD_SendDataArray(EPD_4IN2_Partial_lut_wb1, 42); 
 
-	EPD_4IN2_SendCommand(0x24);
-	for(count=0;count<42;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_bb1[count]);} 
+	EPD_SendCommand(0x24);
+	EPD_SendDataArray(EPD_4IN2_Partial_lut_bb1, 42); 
 }
 
 static void EPD_4IN2_SetLut(void)
 {
-	unsigned int count;
-	EPD_4IN2_SendCommand(0x20);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_vcom0[count]);}
-
-	EPD_4IN2_SendCommand(0x21);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_ww[count]);}   
+	EPD_SendCommand(0x20);
+	EPD_SendDataArray(EPD_4IN2_lut_vcom0, 36);
+
+	EPD_SendCommand(0x21);
+	EPD_SendDataArray(EPD_4IN2_lut_ww, 36);   
 	
-	EPD_4IN2_SendCommand(0x22);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_bw[count]);} 
+	EPD_SendCommand(0x22);
+	EPD_SendDataArray(EPD_4IN2_lut_bw, 36); 
 
-	EPD_4IN2_SendCommand(0x23);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_wb[count]);} 
+	EPD_SendCommand(0x23);
+	EPD_SendDataArray(EPD_4IN2_lut_wb, 36); 
 
-	EPD_4IN2_SendCommand(0x24);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_bb[count]);}   
+	EPD_SendCommand(0x24);
+	EPD_SendDataArray(EPD_4IN2_lut_bb, 36);   
 }
 
 //LUT download
 static void EPD_4IN2_4Gray_lut(void)
 {
-	unsigned int count;	 
 	{
-		EPD_4IN2_SendCommand(0x20);							//vcom
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_vcom[count]);}
+		EPD_SendCommand(0x20);							//vcom
+		EPD_SendDataArray(EPD_4IN2_4Gray_lut_vcom, 42);
 		
-	EPD_4IN2_SendCommand(0x21);							//red not use
-	for(count=0;count<42;count++)
-		{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_ww[count]);}
+	EPD_SendCommand(0x21);							//red not use
+	EPD_SendDataArray(EPD_4IN2_4Gray_lut_ww, 42);
 
-		EPD_4IN2_SendCommand(0x22);							//bw r
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_bw[count]);}
+		EPD_SendCommand(0x22);							//bw r
+		EPD_SendDataArray(EPD_4IN2_4Gray_lut_bw, 42);
 
-		EPD_4IN2_SendCommand(0x23);							//wb w
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_wb[count]);}
+		EPD_SendCommand(0x23);							//wb w
+		EPD_SendDataArray(EPD_4IN2_4Gray_lut_wb, 42);
 
-		EPD_4IN2_SendCommand(0x24);							//bb b
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_bb[count]);}
+		EPD_SendCommand(0x24);							//bb b
+		EPD_SendDataArray(EPD_4IN2_4Gray_lut_bb, 42);
 
-		EPD_4IN2_SendCommand(0x25);							//vcom
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_ww[count]);}
+		EPD_SendCommand(0x25);							//vcom
+		EPD_SendDataArray(EPD_4IN2_4Gray_lut_ww, 42);
 	}	         
 }
 /******************************************************************************
@@ -437,37 +392,37 @@ void EPD_4IN2_Init_Partial(void)
 {
     EPD_4IN2_Reset();
 
-    EPD_4IN2_SendCommand(0x01); // POWER SETTING
-    EPD_4IN2_SendData(0x03);
-    EPD_4IN2_SendData(0x00);
-    EPD_4IN2_SendData(0x2b);
-    EPD_4IN2_SendData(0x2b);
+    EPD_SendCommand(0x01); // POWER SETTING
+    EPD_SendData(0x03);
+    EPD_SendData(0x00);
+    EPD_SendData(0x2b);
+    EPD_SendData(0x2b);
 
-    EPD_4IN2_SendCommand(0x06); // boost soft start
-    EPD_4IN2_SendData(0x17);		//A
-    EPD_4IN2_SendData(0x17);		//B
-    EPD_4IN2_SendData(0x17);		//C
+    EPD_SendCommand(0x06); // boost soft start
+    EPD_SendData(0x17);		//A
+    EPD_SendData(0x17);		//B
+    EPD_SendData(0x17);		//C
 
-    EPD_4IN2_SendCommand(0x04); // POWER_ON
+    EPD_SendCommand(0x04); // POWER_ON
     EPD_4IN2_ReadBusy();
 
-    EPD_4IN2_SendCommand(0x00); // panel setting
-    EPD_4IN2_SendData(0xbf); // KW-BF   KWR-AF	BWROTP 0f	BWOTP 1f
+    EPD_SendCommand(0x00); // panel setting
+    EPD_SendData(0xbf); // KW-BF   KWR-AF	BWROTP 0f	BWOTP 1f
 
-    EPD_4IN2_SendCommand(0x30); // PLL setting
-    EPD_4IN2_SendData(0x3C); // 3A 100HZ   29 150Hz 39 200HZ	31 171HZ
+    EPD_SendCommand(0x30); // PLL setting
+    EPD_SendData(0x3C); // 3A 100HZ   29 150Hz 39 200HZ	31 171HZ
 
-    EPD_4IN2_SendCommand(0x61); // resolution setting
-    EPD_4IN2_SendData(0x01);
-    EPD_4IN2_SendData(0x90); //128
-    EPD_4IN2_SendData(0x01); //
-    EPD_4IN2_SendData(0x2c);
+    EPD_SendCommand(0x61); // resolution setting
+    EPD_SendData(0x01);
+    EPD_SendData(0x90); //128
+    EPD_SendData(0x01); //
+    EPD_SendData(0x2c);
 
-    EPD_4IN2_SendCommand(0x82); // vcom_DC setting
-    EPD_4IN2_SendData(0x12);
+    EPD_SendCommand(0x82); // vcom_DC setting
+    EPD_SendData(0x12);
 
-    EPD_4IN2_SendCommand(0X50); // VCOM AND DATA INTERVAL SETTING
-    EPD_4IN2_SendData(0x07); // 97white border 77black border		VBDF 17|D7 VBDW 97 VBDB 57		VBDF F7 VBDW 77 VBDB 37  VBDR B7
+    EPD_SendCommand(0X50); // VCOM AND DATA INTERVAL SETTING
+    EPD_SendData(0x07); // 97white border 77black border		VBDF 17|D7 VBDW 97 VBDB 57		VBDF F7 VBDW 77 VBDB 37  VBDR B7
 
     EPD_4IN2_Partial_SetLut();
 }
@@ -476,39 +431,39 @@ void EPD_4IN2_Init_Partial(void)
 void EPD_4IN2_Init_Fast(void)
 {
 	EPD_4IN2_Reset();
-	EPD_4IN2_SendCommand(0x01);			//POWER SETTING 
-	EPD_4IN2_SendData (0x03);	          
-	EPD_4IN2_SendData (0x00);
-	EPD_4IN2_SendData (0x2b);  
-	EPD_4IN2_SendData (0x2b);
-
-	EPD_4IN2_SendCommand(0x06);         //boost soft start
-	EPD_4IN2_SendData (0x17);		//A
-	EPD_4IN2_SendData (0x17);		//B
-	EPD_4IN2_SendData (0x17);		//C       
-
-	EPD_4IN2_SendCommand(0x04);  
+	EPD_SendCommand(0x01);			//POWER SETTING 
+	EPD_SendData (0x03);	          
+	EPD_SendData (0x00);
+	EPD_SendData (0x2b);  
+	EPD_SendData (0x2b);
+
+	EPD_SendCommand(0x06);         //boost soft start
+	EPD_SendData (0x17);		//A
+	EPD_SendData (0x17);		//B
+	EPD_SendData (0x17);		//C       
+
+	EPD_SendCommand(0x04);  
 	EPD_4IN2_ReadBusy();
 
-	EPD_4IN2_SendCommand(0x00);			//panel setting
-	EPD_4IN2_SendData(0xbf);		//KW-bf   KWR-2F	BWROTP 0f	BWOTP 1f
+	EPD_SendCommand(0x00);			//panel setting
+	EPD_SendData(0xbf);		//KW-bf   KWR-2F	BWROTP 0f	BWOTP 1f
 
 
-	EPD_4IN2_SendCommand(0x30);			
-	EPD_4IN2_SendData (0x3c);      	// 3A 100HZ   29 150Hz 39 200HZ	31 171HZ
+	EPD_SendCommand(0x30);			
+	EPD_SendData (0x3c);      	// 3A 100HZ   29 150Hz 39 200HZ	31 171HZ
 
-	EPD_4IN2_SendCommand(0x61);			//resolution setting
-	EPD_4IN2_SendData (0x01);        	 
-	EPD_4IN2_SendData (0x90);	 //400	
-	EPD_4IN2_SendData (0x01);	 //300
-	EPD_4IN2_SendData (0x2c);	   
+	EPD_SendCommand(0x61);			//resolution setting
+	EPD_SendData (0x01);        	 
+	EPD_SendData (0x90);	 //400	
+	EPD_SendData (0x01);	 //300
+	EPD_SendData (0x2c);	   
 
 
-	EPD_4IN2_SendCommand(0x82);			//vcom_DC setting  	
-	EPD_4IN2_SendData (0x12);	
+	EPD_SendCommand(0x82);			//vcom_DC setting  	
+	EPD_SendData (0x12);	
 
-	EPD_4IN2_SendCommand(0X50);
-	EPD_4IN2_SendData(0x97);
+	EPD_SendCommand(0X50);
+	EPD_SendData(0x97);
 
 	EPD_4IN2_SetLut();		
 		
@@ -517,38 +472,38 @@ void EPD_4IN2_Init_Fast(void)
 void EPD_4IN2_Init_4Gray(void)
 {
 	EPD_4IN2_Reset();
-	EPD_4IN2_SendCommand(0x01);			//POWER SETTING
-	EPD_4IN2_SendData (0x03);
-	EPD_4IN2_SendData (0x00);       //VGH=20V,VGL=-20V
-	EPD_4IN2_SendData (0x2b);		//VDH=15V															 
-	EPD_4IN2_SendData (0x2b);		//VDL=-15V
-	EPD_4IN2_SendData (0x13);
-
-	EPD_4IN2_SendCommand(0x06);         //booster soft start
-	EPD_4IN2_SendData (0x17);		//A
-	EPD_4IN2_SendData (0x17);		//B
-	EPD_4IN2_SendData (0x17);		//C 
-
-	EPD_4IN2_SendCommand(0x04);
+	EPD_SendCommand(0x01);			//POWER SETTING
+	EPD_SendData (0x03);
+	EPD_SendData (0x00);       //VGH=20V,VGL=-20V
+	EPD_SendData (0x2b);		//VDH=15V															 
+	EPD_SendData (0x2b);		//VDL=-15V
+	EPD_SendData (0x13);
+
+	EPD_SendCommand(0x06);         //booster soft start
+	EPD_SendData (0x17);		//A
+	EPD_SendData (0x17);		//B
+	EPD_SendData (0x17);		//C 
+
+	EPD_SendCommand(0x04);
 	EPD_4IN2_ReadBusy();
 
-	EPD_4IN2_SendCommand(0x00);			//panel setting
-	EPD_4IN2_SendData(0x3f);		//KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
+	EPD_SendCommand(0x00);			//panel setting
+	EPD_SendData(0x3f);		//KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
 
-	EPD_4IN2_SendCommand(0x30);			//PLL setting
-	EPD_4IN2_SendData (0x3c);      	//100hz 
+	EPD_SendCommand(0x30);			//PLL setting
+	EPD_SendData (0x3c);      	//100hz 
 
-	EPD_4IN2_SendCommand(0x61);			//resolution setting
-	EPD_4IN2_SendData (0x01);		//400
-	EPD_4IN2_SendData (0x90);     	 
-	EPD_4IN2_SendData (0x01);		//300
-	EPD_4IN2_SendData (0x2c);
+	EPD_SendCommand(0x61);			//resolution setting
+	EPD_SendData (0x01);		//400
+	EPD_SendData (0x90);     	 
+	EPD_SendData (0x01);		//300
+	EPD_SendData (0x2c);
 
-	EPD_4IN2_SendCommand(0x82);			//vcom_DC setting
-	EPD_4IN2_SendData (0x12);
+	EPD_SendCommand(0x82);			//vcom_DC setting
+	EPD_SendData (0x12);
 
-	EPD_4IN2_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING			
-	EPD_4IN2_SendData(0x97);
+	EPD_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING			
+	EPD_SendData(0x97);
 }
 /******************************************************************************
 function :	Clear screen
@@ -560,21 +515,13 @@ void EPD_4IN2_Clear(void)
     Width = (EPD_4IN2_WIDTH % 8 == 0)? (EPD_4IN2_WIDTH / 8 ): (EPD_4IN2_WIDTH / 8 + 1);
     Height = EPD_4IN2_HEIGHT;
 
-    EPD_4IN2_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
 
-    EPD_4IN2_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
 
-	EPD_4IN2_SendCommand(0x12);		 //DISPLAY REFRESH 		
+	EPD_SendCommand(0x12);		 //DISPLAY REFRESH 		
 	EPD_Delay_ms(1);	
     EPD_4IN2_TurnOnDisplay();
 }
@@ -589,21 +536,13 @@ void EPD_4IN2_Display(UBYTE *Image)
     Width = (EPD_4IN2_WIDTH % 8 == 0)? (EPD_4IN2_WIDTH / 8 ): (EPD_4IN2_WIDTH / 8 + 1);
     Height = EPD_4IN2_HEIGHT;
 
-	EPD_4IN2_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2_SendData(0x00);
-        }
-    }
+	EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0x00, (UDOUBLE)Width * Height);
 
-    EPD_4IN2_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 
-	EPD_4IN2_SendCommand(0x12);		 //DISPLAY REFRESH 		
+	EPD_SendCommand(0x12);		 //DISPLAY REFRESH 		
 	EPD_Delay_ms(10);		
     EPD_4IN2_TurnOnDisplay();
 }
@@ -619,36 +558,36 @@ void EPD_4IN2_PartialDisplay(UWORD X_start,UWORD Y_start,UWORD X_end,UWORD Y_end
 	X_end = (X_end % 8 == 0)? (X_end): (X_end/8*8+8);
 	
 
-	EPD_4IN2_SendCommand(0x91);		//This command makes the display enter partial mode
-	EPD_4IN2_SendCommand(0x90);		//resolution setting
-	EPD_4IN2_SendData ((X_start)/256);
-	EPD_4IN2_SendData ((X_start)%256);   //x-start    
+	EPD_SendCommand(0x91);		//This command makes the display enter partial mode
+	EPD_SendCommand(0x90);		//resolution setting
+	EPD_SendData ((X_start)/256);
+	EPD_SendData ((X_start)%256);   //x-start    
 
-	EPD_4IN2_SendData ((X_end )/256);		
-	EPD_4IN2_SendData ((X_end )%256-1);  //x-end
+	EPD_SendData ((X_end )/256);		
+	EPD_SendData ((X_end )%256-1);  //x-end
 
-	EPD_4IN2_SendData (Y_start/256);
-	EPD_4IN2_SendData (Y_start%256);   //y-start    
+	EPD_SendData (Y_start/256);
+	EPD_SendData (Y_start%256);   //y-start    
 
-	EPD_4IN2_SendData (Y_end/256);		
-	EPD_4IN2_SendData (Y_end%256-1);  //y-end
-	EPD_4IN2_SendData (0x28);	
+	EPD_SendData (Y_end/256);		
+	EPD_SendData (Y_end%256-1);  //y-end
+	EPD_SendData (0x28);	
 
-	EPD_4IN2_SendCommand(0x10);	       //writes Old data to SRAM for programming
+	EPD_SendCommand(0x10);	       //writes Old data to SRAM for programming
 	for (UWORD j = 0; j < Y_end - Y_start; j++) {
 			for (UWORD i = 0; i < (X_end - X_start)/8; i++) {
-					EPD_4IN2_SendData(DATA[(Y_start + j)*Width + X_start/8 + i]);
+					EPD_SendData(DATA[(Y_start + j)*Width + X_start/8 + i]);
 			}
 	}
-	EPD_4IN2_SendCommand(0x13);				 //writes New data to SRAM.
+	EPD_SendCommand(0x13);				 //writes New data to SRAM.
 	for (UWORD j = 0; j < Y_end - Y_start; j++) {
 			for (UWORD i = 0; i < (X_end - X_start)/8; i++) {
-					EPD_4IN2_SendData(~Image[(Y_start + j)*Width + X_start/8 + i]);
+					EPD_SendData(~Image[(Y_start + j)*Width + X_start/8 + i]);
 		DATA[(Y_start + j)*Width + X_start/8 + i] = ~Image[(Y_start + j)*Width + X_start/8 + i];
 			}
 	}
 
-	EPD_4IN2_SendCommand(0x12);		 //DISPLAY REFRESH 		             
+	EPD_SendCommand(0x12);		 //DISPLAY REFRESH 		             
 	EPD_Delay_ms(10);     //The delay here is necessary, 200uS at least!!!     
 	EPD_4IN2_TurnOnDisplay();
 }
@@ -662,7 +601,7 @@ void EPD_4IN2_4GrayDisplay(const UBYTE *Image)
 0x10|  01     01     00     00
 0x13|  01     00     01     00
 *********************************/
-	EPD_4IN2_SendCommand(0x10);	       
+	EPD_SendCommand(0x10);	       
 	// EPD_4IN2_HEIGHT
 	// EPD_4IN2_WIDTH
 	for(m = 0; m<EPD_4IN2_HEIGHT;m++)
@@ -703,10 +642,10 @@ void EPD_4IN2_4GrayDisplay(const UBYTE *Image)
 				}
 				
 			 }
-			EPD_4IN2_SendData(temp3);			
+			EPD_SendData(temp3);			
 		}
     // new  data
-    EPD_4IN2_SendCommand(0x13);	 
+    EPD_SendCommand(0x13);	 
 	for(m = 0; m<EPD_4IN2_HEIGHT;m++)
 		for(i=0;i<EPD_4IN2_WIDTH/8;i++)
 		{
@@ -744,7 +683,7 @@ void EPD_4IN2_4GrayDisplay(const UBYTE *Image)
 				}
 				
 			 }
-			EPD_4IN2_SendData(temp3);	
+			EPD_SendData(temp3);	
 		}
     
     EPD_4IN2_4Gray_lut();
@@ -756,14 +695,14 @@ parameter:
 ******************************************************************************/
 void EPD_4IN2_Sleep(void)
 {
-	EPD_4IN2_SendCommand(0x50); // DEEP_SLEEP
-    EPD_4IN2_SendData(0XF7);
+	EPD_SendCommand(0x50); // DEEP_SLEEP
+    EPD_SendData(0XF7);
 
-    EPD_4IN2_SendCommand(0x02); // POWER_OFF
+    EPD_SendCommand(0x02); // POWER_OFF
     EPD_4IN2_ReadBusy();
 
-    EPD_4IN2_SendCommand(0x07); // DEEP_SLEEP
-    EPD_4IN2_SendData(0XA5);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
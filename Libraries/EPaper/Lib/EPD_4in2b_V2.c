@@ -32,73 +32,35 @@
 
 #ifdef EPD_4IN2B_V2
 
-/******************************************************************************
-function :	Software reset
-parameter:
-******************************************************************************/
-static void EPD_4IN2B_V2_Reset(void)
-{
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(200);
-    EPD_Digital_Write(EPD_RST_PIN, 0);
-    EPD_Delay_ms(2);
-    EPD_Digital_Write(EPD_RST_PIN, 1);
-    EPD_Delay_ms(200);
-}
-
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_4IN2B_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_4IN2B_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	Wait until the busy_pin goes LOW
-parameter:
-******************************************************************************/
-void EPD_4IN2B_V2_ReadBusy(void)
-{
-    EPD_Printf("e-Paper busy\r\n");
-    unsigned char busy;
-    do{
-        EPD_4IN2B_V2_SendCommand(0x71);
-		busy = EPD_Digital_Read(EPD_BUSY_PIN);
-		busy =!(busy & 0x01); 
-    }while(busy);
-    EPD_Printf("e-Paper busy release\r\n");
-    EPD_Delay_ms(200);
-}
-
-/******************************************************************************
-function :	Turn On Display
-parameter:
-******************************************************************************/
-static void EPD_4IN2B_V2_TurnOnDisplay(void)
-{
-    EPD_4IN2B_V2_SendCommand(0x12); // DISPLAY_REFRESH
-    EPD_Delay_ms(100);
-    EPD_4IN2B_V2_ReadBusy();
-}
+static const UBYTE EPD_4IN2B_V2_InitScript[] = {
+    EPD_OP_RESET, 200, 2,
+    0, 0x04,                        // power on
+    EPD_OP_WAIT,
+    EPD_OP_DELAY, 200,
+    1, 0x00, 0x0f,                  // panel setting
+    EPD_OP_END
+};
+
+static const UBYTE EPD_4IN2B_V2_RefreshScript[] = {
+    0, 0x12,                        // DISPLAY_REFRESH
+    EPD_OP_DELAY, 100,
+    EPD_OP_END
+};
+
+static const UBYTE EPD_4IN2B_V2_SleepScript[] = {
+    1, 0x50, 0xf7,                  // border floating
+    0, 0x02,                        // power off
+    EPD_OP_WAIT,
+    EPD_OP_DELAY, 200,
+    1, 0x07, 0xA5,                  // deep sleep
+    EPD_OP_END
+};
+
+const EPD_PANEL EPD_4IN2B_V2_Panel = {
+    EPD_4IN2B_V2_WIDTH, EPD_4IN2B_V2_HEIGHT,
+    0, 0x71, {0x10, 0x13}, NULL,
+    EPD_4IN2B_V2_InitScript, EPD_4IN2B_V2_RefreshScript, EPD_4IN2B_V2_SleepScript
+};
 
 /******************************************************************************
 function :	Initialize the e-Paper register
@@ -106,13 +68,7 @@ parameter:
 ******************************************************************************/
 void EPD_4IN2B_V2_Init(void)
 {
-    EPD_4IN2B_V2_Reset();
-    
-    EPD_4IN2B_V2_SendCommand(0x04); 
-    EPD_4IN2B_V2_ReadBusy();
-
-    EPD_4IN2B_V2_SendCommand(0x00);
-    EPD_4IN2B_V2_SendData(0x0f);
+    EPD_Panel_Init(&EPD_4IN2B_V2_Panel);
 }
 
 /******************************************************************************
@@ -121,25 +77,7 @@ parameter:
 ******************************************************************************/
 void EPD_4IN2B_V2_Clear(void)
 {
-    UWORD Width, Height;
-    Width = (EPD_4IN2B_V2_WIDTH % 8 == 0)? (EPD_4IN2B_V2_WIDTH / 8 ): (EPD_4IN2B_V2_WIDTH / 8 + 1);
-    Height = EPD_4IN2B_V2_HEIGHT;
-
-    EPD_4IN2B_V2_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2B_V2_SendData(0xFF);
-        }
-    }
-
-    EPD_4IN2B_V2_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2B_V2_SendData(0xFF);
-        }
-    }
-
-    EPD_4IN2B_V2_TurnOnDisplay();
+    EPD_Panel_Clear(&EPD_4IN2B_V2_Panel);
 }
 
 /******************************************************************************
@@ -148,25 +86,20 @@ parameter:
 ******************************************************************************/
 void EPD_4IN2B_V2_Display(const UBYTE *blackimage, const UBYTE *ryimage)
 {
-    UWORD Width, Height;
-    Width = (EPD_4IN2B_V2_WIDTH % 8 == 0)? (EPD_4IN2B_V2_WIDTH / 8 ): (EPD_4IN2B_V2_WIDTH / 8 + 1);
-    Height = EPD_4IN2B_V2_HEIGHT;
-
-    EPD_4IN2B_V2_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2B_V2_SendData(blackimage[i + j * Width]);
-        }
-    }
-
-    EPD_4IN2B_V2_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2B_V2_SendData(ryimage[i + j * Width]);
-        }
-    }
+    EPD_Panel_Display(&EPD_4IN2B_V2_Panel, blackimage, ryimage);
+}
 
-    EPD_4IN2B_V2_TurnOnDisplay();
+/******************************************************************************
+function :	Sends one band of one plane, refreshing after the last red band
+parameter:
+    Band   : Rows lines of the plane, as rendered by Paint_RenderPlanes()
+    Plane  : PAINT_PLANE_BLACK (0) or PAINT_PLANE_RED (1)
+    Ystart : First line of the band
+    Rows   : Number of lines in the band
+******************************************************************************/
+void EPD_4IN2B_V2_DisplayBand(const UBYTE *Band, UBYTE Plane, UWORD Ystart, UWORD Rows)
+{
+    EPD_Panel_DisplayBand(&EPD_4IN2B_V2_Panel, Plane, Band, Ystart, Rows);
 }
 
 /******************************************************************************
@@ -175,13 +108,7 @@ parameter:
 ******************************************************************************/
 void EPD_4IN2B_V2_Sleep(void)
 {
-    EPD_4IN2B_V2_SendCommand(0X50);
-    EPD_4IN2B_V2_SendData(0xf7);		//border floating	
-
-    EPD_4IN2B_V2_SendCommand(0X02);  	//power off
-    EPD_4IN2B_V2_ReadBusy(); //waiting for the electronic paper IC to release the idle signal
-    EPD_4IN2B_V2_SendCommand(0X07);  	//deep sleep
-    EPD_4IN2B_V2_SendData(0xA5);
+    EPD_Panel_Sleep(&EPD_4IN2B_V2_Panel);
 }
 
 #endif
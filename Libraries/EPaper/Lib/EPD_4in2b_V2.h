@@ -31,15 +31,18 @@
 #ifndef __EPD_4IN2B_V2_H_
 #define __EPD_4IN2B_V2_H_
 
-#include "EPD_Common.h"
+#include "EPD_Panel.h"
 
 // Display resolution
 #define EPD_4IN2B_V2_WIDTH       400
 #define EPD_4IN2B_V2_HEIGHT      300
 
+extern const EPD_PANEL EPD_4IN2B_V2_Panel;
+
 void EPD_4IN2B_V2_Init(void);
 void EPD_4IN2B_V2_Clear(void);
 void EPD_4IN2B_V2_Display(const UBYTE *blackimage, const UBYTE *ryimage);
+void EPD_4IN2B_V2_DisplayBand(const UBYTE *Band, UBYTE Plane, UWORD Ystart, UWORD Rows);
 void EPD_4IN2B_V2_Sleep(void);
 
 #endif
@@ -99,32 +99,6 @@ static void EPD_4IN2BC_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_4IN2BC_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_4IN2BC_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -144,7 +118,7 @@ parameter:
 ******************************************************************************/
 static void EPD_4IN2BC_TurnOnDisplay(void)
 {
-    EPD_4IN2BC_SendCommand(0x12); // DISPLAY_REFRESH
+    EPD_SendCommand(0x12); // DISPLAY_REFRESH
     EPD_Delay_ms(100);
     EPD_4IN2BC_ReadBusy();
 }
@@ -157,14 +131,14 @@ void EPD_4IN2BC_Init(void)
 {
     EPD_4IN2BC_Reset();
 
-    EPD_4IN2BC_SendCommand(0x06); // BOOSTER_SOFT_START
-    EPD_4IN2BC_SendData(0x17);
-    EPD_4IN2BC_SendData(0x17);
-    EPD_4IN2BC_SendData(0x17); // 07 0f 17 1f 27 2F 37 2f
-    EPD_4IN2BC_SendCommand(0x04); // POWER_ON
+    EPD_SendCommand(0x06); // BOOSTER_SOFT_START
+    EPD_SendData(0x17);
+    EPD_SendData(0x17);
+    EPD_SendData(0x17); // 07 0f 17 1f 27 2F 37 2f
+    EPD_SendCommand(0x04); // POWER_ON
     EPD_4IN2BC_ReadBusy();
-    EPD_4IN2BC_SendCommand(0x00); // PANEL_SETTING
-    EPD_4IN2BC_SendData(0x0F); // LUT from OTP
+    EPD_SendCommand(0x00); // PANEL_SETTING
+    EPD_SendData(0x0F); // LUT from OTP
 }
 
 /******************************************************************************
@@ -177,19 +151,11 @@ void EPD_4IN2BC_Clear(void)
     Width = (EPD_4IN2BC_WIDTH % 8 == 0)? (EPD_4IN2BC_WIDTH / 8 ): (EPD_4IN2BC_WIDTH / 8 + 1);
     Height = EPD_4IN2BC_HEIGHT;
 
-    EPD_4IN2BC_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2BC_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
 
-    EPD_4IN2BC_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2BC_SendData(0xFF);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0xFF, (UDOUBLE)Width * Height);
 
     EPD_4IN2BC_TurnOnDisplay();
 }
@@ -204,19 +170,11 @@ void EPD_4IN2BC_Display(const UBYTE *blackimage, const UBYTE *ryimage)
     Width = (EPD_4IN2BC_WIDTH % 8 == 0)? (EPD_4IN2BC_WIDTH / 8 ): (EPD_4IN2BC_WIDTH / 8 + 1);
     Height = EPD_4IN2BC_HEIGHT;
 
-    EPD_4IN2BC_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2BC_SendData(blackimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * Height);
 
-    EPD_4IN2BC_SendCommand(0x13);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN2BC_SendData(ryimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x13);
+    EPD_SendDataArray(ryimage, (UDOUBLE)Width * Height);
 
     EPD_4IN2BC_TurnOnDisplay();
 }
@@ -227,10 +185,10 @@ parameter:
 ******************************************************************************/
 void EPD_4IN2BC_Sleep(void)
 {
-    EPD_4IN2BC_SendCommand(0x02); // POWER_OFF
+    EPD_SendCommand(0x02); // POWER_OFF
     EPD_4IN2BC_ReadBusy();
-    EPD_4IN2BC_SendCommand(0x07); // DEEP_SLEEP
-    EPD_4IN2BC_SendData(0XA5);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
@@ -46,32 +46,6 @@ static void EPD_4IN37G_Reset(void)
     EPD_Delay_ms(20);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_4IN37G_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_4IN37G_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -91,12 +65,12 @@ parameter:
 ******************************************************************************/
 static void EPD_4IN37G_TurnOnDisplay(void)
 {
-    EPD_4IN37G_SendCommand(0x12); // DISPLAY_REFRESH
-    EPD_4IN37G_SendData(0x00);
+    EPD_SendCommand(0x12); // DISPLAY_REFRESH
+    EPD_SendData(0x00);
     EPD_4IN37G_ReadBusyH();
 
-    EPD_4IN37G_SendCommand(0x02); // POWER_OFF
-    EPD_4IN37G_SendData(0X00);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
     EPD_4IN37G_ReadBusyH();
 }
 
@@ -108,71 +82,71 @@ void EPD_4IN37G_Init(void)
 {
     EPD_4IN37G_Reset();
 
-    EPD_4IN37G_SendCommand(0xAA);
-    EPD_4IN37G_SendData(0x49);
-    EPD_4IN37G_SendData(0x55);
-    EPD_4IN37G_SendData(0x20);
-	EPD_4IN37G_SendData(0x08);
-	EPD_4IN37G_SendData(0x09);
-    EPD_4IN37G_SendData(0x18);
-
-    EPD_4IN37G_SendCommand(0x01);
-    EPD_4IN37G_SendData(0x3F);
-
-    EPD_4IN37G_SendCommand(0x00);
-    EPD_4IN37G_SendData(0x4F);
-    EPD_4IN37G_SendData(0x69);
-
-    EPD_4IN37G_SendCommand(0x05);
-    EPD_4IN37G_SendData(0x40);
-    EPD_4IN37G_SendData(0x1F);
-    EPD_4IN37G_SendData(0x1F);
-    EPD_4IN37G_SendData(0x2C);
-
-    EPD_4IN37G_SendCommand(0x08);
-    EPD_4IN37G_SendData(0x6F);
-    EPD_4IN37G_SendData(0x1F);
-    EPD_4IN37G_SendData(0x1F);
-    EPD_4IN37G_SendData(0x22);
+    EPD_SendCommand(0xAA);
+    EPD_SendData(0x49);
+    EPD_SendData(0x55);
+    EPD_SendData(0x20);
+	EPD_SendData(0x08);
+	EPD_SendData(0x09);
+    EPD_SendData(0x18);
+
+    EPD_SendCommand(0x01);
+    EPD_SendData(0x3F);
+
+    EPD_SendCommand(0x00);
+    EPD_SendData(0x4F);
+    EPD_SendData(0x69);
+
+    EPD_SendCommand(0x05);
+    EPD_SendData(0x40);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x2C);
+
+    EPD_SendCommand(0x08);
+    EPD_SendData(0x6F);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x22);
 
 	//===================
 	//20211212
 	//First setting
-    EPD_4IN37G_SendCommand(0x06);
-    EPD_4IN37G_SendData(0x6F);
-    EPD_4IN37G_SendData(0x1F);
-    EPD_4IN37G_SendData(0x17);
-    EPD_4IN37G_SendData(0x17);
+    EPD_SendCommand(0x06);
+    EPD_SendData(0x6F);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x17);
+    EPD_SendData(0x17);
 	//===================
 	
-    EPD_4IN37G_SendCommand(0x03);
-    EPD_4IN37G_SendData(0x00);
-    EPD_4IN37G_SendData(0x54);
-    EPD_4IN37G_SendData(0x00);
-    EPD_4IN37G_SendData(0x44); 
+    EPD_SendCommand(0x03);
+    EPD_SendData(0x00);
+    EPD_SendData(0x54);
+    EPD_SendData(0x00);
+    EPD_SendData(0x44); 
 
-    EPD_4IN37G_SendCommand(0x50);
-    EPD_4IN37G_SendData(0x3F);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x3F);
 
-    EPD_4IN37G_SendCommand(0x60);
-    EPD_4IN37G_SendData(0x02);
-    EPD_4IN37G_SendData(0x00);
+    EPD_SendCommand(0x60);
+    EPD_SendData(0x02);
+    EPD_SendData(0x00);
 
 	//Please notice that PLL must be set for version 2 IC
-    EPD_4IN37G_SendCommand(0x30);
-    EPD_4IN37G_SendData(0x08);
+    EPD_SendCommand(0x30);
+    EPD_SendData(0x08);
 	
-    EPD_4IN37G_SendCommand(0x61);
-    EPD_4IN37G_SendData(0x02);
-    EPD_4IN37G_SendData(0x00);
-    EPD_4IN37G_SendData(0x01); 
-    EPD_4IN37G_SendData(0x70); 
+    EPD_SendCommand(0x61);
+    EPD_SendData(0x02);
+    EPD_SendData(0x00);
+    EPD_SendData(0x01); 
+    EPD_SendData(0x70); 
 
-    EPD_4IN37G_SendCommand(0xE3);
-    EPD_4IN37G_SendData(0x2F);
+    EPD_SendCommand(0xE3);
+    EPD_SendData(0x2F);
 
-    EPD_4IN37G_SendCommand(0x84);
-    EPD_4IN37G_SendData(0x01);
+    EPD_SendCommand(0x84);
+    EPD_SendData(0x01);
 }
 
 /******************************************************************************
@@ -185,15 +159,11 @@ void EPD_4IN37G_Clear(UBYTE color)
     Width = (EPD_4IN37G_WIDTH % 4 == 0)? (EPD_4IN37G_WIDTH / 4 ): (EPD_4IN37G_WIDTH / 4 + 1);
     Height = EPD_4IN37G_HEIGHT;
     
-    EPD_4IN37G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_4IN37G_ReadBusyH();
 
-    EPD_4IN37G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN37G_SendData((color << 6) | (color << 4) | (color << 2) | color);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst((color << 6) | (color << 4) | (color << 2) | color, (UDOUBLE)Width * Height);
     EPD_4IN37G_TurnOnDisplay();
 }
 
@@ -207,15 +177,11 @@ void EPD_4IN37G_Display(UBYTE *Image)
     Width = (EPD_4IN37G_WIDTH % 4 == 0)? (EPD_4IN37G_WIDTH / 4 ): (EPD_4IN37G_WIDTH / 4 + 1);
     Height = EPD_4IN37G_HEIGHT;
     
-    EPD_4IN37G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_4IN37G_ReadBusyH();
 
-    EPD_4IN37G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN37G_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
     EPD_4IN37G_TurnOnDisplay();
 }
 
@@ -225,10 +191,10 @@ parameter:
 ******************************************************************************/
 void EPD_4IN37G_Sleep(void)
 {
-    EPD_4IN37G_SendCommand(0x02); // POWER_OFF
-    EPD_4IN37G_SendData(0X00);
-    EPD_4IN37G_SendCommand(0x07); // DEEP_SLEEP
-    EPD_4IN37G_SendData(0XA5);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
@@ -46,33 +46,6 @@ static void EPD_5IN65F_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_5IN65F_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_5IN65F_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-
 static void EPD_5IN65F_BusyHigh(void)// If BUSYN=0 then waiting
 {
     while(!(EPD_Digital_Read(EPD_BUSY_PIN)));
@@ -91,39 +64,39 @@ void EPD_5IN65F_Init(void)
 {
 	EPD_5IN65F_Reset();
     EPD_5IN65F_BusyHigh();
-    EPD_5IN65F_SendCommand(0x00);
-    EPD_5IN65F_SendData(0xEF);
-    EPD_5IN65F_SendData(0x08);
-    EPD_5IN65F_SendCommand(0x01);
-    EPD_5IN65F_SendData(0x37);
-    EPD_5IN65F_SendData(0x00);
-    EPD_5IN65F_SendData(0x23);
-    EPD_5IN65F_SendData(0x23);
-    EPD_5IN65F_SendCommand(0x03);
-    EPD_5IN65F_SendData(0x00);
-    EPD_5IN65F_SendCommand(0x06);
-    EPD_5IN65F_SendData(0xC7);
-    EPD_5IN65F_SendData(0xC7);
-    EPD_5IN65F_SendData(0x1D);
-    EPD_5IN65F_SendCommand(0x30);
-    EPD_5IN65F_SendData(0x3C);
-    EPD_5IN65F_SendCommand(0x41);
-    EPD_5IN65F_SendData(0x00);
-    EPD_5IN65F_SendCommand(0x50);
-    EPD_5IN65F_SendData(0x37);
-    EPD_5IN65F_SendCommand(0x60);
-    EPD_5IN65F_SendData(0x22);
-    EPD_5IN65F_SendCommand(0x61);
-    EPD_5IN65F_SendData(0x02);
-    EPD_5IN65F_SendData(0x58);
-    EPD_5IN65F_SendData(0x01);
-    EPD_5IN65F_SendData(0xC0);
-    EPD_5IN65F_SendCommand(0xE3);
-    EPD_5IN65F_SendData(0xAA);
+    EPD_SendCommand(0x00);
+    EPD_SendData(0xEF);
+    EPD_SendData(0x08);
+    EPD_SendCommand(0x01);
+    EPD_SendData(0x37);
+    EPD_SendData(0x00);
+    EPD_SendData(0x23);
+    EPD_SendData(0x23);
+    EPD_SendCommand(0x03);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x06);
+    EPD_SendData(0xC7);
+    EPD_SendData(0xC7);
+    EPD_SendData(0x1D);
+    EPD_SendCommand(0x30);
+    EPD_SendData(0x3C);
+    EPD_SendCommand(0x41);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x37);
+    EPD_SendCommand(0x60);
+    EPD_SendData(0x22);
+    EPD_SendCommand(0x61);
+    EPD_SendData(0x02);
+    EPD_SendData(0x58);
+    EPD_SendData(0x01);
+    EPD_SendData(0xC0);
+    EPD_SendCommand(0xE3);
+    EPD_SendData(0xAA);
 	
 	EPD_Delay_ms(100);
-    EPD_5IN65F_SendCommand(0x50);
-    EPD_5IN65F_SendData(0x37);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x37);
 }
 
 /******************************************************************************
@@ -132,21 +105,18 @@ parameter:
 ******************************************************************************/
 void EPD_5IN65F_Clear(UBYTE color)
 {
-    EPD_5IN65F_SendCommand(0x61);//Set Resolution setting
-    EPD_5IN65F_SendData(0x02);
-    EPD_5IN65F_SendData(0x58);
-    EPD_5IN65F_SendData(0x01);
-    EPD_5IN65F_SendData(0xC0);
-    EPD_5IN65F_SendCommand(0x10);
-    for(int i=0; i<EPD_5IN65F_WIDTH/2; i++) {
-        for(int j=0; j<EPD_5IN65F_HEIGHT; j++)
-            EPD_5IN65F_SendData((color<<4)|color);
-    }
-    EPD_5IN65F_SendCommand(0x04);//0x04
+    EPD_SendCommand(0x61);//Set Resolution setting
+    EPD_SendData(0x02);
+    EPD_SendData(0x58);
+    EPD_SendData(0x01);
+    EPD_SendData(0xC0);
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst((color<<4)|color, (UDOUBLE)EPD_5IN65F_HEIGHT * (EPD_5IN65F_WIDTH/2));
+    EPD_SendCommand(0x04);//0x04
     EPD_5IN65F_BusyHigh();
-    EPD_5IN65F_SendCommand(0x12);//0x12
+    EPD_SendCommand(0x12);//0x12
     EPD_5IN65F_BusyHigh();
-    EPD_5IN65F_SendCommand(0x02);  //0x02
+    EPD_SendCommand(0x02);  //0x02
     EPD_5IN65F_BusyLow();
     EPD_Delay_ms(500);
 }
@@ -157,27 +127,52 @@ parameter:
 ******************************************************************************/
 void EPD_5IN65F_Display(const UBYTE *image)
 {
-    unsigned long i,j;
-    EPD_5IN65F_SendCommand(0x61);//Set Resolution setting
-    EPD_5IN65F_SendData(0x02);
-    EPD_5IN65F_SendData(0x58);
-    EPD_5IN65F_SendData(0x01);
-    EPD_5IN65F_SendData(0xC0);
-    EPD_5IN65F_SendCommand(0x10);
-    for(i=0; i<EPD_5IN65F_HEIGHT; i++) {
-        for(j=0; j<EPD_5IN65F_WIDTH/2; j++)
-            EPD_5IN65F_SendData(image[j+((EPD_5IN65F_WIDTH/2)*i)]);
-    }
-    EPD_5IN65F_SendCommand(0x04);//0x04
+    EPD_SendCommand(0x61);//Set Resolution setting
+    EPD_SendData(0x02);
+    EPD_SendData(0x58);
+    EPD_SendData(0x01);
+    EPD_SendData(0xC0);
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(image, (UDOUBLE)EPD_5IN65F_WIDTH / 2 * EPD_5IN65F_HEIGHT);
+    EPD_SendCommand(0x04);//0x04
     EPD_5IN65F_BusyHigh();
-    EPD_5IN65F_SendCommand(0x12);//0x12
+    EPD_SendCommand(0x12);//0x12
     EPD_5IN65F_BusyHigh();
-    EPD_5IN65F_SendCommand(0x02);  //0x02
+    EPD_SendCommand(0x02);  //0x02
     EPD_5IN65F_BusyLow();
 	EPD_Delay_ms(200);
 	
 }
 
+/******************************************************************************
+function :	Sends one band of the image to the RAM, refreshing after the last
+parameter:
+    Band   : Rows lines of the image, as filled by Paint_RenderBands()
+    Ystart : First line of the band
+    Rows   : Number of lines in the band
+******************************************************************************/
+void EPD_5IN65F_DisplayBand(const UBYTE *Band, UWORD Ystart, UWORD Rows)
+{
+    if (Ystart == 0) {
+        EPD_SendCommand(0x61);//Set Resolution setting
+        EPD_SendData(0x02);
+        EPD_SendData(0x58);
+        EPD_SendData(0x01);
+        EPD_SendData(0xC0);
+        EPD_SendCommand(0x10);
+    }
+    EPD_SendDataArray(Band, (UDOUBLE)Rows * (EPD_5IN65F_WIDTH / 2));
+    if (Ystart + Rows >= EPD_5IN65F_HEIGHT) {
+        EPD_SendCommand(0x04);//0x04
+        EPD_5IN65F_BusyHigh();
+        EPD_SendCommand(0x12);//0x12
+        EPD_5IN65F_BusyHigh();
+        EPD_SendCommand(0x02);  //0x02
+        EPD_5IN65F_BusyLow();
+        EPD_Delay_ms(200);
+    }
+}
+
 /******************************************************************************
 function :	Sends the part image buffer in RAM to e-Paper and displays
 parameter:
@@ -186,27 +181,27 @@ void EPD_5IN65F_Display_part(const UBYTE *image, UWORD xstart, UWORD ystart,
 								UWORD image_width, UWORD image_heigh)
 {
     unsigned long i,j;
-    EPD_5IN65F_SendCommand(0x61);//Set Resolution setting
-    EPD_5IN65F_SendData(0x02);
-    EPD_5IN65F_SendData(0x58);
-    EPD_5IN65F_SendData(0x01);
-    EPD_5IN65F_SendData(0xC0);
-    EPD_5IN65F_SendCommand(0x10);
+    EPD_SendCommand(0x61);//Set Resolution setting
+    EPD_SendData(0x02);
+    EPD_SendData(0x58);
+    EPD_SendData(0x01);
+    EPD_SendData(0xC0);
+    EPD_SendCommand(0x10);
     for(i=0; i<EPD_5IN65F_HEIGHT; i++) {
         for(j=0; j< EPD_5IN65F_WIDTH/2; j++) {
 						if(i<image_heigh+ystart && i>=ystart && j<(image_width+xstart)/2 && j>=xstart/2) {
-							EPD_5IN65F_SendData(image[(j-xstart/2) + (image_width/2*(i-ystart))]);
+							EPD_SendData(image[(j-xstart/2) + (image_width/2*(i-ystart))]);
 						}
 						else {
-							EPD_5IN65F_SendData(0x11);
+							EPD_SendData(0x11);
 						}
 				}
     }
-    EPD_5IN65F_SendCommand(0x04);//0x04
+    EPD_SendCommand(0x04);//0x04
     EPD_5IN65F_BusyHigh();
-    EPD_5IN65F_SendCommand(0x12);//0x12
+    EPD_SendCommand(0x12);//0x12
     EPD_5IN65F_BusyHigh();
-    EPD_5IN65F_SendCommand(0x02);  //0x02
+    EPD_SendCommand(0x02);  //0x02
     EPD_5IN65F_BusyLow();
 	EPD_Delay_ms(200);
 	
@@ -219,8 +214,8 @@ parameter:
 void EPD_5IN65F_Sleep(void)
 {
     EPD_Delay_ms(100);
-    EPD_5IN65F_SendCommand(0x07);
-    EPD_5IN65F_SendData(0xA5);
+    EPD_SendCommand(0x07);
+    EPD_SendData(0xA5);
     EPD_Delay_ms(100);
 	EPD_Digital_Write(EPD_RST_PIN, 0); // Reset
 }
@@ -51,6 +51,7 @@ Color Index
 void EPD_5IN65F_Clear(UBYTE color);
 void EPD_5IN65F_Sleep(void);
 void EPD_5IN65F_Display(const UBYTE *image);
+void EPD_5IN65F_DisplayBand(const UBYTE *Band, UWORD Ystart, UWORD Rows);
 void EPD_5IN65F_Init(void);
 void EPD_5IN65F_Display_part(const UBYTE *image, UWORD xstart, UWORD ystart, UWORD image_width, UWORD image_heigh);
 
@@ -102,32 +102,6 @@ static void EPD_5IN83_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_5IN83_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_5IN83_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -147,7 +121,7 @@ parameter:
 ******************************************************************************/
 static void EPD_5IN83_TurnOnDisplay(void)
 {
-    EPD_5IN83_SendCommand(0x12); // DISPLAY_REFRESH
+    EPD_SendCommand(0x12); // DISPLAY_REFRESH
     EPD_Delay_ms(100);
     EPD_5IN83_ReadBusy();
 }
@@ -160,45 +134,45 @@ void EPD_5IN83_Init(void)
 {
     EPD_5IN83_Reset();
 
-    EPD_5IN83_SendCommand(0x01); // POWER_SETTING
-    EPD_5IN83_SendData(0x37);
-    EPD_5IN83_SendData(0x00);
+    EPD_SendCommand(0x01); // POWER_SETTING
+    EPD_SendData(0x37);
+    EPD_SendData(0x00);
 
-    EPD_5IN83_SendCommand(0x00); // PANEL_SETTING
-    EPD_5IN83_SendData(0xCF);
-    EPD_5IN83_SendData(0x08);
+    EPD_SendCommand(0x00); // PANEL_SETTING
+    EPD_SendData(0xCF);
+    EPD_SendData(0x08);
 
-    EPD_5IN83_SendCommand(0x06); // BOOSTER_SOFT_START
-    EPD_5IN83_SendData(0xc7);
-    EPD_5IN83_SendData(0xcc);
-    EPD_5IN83_SendData(0x28);
+    EPD_SendCommand(0x06); // BOOSTER_SOFT_START
+    EPD_SendData(0xc7);
+    EPD_SendData(0xcc);
+    EPD_SendData(0x28);
 
-    EPD_5IN83_SendCommand(0x04); // POWER_ON
+    EPD_SendCommand(0x04); // POWER_ON
     EPD_5IN83_ReadBusy();
 
-    EPD_5IN83_SendCommand(0x30); // PLL_CONTROL
-    EPD_5IN83_SendData(0x3c);
+    EPD_SendCommand(0x30); // PLL_CONTROL
+    EPD_SendData(0x3c);
 
-    EPD_5IN83_SendCommand(0x41); // TEMPERATURE_CALIBRATION
-    EPD_5IN83_SendData(0x00);
+    EPD_SendCommand(0x41); // TEMPERATURE_CALIBRATION
+    EPD_SendData(0x00);
 
-    EPD_5IN83_SendCommand(0x50); // VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_5IN83_SendData(0x77);
+    EPD_SendCommand(0x50); // VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SendData(0x77);
 
-    EPD_5IN83_SendCommand(0x60); // TCON_SETTING
-    EPD_5IN83_SendData(0x22);
+    EPD_SendCommand(0x60); // TCON_SETTING
+    EPD_SendData(0x22);
 
-    EPD_5IN83_SendCommand(0x61); // TCON_RESOLUTION
-    EPD_5IN83_SendData(EPD_5IN83_WIDTH >> 8); // source 600
-    EPD_5IN83_SendData(EPD_5IN83_WIDTH & 0xff);
-    EPD_5IN83_SendData(EPD_5IN83_HEIGHT >> 8); // gate 448
-    EPD_5IN83_SendData(EPD_5IN83_HEIGHT & 0xff);
+    EPD_SendCommand(0x61); // TCON_RESOLUTION
+    EPD_SendData(EPD_5IN83_WIDTH >> 8); // source 600
+    EPD_SendData(EPD_5IN83_WIDTH & 0xff);
+    EPD_SendData(EPD_5IN83_HEIGHT >> 8); // gate 448
+    EPD_SendData(EPD_5IN83_HEIGHT & 0xff);
 
-    EPD_5IN83_SendCommand(0x82); // VCM_DC_SETTING
-    EPD_5IN83_SendData(0x1E); // decide by LUT file
+    EPD_SendCommand(0x82); // VCM_DC_SETTING
+    EPD_SendData(0x1E); // decide by LUT file
 
-    EPD_5IN83_SendCommand(0xe5); // FLASH MODE
-    EPD_5IN83_SendData(0x03);
+    EPD_SendCommand(0xe5); // FLASH MODE
+    EPD_SendData(0x03);
 }
 
 /******************************************************************************
@@ -211,13 +185,9 @@ void EPD_5IN83_Clear(void)
     Width = (EPD_5IN83_WIDTH % 8 == 0)? (EPD_5IN83_WIDTH / 8 ): (EPD_5IN83_WIDTH / 8 + 1);
     Height = EPD_5IN83_HEIGHT;
 
-    EPD_5IN83_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            for(UBYTE k = 0; k < 4; k++) {
-                EPD_5IN83_SendData(0x33);
-            }
-        }
+        EPD_SendDataBurst(0x33, (UDOUBLE)4 * Width);
     }
 		EPD_5IN83_TurnOnDisplay();
 }
@@ -233,7 +203,7 @@ void EPD_5IN83_Display(UBYTE *Image)
     Width = (EPD_5IN83_WIDTH % 8 == 0)? (EPD_5IN83_WIDTH / 8 ): (EPD_5IN83_WIDTH / 8 + 1);
     Height = EPD_5IN83_HEIGHT;
 
-    EPD_5IN83_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (UWORD j = 0; j < Height; j++) {
         for (UWORD i = 0; i < Width; i++) {
             Data_Black = ~Image[i + j * Width];
@@ -250,7 +220,7 @@ void EPD_5IN83_Display(UBYTE *Image)
                 else
                     Data |= 0x03;
                 Data_Black <<= 1;
-                EPD_5IN83_SendData(Data);
+                EPD_SendData(Data);
             }
         }
     }
@@ -263,10 +233,10 @@ parameter:
 ******************************************************************************/
 void EPD_5IN83_Sleep(void)
 {
-    EPD_5IN83_SendCommand(0x02); // POWER_OFF
+    EPD_SendCommand(0x02); // POWER_OFF
     EPD_5IN83_ReadBusy();
-    EPD_5IN83_SendCommand(0x07); // DEEP_SLEEP
-    EPD_5IN83_SendData(0XA5);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
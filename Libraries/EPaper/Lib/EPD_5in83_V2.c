@@ -46,32 +46,6 @@ static void EPD_5in83_V2_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_5in83_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_5in83_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -80,7 +54,7 @@ static void EPD_5in83_V2_ReadBusy(void)
 {
 	EPD_Printf("e-Paper busy\r\n");
 	do {
-		EPD_5in83_V2_SendCommand(0x71);
+		EPD_SendCommand(0x71);
 		EPD_Delay_ms(50);    
 	}
 	while(!EPD_Digital_Read(EPD_BUSY_PIN));   
@@ -94,7 +68,7 @@ parameter:
 ******************************************************************************/
 static void EPD_5in83_V2_TurnOnDisplay(void)
 {
-	EPD_5in83_V2_SendCommand(0x12);	//DISPLAY REFRESH 	
+	EPD_SendCommand(0x12);	//DISPLAY REFRESH 	
 	EPD_Delay_ms(100);					//!!!The delay here is necessary, 200uS at least!!!     
 	EPD_5in83_V2_ReadBusy();			//waiting for the electronic paper IC to release the idle signal
 }
@@ -107,34 +81,34 @@ void EPD_5in83_V2_Init(void)
 {
     EPD_5in83_V2_Reset();
 
-	EPD_5in83_V2_SendCommand(0x01);			//POWER SETTING
-	EPD_5in83_V2_SendData (0x07);
-	EPD_5in83_V2_SendData (0x07);    //VGH=20V,VGL=-20V
-	EPD_5in83_V2_SendData (0x3f);		//VDH=15V
-	EPD_5in83_V2_SendData (0x3f);		//VDL=-15V
+	EPD_SendCommand(0x01);			//POWER SETTING
+	EPD_SendData (0x07);
+	EPD_SendData (0x07);    //VGH=20V,VGL=-20V
+	EPD_SendData (0x3f);		//VDH=15V
+	EPD_SendData (0x3f);		//VDL=-15V
 
-	EPD_5in83_V2_SendCommand(0x04); //POWER ON
+	EPD_SendCommand(0x04); //POWER ON
 	EPD_Delay_ms(100);  
 	EPD_5in83_V2_ReadBusy();        //waiting for the electronic paper IC to release the idle signal
 
-	EPD_5in83_V2_SendCommand(0X00);			//PANNEL SETTING
-	EPD_5in83_V2_SendData(0x1F);   //KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
+	EPD_SendCommand(0X00);			//PANNEL SETTING
+	EPD_SendData(0x1F);   //KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
 
-	EPD_5in83_V2_SendCommand(0x61);        	//tres			
-	EPD_5in83_V2_SendData (0x02);		//source 648
-	EPD_5in83_V2_SendData (0x88);
-	EPD_5in83_V2_SendData (0x01);		//gate 480
-	EPD_5in83_V2_SendData (0xE0);
+	EPD_SendCommand(0x61);        	//tres			
+	EPD_SendData (0x02);		//source 648
+	EPD_SendData (0x88);
+	EPD_SendData (0x01);		//gate 480
+	EPD_SendData (0xE0);
 
-	EPD_5in83_V2_SendCommand(0X15);		
-	EPD_5in83_V2_SendData(0x00);		
+	EPD_SendCommand(0X15);		
+	EPD_SendData(0x00);		
 
-	EPD_5in83_V2_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING
-	EPD_5in83_V2_SendData(0x10);
-	EPD_5in83_V2_SendData(0x07);
+	EPD_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING
+	EPD_SendData(0x10);
+	EPD_SendData(0x07);
 
-	EPD_5in83_V2_SendCommand(0X60);			//TCON SETTING
-	EPD_5in83_V2_SendData(0x22);
+	EPD_SendCommand(0X60);			//TCON SETTING
+	EPD_SendData(0x22);
 }
 
 /******************************************************************************
@@ -143,18 +117,14 @@ parameter:
 ******************************************************************************/
 void EPD_5in83_V2_Clear(void)
 {
-    UWORD Width, Height, i;
+    UWORD Width, Height;
     Width = (EPD_5in83_V2_WIDTH % 8 == 0)? (EPD_5in83_V2_WIDTH / 8 ): (EPD_5in83_V2_WIDTH / 8 + 1);
     Height = EPD_5in83_V2_HEIGHT;
 
-	EPD_5in83_V2_SendCommand(0x10);
-	for(i=0; i<Width*Height; i++) {
-		EPD_5in83_V2_SendData(0x00);  
-	}
-	EPD_5in83_V2_SendCommand(0x13);
-	for(i=0; i<Width*Height; i++) {
-		EPD_5in83_V2_SendData(0x00);  
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst(0x00, Width*Height);
+	EPD_SendCommand(0x13);
+	EPD_SendDataBurst(0x00, Width*Height);
 	EPD_5in83_V2_TurnOnDisplay();
 }
 
@@ -168,16 +138,12 @@ void EPD_5in83_V2_Display(UBYTE *Image)
     Width = (EPD_5in83_V2_WIDTH % 8 == 0)? (EPD_5in83_V2_WIDTH / 8 ): (EPD_5in83_V2_WIDTH / 8 + 1);
     Height = EPD_5in83_V2_HEIGHT;
 
-	EPD_5in83_V2_SendCommand(0x10);
-	for(i=0;i<Height;i++) {
-		for(j=0; j<Width; j++) {
-			EPD_5in83_V2_SendData(0x00);  
-		}
-	}
-	EPD_5in83_V2_SendCommand(0x13);
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst(0x00, (UDOUBLE)Width * Height);
+	EPD_SendCommand(0x13);
 	for(i=0;i<Height;i++) {
 		for(j=0; j<Width; j++) {
-			EPD_5in83_V2_SendData(~Image[i*Width + j]);  
+			EPD_SendData(~Image[i*Width + j]);  
 		}
 	}
     EPD_5in83_V2_TurnOnDisplay();
@@ -189,10 +155,10 @@ parameter:
 ******************************************************************************/
 void EPD_5in83_V2_Sleep(void)
 {
-	EPD_5in83_V2_SendCommand(0X02);  	//power off
+	EPD_SendCommand(0X02);  	//power off
 	EPD_5in83_V2_ReadBusy();			//waiting for the electronic paper IC to release the idle signal
-	EPD_5in83_V2_SendCommand(0X07);		//deep sleep
-	EPD_5in83_V2_SendData(0xA5);
+	EPD_SendCommand(0X07);		//deep sleep
+	EPD_SendData(0xA5);
 }
 
 #endif
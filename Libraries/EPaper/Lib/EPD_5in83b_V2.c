@@ -45,32 +45,6 @@ static void EPD_5IN83B_V2_Reset(void)
 	EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_5IN83B_V2_SendCommand(UBYTE Reg)
-{
-	EPD_Digital_Write(EPD_DC_PIN, 0);
-	EPD_Digital_Write(EPD_CS_PIN, 0);
-	EPD_SPI_WriteByte(Reg);
-	EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_5IN83B_V2_SendData(UBYTE Data)
-{
-	EPD_Digital_Write(EPD_CS_PIN, 0);
-	EPD_Digital_Write(EPD_DC_PIN, 1);
-	EPD_SPI_WriteByte(Data);
-	EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -81,7 +55,7 @@ void EPD_5IN83B_V2_WaitUntilIdle(void)
 	UBYTE busy;
 	do
 	{
-		EPD_5IN83B_V2_SendCommand(0x71);
+		EPD_SendCommand(0x71);
 		busy = EPD_Digital_Read(EPD_BUSY_PIN);
 		busy =!(busy & 0x01);
 	}
@@ -96,7 +70,7 @@ parameter:
 ******************************************************************************/
 static void EPD_5IN83B_V2_TurnOnDisplay(void)
 {
-	EPD_5IN83B_V2_SendCommand(0x12);			//DISPLAY REFRESH 	
+	EPD_SendCommand(0x12);			//DISPLAY REFRESH 	
 	EPD_Delay_ms(100);	        //!!!The delay here is necessary, 200uS at least!!!     
 	EPD_5IN83B_V2_WaitUntilIdle();        //waiting for the electronic paper IC to release the idle signal
 }
@@ -109,34 +83,34 @@ UBYTE EPD_5IN83B_V2_Init(void)
 {
 	EPD_5IN83B_V2_Reset();
 	EPD_5IN83B_V2_WaitUntilIdle();
-	EPD_5IN83B_V2_SendCommand(0x01);			//POWER SETTING
-	EPD_5IN83B_V2_SendData (0x07);
-	EPD_5IN83B_V2_SendData (0x07);    //VGH=20V,VGL=-20V
-	EPD_5IN83B_V2_SendData (0x3f);		//VDH=15V
-	EPD_5IN83B_V2_SendData (0x3f);		//VDL=-15V
+	EPD_SendCommand(0x01);			//POWER SETTING
+	EPD_SendData (0x07);
+	EPD_SendData (0x07);    //VGH=20V,VGL=-20V
+	EPD_SendData (0x3f);		//VDH=15V
+	EPD_SendData (0x3f);		//VDL=-15V
 
-	EPD_5IN83B_V2_SendCommand(0x04); //POWER ON
+	EPD_SendCommand(0x04); //POWER ON
 	EPD_Delay_ms(100);  
 	EPD_5IN83B_V2_WaitUntilIdle();        //waiting for the electronic paper IC to release the idle signal
 
-	EPD_5IN83B_V2_SendCommand(0X00);			//PANNEL SETTING
-	EPD_5IN83B_V2_SendData(0x0F);   //KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
+	EPD_SendCommand(0X00);			//PANNEL SETTING
+	EPD_SendData(0x0F);   //KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
 
-	EPD_5IN83B_V2_SendCommand(0x61);        	//tres			
-	EPD_5IN83B_V2_SendData (0x02);		//source 648
-	EPD_5IN83B_V2_SendData (0x88);
-	EPD_5IN83B_V2_SendData (0x01);		//gate 480
-	EPD_5IN83B_V2_SendData (0xe0);
+	EPD_SendCommand(0x61);        	//tres			
+	EPD_SendData (0x02);		//source 648
+	EPD_SendData (0x88);
+	EPD_SendData (0x01);		//gate 480
+	EPD_SendData (0xe0);
 
-	EPD_5IN83B_V2_SendCommand(0X15);		
-	EPD_5IN83B_V2_SendData(0x00);		
+	EPD_SendCommand(0X15);		
+	EPD_SendData(0x00);		
 
-	EPD_5IN83B_V2_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING
-	EPD_5IN83B_V2_SendData(0x11);
-	EPD_5IN83B_V2_SendData(0x07);
+	EPD_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING
+	EPD_SendData(0x11);
+	EPD_SendData(0x07);
 
-	EPD_5IN83B_V2_SendCommand(0X60);			//TCON SETTING
-	EPD_5IN83B_V2_SendData(0x22);
+	EPD_SendCommand(0X60);			//TCON SETTING
+	EPD_SendData(0x22);
 
 	return 0;
 }
@@ -150,17 +124,10 @@ void EPD_5IN83B_V2_Clear(void)
 	UWORD Width, Height;
 	Width =(EPD_5IN83B_V2_WIDTH % 8 == 0)?(EPD_5IN83B_V2_WIDTH / 8 ):(EPD_5IN83B_V2_WIDTH / 8 + 1);
 	Height = EPD_5IN83B_V2_HEIGHT;
-	UWORD i;
-	EPD_5IN83B_V2_SendCommand(0x10);
-	for(i=0; i<Width*Height; i++) {
-		EPD_5IN83B_V2_SendData(0xff);
-
-	}
-	EPD_5IN83B_V2_SendCommand(0x13);
-	for(i=0; i<Width*Height; i++)	{
-		EPD_5IN83B_V2_SendData(0x00);
-
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst(0xff, Width*Height);
+	EPD_SendCommand(0x13);
+	EPD_SendDataBurst(0x00, Width*Height);
 	EPD_5IN83B_V2_TurnOnDisplay();
 }
 
@@ -173,42 +140,23 @@ void EPD_5IN83B_V2_Clear_C(UBYTE color)
 	UWORD Width, Height;
 	Width =(EPD_5IN83B_V2_WIDTH % 8 == 0)?(EPD_5IN83B_V2_WIDTH / 8 ):(EPD_5IN83B_V2_WIDTH / 8 + 1);
 	Height = EPD_5IN83B_V2_HEIGHT;
-	UWORD i;
 	if(color == 0) {
-	EPD_5IN83B_V2_SendCommand(0x10);
-	for(i=0; i<Width*Height; i++) {
-		EPD_5IN83B_V2_SendData(0xff);
-
-	}
-	EPD_5IN83B_V2_SendCommand(0x13);
-	for(i=0; i<Width*Height; i++)	{
-		EPD_5IN83B_V2_SendData(0x00);
-
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst(0xff, Width*Height);
+	EPD_SendCommand(0x13);
+	EPD_SendDataBurst(0x00, Width*Height);
 }
 	else if(color == 1) {
-	EPD_5IN83B_V2_SendCommand(0x10);
-	for(i=0; i<Width*Height; i++) {
-		EPD_5IN83B_V2_SendData(0xff);
-
-	}
-	EPD_5IN83B_V2_SendCommand(0x13);
-	for(i=0; i<Width*Height; i++)	{
-		EPD_5IN83B_V2_SendData(0xff);
-
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst(0xff, Width*Height);
+	EPD_SendCommand(0x13);
+	EPD_SendDataBurst(0xff, Width*Height);
 }
 	else if(color == 2) {
-	EPD_5IN83B_V2_SendCommand(0x10);
-	for(i=0; i<Width*Height; i++) {
-		EPD_5IN83B_V2_SendData(0x00);
-
-	}
-	EPD_5IN83B_V2_SendCommand(0x13);
-	for(i=0; i<Width*Height; i++)	{
-		EPD_5IN83B_V2_SendData(0x00);
-
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst(0x00, Width*Height);
+	EPD_SendCommand(0x13);
+	EPD_SendDataBurst(0x00, Width*Height);
 }
 	EPD_5IN83B_V2_TurnOnDisplay();
 }
@@ -223,17 +171,13 @@ void EPD_5IN83B_V2_Display(const UBYTE *blackimage, const UBYTE *ryimage)
 	Width =(EPD_5IN83B_V2_WIDTH % 8 == 0)?(EPD_5IN83B_V2_WIDTH / 8 ):(EPD_5IN83B_V2_WIDTH / 8 + 1);
 	Height = EPD_5IN83B_V2_HEIGHT;
 	//send black data
-	EPD_5IN83B_V2_SendCommand(0x10);
-	for (UDOUBLE j = 0; j < Height; j++) {
-		for (UDOUBLE i = 0; i < Width; i++) {
-			EPD_5IN83B_V2_SendData(blackimage[i + j * Width]);
-		}
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataArray(blackimage, (UDOUBLE)Width * Height);
 	//send red data
-	EPD_5IN83B_V2_SendCommand(0x13);
+	EPD_SendCommand(0x13);
 	for (UDOUBLE j = 0; j < Height; j++) {
 		for (UDOUBLE i = 0; i < Width; i++) {
-			EPD_5IN83B_V2_SendData(~ryimage[i + j * Width]);
+			EPD_SendData(~ryimage[i + j * Width]);
 		}
 	}
 	EPD_5IN83B_V2_TurnOnDisplay();
@@ -246,54 +190,38 @@ void EPD_5IN83B_V2_DisplayPicture(const UBYTE *blackimage,UBYTE Block)
 	Height = EPD_5IN83B_V2_HEIGHT;
 
 	if(Block == 0){
-		EPD_5IN83B_V2_SendCommand(0x10);
-    for (UDOUBLE j = 0; j < Height/4; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_5IN83B_V2_SendData(blackimage[i + j * Width]);
-        }
-    }		
+		EPD_SendCommand(0x10);
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * (Height/4));		
 	}else if(Block == 1){
-		for (UDOUBLE j = 0; j < Height/4; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_5IN83B_V2_SendData(blackimage[i + j * Width]);
-        }
-    }
+		EPD_SendDataArray(blackimage, (UDOUBLE)Width * (Height/4));
 	}else if(Block == 2){
-		for (UDOUBLE j = 0; j < Height/4; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_5IN83B_V2_SendData(blackimage[i + j * Width]);
-        }
-    }
+		EPD_SendDataArray(blackimage, (UDOUBLE)Width * (Height/4));
 	}else if(Block == 3){
-		for (UDOUBLE j = 0; j < Height/4; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_5IN83B_V2_SendData(blackimage[i + j * Width]);
-        }
-    }
+		EPD_SendDataArray(blackimage, (UDOUBLE)Width * (Height/4));
 	}
 	else if(Block == 4){
-		EPD_5IN83B_V2_SendCommand(0x13);
+		EPD_SendCommand(0x13);
     for (UDOUBLE j = 0; j < Height/4; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_5IN83B_V2_SendData(~blackimage[i + j * Width]);
+            EPD_SendData(~blackimage[i + j * Width]);
         }
     }
 	}else if(Block == 5){
 		for (UDOUBLE j = 0; j < Height/4; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_5IN83B_V2_SendData(~blackimage[i + j * Width]);
+            EPD_SendData(~blackimage[i + j * Width]);
         }
     }
 	}else if(Block == 6){
 		for (UDOUBLE j = 0; j < Height/4; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_5IN83B_V2_SendData(~blackimage[i + j * Width]);
+            EPD_SendData(~blackimage[i + j * Width]);
         }
     }
 	}else if(Block == 7){
 		for (UDOUBLE j = 0; j < Height/4; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_5IN83B_V2_SendData(~blackimage[i + j * Width]);
+            EPD_SendData(~blackimage[i + j * Width]);
         }
     }
 		EPD_5IN83B_V2_TurnOnDisplay();
@@ -306,10 +234,10 @@ parameter:
 ******************************************************************************/
 void EPD_5IN83B_V2_Sleep(void)
 {
-	EPD_5IN83B_V2_SendCommand(0X02);  	//power off
+	EPD_SendCommand(0X02);  	//power off
 	EPD_5IN83B_V2_WaitUntilIdle();        //waiting for the electronic paper IC to release the idle signal
-	EPD_5IN83B_V2_SendCommand(0X07);  	//deep sleep
-	EPD_5IN83B_V2_SendData(0xA5);
+	EPD_SendCommand(0X07);  	//deep sleep
+	EPD_SendData(0xA5);
 }
 
 #endif
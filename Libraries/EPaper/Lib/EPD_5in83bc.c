@@ -100,32 +100,6 @@ static void EPD_5IN83BC_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_5IN83BC_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_5IN83BC_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -135,7 +109,7 @@ void EPD_5IN83BC_ReadBusy(void)
     UBYTE busy;
     EPD_Printf("e-Paper busy\r\n");
     do {
-        EPD_5IN83BC_SendCommand(0x71);
+        EPD_SendCommand(0x71);
         busy = EPD_Digital_Read(EPD_BUSY_PIN);
         busy =!(busy & 0x01);
     } while(busy);
@@ -148,9 +122,9 @@ parameter:
 ******************************************************************************/
 static void EPD_5IN83BC_TurnOnDisplay(void)
 {
-    EPD_5IN83BC_SendCommand(0x04); // POWER ON
+    EPD_SendCommand(0x04); // POWER ON
     EPD_5IN83BC_ReadBusy();
-    EPD_5IN83BC_SendCommand(0x12); // display refresh
+    EPD_SendCommand(0x12); // display refresh
     EPD_Delay_ms(100);
     EPD_5IN83BC_ReadBusy();
 
@@ -164,42 +138,42 @@ void EPD_5IN83BC_Init(void)
 {
     EPD_5IN83BC_Reset();
 
-    EPD_5IN83BC_SendCommand(0x01); // POWER_SETTING
-    EPD_5IN83BC_SendData(0x37);
-    EPD_5IN83BC_SendData(0x00);
+    EPD_SendCommand(0x01); // POWER_SETTING
+    EPD_SendData(0x37);
+    EPD_SendData(0x00);
 
-    EPD_5IN83BC_SendCommand(0x00); // PANEL_SETTING
-    EPD_5IN83BC_SendData(0xCF);
-    EPD_5IN83BC_SendData(0x08);
+    EPD_SendCommand(0x00); // PANEL_SETTING
+    EPD_SendData(0xCF);
+    EPD_SendData(0x08);
 
-    EPD_5IN83BC_SendCommand(0x30); // PLL_CONTROL
-    EPD_5IN83BC_SendData(0x3A); //PLL:  0-15:0x3C, 15+:0x3A
+    EPD_SendCommand(0x30); // PLL_CONTROL
+    EPD_SendData(0x3A); //PLL:  0-15:0x3C, 15+:0x3A
 
-    EPD_5IN83BC_SendCommand(0x82); // VCM_DC_SETTING
-    EPD_5IN83BC_SendData(0x28); //all temperature  range
+    EPD_SendCommand(0x82); // VCM_DC_SETTING
+    EPD_SendData(0x28); //all temperature  range
 
-    EPD_5IN83BC_SendCommand(0x06); // BOOSTER_SOFT_START
-    EPD_5IN83BC_SendData (0xc7);
-    EPD_5IN83BC_SendData (0xcc);
-    EPD_5IN83BC_SendData (0x15);
+    EPD_SendCommand(0x06); // BOOSTER_SOFT_START
+    EPD_SendData (0xc7);
+    EPD_SendData (0xcc);
+    EPD_SendData (0x15);
 
-    EPD_5IN83BC_SendCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-    EPD_5IN83BC_SendData(0x77);
+    EPD_SendCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+    EPD_SendData(0x77);
 
-    EPD_5IN83BC_SendCommand(0x60); // TCON_SETTING
-    EPD_5IN83BC_SendData(0x22);
+    EPD_SendCommand(0x60); // TCON_SETTING
+    EPD_SendData(0x22);
 
-    EPD_5IN83BC_SendCommand(0x65); // FLASH CONTROL
-    EPD_5IN83BC_SendData(0x00);
+    EPD_SendCommand(0x65); // FLASH CONTROL
+    EPD_SendData(0x00);
 
-    EPD_5IN83BC_SendCommand(0x61); // TCON_RESOLUTION
-    EPD_5IN83BC_SendData (0x02); // source 600
-    EPD_5IN83BC_SendData (0x58);
-    EPD_5IN83BC_SendData (0x01); // gate 448
-    EPD_5IN83BC_SendData (0xc0);
+    EPD_SendCommand(0x61); // TCON_RESOLUTION
+    EPD_SendData (0x02); // source 600
+    EPD_SendData (0x58);
+    EPD_SendData (0x01); // gate 448
+    EPD_SendData (0xc0);
 
-    EPD_5IN83BC_SendCommand(0xe5); // FLASH MODE
-    EPD_5IN83BC_SendData(0x03);
+    EPD_SendCommand(0xe5); // FLASH MODE
+    EPD_SendData(0x03);
 
 }
 
@@ -213,13 +187,9 @@ void EPD_5IN83BC_Clear(void)
     Width = (EPD_5IN83BC_WIDTH % 8 == 0)? (EPD_5IN83BC_WIDTH / 8): (EPD_5IN83BC_WIDTH / 8 + 1);
     Height = EPD_5IN83BC_HEIGHT;
 
-    EPD_5IN83BC_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            for(UBYTE k = 0; k < 4; k++) {
-                EPD_5IN83BC_SendData(0x33);
-            }
-        }
+        EPD_SendDataBurst(0x33, (UDOUBLE)4 * Width);
     }
 
     EPD_5IN83BC_TurnOnDisplay();
@@ -236,7 +206,7 @@ void EPD_5IN83BC_Display(const UBYTE *blackimage, const UBYTE *ryimage)
     Width = (EPD_5IN83BC_WIDTH % 8 == 0)? (EPD_5IN83BC_WIDTH / 8 ): (EPD_5IN83BC_WIDTH / 8 + 1);
     Height = EPD_5IN83BC_HEIGHT;
 
-    EPD_5IN83BC_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (j = 0; j < Height; j++) {
         for (i = 0; i < Width; i++) {
             Data_Black = blackimage[i + j * Width];
@@ -263,7 +233,7 @@ void EPD_5IN83BC_Display(const UBYTE *blackimage, const UBYTE *ryimage)
                 }
                 Data_Black = (Data_Black << 1) & 0xFF;
                 Data_RY = (Data_RY << 1) & 0xFF;
-                EPD_5IN83BC_SendData(Data);
+                EPD_SendData(Data);
             }
         }
     }
@@ -282,7 +252,7 @@ void EPD_5IN83BC_DisplayHalfScreen(const UBYTE *blackimage, const UBYTE *ryimage
     Width = (EPD_5IN83BC_WIDTH % 8 == 0)? (EPD_5IN83BC_WIDTH / 8 ): (EPD_5IN83BC_WIDTH / 8 + 1);
     Height = EPD_5IN83BC_HEIGHT;
 
-    EPD_5IN83BC_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (j = 0; j < Height / 2; j++) {
         for (i = 0; i < Width; i++) {
             Data_Black = blackimage[i + j * Width];
@@ -309,17 +279,13 @@ void EPD_5IN83BC_DisplayHalfScreen(const UBYTE *blackimage, const UBYTE *ryimage
                 }
                 Data_Black = (Data_Black << 1) & 0xFF;
                 Data_RY = (Data_RY << 1) & 0xFF;
-                EPD_5IN83BC_SendData(Data);
+                EPD_SendData(Data);
             }
         }
     }
 		
 		for (j = 0; j < Height / 2; j++) {
-        for (i = 0; i < Width; i++) {
-            for(UBYTE k = 0; k < 4; k++) {
-                EPD_5IN83BC_SendData(0x33);
-            }
-        }
+        EPD_SendDataBurst(0x33, (UDOUBLE)4 * Width);
     }
 
     EPD_5IN83BC_TurnOnDisplay();
@@ -331,10 +297,10 @@ parameter:
 ******************************************************************************/
 void EPD_5IN83BC_Sleep(void)
 {
-    EPD_5IN83BC_SendCommand(0x02); // POWER_OFF
+    EPD_SendCommand(0x02); // POWER_OFF
     EPD_5IN83BC_ReadBusy();
-    EPD_5IN83BC_SendCommand(0x07); // DEEP_SLEEP
-    EPD_5IN83BC_SendData(0XA5);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
@@ -46,32 +46,6 @@ static void EPD_7IN3F_Reset(void)
 	EPD_Delay_ms(20);
 }
 
-/******************************************************************************
-function :  send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_7IN3F_SendCommand(UBYTE Reg)
-{
-	EPD_Digital_Write(EPD_DC_PIN, 0);
-	EPD_Digital_Write(EPD_CS_PIN, 0);
-	EPD_SPI_WriteByte(Reg);
-	EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :  send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_7IN3F_SendData(UBYTE Data)
-{
-	EPD_Digital_Write(EPD_DC_PIN, 1);
-	EPD_Digital_Write(EPD_CS_PIN, 0);
-	EPD_SPI_WriteByte(Data);
-	EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :  Wait until the busy_pin goes LOW
 parameter:
@@ -91,15 +65,15 @@ parameter:
 ******************************************************************************/
 static void EPD_7IN3F_TurnOnDisplay(void)
 {
-	EPD_7IN3F_SendCommand(0x04); // POWER_ON
+	EPD_SendCommand(0x04); // POWER_ON
 	EPD_7IN3F_ReadBusyH();
 
-	EPD_7IN3F_SendCommand(0x12); // DISPLAY_REFRESH
-	EPD_7IN3F_SendData(0x00);
+	EPD_SendCommand(0x12); // DISPLAY_REFRESH
+	EPD_SendData(0x00);
 	EPD_7IN3F_ReadBusyH();
 
-	EPD_7IN3F_SendCommand(0x02); // POWER_OFF
-	EPD_7IN3F_SendData(0X00);
+	EPD_SendCommand(0x02); // POWER_OFF
+	EPD_SendData(0X00);
 	EPD_7IN3F_ReadBusyH();
 }
 
@@ -113,90 +87,90 @@ void EPD_7IN3F_Init(void)
 	EPD_7IN3F_ReadBusyH();
 	EPD_Delay_ms(30);
 
-	EPD_7IN3F_SendCommand(0xAA);    // CMDH
-	EPD_7IN3F_SendData(0x49);
-	EPD_7IN3F_SendData(0x55);
-	EPD_7IN3F_SendData(0x20);
-	EPD_7IN3F_SendData(0x08);
-	EPD_7IN3F_SendData(0x09);
-	EPD_7IN3F_SendData(0x18);
-
-	EPD_7IN3F_SendCommand(0x01);
-	EPD_7IN3F_SendData(0x3F);
-	EPD_7IN3F_SendData(0x00);
-	EPD_7IN3F_SendData(0x32);
-	EPD_7IN3F_SendData(0x2A);
-	EPD_7IN3F_SendData(0x0E);
-	EPD_7IN3F_SendData(0x2A);
-
-	EPD_7IN3F_SendCommand(0x00);
-	EPD_7IN3F_SendData(0x5F);
-	EPD_7IN3F_SendData(0x69);
-
-	EPD_7IN3F_SendCommand(0x03);
-	EPD_7IN3F_SendData(0x00);
-	EPD_7IN3F_SendData(0x54);
-	EPD_7IN3F_SendData(0x00);
-	EPD_7IN3F_SendData(0x44); 
-
-	EPD_7IN3F_SendCommand(0x05);
-	EPD_7IN3F_SendData(0x40);
-	EPD_7IN3F_SendData(0x1F);
-	EPD_7IN3F_SendData(0x1F);
-	EPD_7IN3F_SendData(0x2C);
-
-	EPD_7IN3F_SendCommand(0x06);
-	EPD_7IN3F_SendData(0x6F);
-	EPD_7IN3F_SendData(0x1F);
-	EPD_7IN3F_SendData(0x1F);
-	EPD_7IN3F_SendData(0x22);
-
-	EPD_7IN3F_SendCommand(0x08);
-	EPD_7IN3F_SendData(0x6F);
-	EPD_7IN3F_SendData(0x1F);
-	EPD_7IN3F_SendData(0x1F);
-	EPD_7IN3F_SendData(0x22);
-
-	EPD_7IN3F_SendCommand(0x13);    // IPC
-	EPD_7IN3F_SendData(0x00);
-	EPD_7IN3F_SendData(0x04);
-
-	EPD_7IN3F_SendCommand(0x30);
-	EPD_7IN3F_SendData(0x3C);
-
-	EPD_7IN3F_SendCommand(0x41);     // TSE
-	EPD_7IN3F_SendData(0x00);
-
-	EPD_7IN3F_SendCommand(0x50);
-	EPD_7IN3F_SendData(0x3F);
-
-	EPD_7IN3F_SendCommand(0x60);
-	EPD_7IN3F_SendData(0x02);
-	EPD_7IN3F_SendData(0x00);
-
-	EPD_7IN3F_SendCommand(0x61);
-	EPD_7IN3F_SendData(0x03);
-	EPD_7IN3F_SendData(0x20);
-	EPD_7IN3F_SendData(0x01); 
-	EPD_7IN3F_SendData(0xE0);
-
-	EPD_7IN3F_SendCommand(0x82);
-	EPD_7IN3F_SendData(0x1E); 
-
-	EPD_7IN3F_SendCommand(0x84);
-	EPD_7IN3F_SendData(0x00);
-
-	EPD_7IN3F_SendCommand(0x86);    // AGID
-	EPD_7IN3F_SendData(0x00);
-
-	EPD_7IN3F_SendCommand(0xE3);
-	EPD_7IN3F_SendData(0x2F);
-
-	EPD_7IN3F_SendCommand(0xE0);   // CCSET
-	EPD_7IN3F_SendData(0x00); 
-
-	EPD_7IN3F_SendCommand(0xE6);   // TSSET
-	EPD_7IN3F_SendData(0x00);
+	EPD_SendCommand(0xAA);    // CMDH
+	EPD_SendData(0x49);
+	EPD_SendData(0x55);
+	EPD_SendData(0x20);
+	EPD_SendData(0x08);
+	EPD_SendData(0x09);
+	EPD_SendData(0x18);
+
+	EPD_SendCommand(0x01);
+	EPD_SendData(0x3F);
+	EPD_SendData(0x00);
+	EPD_SendData(0x32);
+	EPD_SendData(0x2A);
+	EPD_SendData(0x0E);
+	EPD_SendData(0x2A);
+
+	EPD_SendCommand(0x00);
+	EPD_SendData(0x5F);
+	EPD_SendData(0x69);
+
+	EPD_SendCommand(0x03);
+	EPD_SendData(0x00);
+	EPD_SendData(0x54);
+	EPD_SendData(0x00);
+	EPD_SendData(0x44); 
+
+	EPD_SendCommand(0x05);
+	EPD_SendData(0x40);
+	EPD_SendData(0x1F);
+	EPD_SendData(0x1F);
+	EPD_SendData(0x2C);
+
+	EPD_SendCommand(0x06);
+	EPD_SendData(0x6F);
+	EPD_SendData(0x1F);
+	EPD_SendData(0x1F);
+	EPD_SendData(0x22);
+
+	EPD_SendCommand(0x08);
+	EPD_SendData(0x6F);
+	EPD_SendData(0x1F);
+	EPD_SendData(0x1F);
+	EPD_SendData(0x22);
+
+	EPD_SendCommand(0x13);    // IPC
+	EPD_SendData(0x00);
+	EPD_SendData(0x04);
+
+	EPD_SendCommand(0x30);
+	EPD_SendData(0x3C);
+
+	EPD_SendCommand(0x41);     // TSE
+	EPD_SendData(0x00);
+
+	EPD_SendCommand(0x50);
+	EPD_SendData(0x3F);
+
+	EPD_SendCommand(0x60);
+	EPD_SendData(0x02);
+	EPD_SendData(0x00);
+
+	EPD_SendCommand(0x61);
+	EPD_SendData(0x03);
+	EPD_SendData(0x20);
+	EPD_SendData(0x01); 
+	EPD_SendData(0xE0);
+
+	EPD_SendCommand(0x82);
+	EPD_SendData(0x1E); 
+
+	EPD_SendCommand(0x84);
+	EPD_SendData(0x00);
+
+	EPD_SendCommand(0x86);    // AGID
+	EPD_SendData(0x00);
+
+	EPD_SendCommand(0xE3);
+	EPD_SendData(0x2F);
+
+	EPD_SendCommand(0xE0);   // CCSET
+	EPD_SendData(0x00); 
+
+	EPD_SendCommand(0xE6);   // TSSET
+	EPD_SendData(0x00);
 }
 
 /******************************************************************************
@@ -209,12 +183,8 @@ void EPD_7IN3F_Clear(UBYTE color)
 	Width = (EPD_7IN3F_WIDTH % 2 == 0)? (EPD_7IN3F_WIDTH / 2 ): (EPD_7IN3F_WIDTH / 2 + 1);
 	Height = EPD_7IN3F_HEIGHT;
 
-	EPD_7IN3F_SendCommand(0x10);
-	for (UWORD j = 0; j < Height; j++) {
-		for (UWORD i = 0; i < Width; i++) {
-			EPD_7IN3F_SendData((color<<4)|color);
-		}
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataBurst((color<<4)|color, (UDOUBLE)Width * Height);
 
 	EPD_7IN3F_TurnOnDisplay();
 }
@@ -230,11 +200,11 @@ void EPD_7IN3F_Show7Block(void)
 	{EPD_7IN3F_BLACK, EPD_7IN3F_BLUE, EPD_7IN3F_GREEN, EPD_7IN3F_ORANGE,
 	EPD_7IN3F_RED, EPD_7IN3F_YELLOW, EPD_7IN3F_WHITE, EPD_7IN3F_WHITE};
 
-	EPD_7IN3F_SendCommand(0x10);
+	EPD_SendCommand(0x10);
 	for(i=0; i<240; i++) {
 		for(k = 0 ; k < 4; k ++) {
 			for(j = 0 ; j < 100; j ++) {
-				EPD_7IN3F_SendData((Color_seven[k]<<4) |Color_seven[k]);
+				EPD_SendData((Color_seven[k]<<4) |Color_seven[k]);
 			}
 		}
 	}
@@ -242,7 +212,7 @@ void EPD_7IN3F_Show7Block(void)
 	for(i=0; i<240; i++) {
 		for(k = 4 ; k < 8; k ++) {
 			for(j = 0 ; j < 100; j ++) {
-				EPD_7IN3F_SendData((Color_seven[k]<<4) |Color_seven[k]);
+				EPD_SendData((Color_seven[k]<<4) |Color_seven[k]);
 			}
 		}
 	}
@@ -259,15 +229,30 @@ void EPD_7IN3F_Display(const UBYTE *Image)
 	Width = (EPD_7IN3F_WIDTH % 2 == 0)? (EPD_7IN3F_WIDTH / 2 ): (EPD_7IN3F_WIDTH / 2 + 1);
 	Height = EPD_7IN3F_HEIGHT;
 
-	EPD_7IN3F_SendCommand(0x10);
-	for (UWORD j = 0; j < Height; j++) {
-		for (UWORD i = 0; i < Width; i++) {
-			EPD_7IN3F_SendData(Image[i + j * Width]);
-		}
-	}
+	EPD_SendCommand(0x10);
+	EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
 	EPD_7IN3F_TurnOnDisplay();
 }
 
+/******************************************************************************
+function :  Sends one band of the image to the RAM, refreshing after the last
+parameter:
+    Band   : Rows lines of the image, as filled by Paint_RenderBands()
+    Ystart : First line of the band
+    Rows   : Number of lines in the band
+******************************************************************************/
+void EPD_7IN3F_DisplayBand(const UBYTE *Band, UWORD Ystart, UWORD Rows)
+{
+	UWORD Width;
+	Width = (EPD_7IN3F_WIDTH % 2 == 0)? (EPD_7IN3F_WIDTH / 2 ): (EPD_7IN3F_WIDTH / 2 + 1);
+
+	if (Ystart == 0)
+		EPD_SendCommand(0x10);
+	EPD_SendDataArray(Band, (UDOUBLE)Rows * Width);
+	if (Ystart + Rows >= EPD_7IN3F_HEIGHT)
+		EPD_7IN3F_TurnOnDisplay();
+}
+
 void EPD_7IN3F_DisplayPart(const UBYTE *Image, UWORD xstart, UWORD ystart, UWORD image_width, UWORD image_heigh)
 {
 	unsigned long i, j;
@@ -275,14 +260,14 @@ void EPD_7IN3F_DisplayPart(const UBYTE *Image, UWORD xstart, UWORD ystart, UWORD
 	Width = (EPD_7IN3F_WIDTH % 2 == 0)? (EPD_7IN3F_WIDTH / 2 ): (EPD_7IN3F_WIDTH / 2 + 1);
 	Height = EPD_7IN3F_HEIGHT;
 	
-	EPD_7IN3F_SendCommand(0x10);
+	EPD_SendCommand(0x10);
 	for(i=0; i<Height; i++) {
 		for(j=0; j<Width; j++) {
 			if(i<image_heigh+ystart && i>=ystart && j<(image_width+xstart)/2 && j>=xstart/2) {
-				EPD_7IN3F_SendData(Image[(j-xstart/2) + (image_width/2*(i-ystart))]);
+				EPD_SendData(Image[(j-xstart/2) + (image_width/2*(i-ystart))]);
 			}
 			else {
-				EPD_7IN3F_SendData(0x11);
+				EPD_SendData(0x11);
 			}
 		}
 	}
@@ -295,8 +280,8 @@ parameter:
 ******************************************************************************/
 void EPD_7IN3F_Sleep(void)
 {
-	EPD_7IN3F_SendCommand(0x07); // DEEP_SLEEP
-	EPD_7IN3F_SendData(0XA5);
+	EPD_SendCommand(0x07); // DEEP_SLEEP
+	EPD_SendData(0XA5);
 }
 
 #endif
@@ -53,6 +53,7 @@ void EPD_7IN3F_Init(void);
 void EPD_7IN3F_Clear(UBYTE color);
 void EPD_7IN3F_Show7Block(void);
 void EPD_7IN3F_Display(const UBYTE *Image);
+void EPD_7IN3F_DisplayBand(const UBYTE *Band, UWORD Ystart, UWORD Rows);
 void EPD_7IN3F_DisplayPart(const UBYTE *Image, UWORD xstart, UWORD ystart, UWORD image_width, UWORD image_heigh);
 void EPD_7IN3F_Sleep(void);
 
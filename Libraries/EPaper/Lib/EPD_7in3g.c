@@ -46,32 +46,6 @@ static void EPD_7IN3G_Reset(void)
     EPD_Delay_ms(20);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_7IN3G_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_7IN3G_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -91,12 +65,12 @@ parameter:
 ******************************************************************************/
 static void EPD_7IN3G_TurnOnDisplay(void)
 {
-    EPD_7IN3G_SendCommand(0x12); // DISPLAY_REFRESH
-    EPD_7IN3G_SendData(0x00);
+    EPD_SendCommand(0x12); // DISPLAY_REFRESH
+    EPD_SendData(0x00);
     EPD_7IN3G_ReadBusyH();
 
-    EPD_7IN3G_SendCommand(0x02); // POWER_OFF
-    EPD_7IN3G_SendData(0X00);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
     EPD_7IN3G_ReadBusyH();
 }
 
@@ -110,70 +84,70 @@ void EPD_7IN3G_Init(void)
     EPD_7IN3G_ReadBusyH();
     EPD_Delay_ms(30);
 
-    EPD_7IN3G_SendCommand(0xAA);
-    EPD_7IN3G_SendData(0x49);
-    EPD_7IN3G_SendData(0x55);
-    EPD_7IN3G_SendData(0x20);
-    EPD_7IN3G_SendData(0x08);
-    EPD_7IN3G_SendData(0x09);
-    EPD_7IN3G_SendData(0x18);
-
-    EPD_7IN3G_SendCommand(0x01);
-    EPD_7IN3G_SendData(0x3F);
-
-    EPD_7IN3G_SendCommand(0x00);
-    EPD_7IN3G_SendData(0x4F);
-    EPD_7IN3G_SendData(0x69);
-
-    EPD_7IN3G_SendCommand(0x05);
-    EPD_7IN3G_SendData(0x40);
-    EPD_7IN3G_SendData(0x1F);
-    EPD_7IN3G_SendData(0x1F);
-    EPD_7IN3G_SendData(0x2C);
-
-    EPD_7IN3G_SendCommand(0x08);
-    EPD_7IN3G_SendData(0x6F);
-    EPD_7IN3G_SendData(0x1F);
-    EPD_7IN3G_SendData(0x1F);
-    EPD_7IN3G_SendData(0x22);
+    EPD_SendCommand(0xAA);
+    EPD_SendData(0x49);
+    EPD_SendData(0x55);
+    EPD_SendData(0x20);
+    EPD_SendData(0x08);
+    EPD_SendData(0x09);
+    EPD_SendData(0x18);
+
+    EPD_SendCommand(0x01);
+    EPD_SendData(0x3F);
+
+    EPD_SendCommand(0x00);
+    EPD_SendData(0x4F);
+    EPD_SendData(0x69);
+
+    EPD_SendCommand(0x05);
+    EPD_SendData(0x40);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x2C);
+
+    EPD_SendCommand(0x08);
+    EPD_SendData(0x6F);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x22);
 
     //===================
     //20211212
     //First setting
-    EPD_7IN3G_SendCommand(0x06);
-    EPD_7IN3G_SendData(0x6F);
-    EPD_7IN3G_SendData(0x1F);
-    EPD_7IN3G_SendData(0x14);
-    EPD_7IN3G_SendData(0x14);
+    EPD_SendCommand(0x06);
+    EPD_SendData(0x6F);
+    EPD_SendData(0x1F);
+    EPD_SendData(0x14);
+    EPD_SendData(0x14);
     //===================
 
-    EPD_7IN3G_SendCommand(0x03);
-    EPD_7IN3G_SendData(0x00);
-    EPD_7IN3G_SendData(0x54);
-    EPD_7IN3G_SendData(0x00);
-    EPD_7IN3G_SendData(0x44);
+    EPD_SendCommand(0x03);
+    EPD_SendData(0x00);
+    EPD_SendData(0x54);
+    EPD_SendData(0x00);
+    EPD_SendData(0x44);
 
-    EPD_7IN3G_SendCommand(0x60);
-    EPD_7IN3G_SendData(0x02);
-    EPD_7IN3G_SendData(0x00);
+    EPD_SendCommand(0x60);
+    EPD_SendData(0x02);
+    EPD_SendData(0x00);
     //Please notice that PLL must be set for version 2 IC
-    EPD_7IN3G_SendCommand(0x30);
-    EPD_7IN3G_SendData(0x08);
+    EPD_SendCommand(0x30);
+    EPD_SendData(0x08);
 
-    EPD_7IN3G_SendCommand(0x50);
-    EPD_7IN3G_SendData(0x3F);
+    EPD_SendCommand(0x50);
+    EPD_SendData(0x3F);
 
-    EPD_7IN3G_SendCommand(0x61);
-    EPD_7IN3G_SendData(0x03);
-    EPD_7IN3G_SendData(0x20);
-    EPD_7IN3G_SendData(0x01); 
-    EPD_7IN3G_SendData(0xE0); 
+    EPD_SendCommand(0x61);
+    EPD_SendData(0x03);
+    EPD_SendData(0x20);
+    EPD_SendData(0x01); 
+    EPD_SendData(0xE0); 
 
-    EPD_7IN3G_SendCommand(0xE3);
-    EPD_7IN3G_SendData(0x2F);
+    EPD_SendCommand(0xE3);
+    EPD_SendData(0x2F);
 
-    EPD_7IN3G_SendCommand(0x84);
-    EPD_7IN3G_SendData(0x01);
+    EPD_SendCommand(0x84);
+    EPD_SendData(0x01);
 }
 
 /******************************************************************************
@@ -186,15 +160,11 @@ void EPD_7IN3G_Clear(UBYTE color)
     Width = (EPD_7IN3G_WIDTH % 4 == 0)? (EPD_7IN3G_WIDTH / 4 ): (EPD_7IN3G_WIDTH / 4 + 1);
     Height = EPD_7IN3G_HEIGHT;
     
-    EPD_7IN3G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_7IN3G_ReadBusyH();
 
-    EPD_7IN3G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_7IN3G_SendData((color << 6) | (color << 4) | (color << 2) | color);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst((color << 6) | (color << 4) | (color << 2) | color, (UDOUBLE)Width * Height);
 
     EPD_7IN3G_TurnOnDisplay();
 }
@@ -209,15 +179,11 @@ void EPD_7IN3G_Display(const UBYTE *Image)
     Width = (EPD_7IN3G_WIDTH % 4 == 0)? (EPD_7IN3G_WIDTH / 4 ): (EPD_7IN3G_WIDTH / 4 + 1);
     Height = EPD_7IN3G_HEIGHT;
     
-    EPD_7IN3G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_7IN3G_ReadBusyH();
 
-    EPD_7IN3G_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_7IN3G_SendData(Image[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(Image, (UDOUBLE)Width * Height);
     EPD_7IN3G_TurnOnDisplay();
 }
 
@@ -227,17 +193,17 @@ void EPD_7IN3G_Display_part(UBYTE *Image, UWORD xstart, UWORD ystart, UWORD imag
     Width = (EPD_7IN3G_WIDTH % 4 == 0)? (EPD_7IN3G_WIDTH / 4 ): (EPD_7IN3G_WIDTH / 4 + 1);
     Height = EPD_7IN3G_HEIGHT;
     
-    EPD_7IN3G_SendCommand(0x04);
+    EPD_SendCommand(0x04);
     EPD_7IN3G_ReadBusyH();
 
-    EPD_7IN3G_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (UWORD i = 0; i < Height; i++) {
         for (UWORD j = 0; j < Width; j++) {
 					if(i<image_height+ystart && i>=ystart && j<(image_width+xstart)/4 && j>=xstart/4) {
-							EPD_7IN3G_SendData(Image[(j-xstart/4) + (image_width/4*(i-ystart))]);
+							EPD_SendData(Image[(j-xstart/4) + (image_width/4*(i-ystart))]);
 						}
 						else
-            EPD_7IN3G_SendData(0x55);
+            EPD_SendData(0x55);
         }
     }
     EPD_7IN3G_TurnOnDisplay();
@@ -249,10 +215,10 @@ parameter:
 ******************************************************************************/
 void EPD_7IN3G_Sleep(void)
 {
-    EPD_7IN3G_SendCommand(0x02); // POWER_OFF
-    EPD_7IN3G_SendData(0X00);
-    EPD_7IN3G_SendCommand(0x07); // DEEP_SLEEP
-    EPD_7IN3G_SendData(0XA5);
+    EPD_SendCommand(0x02); // POWER_OFF
+    EPD_SendData(0X00);
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);
 }
 
 #endif
@@ -102,32 +102,6 @@ static void EPD_7IN5_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_7IN5_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_7IN5_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -148,7 +122,7 @@ parameter:
 ******************************************************************************/
 static void EPD_7IN5_TurnOnDisplay(void)
 {
-    EPD_7IN5_SendCommand(0x12); // DISPLAY_REFRESH
+    EPD_SendCommand(0x12); // DISPLAY_REFRESH
     EPD_Delay_ms(100);
     EPD_7IN5_ReadBusy();
 }
@@ -161,45 +135,45 @@ void EPD_7IN5_Init(void)
 {
     EPD_7IN5_Reset();
 
-    EPD_7IN5_SendCommand(0x01); // POWER_SETTING
-    EPD_7IN5_SendData(0x37);
-    EPD_7IN5_SendData(0x00);
+    EPD_SendCommand(0x01); // POWER_SETTING
+    EPD_SendData(0x37);
+    EPD_SendData(0x00);
 
-    EPD_7IN5_SendCommand(0x00); // PANEL_SETTING
-    EPD_7IN5_SendData(0xCF);
-    EPD_7IN5_SendData(0x08);
+    EPD_SendCommand(0x00); // PANEL_SETTING
+    EPD_SendData(0xCF);
+    EPD_SendData(0x08);
 
-    EPD_7IN5_SendCommand(0x06); // BOOSTER_SOFT_START
-    EPD_7IN5_SendData(0xc7);
-    EPD_7IN5_SendData(0xcc);
-    EPD_7IN5_SendData(0x28);
+    EPD_SendCommand(0x06); // BOOSTER_SOFT_START
+    EPD_SendData(0xc7);
+    EPD_SendData(0xcc);
+    EPD_SendData(0x28);
 
-    EPD_7IN5_SendCommand(0x04); // POWER_ON
+    EPD_SendCommand(0x04); // POWER_ON
     EPD_7IN5_ReadBusy();
 
-    EPD_7IN5_SendCommand(0x30); // PLL_CONTROL
-    EPD_7IN5_SendData(0x3c);
+    EPD_SendCommand(0x30); // PLL_CONTROL
+    EPD_SendData(0x3c);
 
-    EPD_7IN5_SendCommand(0x41); // TEMPERATURE_CALIBRATION
-    EPD_7IN5_SendData(0x00);
+    EPD_SendCommand(0x41); // TEMPERATURE_CALIBRATION
+    EPD_SendData(0x00);
 
-    EPD_7IN5_SendCommand(0x50); // VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_7IN5_SendData(0x77);
+    EPD_SendCommand(0x50); // VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SendData(0x77);
 
-    EPD_7IN5_SendCommand(0x60); // TCON_SETTING
-    EPD_7IN5_SendData(0x22);
+    EPD_SendCommand(0x60); // TCON_SETTING
+    EPD_SendData(0x22);
 
-    EPD_7IN5_SendCommand(0x61); // TCON_RESOLUTION
-    EPD_7IN5_SendData(EPD_7IN5_WIDTH >> 8); // source 640
-    EPD_7IN5_SendData(EPD_7IN5_WIDTH & 0xff);
-    EPD_7IN5_SendData(EPD_7IN5_HEIGHT >> 8); // gate 384
-    EPD_7IN5_SendData(EPD_7IN5_HEIGHT & 0xff);
+    EPD_SendCommand(0x61); // TCON_RESOLUTION
+    EPD_SendData(EPD_7IN5_WIDTH >> 8); // source 640
+    EPD_SendData(EPD_7IN5_WIDTH & 0xff);
+    EPD_SendData(EPD_7IN5_HEIGHT >> 8); // gate 384
+    EPD_SendData(EPD_7IN5_HEIGHT & 0xff);
 
-    EPD_7IN5_SendCommand(0x82); // VCM_DC_SETTING
-    EPD_7IN5_SendData(0x1E); // decide by LUT file
+    EPD_SendCommand(0x82); // VCM_DC_SETTING
+    EPD_SendData(0x1E); // decide by LUT file
 
-    EPD_7IN5_SendCommand(0xe5); // FLASH MODE
-    EPD_7IN5_SendData(0x03);
+    EPD_SendCommand(0xe5); // FLASH MODE
+    EPD_SendData(0x03);
 
 }
 
@@ -213,13 +187,9 @@ void EPD_7IN5_Clear(void)
     Width = (EPD_7IN5_WIDTH % 8 == 0)? (EPD_7IN5_WIDTH / 8 ): (EPD_7IN5_WIDTH / 8 + 1);
     Height = EPD_7IN5_HEIGHT;
 
-    EPD_7IN5_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            for(UBYTE k = 0; k < 4; k++) {
-                EPD_7IN5_SendData(0x33);
-            }
-        }
+        EPD_SendDataBurst(0x33, (UDOUBLE)4 * Width);
     }
     EPD_7IN5_TurnOnDisplay();
 }
@@ -235,7 +205,7 @@ void EPD_7IN5_Display(UBYTE *Image)
     Width = (EPD_7IN5_WIDTH % 8 == 0)? (EPD_7IN5_WIDTH / 8 ): (EPD_7IN5_WIDTH / 8 + 1);
     Height = EPD_7IN5_HEIGHT;
 
-    EPD_7IN5_SendCommand(0x10);
+    EPD_SendCommand(0x10);
     for (UWORD j = 0; j < Height; j++) {
         for (UWORD i = 0; i < Width; i++) {
             Data_Black = ~Image[i + j * Width];
@@ -252,7 +222,7 @@ void EPD_7IN5_Display(UBYTE *Image)
                 else
                     Data |= 0x03;
                 Data_Black <<= 1;
-                EPD_7IN5_SendData(Data);
+                EPD_SendData(Data);
             }
         }
     }
@@ -265,10 +235,10 @@ parameter:
 ******************************************************************************/
 void EPD_7IN5_Sleep(void)
 {
-    EPD_7IN5_SendCommand(0x02); // POWER_OFF
+    EPD_SendCommand(0x02); // POWER_OFF
     EPD_7IN5_ReadBusy();
-    EPD_7IN5_SendCommand(0x07); // DEEP_SLEEP
-    EPD_7IN5_SendData(0XA5);;
+    EPD_SendCommand(0x07); // DEEP_SLEEP
+    EPD_SendData(0XA5);;
 }
 
 #endif
@@ -46,32 +46,6 @@ static void EPD_7IN5_HD_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function : send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_7IN5_HD_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_7IN5_HD_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -97,64 +71,64 @@ void EPD_7IN5_HD_Init(void)
     EPD_7IN5_HD_Reset();
     
     EPD_7IN5_HD_WaitUntilIdle();
-    EPD_7IN5_HD_SendCommand(0x12);  //SWRESET
+    EPD_SendCommand(0x12);  //SWRESET
     EPD_7IN5_HD_WaitUntilIdle();
     
-    EPD_7IN5_HD_SendCommand(0x46);  // Auto Write Red RAM
-    EPD_7IN5_HD_SendData(0xf7);
+    EPD_SendCommand(0x46);  // Auto Write Red RAM
+    EPD_SendData(0xf7);
     EPD_7IN5_HD_WaitUntilIdle();
-    EPD_7IN5_HD_SendCommand(0x47);  // Auto Write  B/W RAM
-    EPD_7IN5_HD_SendData(0xf7);
+    EPD_SendCommand(0x47);  // Auto Write  B/W RAM
+    EPD_SendData(0xf7);
     EPD_7IN5_HD_WaitUntilIdle();
 
 
-    EPD_7IN5_HD_SendCommand(0x0C);  // Soft start setting
-    EPD_7IN5_HD_SendData(0xAE);
-    EPD_7IN5_HD_SendData(0xC7);
-    EPD_7IN5_HD_SendData(0xC3);
-    EPD_7IN5_HD_SendData(0xC0);
-    EPD_7IN5_HD_SendData(0x40); 
+    EPD_SendCommand(0x0C);  // Soft start setting
+    EPD_SendData(0xAE);
+    EPD_SendData(0xC7);
+    EPD_SendData(0xC3);
+    EPD_SendData(0xC0);
+    EPD_SendData(0x40); 
 
 
-    EPD_7IN5_HD_SendCommand(0x01);  // Set MUX as 527
-    EPD_7IN5_HD_SendData(0xAF);
-    EPD_7IN5_HD_SendData(0x02);
-    EPD_7IN5_HD_SendData(0x01);//0x01
+    EPD_SendCommand(0x01);  // Set MUX as 527
+    EPD_SendData(0xAF);
+    EPD_SendData(0x02);
+    EPD_SendData(0x01);//0x01
 
 
-    EPD_7IN5_HD_SendCommand(0x11);  // Data entry mode      
-    EPD_7IN5_HD_SendData(0x01);
+    EPD_SendCommand(0x11);  // Data entry mode      
+    EPD_SendData(0x01);
 
-    EPD_7IN5_HD_SendCommand(0x44); 
-    EPD_7IN5_HD_SendData(0x00); // RAM x address start at 0
-    EPD_7IN5_HD_SendData(0x00); 
-    EPD_7IN5_HD_SendData(0x6F); 
-    EPD_7IN5_HD_SendData(0x03); 
-    EPD_7IN5_HD_SendCommand(0x45); 
-    EPD_7IN5_HD_SendData(0xAF); 
-    EPD_7IN5_HD_SendData(0x02);
-    EPD_7IN5_HD_SendData(0x00); 
-    EPD_7IN5_HD_SendData(0x00);
+    EPD_SendCommand(0x44); 
+    EPD_SendData(0x00); // RAM x address start at 0
+    EPD_SendData(0x00); 
+    EPD_SendData(0x6F); 
+    EPD_SendData(0x03); 
+    EPD_SendCommand(0x45); 
+    EPD_SendData(0xAF); 
+    EPD_SendData(0x02);
+    EPD_SendData(0x00); 
+    EPD_SendData(0x00);
 
 
-    EPD_7IN5_HD_SendCommand(0x3C); // VBD
-    EPD_7IN5_HD_SendData(0x05); // LUT1, for white
+    EPD_SendCommand(0x3C); // VBD
+    EPD_SendData(0x05); // LUT1, for white
 
-    EPD_7IN5_HD_SendCommand(0x18);
-    EPD_7IN5_HD_SendData(0X80);
+    EPD_SendCommand(0x18);
+    EPD_SendData(0X80);
 
 
-    EPD_7IN5_HD_SendCommand(0x22);
-    EPD_7IN5_HD_SendData(0XB1); //Load Temperature and waveform setting.
-    EPD_7IN5_HD_SendCommand(0x20);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0XB1); //Load Temperature and waveform setting.
+    EPD_SendCommand(0x20);
     EPD_7IN5_HD_WaitUntilIdle();
     
-    EPD_7IN5_HD_SendCommand(0x4E); // set RAM x address count to 0;
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendCommand(0x4F); 
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendData(0x00);
+    EPD_SendCommand(0x4E); // set RAM x address count to 0;
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
     // return 0;
 }
 
@@ -168,22 +142,17 @@ void EPD_7IN5_HD_Clear(void)
     Width =(EPD_7IN5_HD_WIDTH % 8 == 0)?(EPD_7IN5_HD_WIDTH / 8 ):(EPD_7IN5_HD_WIDTH / 8 + 1);
     Height = EPD_7IN5_HD_HEIGHT;
     
-    EPD_7IN5_HD_SendCommand(0x4F); 
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendCommand(0x24);
-    UDOUBLE i;
-    for(i=0; i<58080; i++) {
-        EPD_7IN5_HD_SendData(0xff);
-    }
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0xff, 58080);
  
-    EPD_7IN5_HD_SendCommand(0x26);
-    for(i=0; i<Height*Width; i++){
-        EPD_7IN5_HD_SendData(0xff);
-    }
-    EPD_7IN5_HD_SendCommand(0x22);
-    EPD_7IN5_HD_SendData(0xF7);//Load LUT from MCU(0x32)
-    EPD_7IN5_HD_SendCommand(0x20);
+    EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0xff, Height*Width);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xF7);//Load LUT from MCU(0x32)
+    EPD_SendCommand(0x20);
     EPD_Delay_ms(10);
     EPD_7IN5_HD_WaitUntilIdle();
 }
@@ -198,25 +167,18 @@ void EPD_7IN5_HD_Display(const UBYTE *blackimage)
     Width =(EPD_7IN5_HD_WIDTH % 8 == 0)?(EPD_7IN5_HD_WIDTH / 8 ):(EPD_7IN5_HD_WIDTH / 8 + 1);
     Height = EPD_7IN5_HD_HEIGHT;
     
-    EPD_7IN5_HD_SendCommand(0x4F); 
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendCommand(0x24);
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x24);
 
-    UDOUBLE i;
-    for (UDOUBLE j = 0; j < Height; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_7IN5_HD_SendData(blackimage[i + j * Width]);
-        }
-    }
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * Height);
     
-    EPD_7IN5_HD_SendCommand(0x26);
-    for(i=0; i<Height*Width; i++)	{
-        EPD_7IN5_HD_SendData(0xff);
-    }
-    EPD_7IN5_HD_SendCommand(0x22);
-    EPD_7IN5_HD_SendData(0xF7);//Load LUT from MCU(0x32)
-    EPD_7IN5_HD_SendCommand(0x20);
+    EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0xff, Height*Width);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xF7);//Load LUT from MCU(0x32)
+    EPD_SendCommand(0x20);
     EPD_Delay_ms(10);
     EPD_7IN5_HD_WaitUntilIdle();
 }
@@ -226,24 +188,16 @@ void EPD_7IN5_HD_WritePicture(const UBYTE *blackimage, UBYTE Block)
   Width =(EPD_7IN5_HD_WIDTH % 8 == 0)?(EPD_7IN5_HD_WIDTH / 8 ):(EPD_7IN5_HD_WIDTH / 8 + 1);
   Height = EPD_7IN5_HD_HEIGHT;
 	if(Block == 0){
-	  EPD_7IN5_HD_SendCommand(0x4F); 
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendCommand(0x24);
-    for (UDOUBLE j = 0; j < Height/2; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_7IN5_HD_SendData(blackimage[i + j * Width]);
-        }
-    }
+	  EPD_SendCommand(0x4F); 
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * (Height/2));
 	}else if(Block == 1){
-		for (UDOUBLE j = 0; j < Height/2; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_7IN5_HD_SendData(blackimage[i + j * Width]);
-        }
-    }
-		EPD_7IN5_HD_SendCommand(0x22);
-    EPD_7IN5_HD_SendData(0xF7);//Load LUT from MCU(0x32)
-    EPD_7IN5_HD_SendCommand(0x20);
+		EPD_SendDataArray(blackimage, (UDOUBLE)Width * (Height/2));
+		EPD_SendCommand(0x22);
+    EPD_SendData(0xF7);//Load LUT from MCU(0x32)
+    EPD_SendCommand(0x20);
     EPD_Delay_ms(10);
     EPD_7IN5_HD_WaitUntilIdle();
 	}
@@ -259,26 +213,26 @@ void EPD_7IN5_HD_DisplayImage(const UBYTE *blackimage,UDOUBLE start_X, UDOUBLE s
     Width =(EPD_7IN5_HD_WIDTH % 8 == 0)?(EPD_7IN5_HD_WIDTH / 8 ):(EPD_7IN5_HD_WIDTH / 8 + 1);
     Height = EPD_7IN5_HD_HEIGHT;
 		
-	  EPD_7IN5_HD_SendCommand(0x4F); 
-    EPD_7IN5_HD_SendData(0x00);
-    EPD_7IN5_HD_SendData(0x00);
+	  EPD_SendCommand(0x4F); 
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
 		//send black data
 	
 		
-    EPD_7IN5_HD_SendCommand(0x24);
+    EPD_SendCommand(0x24);
     for (UDOUBLE j = 0; j < Height; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
 						if((i>=start_X/8) && (i<(start_X+image_width)/8) && (j>=start_Y) && (j<(start_Y+image_high))){
-							EPD_7IN5_HD_SendData(~blackimage[i-start_X/8 + (j - start_Y) * image_width/8]);
+							EPD_SendData(~blackimage[i-start_X/8 + (j - start_Y) * image_width/8]);
 						}else{
-							EPD_7IN5_HD_SendData(0xff);
+							EPD_SendData(0xff);
 						}
 						
         }
     }
-		EPD_7IN5_HD_SendCommand(0x22);
-    EPD_7IN5_HD_SendData(0xF7);//Load LUT from MCU(0x32)
-    EPD_7IN5_HD_SendCommand(0x20);
+		EPD_SendCommand(0x22);
+    EPD_SendData(0xF7);//Load LUT from MCU(0x32)
+    EPD_SendCommand(0x20);
     EPD_Delay_ms(10);
     EPD_7IN5_HD_WaitUntilIdle();
 }
@@ -288,8 +242,8 @@ parameter:
 ******************************************************************************/
 void EPD_7IN5_HD_Sleep(void)
 {
-    EPD_7IN5_HD_SendCommand(0x10);
-    EPD_7IN5_HD_SendData(0x01);
+    EPD_SendCommand(0x10);
+    EPD_SendData(0x01);
 }
 
 #endif
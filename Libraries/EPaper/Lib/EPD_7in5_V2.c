@@ -100,32 +100,6 @@ static void EPD_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -146,27 +120,21 @@ static void EPD_WaitUntilIdle(void)
 
 static void EPD_7IN5_V2_LUT(UBYTE* lut_vcom,  UBYTE* lut_ww, UBYTE* lut_bw, UBYTE* lut_wb, UBYTE* lut_bb)
 {
-	UBYTE count;
 
 	EPD_SendCommand(0x20); //VCOM	
-	for(count=0; count<42; count++)
-		EPD_SendData(lut_vcom[count]);
+	EPD_SendDataArray(lut_vcom, 42);
 
 	EPD_SendCommand(0x21); //LUTBW
-	for(count=0; count<42; count++)
-		EPD_SendData(lut_ww[count]);
+	EPD_SendDataArray(lut_ww, 42);
 
 	EPD_SendCommand(0x22); //LUTBW
-	for(count=0; count<42; count++)
-		EPD_SendData(lut_bw[count]);
+	EPD_SendDataArray(lut_bw, 42);
 
 	EPD_SendCommand(0x23); //LUTWB
-	for(count=0; count<42; count++)
-		EPD_SendData(lut_wb[count]);
+	EPD_SendDataArray(lut_wb, 42);
 
 	EPD_SendCommand(0x24); //LUTBB
-	for(count=0; count<42; count++)
-		EPD_SendData(lut_bb[count]);
+	EPD_SendDataArray(lut_bb, 42);
 }
 
 /******************************************************************************
@@ -280,15 +248,10 @@ void EPD_7IN5_V2_Clear(void)
     Width =(EPD_7IN5_V2_WIDTH % 8 == 0)?(EPD_7IN5_V2_WIDTH / 8 ):(EPD_7IN5_V2_WIDTH / 8 + 1);
     Height = EPD_7IN5_V2_HEIGHT;
 
-    UWORD i;
     EPD_SendCommand(0x10);
-    for(i=0; i<Height*Width; i++) {
-        EPD_SendData(0x00);
-    }
+    EPD_SendDataBurst(0x00, Height*Width);
     EPD_SendCommand(0x13);
-    for(i=0; i<Height*Width; i++)	{
-        EPD_SendData(0x00);
-    }
+    EPD_SendDataBurst(0x00, Height*Width);
     EPD_7IN5_V2_TurnOnDisplay();
 }
 
@@ -298,11 +261,8 @@ void EPD_7IN5_V2_ClearBlack(void)
     Width =(EPD_7IN5_V2_WIDTH % 8 == 0)?(EPD_7IN5_V2_WIDTH / 8 ):(EPD_7IN5_V2_WIDTH / 8 + 1);
     Height = EPD_7IN5_V2_HEIGHT;
 
-    UWORD i;
     EPD_SendCommand(0x13);
-    for(i=0; i<Height*Width; i++)	{
-        EPD_SendData(0xFF);
-    }
+    EPD_SendDataBurst(0xFF, Height*Width);
     EPD_7IN5_V2_TurnOnDisplay();
 }
 
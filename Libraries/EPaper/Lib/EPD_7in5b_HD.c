@@ -45,33 +45,6 @@ static void EPD_7IN5B_HD_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_7IN5B_HD_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_7IN5B_HD_SendData(UBYTE Data)
-{
-    
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -93,9 +66,9 @@ parameter:
 ******************************************************************************/
 static void EPD_7IN5B_HD_TurnOnDisplay(void)
 {
-    EPD_7IN5B_HD_SendCommand(0x22);
-    EPD_7IN5B_HD_SendData(0xC7);    //Load LUT from MCU(0x32)
-    EPD_7IN5B_HD_SendCommand(0x20);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0xC7);    //Load LUT from MCU(0x32)
+    EPD_SendCommand(0x20);
     EPD_Delay_ms(200);      //!!!The delay here is necessary, 200uS at least!!!     
     EPD_7IN5B_HD_WaitUntilIdle();       //waiting for the electronic paper IC to release the idle signal
 }
@@ -108,59 +81,59 @@ UBYTE EPD_7IN5B_HD_Init(void)
 {
     EPD_7IN5B_HD_Reset();
 
-    EPD_7IN5B_HD_SendCommand(0x12); 		  //SWRESET
+    EPD_SendCommand(0x12); 		  //SWRESET
     EPD_7IN5B_HD_WaitUntilIdle();        //waiting for the electronic paper IC to release the idle signal
 
-    EPD_7IN5B_HD_SendCommand(0x46);  // Auto Write RAM
-    EPD_7IN5B_HD_SendData(0xF7);
+    EPD_SendCommand(0x46);  // Auto Write RAM
+    EPD_SendData(0xF7);
     EPD_7IN5B_HD_WaitUntilIdle();        //waiting for the electronic paper IC to release the idle signal
 
-    EPD_7IN5B_HD_SendCommand(0x47);  // Auto Write RAM
-    EPD_7IN5B_HD_SendData(0xF7);
+    EPD_SendCommand(0x47);  // Auto Write RAM
+    EPD_SendData(0xF7);
     EPD_7IN5B_HD_WaitUntilIdle();        //waiting for the electronic paper IC to release the idle signal
 
-    EPD_7IN5B_HD_SendCommand(0x0C);  // Soft start setting
-    EPD_7IN5B_HD_SendData(0xAE);
-    EPD_7IN5B_HD_SendData(0xC7);
-    EPD_7IN5B_HD_SendData(0xC3);
-    EPD_7IN5B_HD_SendData(0xC0);
-    EPD_7IN5B_HD_SendData(0x40);   
-
-    EPD_7IN5B_HD_SendCommand(0x01);  // Set MUX as 527
-    EPD_7IN5B_HD_SendData(0xAF);
-    EPD_7IN5B_HD_SendData(0x02);
-    EPD_7IN5B_HD_SendData(0x01);
-
-    EPD_7IN5B_HD_SendCommand(0x11);  // Data entry mode
-    EPD_7IN5B_HD_SendData(0x01);
-
-    EPD_7IN5B_HD_SendCommand(0x44);
-    EPD_7IN5B_HD_SendData(0x00); // RAM x address start at 0
-    EPD_7IN5B_HD_SendData(0x00);
-    EPD_7IN5B_HD_SendData(0x6F); // RAM x address end at 36Fh -> 879
-    EPD_7IN5B_HD_SendData(0x03);
-    EPD_7IN5B_HD_SendCommand(0x45);
-    EPD_7IN5B_HD_SendData(0xAF); // RAM y address start at 20Fh;
-    EPD_7IN5B_HD_SendData(0x02);
-    EPD_7IN5B_HD_SendData(0x00); // RAM y address end at 00h;
-    EPD_7IN5B_HD_SendData(0x00);
-
-    EPD_7IN5B_HD_SendCommand(0x3C); // VBD
-    EPD_7IN5B_HD_SendData(0x01); // LUT1, for white
-
-    EPD_7IN5B_HD_SendCommand(0x18);
-    EPD_7IN5B_HD_SendData(0X80);
-    EPD_7IN5B_HD_SendCommand(0x22);
-    EPD_7IN5B_HD_SendData(0XB1);	//Load Temperature and waveform setting.
-    EPD_7IN5B_HD_SendCommand(0x20);
+    EPD_SendCommand(0x0C);  // Soft start setting
+    EPD_SendData(0xAE);
+    EPD_SendData(0xC7);
+    EPD_SendData(0xC3);
+    EPD_SendData(0xC0);
+    EPD_SendData(0x40);   
+
+    EPD_SendCommand(0x01);  // Set MUX as 527
+    EPD_SendData(0xAF);
+    EPD_SendData(0x02);
+    EPD_SendData(0x01);
+
+    EPD_SendCommand(0x11);  // Data entry mode
+    EPD_SendData(0x01);
+
+    EPD_SendCommand(0x44);
+    EPD_SendData(0x00); // RAM x address start at 0
+    EPD_SendData(0x00);
+    EPD_SendData(0x6F); // RAM x address end at 36Fh -> 879
+    EPD_SendData(0x03);
+    EPD_SendCommand(0x45);
+    EPD_SendData(0xAF); // RAM y address start at 20Fh;
+    EPD_SendData(0x02);
+    EPD_SendData(0x00); // RAM y address end at 00h;
+    EPD_SendData(0x00);
+
+    EPD_SendCommand(0x3C); // VBD
+    EPD_SendData(0x01); // LUT1, for white
+
+    EPD_SendCommand(0x18);
+    EPD_SendData(0X80);
+    EPD_SendCommand(0x22);
+    EPD_SendData(0XB1);	//Load Temperature and waveform setting.
+    EPD_SendCommand(0x20);
     EPD_7IN5B_HD_WaitUntilIdle();        //waiting for the electronic paper IC to release the idle signal
 
-    EPD_7IN5B_HD_SendCommand(0x4E); 
-    EPD_7IN5B_HD_SendData(0x00);
-    EPD_7IN5B_HD_SendData(0x00);
-    EPD_7IN5B_HD_SendCommand(0x4F); 
-    EPD_7IN5B_HD_SendData(0xAF);
-    EPD_7IN5B_HD_SendData(0x02);
+    EPD_SendCommand(0x4E); 
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0xAF);
+    EPD_SendData(0x02);
     return 0;
 }
 
@@ -173,20 +146,13 @@ void EPD_7IN5B_HD_Clear(void)
     UWORD Width, Height;
     Width =(EPD_7IN5B_HD_WIDTH % 8 == 0)?(EPD_7IN5B_HD_WIDTH / 8 ):(EPD_7IN5B_HD_WIDTH / 8 + 1);
     Height = EPD_7IN5B_HD_HEIGHT;
-    EPD_7IN5B_HD_SendCommand(0x4F); 
-    EPD_7IN5B_HD_SendData(0xAf);
-    EPD_7IN5B_HD_SendData(0x02);
-    UWORD i;
-    EPD_7IN5B_HD_SendCommand(0x24);
-    for(i=0; i<Width*Height; i++) {
-        EPD_7IN5B_HD_SendData(0xff);
-
-    }
-    EPD_7IN5B_HD_SendCommand(0x26);
-    for(i=0; i<Width*Height; i++)	{
-        EPD_7IN5B_HD_SendData(0x00);
-
-    }
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0xAf);
+    EPD_SendData(0x02);
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0xff, Width*Height);
+    EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0x00, Width*Height);
     EPD_7IN5B_HD_TurnOnDisplay();
 }
 
@@ -196,21 +162,14 @@ void EPD_7IN5B_HD_ClearRed(void)
     Width =(EPD_7IN5B_HD_WIDTH % 8 == 0)?(EPD_7IN5B_HD_WIDTH / 8 ):(EPD_7IN5B_HD_WIDTH / 8 + 1);
     Height = EPD_7IN5B_HD_HEIGHT;
 
-    UWORD i;
-    EPD_7IN5B_HD_SendCommand(0x4F); 
-    EPD_7IN5B_HD_SendData(0xAF);
-    EPD_7IN5B_HD_SendData(0x02);
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0xAF);
+    EPD_SendData(0x02);
     
-    EPD_7IN5B_HD_SendCommand(0x24);
-    for(i=0; i<Width*Height; i++) {
-        EPD_7IN5B_HD_SendData(0xff);
-
-    }
-    EPD_7IN5B_HD_SendCommand(0x26);
-    for(i=0; i<Width*Height; i++)	{
-        EPD_7IN5B_HD_SendData(0xff);
-
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0xff, Width*Height);
+    EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0xff, Width*Height);
     EPD_7IN5B_HD_TurnOnDisplay();
 }
 
@@ -220,21 +179,14 @@ void EPD_7IN5B_HD_ClearBlack(void)
     Width =(EPD_7IN5B_HD_WIDTH % 8 == 0)?(EPD_7IN5B_HD_WIDTH / 8 ):(EPD_7IN5B_HD_WIDTH / 8 + 1);
     Height = EPD_7IN5B_HD_HEIGHT;
 
-    UWORD i;
-    EPD_7IN5B_HD_SendCommand(0x4F); 
-    EPD_7IN5B_HD_SendData(0xAF);
-    EPD_7IN5B_HD_SendData(0x02);
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0xAF);
+    EPD_SendData(0x02);
     
-    EPD_7IN5B_HD_SendCommand(0x24);
-    for(i=0; i<Width*Height; i++) {
-        EPD_7IN5B_HD_SendData(0x00);
-
-    }
-    EPD_7IN5B_HD_SendCommand(0x26);
-    for(i=0; i<Width*Height; i++)	{
-        EPD_7IN5B_HD_SendData(0x00);
-
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataBurst(0x00, Width*Height);
+    EPD_SendCommand(0x26);
+    EPD_SendDataBurst(0x00, Width*Height);
     EPD_7IN5B_HD_TurnOnDisplay();
 }
 
@@ -247,23 +199,19 @@ void EPD_7IN5B_HD_Display(const UBYTE *blackimage, const UBYTE *ryimage)
     UDOUBLE Width, Height;
     Width =(EPD_7IN5B_HD_WIDTH % 8 == 0)?(EPD_7IN5B_HD_WIDTH / 8 ):(EPD_7IN5B_HD_WIDTH / 8 + 1);
     Height = EPD_7IN5B_HD_HEIGHT;
-    EPD_7IN5B_HD_SendCommand(0x4F); 
-    EPD_7IN5B_HD_SendData(0xAF);
-    EPD_7IN5B_HD_SendData(0x02);
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0xAF);
+    EPD_SendData(0x02);
  //send black data
-    EPD_7IN5B_HD_SendCommand(0x24);
-    for (UDOUBLE j = 0; j < Height; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_7IN5B_HD_SendData(blackimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x24);
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * Height);
  
 
     //send red data
-    EPD_7IN5B_HD_SendCommand(0x26);
+    EPD_SendCommand(0x26);
     for (UDOUBLE j = 0; j < Height; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_7IN5B_HD_SendData(~ryimage[i + j * Width]);
+            EPD_SendData(~ryimage[i + j * Width]);
         }
     }
     EPD_7IN5B_HD_TurnOnDisplay();
@@ -277,32 +225,24 @@ void EPD_7IN5B_HD_DisplayPicture(const UBYTE *blackimage,UBYTE Block)
 	Height = EPD_7IN5B_HD_HEIGHT;
 
 	if(Block == 0){
-		EPD_7IN5B_HD_SendCommand(0x4F); 
-		EPD_7IN5B_HD_SendData(0xAF);
-		EPD_7IN5B_HD_SendData(0x02);
-		EPD_7IN5B_HD_SendCommand(0x24);
-        for (UDOUBLE j = 0; j < Height/2; j++) {
-            for (UDOUBLE i = 0; i < Width; i++) {
-                EPD_7IN5B_HD_SendData(blackimage[i + j * Width]);
-            }
-        }   	
+		EPD_SendCommand(0x4F); 
+		EPD_SendData(0xAF);
+		EPD_SendData(0x02);
+		EPD_SendCommand(0x24);
+        EPD_SendDataArray(blackimage, (UDOUBLE)Width * (Height/2));   	
 	}else if(Block == 1){
-		for (UDOUBLE j = 0; j < Height/2; j++) {
-            for (UDOUBLE i = 0; i < Width; i++) {
-                EPD_7IN5B_HD_SendData(blackimage[i + j * Width]);
-            }
-        }
+		EPD_SendDataArray(blackimage, (UDOUBLE)Width * (Height/2));
 	}else if(Block == 2){
-		EPD_7IN5B_HD_SendCommand(0x26);
+		EPD_SendCommand(0x26);
         for (UDOUBLE j = 0; j < Height/2; j++) {
             for (UDOUBLE i = 0; i < Width; i++) {
-                EPD_7IN5B_HD_SendData(~blackimage[i + j * Width]);
+                EPD_SendData(~blackimage[i + j * Width]);
             }
         }
 	}else if(Block == 3){
 		for (UDOUBLE j = 0; j < Height/2; j++) {
             for (UDOUBLE i = 0; i < Width; i++) {
-                EPD_7IN5B_HD_SendData(~blackimage[i + j * Width]);
+                EPD_SendData(~blackimage[i + j * Width]);
             }
         }
 		EPD_7IN5B_HD_TurnOnDisplay();
@@ -318,32 +258,32 @@ void EPD_7IN5B_HD_DisplayImage(const UBYTE *blackimage, const UBYTE *ryimage,UDO
     Width =(EPD_7IN5B_HD_WIDTH % 8 == 0)?(EPD_7IN5B_HD_WIDTH / 8 ):(EPD_7IN5B_HD_WIDTH / 8 + 1);
     Height = EPD_7IN5B_HD_HEIGHT;
 		
-    EPD_7IN5B_HD_SendCommand(0x4F); 
-    EPD_7IN5B_HD_SendData(0xAF);
-    EPD_7IN5B_HD_SendData(0x02);
+    EPD_SendCommand(0x4F); 
+    EPD_SendData(0xAF);
+    EPD_SendData(0x02);
 		//send black data
 	
 		
-    EPD_7IN5B_HD_SendCommand(0x24);
+    EPD_SendCommand(0x24);
     for (UDOUBLE j = 0; j < Height; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
             if((i>=start_X/8) && (i<(start_X+image_width)/8) && (j>=start_Y) && (j<(start_Y+image_high))){
-                EPD_7IN5B_HD_SendData(blackimage[i-start_X/8 + (j - start_Y) * image_width/8]);
+                EPD_SendData(blackimage[i-start_X/8 + (j - start_Y) * image_width/8]);
             }else{
-                EPD_7IN5B_HD_SendData(0xff);
+                EPD_SendData(0xff);
             }
         }
     }
  
 
     //send red data
-    EPD_7IN5B_HD_SendCommand(0x26);
+    EPD_SendCommand(0x26);
     for (UDOUBLE j = 0; j < Height; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
             if((i>=start_X/8) && (i<(start_X+image_width)/8) && (j>=start_Y) && (j<(start_Y+image_high))){
-                EPD_7IN5B_HD_SendData(~ryimage[i-start_X/8 + (j - start_Y) * image_width/8]);
+                EPD_SendData(~ryimage[i-start_X/8 + (j - start_Y) * image_width/8]);
             }else{
-                EPD_7IN5B_HD_SendData(0x00);
+                EPD_SendData(0x00);
             }		
         }
     }
@@ -356,8 +296,8 @@ parameter:
 ******************************************************************************/
 void EPD_7IN5B_HD_Sleep(void)
 {
-    EPD_7IN5B_HD_SendCommand(0x10);  	//deep sleep
-    EPD_7IN5B_HD_SendData(0x01);
+    EPD_SendCommand(0x10);  	//deep sleep
+    EPD_SendData(0x01);
 }
 
 #endif
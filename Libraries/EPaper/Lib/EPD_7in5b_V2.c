@@ -45,32 +45,6 @@ static void EPD_7IN5B_V2_Reset(void)
     EPD_Delay_ms(200);
 }
 
-/******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
-******************************************************************************/
-static void EPD_7IN5B_V2_SendCommand(UBYTE Reg)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 0);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Reg);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
-/******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
-******************************************************************************/
-static void EPD_7IN5B_V2_SendData(UBYTE Data)
-{
-    EPD_Digital_Write(EPD_DC_PIN, 1);
-    EPD_Digital_Write(EPD_CS_PIN, 0);
-    EPD_SPI_WriteByte(Data);
-    EPD_Digital_Write(EPD_CS_PIN, 1);
-}
-
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -80,7 +54,7 @@ void EPD_7IN5B_V2_WaitUntilIdle(void)
 	EPD_Printf("e-Paper busy\r\n");
 	unsigned char busy;
 	do	{
-		EPD_7IN5B_V2_SendCommand(0x71);
+		EPD_SendCommand(0x71);
 		busy = EPD_Digital_Read(EPD_BUSY_PIN);
 		busy =!(busy & 0x01);        
 	}while(busy);
@@ -96,7 +70,7 @@ parameter:
 ******************************************************************************/
 static void EPD_7IN5B_V2_TurnOnDisplay(void)
 {
-    EPD_7IN5B_V2_SendCommand(0x12);			//DISPLAY REFRESH
+    EPD_SendCommand(0x12);			//DISPLAY REFRESH
     EPD_Delay_ms(100);	        //!!!The delay here is necessary, 200uS at least!!!
     EPD_7IN5B_V2_WaitUntilIdle();
 }
@@ -109,45 +83,45 @@ UBYTE EPD_7IN5B_V2_Init(void)
 {
     EPD_7IN5B_V2_Reset();
 
-    EPD_7IN5B_V2_SendCommand(0x01);			//POWER SETTING
-    EPD_7IN5B_V2_SendData(0x07);
-    EPD_7IN5B_V2_SendData(0x07);    //VGH=20V,VGL=-20V
-    EPD_7IN5B_V2_SendData(0x3f);		//VDH=15V
-    EPD_7IN5B_V2_SendData(0x3f);		//VDL=-15V
+    EPD_SendCommand(0x01);			//POWER SETTING
+    EPD_SendData(0x07);
+    EPD_SendData(0x07);    //VGH=20V,VGL=-20V
+    EPD_SendData(0x3f);		//VDH=15V
+    EPD_SendData(0x3f);		//VDL=-15V
 
-    EPD_7IN5B_V2_SendCommand(0x04); //POWER ON
+    EPD_SendCommand(0x04); //POWER ON
     EPD_Delay_ms(100);
     EPD_7IN5B_V2_WaitUntilIdle();
 
-    EPD_7IN5B_V2_SendCommand(0X00);			//PANNEL SETTING
-    EPD_7IN5B_V2_SendData(0x0F);   //KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
+    EPD_SendCommand(0X00);			//PANNEL SETTING
+    EPD_SendData(0x0F);   //KW-3f   KWR-2F	BWROTP 0f	BWOTP 1f
 
-    EPD_7IN5B_V2_SendCommand(0x61);        	//tres
-    EPD_7IN5B_V2_SendData(0x03);		//source 800
-    EPD_7IN5B_V2_SendData(0x20);
-    EPD_7IN5B_V2_SendData(0x01);		//gate 480
-    EPD_7IN5B_V2_SendData(0xE0);
+    EPD_SendCommand(0x61);        	//tres
+    EPD_SendData(0x03);		//source 800
+    EPD_SendData(0x20);
+    EPD_SendData(0x01);		//gate 480
+    EPD_SendData(0xE0);
 
-    EPD_7IN5B_V2_SendCommand(0X15);
-    EPD_7IN5B_V2_SendData(0x00);
+    EPD_SendCommand(0X15);
+    EPD_SendData(0x00);
 
-    EPD_7IN5B_V2_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING
-    EPD_7IN5B_V2_SendData(0x11);
-    EPD_7IN5B_V2_SendData(0x07);
+    EPD_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING
+    EPD_SendData(0x11);
+    EPD_SendData(0x07);
 
-    EPD_7IN5B_V2_SendCommand(0X60);			//TCON SETTING
-    EPD_7IN5B_V2_SendData(0x22);
+    EPD_SendCommand(0X60);			//TCON SETTING
+    EPD_SendData(0x22);
 	
-	EPD_7IN5B_V2_SendCommand(0X82);
-	EPD_7IN5B_V2_SendData(0x08);
-	EPD_7IN5B_V2_SendCommand(0X30);
-	EPD_7IN5B_V2_SendData(0x06);
+	EPD_SendCommand(0X82);
+	EPD_SendData(0x08);
+	EPD_SendCommand(0X30);
+	EPD_SendData(0x06);
 				
-    EPD_7IN5B_V2_SendCommand(0x65);  // Resolution setting
-    EPD_7IN5B_V2_SendData(0x00);
-    EPD_7IN5B_V2_SendData(0x00);//800*480
-    EPD_7IN5B_V2_SendData(0x00);
-    EPD_7IN5B_V2_SendData(0x00);
+    EPD_SendCommand(0x65);  // Resolution setting
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);//800*480
+    EPD_SendData(0x00);
+    EPD_SendData(0x00);
 
     return 0;
 }
@@ -162,17 +136,10 @@ void EPD_7IN5B_V2_Clear(void)
     Width =(EPD_7IN5B_V2_WIDTH % 8 == 0)?(EPD_7IN5B_V2_WIDTH / 8 ):(EPD_7IN5B_V2_WIDTH / 8 + 1);
     Height = EPD_7IN5B_V2_HEIGHT;
 
-    UWORD i;
-    EPD_7IN5B_V2_SendCommand(0x10);
-    for(i=0; i<Width*Height; i++) {
-        EPD_7IN5B_V2_SendData(0xff);
-
-    }
-    EPD_7IN5B_V2_SendCommand(0x13);
-    for(i=0; i<Width*Height; i++)	{
-        EPD_7IN5B_V2_SendData(0x00);
-
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0xff, Width*Height);
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0x00, Width*Height);
     EPD_7IN5B_V2_TurnOnDisplay();
 }
 
@@ -182,17 +149,10 @@ void EPD_7IN5B_V2_ClearRed(void)
     Width =(EPD_7IN5B_V2_WIDTH % 8 == 0)?(EPD_7IN5B_V2_WIDTH / 8 ):(EPD_7IN5B_V2_WIDTH / 8 + 1);
     Height = EPD_7IN5B_V2_HEIGHT;
 
-    UWORD i;
-    EPD_7IN5B_V2_SendCommand(0x10);
-    for(i=0; i<Width*Height; i++) {
-        EPD_7IN5B_V2_SendData(0xff);
-
-    }
-    EPD_7IN5B_V2_SendCommand(0x13);
-    for(i=0; i<Width*Height; i++)	{
-        EPD_7IN5B_V2_SendData(0xff);
-
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0xff, Width*Height);
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0xff, Width*Height);
     EPD_7IN5B_V2_TurnOnDisplay();
 }
 
@@ -202,17 +162,10 @@ void EPD_7IN5B_V2_ClearBlack(void)
     Width =(EPD_7IN5B_V2_WIDTH % 8 == 0)?(EPD_7IN5B_V2_WIDTH / 8 ):(EPD_7IN5B_V2_WIDTH / 8 + 1);
     Height = EPD_7IN5B_V2_HEIGHT;
 
-    UWORD i;
-    EPD_7IN5B_V2_SendCommand(0x10);
-    for(i=0; i<Width*Height; i++) {
-        EPD_7IN5B_V2_SendData(0x00);
-
-    }
-    EPD_7IN5B_V2_SendCommand(0x13);
-    for(i=0; i<Width*Height; i++)	{
-        EPD_7IN5B_V2_SendData(0x00);
-
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataBurst(0x00, Width*Height);
+    EPD_SendCommand(0x13);
+    EPD_SendDataBurst(0x00, Width*Height);
     EPD_7IN5B_V2_TurnOnDisplay();
 }
 
@@ -227,18 +180,14 @@ void EPD_7IN5B_V2_Display(const UBYTE *blackimage, const UBYTE *ryimage)
     Height = EPD_7IN5B_V2_HEIGHT;
 
 	//send black data
-    EPD_7IN5B_V2_SendCommand(0x10);
-    for (UDOUBLE j = 0; j < Height; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_7IN5B_V2_SendData(blackimage[i + j * Width]);
-        }
-    }
+    EPD_SendCommand(0x10);
+    EPD_SendDataArray(blackimage, (UDOUBLE)Width * Height);
 
     //send red data
-    EPD_7IN5B_V2_SendCommand(0x13);
+    EPD_SendCommand(0x13);
     for (UDOUBLE j = 0; j < Height; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
-            EPD_7IN5B_V2_SendData(~ryimage[i + j * Width]);
+            EPD_SendData(~ryimage[i + j * Width]);
         }
     }
     EPD_7IN5B_V2_TurnOnDisplay();
@@ -253,16 +202,16 @@ void EPD_7IN5B_V2_WritePicture(const UBYTE *blackimage, UBYTE Block)
 	Height = EPD_7IN5B_V2_HEIGHT;
 	
 	if(Block == 0){
-		EPD_7IN5B_V2_SendCommand(0x10);
+		EPD_SendCommand(0x10);
 	}else if(Block == 2){
-		EPD_7IN5B_V2_SendCommand(0x13);
+		EPD_SendCommand(0x13);
 	}
 	for (UDOUBLE j = 0; j < Height/2; j++) {
         for (UDOUBLE i = 0; i < Width; i++) {
 						if(Block>=2){
-							EPD_7IN5B_V2_SendData(~blackimage[i + j * Width]);
+							EPD_SendData(~blackimage[i + j * Width]);
 						}else{
-							EPD_7IN5B_V2_SendData(blackimage[i + j * Width]);
+							EPD_SendData(blackimage[i + j * Width]);
 						}
         }
 	}
@@ -278,10 +227,10 @@ parameter:
 ******************************************************************************/
 void EPD_7IN5B_V2_Sleep(void)
 {
-    EPD_7IN5B_V2_SendCommand(0X02);  	//power off
+    EPD_SendCommand(0X02);  	//power off
     EPD_7IN5B_V2_WaitUntilIdle();
-    EPD_7IN5B_V2_SendCommand(0X07);  	//deep sleep
-    EPD_7IN5B_V2_SendData(0xA5);
+    EPD_SendCommand(0X07);  	//deep sleep
+    EPD_SendData(0xA5);
 }
 
 #endif
@@ -30,6 +30,11 @@
 #
 ******************************************************************************/
 #include "EPD_Common.h"
+#include <string.h>
+
+static volatile UBYTE EPD_Busy;
+static UBYTE EPD_BusyLevel;
+static EPD_DONE EPD_BusyDone;
 
 int EPD_Module_Init(void)
 {
@@ -46,3 +51,150 @@ void EPD_Module_Exit(void)
     EPD_Digital_Write(EPD_RST_PIN, 0);
 }
 
+/******************************************************************************
+function :	send command
+parameter:
+     Reg : Command register
+******************************************************************************/
+void EPD_SendCommand(UBYTE Reg)
+{
+    EPD_Digital_Write(EPD_DC_PIN, 0);
+    EPD_Digital_Write(EPD_CS_PIN, 0);
+    EPD_SPI_WriteByte(Reg);
+    EPD_Digital_Write(EPD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	send data
+parameter:
+    Data : Write data
+******************************************************************************/
+void EPD_SendData(UBYTE Data)
+{
+    EPD_Digital_Write(EPD_DC_PIN, 1);
+    EPD_Digital_Write(EPD_CS_PIN, 0);
+    EPD_SPI_WriteByte(Data);
+    EPD_Digital_Write(EPD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	send a block of data with CS held low
+parameter:
+    Data : Write data
+    Len  : Number of bytes
+******************************************************************************/
+void EPD_SendDataArray(const UBYTE *Data, UDOUBLE Len)
+{
+    UWORD n;
+
+    EPD_Digital_Write(EPD_DC_PIN, 1);
+    EPD_Digital_Write(EPD_CS_PIN, 0);
+    while (Len) {
+        n = Len > 0xFFFF ? 0xFFFF : Len;
+        EPD_SPI_Write_nByte(Data, n);
+        Data += n;
+        Len -= n;
+    }
+    EPD_Digital_Write(EPD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	send the same data byte Len times with CS held low
+parameter:
+    Data : Write data
+    Len  : Number of bytes
+******************************************************************************/
+void EPD_SendDataBurst(UBYTE Data, UDOUBLE Len)
+{
+    UBYTE Buf[32];
+    UWORD n;
+
+    memset(Buf, Data, sizeof(Buf));
+    EPD_Digital_Write(EPD_DC_PIN, 1);
+    EPD_Digital_Write(EPD_CS_PIN, 0);
+    while (Len) {
+        n = Len > sizeof(Buf) ? sizeof(Buf) : Len;
+        EPD_SPI_Write_nByte(Buf, n);
+        Len -= n;
+    }
+    EPD_Digital_Write(EPD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	Mark the panel busy after a refresh command and return at once
+parameter:
+    Level : BUSY pin level while the panel works (1 on SSD16xx, 0 on UC81xx)
+    Done  : Called once from EPD_BusyPoll() when the panel is idle, or NULL
+info:
+    Arms the BUSY interrupt when the platform has one, so that the core can
+    sleep in EPD_Busy_Idle() until the edge instead of polling every 10ms.
+******************************************************************************/
+void EPD_BusyStart(UBYTE Level, EPD_DONE Done)
+{
+    EPD_BusyLevel = Level;
+    EPD_BusyDone = Done;
+    EPD_Busy = 1;
+    EPD_Busy_IRQ_Enable();
+}
+
+/******************************************************************************
+function :	Check the refresh started by EPD_BusyStart()
+parameter:
+info:
+    Returns 1 while the panel is busy. The pin is read here as well, so an
+    edge that came before the interrupt was armed is not lost. Done runs in
+    the caller's context, never in the interrupt, and may send to the panel.
+******************************************************************************/
+UBYTE EPD_BusyPoll(void)
+{
+    EPD_DONE Done;
+
+    if (!EPD_Busy)
+        return 0;
+    if (EPD_Digital_Read(EPD_BUSY_PIN) == EPD_BusyLevel)
+        return 1;
+    EPD_Busy_IRQ_Disable();
+    EPD_Busy = 0;
+    EPD_Printf("e-Paper busy release\r\n");
+    Done = EPD_BusyDone;
+    EPD_BusyDone = NULL;
+    if (Done)
+        Done();
+    return EPD_Busy;
+}
+
+/******************************************************************************
+function :	Block until the panel is idle, running the Done callback
+parameter:
+******************************************************************************/
+void EPD_BusyWait(void)
+{
+    while (EPD_BusyPoll())
+        EPD_BusySleep();
+}
+
+/******************************************************************************
+function :	Sleep once while the panel is still busy
+parameter:
+info:
+    The pin is read again with interrupts locked: a BUSY edge after that
+    read is held pending and wakes EPD_Busy_Idle() at once.
+******************************************************************************/
+void EPD_BusySleep(void)
+{
+    EPD_Busy_Lock();
+    if (EPD_Busy && EPD_Digital_Read(EPD_BUSY_PIN) == EPD_BusyLevel)
+        EPD_Busy_Idle();
+    EPD_Busy_Unlock();
+}
+
+/******************************************************************************
+function :	BUSY edge interrupt, call from the platform's EXTI callback
+parameter:
+info:
+    Only wakes the core: the main loop sees the idle pin in EPD_BusyPoll().
+******************************************************************************/
+void EPD_BusyIRQHandler(void)
+{
+    EPD_Busy_IRQ_Disable();
+}
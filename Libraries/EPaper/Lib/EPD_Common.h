@@ -25,6 +25,16 @@
 *   #define EPD_Digital_Write(_pin, _value) bcm2835_gpio_write(_pin, _value)
 *   #define EPD_Digital_Read(_pin) bcm2835_gpio_lev(_pin)
 *   #define EPD_SPI_WriteByte(__value) bcm2835_spi_transfer(__value)
+* 4.add(2026-10-18):
+*   EPD_SendCommand(), EPD_SendData(), EPD_SendDataArray(), EPD_SendDataBurst()
+*   shared by all drivers; a data block keeps CS low and goes out through
+*   EPD_SPI_Write_nByte() when the platform provides it
+* 5.add(2026-10-18):
+*   EPD_BusyStart(), EPD_BusyPoll(), EPD_BusyWait(), EPD_BusyIRQHandler()
+*   for refreshes that return at once; BUSY can wake the MCU through
+*   EPD_Busy_IRQ_Enable()/EPD_Busy_IRQ_Disable() if the platform has them
+*   EPD_BusySleep(), with EPD_Busy_Lock()/EPD_Busy_Unlock() so that an edge
+*   between the last pin check and the sleep is not lost
 #
 # Permission is hereby granted, free of charge, to any person obtaining a copy
 # of this software and associated documnetation files (the "Software"), to deal
@@ -65,7 +75,49 @@
 #define UWORD   uint16_t
 #define UDOUBLE uint32_t
 
+/**
+ * Block write, falls back to byte writes if the platform has none
+ */
+#ifndef EPD_SPI_Write_nByte
+#define EPD_SPI_Write_nByte(_pData, _Len) do { \
+        for (UWORD _i = 0; _i < (_Len); _i++) \
+            EPD_SPI_WriteByte((_pData)[_i]); \
+    } while (0)
+#endif
+
+/**
+ * BUSY line interrupt, optional: without it EPD_BusyWait() polls the pin
+ */
+#ifndef EPD_Busy_IRQ_Enable
+#define EPD_Busy_IRQ_Enable()
+#define EPD_Busy_IRQ_Disable()
+#endif
+#ifndef EPD_Busy_Idle
+#define EPD_Busy_Idle()                 EPD_Delay_ms(10)
+#endif
+/**
+ * Mask interrupts around the last pin check and EPD_Busy_Idle(), so that an
+ * edge in between stays pending and ends the sleep instead of being lost
+ */
+#ifndef EPD_Busy_Lock
+#define EPD_Busy_Lock()
+#define EPD_Busy_Unlock()
+#endif
+
+typedef void (*EPD_DONE)(void);
+
 int  EPD_Module_Init(void);
 void EPD_Module_Exit(void);
 
+void EPD_SendCommand(UBYTE Reg);
+void EPD_SendData(UBYTE Data);
+void EPD_SendDataArray(const UBYTE *Data, UDOUBLE Len);
+void EPD_SendDataBurst(UBYTE Data, UDOUBLE Len);
+
+void  EPD_BusyStart(UBYTE Level, EPD_DONE Done);
+UBYTE EPD_BusyPoll(void);
+void  EPD_BusyWait(void);
+void  EPD_BusySleep(void);
+void  EPD_BusyIRQHandler(void);
+
 #endif
@@ -0,0 +1,215 @@
+/*****************************************************************************
+* | File      	:   EPD_Panel.c
+* | Author      :   py32f0-template contributors
+* | Function    :   Generic e-paper driver run from a panel descriptor
+* | Info        :
+*                A panel is a const EPD_PANEL: geometry, BUSY polarity, RAM
+*                write commands, waveform and the command scripts for init,
+*                refresh and sleep. One copy of the driver code serves all
+*                panels described this way.
+*                Generalises the init/display/sleep code of the Waveshare
+*                drivers and is distributed under their MIT licence below.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include "EPD_Panel.h"
+
+/******************************************************************************
+function :	Run a command script
+parameter:
+    Panel  : Panel the script belongs to, for EPD_OP_WAIT and EPD_OP_LUT
+    Script : Entries as described in EPD_Panel.h, ending with EPD_OP_END
+******************************************************************************/
+void EPD_Panel_Run(const EPD_PANEL *Panel, const UBYTE *Script)
+{
+    UBYTE n;
+
+    while ((n = *Script++) != EPD_OP_END) {
+        switch (n) {
+        case EPD_OP_RESET:
+            EPD_Digital_Write(EPD_RST_PIN, 1);
+            EPD_Delay_ms(Script[0]);
+            EPD_Digital_Write(EPD_RST_PIN, 0);
+            EPD_Delay_ms(Script[1]);
+            EPD_Digital_Write(EPD_RST_PIN, 1);
+            EPD_Delay_ms(Script[0]);
+            Script += 2;
+            break;
+        case EPD_OP_DELAY:
+            EPD_Delay_ms(*Script++);
+            break;
+        case EPD_OP_WAIT:
+            EPD_Panel_Wait(Panel);
+            break;
+        case EPD_OP_LUT:
+            EPD_Panel_SetLut(Panel, Panel->Lut);
+            break;
+        default:
+            EPD_SendCommand(*Script++);
+            if (n)
+                EPD_SendDataArray(Script, n);
+            Script += n;
+            break;
+        }
+    }
+}
+
+/******************************************************************************
+function :	Wait until the panel releases BUSY
+parameter:
+******************************************************************************/
+void EPD_Panel_Wait(const EPD_PANEL *Panel)
+{
+    EPD_Printf("e-Paper busy\r\n");
+    EPD_BusyStart(Panel->BusyLevel, NULL);
+    for (;;) {
+        if (Panel->BusyCmd)
+            EPD_SendCommand(Panel->BusyCmd);
+        if (!EPD_BusyPoll())
+            break;
+        EPD_BusySleep();
+    }
+}
+
+/******************************************************************************
+function :	Load a waveform from the host (SSD16xx)
+parameter:
+    Lut : 153 bytes for register 0x32, then 0x3F, gate (0x03),
+          source (0x04, 3 bytes) and VCOM (0x2C): 159 bytes
+******************************************************************************/
+void EPD_Panel_SetLut(const EPD_PANEL *Panel, const UBYTE *Lut)
+{
+    EPD_SendCommand(0x32);
+    EPD_SendDataArray(Lut, 153);
+    EPD_Panel_Wait(Panel);
+    EPD_SendCommand(0x3f);
+    EPD_SendData(Lut[153]);
+    EPD_SendCommand(0x03);
+    EPD_SendData(Lut[154]);
+    EPD_SendCommand(0x04);
+    EPD_SendDataArray(Lut + 155, 3);
+    EPD_SendCommand(0x2c);
+    EPD_SendData(Lut[158]);
+}
+
+/******************************************************************************
+function :	Initialize the e-Paper register
+parameter:
+******************************************************************************/
+void EPD_Panel_Init(const EPD_PANEL *Panel)
+{
+    EPD_BusyWait();
+    EPD_Panel_Run(Panel, Panel->Init);
+}
+
+/******************************************************************************
+function :	Clear screen
+parameter:
+******************************************************************************/
+void EPD_Panel_Clear(const EPD_PANEL *Panel)
+{
+    EPD_Panel_Display(Panel, NULL, NULL);
+}
+
+/******************************************************************************
+function :	Sends the planes to e-Paper and displays
+parameter:
+    Black  : Black/white plane, NULL for white
+    Red    : Red/yellow plane, NULL for none; ignored on black/white panels
+******************************************************************************/
+void EPD_Panel_Display(const EPD_PANEL *Panel, const UBYTE *Black, const UBYTE *Red)
+{
+    EPD_Panel_DisplayAsync(Panel, Black, Red, NULL);
+    EPD_Panel_Wait(Panel);
+}
+
+/******************************************************************************
+function :	Sends the planes and starts the refresh without waiting for it
+parameter:
+    Black  : Black/white plane, NULL for white
+    Red    : Red/yellow plane, NULL for none
+    Done   : Called from EPD_BusyPoll() once the refresh is over, or NULL
+info:
+    The UC81xx status command (BusyCmd) is not sent while polling
+    asynchronously, only the BUSY pin is read.
+******************************************************************************/
+void EPD_Panel_DisplayAsync(const EPD_PANEL *Panel, const UBYTE *Black, const UBYTE *Red, EPD_DONE Done)
+{
+    UDOUBLE Size = (UDOUBLE)((Panel->Width + 7) / 8) * Panel->Height;
+    const UBYTE *Plane[2] = {Black, Red};
+    UBYTE i;
+
+    EPD_BusyWait();
+    for (i = 0; i < 2; i++) {
+        if (!Panel->Ram[i])
+            continue;
+        EPD_SendCommand(Panel->Ram[i]);
+        if (Plane[i])
+            EPD_SendDataArray(Plane[i], Size);
+        else
+            EPD_SendDataBurst(0xFF, Size);
+    }
+    EPD_Panel_Run(Panel, Panel->Refresh);
+    EPD_BusyStart(Panel->BusyLevel, Done);
+}
+
+/******************************************************************************
+function :	Sends one band of one plane, refreshing after the last
+parameter:
+    Plane  : 0 black/white, 1 red/yellow
+    Band   : Rows lines of the plane, as rendered by Paint_RenderPlanes()
+    Ystart : First line of the band
+    Rows   : Number of lines in the band
+info:
+    The bands of a plane must arrive top to bottom, and all of plane 0
+    before plane 1: the RAM address counter advances on its own. Planes
+    the panel has no RAM for are skipped.
+******************************************************************************/
+void EPD_Panel_DisplayBand(const EPD_PANEL *Panel, UBYTE Plane, const UBYTE *Band, UWORD Ystart, UWORD Rows)
+{
+    UBYTE Last = Panel->Ram[1] ? 1 : 0;
+
+    if (Plane > Last)
+        return;
+    if (Ystart == 0) {
+        if (Plane == 0)
+            EPD_BusyWait();
+        EPD_SendCommand(Panel->Ram[Plane]);
+    }
+    EPD_SendDataArray(Band, (UDOUBLE)((Panel->Width + 7) / 8) * Rows);
+    if (Plane == Last && Ystart + Rows >= Panel->Height) {
+        EPD_Panel_Run(Panel, Panel->Refresh);
+        EPD_Panel_Wait(Panel);
+    }
+}
+
+/******************************************************************************
+function :	Enter sleep mode
+parameter:
+******************************************************************************/
+void EPD_Panel_Sleep(const EPD_PANEL *Panel)
+{
+    EPD_BusyWait();
+    EPD_Panel_Run(Panel, Panel->Sleep);
+}
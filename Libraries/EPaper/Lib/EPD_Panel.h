@@ -0,0 +1,73 @@
+/*****************************************************************************
+* | File      	:   EPD_Panel.h
+* | Author      :   py32f0-template contributors
+* | Function    :   Generic e-paper driver run from a panel descriptor
+* | Info        :
+*                A panel is a const EPD_PANEL: geometry, BUSY polarity, RAM
+*                write commands, waveform and the command scripts for init,
+*                refresh and sleep. One copy of the driver code serves all
+*                panels described this way.
+*                Generalises the init/display/sleep code of the Waveshare
+*                drivers and is distributed under their MIT licence below.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to  whom the Software is
+# furished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef __EPD_PANEL_H_
+#define __EPD_PANEL_H_
+
+#include "EPD_Common.h"
+
+/**
+ * Script entries: <n> <command> <n data bytes>, n < EPD_OP_RESET,
+ * or one of the operations below
+ */
+#define EPD_OP_RESET    0xFB    // <high ms> <low ms>: pulse RST, then wait high ms
+#define EPD_OP_DELAY    0xFC    // <ms>
+#define EPD_OP_WAIT     0xFD    // wait until BUSY is released
+#define EPD_OP_LUT      0xFE    // load the panel's waveform, see EPD_Panel_SetLut()
+#define EPD_OP_END      0xFF
+
+typedef struct {
+    UWORD Width;            // pixels, a RAM line is (Width + 7) / 8 bytes
+    UWORD Height;
+    UBYTE BusyLevel;        // BUSY pin level while working: 1 SSD16xx, 0 UC81xx
+    UBYTE BusyCmd;          // sent before each BUSY read (UC81xx: 0x71), 0 if none
+    UBYTE Ram[2];           // write commands of the black and red planes, 0 if none
+    const UBYTE *Lut;       // waveform for EPD_OP_LUT, NULL if from OTP
+    const UBYTE *Init;
+    const UBYTE *Refresh;   // starts the refresh once the planes are written
+    const UBYTE *Sleep;
+} EPD_PANEL;
+
+void EPD_Panel_Run(const EPD_PANEL *Panel, const UBYTE *Script);
+void EPD_Panel_Wait(const EPD_PANEL *Panel);
+void EPD_Panel_SetLut(const EPD_PANEL *Panel, const UBYTE *Lut);
+void EPD_Panel_Init(const EPD_PANEL *Panel);
+void EPD_Panel_Clear(const EPD_PANEL *Panel);
+void EPD_Panel_Display(const EPD_PANEL *Panel, const UBYTE *Black, const UBYTE *Red);
+void EPD_Panel_DisplayAsync(const EPD_PANEL *Panel, const UBYTE *Black, const UBYTE *Red, EPD_DONE Done);
+void EPD_Panel_DisplayBand(const EPD_PANEL *Panel, UBYTE Plane, const UBYTE *Band, UWORD Ystart, UWORD Rows);
+void EPD_Panel_Sleep(const EPD_PANEL *Panel);
+
+#endif
@@ -0,0 +1,350 @@
+#!/usr/bin/env python3
+"""
+Convert e-paper fonts and bitmaps to the packed format drawn by GUI_Paint.
+
+    python3 Misc/Python/epd_pack.py font Libraries/EPaper/Fonts/font24.c -o font24p.c --name Font24P
+    python3 Misc/Python/epd_pack.py font Libraries/EPaper/Fonts/font24cn.c -o font24cnp.c --name Font24CNP
+    python3 Misc/Python/epd_pack.py image EPD_TestImage2.c gImage_2in13b_V4b gImage_2in13b_V4r -o packed.c
+
+Bit runs: the pixels of a glyph or 1 bpp bitmap, MSB first, as alternating
+runs of clear and set pixels starting with clear. Each run is one nibble,
+high nibble first: 0..14, or 15 followed by one byte for 15..270. Longer
+runs are split by a zero-length run of the other color.
+
+Fonts: every glyph is bit runs over its Width x Height pixels without row
+padding, or the same pixels as raw bits when that is smaller (bit 15 of the
+glyph offset). ASCII fonts get an offset table next to the data
+(sFONT.offset), CN fonts an index sorted by index bytes (cFONT.packed) so
+Paint_FindCN() can binary search it; duplicate characters keep the first
+entry.
+
+Images: one codec byte, then the array bytes as bit runs (0, for 1 bpp
+pictures) or PackBits (1, for 2 and 4 bpp). --codec auto picks the smaller.
+The output is decoded again and compared with the input before it is
+written.
+"""
+import argparse
+import re
+import sys
+
+RUN_ESCAPE = 15
+RUN_MAX = RUN_ESCAPE + 255
+RAW_FLAG = 0x8000
+CODEC_RUNS = 0
+CODEC_BYTES = 1
+
+RE_NUM = re.compile(r"0[xX][0-9a-fA-F]+|\d+")
+RE_CN = re.compile(r'\{\s*(?:index:\s*)?"((?:[^"\\]|\\.)*)"\s*,\s*(?:matrix:\s*)?\{([^}]*)\}', re.S)
+RE_SFONT = re.compile(r"sFONT\s+(\w+)\s*=\s*\{\s*(\w+)\s*,\s*(\d+)[^,]*,\s*(\d+)", re.S)
+RE_CFONT = re.compile(r"cFONT\s+(\w+)\s*=\s*\{\s*(\w+)\s*,[^,]*,\s*(\d+)[^,]*,\s*(\d+)[^,]*,\s*(\d+)", re.S)
+
+
+class PackError(Exception):
+    pass
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def parse_array(text, name):
+    m = re.search(r"\b" + re.escape(name) + r"\s*\[[^\]]*\]\s*=\s*\{([^}]*)\}", text)
+    if not m:
+        raise PackError("array %s not found" % name)
+    return bytes(int(v, 0) & 0xFF for v in RE_NUM.findall(m.group(1)))
+
+
+def to_bits(data, count=None):
+    bits = [(data[i // 8] >> (7 - i % 8)) & 1 for i in range(len(data) * 8)]
+    return bits if count is None else bits[:count]
+
+
+def from_bits(bits):
+    out = bytearray((len(bits) + 7) // 8)
+    for i, b in enumerate(bits):
+        if b:
+            out[i // 8] |= 0x80 >> (i % 8)
+    return bytes(out)
+
+
+def glyph_bits(glyph, width, height):
+    """Rows padded to whole bytes -> width * height pixels"""
+    row = (width + 7) // 8
+    bits = []
+    for y in range(height):
+        bits += to_bits(glyph[y * row:(y + 1) * row], width)
+    return bits
+
+
+def runs_encode(bits):
+    nibbles = []
+    cur = 0
+    i = 0
+    while i < len(bits):
+        j = i
+        while j < len(bits) and bits[j] == cur:
+            j += 1
+        run = j - i
+        while run > RUN_MAX:
+            nibbles += [RUN_ESCAPE, (RUN_MAX - RUN_ESCAPE) >> 4, (RUN_MAX - RUN_ESCAPE) & 15, 0]
+            run -= RUN_MAX
+        if run < RUN_ESCAPE:
+            nibbles.append(run)
+        else:
+            nibbles += [RUN_ESCAPE, (run - RUN_ESCAPE) >> 4, (run - RUN_ESCAPE) & 15]
+        i = j
+        cur ^= 1
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes(nibbles[k] << 4 | nibbles[k + 1] for k in range(0, len(nibbles), 2))
+
+
+def runs_decode(data, count):
+    pos = [0]
+
+    def nibble():
+        v = data[pos[0] // 2] >> (4 if pos[0] % 2 == 0 else 0) & 15
+        pos[0] += 1
+        return v
+
+    bits = []
+    cur = 0
+    while len(bits) < count:
+        run = nibble()
+        if run == RUN_ESCAPE:
+            run += nibble() << 4
+            run += nibble()
+        bits += [cur] * run
+        cur ^= 1
+    return bits[:count]
+
+
+def packbits_encode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        j = i
+        while j < len(data) and j - i < 128 and data[j] == data[i]:
+            j += 1
+        if j - i >= 3:
+            out += bytes([257 - (j - i), data[i]])
+            i = j
+            continue
+        # Literal up to the next run of three
+        j = i
+        while j < len(data) and j - i < 128:
+            if j + 2 < len(data) and data[j] == data[j + 1] == data[j + 2]:
+                break
+            j += 1
+        out.append(j - i - 1)
+        out += data[i:j]
+        i = j
+    return bytes(out)
+
+
+def packbits_decode(data, count):
+    out = bytearray()
+    i = 0
+    while len(out) < count:
+        h = data[i]
+        i += 1
+        if h < 128:
+            out += data[i:i + h + 1]
+            i += h + 1
+        elif h > 128:
+            out += bytes([data[i]]) * (257 - h)
+            i += 1
+    return bytes(out[:count])
+
+
+def pack_glyph(glyph, width, height):
+    """-> (raw flag, bytes) of the smaller encoding"""
+    bits = glyph_bits(glyph, width, height)
+    runs = runs_encode(bits)
+    raw = from_bits(bits)
+    if runs_decode(runs, len(bits)) != bits:
+        raise PackError("bit runs round trip failed")
+    return (RAW_FLAG, raw) if len(raw) <= len(runs) else (0, runs)
+
+
+def c_bytes(data, indent="  ", per_line=16):
+    lines = []
+    for k in range(0, len(data), per_line):
+        lines.append(indent + ",".join("0x%02X" % b for b in data[k:k + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def c_string(index):
+    out = ""
+    for ch in index.decode("utf-8", "replace"):
+        if ch in '"\\':
+            out += "\\" + ch
+        elif ord(ch) < 0x20:
+            out += "\\x%02x" % ord(ch)
+        else:
+            out += ch
+    return out
+
+
+def pack_sfont(text, args):
+    m = RE_SFONT.search(text)
+    if not m:
+        raise PackError("no sFONT definition")
+    _, table, width, height = m.group(1), m.group(2), int(m.group(3)), int(m.group(4))
+    data = parse_array(text, table)
+    size = (width + 7) // 8 * height
+    count = len(data) // size
+    packed = bytearray()
+    offsets = []
+    for i in range(count):
+        flag, enc = pack_glyph(data[i * size:(i + 1) * size], width, height)
+        if len(packed) >= RAW_FLAG:
+            raise PackError("packed data over 32 KB")
+        offsets.append(flag | len(packed))
+        packed += enc
+    name = args.name
+    total = len(packed) + 2 * len(offsets)
+    out = [header(args, "%d glyphs %dx%d: %d -> %d bytes" % (count, width, height, len(data), total)),
+           "static const uint8_t %s_Data[] = {" % name, c_bytes(packed), "};", "",
+           "/* Glyph offsets into %s_Data, 0x8000: raw bits instead of runs */" % name,
+           "static const uint16_t %s_Offset[] = {" % name,
+           c_words(offsets), "};", "",
+           "sFONT %s = {" % name,
+           "  %s_Data," % name,
+           "  %d, /* Width */" % width,
+           "  %d, /* Height */" % height,
+           "  %s_Offset, /* packed glyphs */" % name,
+           "};", ""]
+    return "\n".join(out), len(data), total
+
+
+def pack_cfont(text, args):
+    m = RE_CFONT.search(text)
+    if not m:
+        raise PackError("no cFONT definition")
+    table, ascii_w, width, height = m.group(2), int(m.group(3)), int(m.group(4)), int(m.group(5))
+    body = re.search(r"\b" + re.escape(table) + r"\s*\[\s*\]\s*=\s*\{(.*)\n\};", text, re.S)
+    if not body:
+        raise PackError("table %s not found" % table)
+    size = (width + 7) // 8 * height
+    entries = {}
+    raw_total = 0
+    for idx, mat in RE_CN.findall(body.group(1)):
+        key = idx.encode("utf-8")[:3].ljust(3, b"\0")
+        glyph = bytes(int(v, 0) & 0xFF for v in RE_NUM.findall(mat)).ljust(size, b"\0")[:size]
+        raw_total += 3 + size
+        entries.setdefault(key, glyph)
+    packed = bytearray()
+    index = []
+    for key in sorted(entries):
+        flag, enc = pack_glyph(entries[key], width, height)
+        if len(packed) >= RAW_FLAG:
+            raise PackError("packed data over 32 KB")
+        index.append((key, flag | len(packed)))
+        packed += enc
+    name = args.name
+    total = len(packed) + 6 * len(index)
+    out = [header(args, "%d glyphs %dx%d: %d -> %d bytes" % (len(index), width, height, raw_total, total)),
+           "static const uint8_t %s_Data[] = {" % name, c_bytes(packed), "};", "",
+           "/* Sorted by index bytes; offset 0x8000: raw bits instead of runs */",
+           "static const CH_CN_PACK %s_Index[] = {" % name]
+    for key, off in index:
+        out.append('  {"%s", 0x%04X},' % (c_string(key.rstrip(b"\0")), off))
+    out += ["};", "",
+            "cFONT %s = {" % name,
+            "  NULL,",
+            "  sizeof(%s_Index)/sizeof(CH_CN_PACK),  /*size of table*/" % name,
+            "  %d, /* ASCII Width */" % ascii_w,
+            "  %d, /* Width */" % width,
+            "  %d, /* Height */" % height,
+            "  NULL, /* index order */",
+            "  %s_Index, /* packed glyphs */" % name,
+            "  %s_Data," % name,
+            "};", ""]
+    return "\n".join(out), raw_total, total
+
+
+def pack_array(data, codec):
+    """-> (codec, bytes) after a round trip check"""
+    runs = runs_encode(to_bits(data))
+    pack = packbits_encode(data)
+    if codec == "runs" or (codec == "auto" and len(runs) <= len(pack)):
+        codec, enc = CODEC_RUNS, runs
+        check = from_bits(runs_decode(runs, len(data) * 8))
+    else:
+        codec, enc = CODEC_BYTES, pack
+        check = packbits_decode(pack, len(data))
+    if check != data:
+        raise PackError("round trip failed")
+    return codec, enc
+
+
+def pack_image(text, args):
+    if args.name and len(args.array) > 1:
+        raise PackError("--name needs a single array")
+    summary = []
+    body = []
+    before = after = 0
+    for array in args.array:
+        data = parse_array(text, array)
+        codec, enc = pack_array(data, args.codec)
+        summary.append("%s: %d -> %d bytes (%s)" % (array, len(data), len(enc) + 1,
+                                                    "bit runs" if codec == CODEC_RUNS else "PackBits"))
+        body += ["const unsigned char %s[] = {" % (args.name or array + "_Packed"),
+                 "  %d, /* codec */" % codec, c_bytes(enc), "};", ""]
+        before += len(data)
+        after += len(enc) + 1
+    return "\n".join([header(args, "\n   ".join(summary))] + body), before, after
+
+
+def c_words(words, per_line=8):
+    return "\n".join("  " + ",".join("0x%04X" % w for w in words[k:k + per_line]) + ","
+                     for k in range(0, len(words), per_line))
+
+
+def header(args, summary):
+    include = '#include <stddef.h>\n#include "fonts.h"\n' if args.cmd == "font" else ""
+    return ("/* Generated by Misc/Python/epd_pack.py from %s, do not edit.\n"
+            "   %s */\n%s" % (args.source.split("/")[-1], summary, include))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0].strip())
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    f = sub.add_parser("font", help="pack an sFONT or cFONT source file")
+    f.add_argument("source")
+    f.add_argument("--name", required=True, help="name of the packed font")
+    f.add_argument("-o", "--output", help="C file to write (default stdout)")
+    i = sub.add_parser("image", help="pack image arrays")
+    i.add_argument("source")
+    i.add_argument("array", nargs="+")
+    i.add_argument("--name", help="name of a single packed array (default <array>_Packed)")
+    i.add_argument("--codec", choices=("auto", "runs", "bytes"), default="auto")
+    i.add_argument("-o", "--output", help="C file to write (default stdout)")
+    args = ap.parse_args()
+
+    try:
+        with open(args.source, encoding="utf-8") as fh:
+            text = strip_comments(fh.read())
+        if args.cmd == "image":
+            out, before, after = pack_image(text, args)
+        elif "CH_CN" in text:
+            out, before, after = pack_cfont(text, args)
+        else:
+            out, before, after = pack_sfont(text, args)
+    except (OSError, PackError) as e:
+        print("epd_pack: %s" % e, file=sys.stderr)
+        return 1
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as fh:
+            fh.write(out)
+        print("%s: %d -> %d bytes (%.0f%%)" % (args.output, before, after, 100.0 * after / before))
+    else:
+        sys.stdout.write(out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+Decode the FAULT lines printed over RTT after a HardFault reset.
+
+    python3 Misc/Python/fault_decode.py Build/app.elf rtt.log
+    JLinkRTTClient | python3 Misc/Python/fault_decode.py Build/app.elf
+
+Addresses are resolved to function+offset from the ELF symbol table; with
+--addr2line (e.g. arm-none-eabi-addr2line) the source line is added. The
+trace entries are return addresses found on the stack above the exception
+frame: a likely call chain, innermost first, not an exact backtrace.
+"""
+import argparse
+import bisect
+import re
+import struct
+import subprocess
+import sys
+
+from m0_bench import Elf, BenchError
+
+RE_FIELD = re.compile(r"(\w+)=([0-9a-fA-F]+)")
+EXC_NAMES = {0: "thread", 2: "NMI", 3: "HardFault", 11: "SVCall", 14: "PendSV", 15: "SysTick"}
+EXC_RETURN = {0xFFFFFFF1: "handler mode, MSP", 0xFFFFFFF9: "thread mode, MSP",
+              0xFFFFFFFD: "thread mode, PSP"}
+
+
+class Symbols:
+    def __init__(self, elf):
+        funcs = []
+        d = elf.data
+        for sh in elf.sections:
+            if sh[1] != 2:
+                continue
+            strtab = elf.sections[sh[6]]
+            for k in range(sh[5] // 16):
+                name_off, value, size, info, _, _ = struct.unpack_from("<IIIBBH", d, sh[4] + k * 16)
+                if (info & 0xF) == 2 and value:  # FUNC
+                    funcs.append((value & ~1, size, elf._str(strtab[4] + name_off)))
+        funcs.sort()
+        self.funcs = funcs
+        self.starts = [f[0] for f in funcs]
+
+    def lookup(self, addr):
+        addr &= ~1
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i < 0:
+            return None
+        start, size, name = self.funcs[i]
+        if size and addr >= start + size:
+            return None
+        return "%s+0x%x" % (name, addr - start)
+
+
+def source_line(tool, elf_path, addr):
+    if not tool:
+        return ""
+    try:
+        out = subprocess.run([tool, "-e", elf_path, "0x%08x" % (addr & ~1)],
+                             capture_output=True, text=True, check=True).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return ""
+    return "" if out.startswith("??") else "  " + out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("elf")
+    ap.add_argument("log", nargs="?", help="RTT log (default: stdin)")
+    ap.add_argument("--addr2line", help="addr2line executable for source lines")
+    args = ap.parse_args()
+
+    try:
+        syms = Symbols(Elf(args.elf))
+    except (OSError, BenchError) as e:
+        print("fault_decode: %s" % e, file=sys.stderr)
+        return 2
+
+    fields = {}
+    trace = []
+    src = open(args.log, errors="replace") if args.log else sys.stdin
+    with src:
+        for line in src:
+            pos = line.find("FAULT ")
+            if pos < 0:
+                continue
+            body = line[pos + 6:]
+            if body.startswith("trace="):
+                trace = [int(t, 16) for t in body[6:].split() if re.fullmatch(r"[0-9a-fA-F]+", t)]
+            else:
+                fields.update({k: int(v, 16) if k != "tick" else int(v) for k, v in RE_FIELD.findall(body)})
+
+    if "pc" not in fields:
+        print("no FAULT record in the input")
+        return 1
+
+    def where(addr):
+        return "0x%08x  %s%s" % (addr, syms.lookup(addr) or "?", source_line(args.addr2line, args.elf, addr))
+
+    ipsr = fields.get("xpsr", 0) & 0x3F
+    exc = EXC_NAMES.get(ipsr, "IRQ%d" % (ipsr - 16) if ipsr >= 16 else "exception %d" % ipsr)
+    print("HardFault at %.3f s, faulting context: %s (%s)"
+          % (fields.get("tick", 0) / 1000.0, exc,
+             EXC_RETURN.get(fields.get("exc", 0), "EXC_RETURN 0x%08x" % fields.get("exc", 0))))
+    print("pc   " + where(fields["pc"]))
+    print("lr   " + where(fields.get("lr", 0)))
+    print("sp   0x%08x" % fields.get("sp", 0))
+    print("xpsr 0x%08x  N%d Z%d C%d V%d T%d" % tuple([fields.get("xpsr", 0)] +
+          [(fields.get("xpsr", 0) >> b) & 1 for b in (31, 30, 29, 28, 24)]))
+    print("r0 0x%08x  r1 0x%08x  r2 0x%08x  r3 0x%08x  r12 0x%08x"
+          % tuple(fields.get(r, 0) for r in ("r0", "r1", "r2", "r3", "r12")))
+    if not fields.get("xpsr", 0) & (1 << 24):
+        print("note: T bit clear, the fault is a branch to an ARM (even) address")
+    if trace:
+        print("stack trace (return addresses above the frame):")
+        for addr in trace:
+            print("  " + where(addr))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
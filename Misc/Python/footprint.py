@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""
+Flash/RAM footprint per module from the linker map (make footprint).
+
+Attributes every input section in Build/app.map to the module that supplied
+it: each file in User/ on its own, the rest grouped as HAL, BSP, CMSIS, RTT,
+EPaper and libc. Sizes are split into .text, .rodata (vector table and ARM
+tables included), .data and .bss. The largest stack frame of each module comes
+from the .su files written by -fstack-usage.
+
+With a baseline file the per-module flash/RAM/stack deltas are shown;
+--update rewrites it. --check fails when a module's or the total flash or RAM
+grew by more than --slack bytes. Without a baseline there is nothing to
+compare against, which is only a warning.
+"""
+import argparse
+import glob
+import os
+import re
+import sys
+
+COLUMNS = ("text", "rodata", "data", "bss")
+
+RE_REGION = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+RE_OUT = re.compile(r"^(\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+))?\s*$")
+RE_IN = re.compile(r"^ (\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*))?$")
+RE_CONT = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+RE_SU = re.compile(r"^(.*?):\d+:\d+:(\S+)\s+(\d+)\s+(\S+)")
+
+
+def module_of(path):
+    """Report row for an object file, archive member or source path."""
+    path = path.replace("\\", "/")
+    if "(" in path or path.endswith(".a"):
+        return "libc"
+    path = re.sub(r"^(\./)?(Build/)?", "", os.path.normpath(path).replace("\\", "/"))
+    path = re.sub(r"\.(o|c|s|su)$", "", path)
+    if path.startswith("User/segger/"):
+        return "RTT"
+    if path.startswith("User/"):
+        return path
+    for prefix, name in (("Libraries/PY32F0xx_HAL_Driver/", "HAL"),
+                         ("Libraries/PY32F0xx_LL_Driver/", "HAL"),
+                         ("Libraries/BSP", "BSP"),
+                         ("Libraries/CMSIS/", "CMSIS"),
+                         ("Libraries/EPaper/", "EPaper"),
+                         ("Libraries/FreeRTOS/", "FreeRTOS")):
+        if path.startswith(prefix):
+            return name
+    return "libc" if path.startswith("/") else path
+
+
+def column_of(out_name, in_name):
+    if out_name in (".bss", ".noinit") or in_name.startswith(".bss") or in_name == "COMMON":
+        return "bss"
+    if out_name == ".data":
+        return "data"
+    if out_name == ".text" and in_name.startswith(".text"):
+        return "text"
+    return "rodata"
+
+
+def parse_map(path):
+    """Returns ({module: {column: bytes}}, {region: (origin, length)}, reserved)."""
+    regions = {}
+    modules = {}
+    reserved = 0
+    state = None
+    out_name = None
+    out_in_memory = False
+    pending = None
+
+    def add(in_name, addr, size, obj):
+        nonlocal reserved
+        if not out_in_memory or addr == 0 or size == 0:
+            return
+        if out_name == "._user_heap_stack":
+            reserved += size
+            return
+        mod = "(fill)" if obj is None else module_of(obj)
+        row = modules.setdefault(mod, dict.fromkeys(COLUMNS, 0))
+        row[column_of(out_name, in_name)] += size
+
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if line.startswith("Memory Configuration"):
+                state = "regions"
+                continue
+            if line.startswith("Linker script and memory map"):
+                state = "map"
+                continue
+            if state == "regions":
+                m = RE_REGION.match(line)
+                if m and m.group(1) != "Name" and m.group(1) != "*default*":
+                    regions[m.group(1)] = (int(m.group(2), 16), int(m.group(3), 16))
+                continue
+            if state != "map" or not line.strip():
+                continue
+
+            if pending:
+                m = RE_CONT.match(line)
+                if m:
+                    add(pending, int(m.group(1), 16), int(m.group(2), 16), m.group(3))
+                pending = None
+                if m:
+                    continue
+
+            m = RE_OUT.match(line)
+            if m:
+                out_name = m.group(1)
+                out_in_memory = out_name.startswith(".") and not out_name.startswith((".debug", ".comment", ".ARM.attributes"))
+                continue
+            if line.startswith(" *fill*"):
+                parts = line.split()
+                if len(parts) >= 3:
+                    add("*fill*", int(parts[1], 16), int(parts[2], 16), None)
+                continue
+            m = RE_IN.match(line)
+            if m and not m.group(1).startswith("*") and m.group(1) != "LOAD":
+                if m.group(2) is None:
+                    pending = m.group(1)
+                else:
+                    add(m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4))
+    return modules, regions, reserved
+
+
+def parse_stack(build_dir):
+    """Returns ({module: largest frame}, [(frame, qualifier, function, module)])."""
+    frames = {}
+    funcs = []
+    for su in glob.glob(os.path.join(build_dir, "**", "*.su"), recursive=True):
+        if os.sep + "sim" + os.sep in su:
+            continue
+        with open(su) as f:
+            for line in f:
+                m = RE_SU.match(line)
+                if not m:
+                    continue
+                mod = module_of(m.group(1))
+                size = int(m.group(3))
+                frames[mod] = max(frames.get(mod, 0), size)
+                funcs.append((size, m.group(4), m.group(2), mod))
+    funcs.sort(reverse=True)
+    return frames, funcs
+
+
+def read_baseline(path):
+    base = {}
+    try:
+        with open(path) as f:
+            for line in f:
+                line = line.split("#", 1)[0].split()
+                if len(line) == 4:
+                    base[line[0]] = tuple(int(v) for v in line[1:])
+    except FileNotFoundError:
+        return None
+    return base
+
+
+def write_baseline(path, rows):
+    with open(path, "w") as f:
+        f.write("# module  flash ram max-frame (footprint.py --update)\n")
+        for name, vals in rows.items():
+            f.write("%s %d %d %d\n" % (name, vals[0], vals[1], vals[2]))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("map")
+    ap.add_argument("--build-dir", help="where the .su files are (default: next to the map)")
+    ap.add_argument("--baseline", help="baseline file to diff against")
+    ap.add_argument("--update", action="store_true", help="rewrite the baseline from this build")
+    ap.add_argument("--check", action="store_true", help="fail if flash or RAM grew against the baseline")
+    ap.add_argument("--slack", type=int, default=0, help="bytes of growth --check lets through (default 0)")
+    ap.add_argument("--top", type=int, default=5, help="number of largest stack frames to list")
+    args = ap.parse_args()
+
+    try:
+        modules, regions, reserved = parse_map(args.map)
+    except OSError as e:
+        print("footprint: %s" % e, file=sys.stderr)
+        return 2
+    frames, funcs = parse_stack(args.build_dir or os.path.dirname(args.map) or ".")
+    base = read_baseline(args.baseline) if args.baseline else None
+    if args.baseline and base is None and not args.update:
+        print("footprint: warning: no baseline at %s, deltas not checked; run with --update to create it"
+              % args.baseline, file=sys.stderr)
+
+    def order(name):
+        return (not name.startswith("User/"), name.startswith("("), name)
+
+    rows = {}
+    grown = []
+    total = dict.fromkeys(COLUMNS, 0)
+    print("%-28s %6s %6s %5s %5s | %6s %5s %5s" % ("module", "text", "rodata", "data", "bss",
+                                                 "flash", "ram", "frame"))
+    for name in sorted(set(modules) | set(frames), key=order):
+        row = modules.get(name, dict.fromkeys(COLUMNS, 0))
+        for c in COLUMNS:
+            total[c] += row[c]
+        flash = row["text"] + row["rodata"] + row["data"]
+        ram = row["data"] + row["bss"]
+        rows[name] = (flash, ram, frames.get(name, 0))
+        line = "%-28s %6d %6d %5d %5d | %6d %5d %5d" % (name, row["text"], row["rodata"], row["data"],
+                                                      row["bss"], flash, ram, rows[name][2])
+        if base is not None:
+            old = base.get(name, (0, 0, 0))
+            delta = [n - o for n, o in zip(rows[name], old)]
+            if any(delta):
+                line += "  %+d / %+d / %+d" % tuple(delta)
+            if max(delta[0], delta[1]) > args.slack:
+                grown.append((name, delta[0], delta[1]))
+        print(line)
+    for name in (base or {}):
+        if name not in rows:
+            print("%-28s removed  %+d / %+d / %+d" % ((name,) + tuple(-v for v in base[name])))
+
+    flash = total["text"] + total["rodata"] + total["data"]
+    ram = total["data"] + total["bss"]
+    print("%-28s %6d %6d %5d %5d | %6d %5d" % ("total", total["text"], total["rodata"],
+                                             total["data"], total["bss"], flash, ram))
+    if base is not None:
+        delta = (flash - sum(v[0] for v in base.values()), ram - sum(v[1] for v in base.values()))
+        if max(delta) > args.slack:
+            grown.append(("total",) + delta)
+    if "FLASH" in regions:
+        size = regions["FLASH"][1]
+        print("FLASH %6d / %d bytes (%.1f%%), %d free" % (flash, size, 100.0 * flash / size, size - flash))
+    if "RAM" in regions:
+        size = regions["RAM"][1]
+        print("RAM   %6d / %d bytes (%.1f%%) + %d heap/stack reserve, %d free"
+              % (ram, size, 100.0 * ram / size, reserved, size - ram - reserved))
+
+    if funcs:
+        print("largest stack frames (-fstack-usage):")
+        for size, qual, func, mod in funcs[:args.top]:
+            print("  %5d  %-30s %s%s" % (size, func, mod, "" if qual == "static" else "  (%s)" % qual))
+
+    if args.baseline and args.update:
+        write_baseline(args.baseline, rows)
+        print("baseline written to %s" % args.baseline)
+    elif args.check and grown:
+        for name, dflash, dram in grown:
+            print("footprint: %s grew by %+d flash / %+d ram (slack %d)" % (name, dflash, dram, args.slack),
+                  file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,680 @@
+#!/usr/bin/env python3
+"""
+Cortex-M0+ cycle benchmark for the firmware ELF (make bench).
+
+Runs selected functions of Build/app.elf on a small ARMv6-M instruction set
+simulator with the Cortex-M0+ cycle table (TRM r0p1, table 3-1): zero flash
+wait states (HSI 8 MHz), single-cycle multiplier, 2-cycle loads/stores,
+taken branches 2, BL 3, POP {pc} 3+N. Peripherals are a register file that
+returns what was last written, preset per case so polling code terminates.
+
+Each case reports cycles per call. With a baseline file the run fails when a
+case exceeds its baseline by more than the tolerance, or a baseline case was
+not run; --update rewrites it. A case whose function is not in the ELF (say,
+inlined) is an error rather than a silent skip.
+--self-test times hand-assembled snippets against the TRM table first and
+needs no ELF.
+"""
+import argparse
+import struct
+import sys
+
+M32 = 0xFFFFFFFF
+
+FLASH_BASE = 0x08000000
+FLASH_SIZE = 0x5000
+RAM_BASE = 0x20000000
+RAM_SIZE = 0xC00
+RETURN_MAGIC = 0x0F000000  # never executed: marks the end of a call
+IRQ_ENTRY_CYCLES = 15      # exception entry latency, not included in results
+
+TIM16_BASE = 0x40014400
+TIM_DIER = 0x0C
+TIM_SR = 0x10
+
+
+class BenchError(Exception):
+    pass
+
+
+# ---- Memory ----------------------------------------------------------------
+
+class Memory:
+    def __init__(self):
+        self.flash = bytearray(b"\xff" * FLASH_SIZE)
+        self.ram = bytearray(RAM_SIZE)
+        self.periph = {}
+
+    def _region(self, addr, size):
+        if FLASH_BASE <= addr and addr + size <= FLASH_BASE + FLASH_SIZE:
+            return self.flash, addr - FLASH_BASE
+        if addr + size <= FLASH_SIZE:  # boot alias of flash at 0
+            return self.flash, addr
+        if RAM_BASE <= addr and addr + size <= RAM_BASE + RAM_SIZE:
+            return self.ram, addr - RAM_BASE
+        return None, 0
+
+    def _is_periph(self, addr):
+        return 0x40000000 <= addr < 0x60000000 or 0xE0000000 <= addr < 0xE0100000
+
+    def load(self, addr, data):
+        buf, off = self._region(addr, len(data))
+        if buf is None:
+            raise BenchError("load outside memory at 0x%08x" % addr)
+        buf[off:off + len(data)] = data
+
+    def read(self, addr, size):
+        if addr % size:
+            raise BenchError("unaligned %d-byte read at 0x%08x" % (size, addr))
+        buf, off = self._region(addr, size)
+        if buf is not None:
+            return int.from_bytes(buf[off:off + size], "little")
+        if self._is_periph(addr):
+            word = self.periph.get(addr & ~3, 0)
+            shift = (addr & 3) * 8
+            return (word >> shift) & ((1 << (size * 8)) - 1)
+        raise BenchError("read from unmapped 0x%08x" % addr)
+
+    def write(self, addr, size, value):
+        if addr % size:
+            raise BenchError("unaligned %d-byte write at 0x%08x" % (size, addr))
+        value &= (1 << (size * 8)) - 1
+        if RAM_BASE <= addr and addr + size <= RAM_BASE + RAM_SIZE:
+            off = addr - RAM_BASE
+            self.ram[off:off + size] = value.to_bytes(size, "little")
+            return
+        if self._is_periph(addr):
+            base = addr & ~3
+            shift = (addr & 3) * 8
+            mask = ((1 << (size * 8)) - 1) << shift
+            word = self.periph.get(base, 0)
+            self.periph[base] = (word & ~mask) | (value << shift)
+            return
+        raise BenchError("write to 0x%08x" % addr)
+
+
+# ---- ARMv6-M core ----------------------------------------------------------
+
+def _sx(value, bits):
+    sign = 1 << (bits - 1)
+    return (value & (sign - 1)) - (value & sign)
+
+
+class CortexM0Plus:
+    def __init__(self, mem, mul_cycles=1):
+        self.mem = mem
+        self.r = [0] * 16
+        self.n = self.z = self.c = self.v = 0
+        self.primask = 0
+        self.cycles = 0
+        self.mul_cycles = mul_cycles
+
+    # -- helpers
+    def _get(self, reg):
+        return (self.r[15] + 4) & M32 if reg == 15 else self.r[reg]
+
+    def _nz(self, res):
+        self.n = res >> 31
+        self.z = 1 if res == 0 else 0
+
+    def _addc(self, a, b, carry):
+        b &= M32
+        u = a + b + carry
+        res = u & M32
+        s = _sx(a, 32) + _sx(b, 32) + carry
+        self.c = u >> 32
+        self.v = 1 if s != _sx(res, 32) else 0
+        self._nz(res)
+        return res
+
+    def _cond(self, cond):
+        n, z, c, v = self.n, self.z, self.c, self.v
+        return [z, not z, c, not c, n, not n, v, not v,
+                c and not z, not c or z, n == v, n != v,
+                not z and n == v, z or n != v][cond]
+
+    def _load(self, addr, size, signed=False):
+        val = self.mem.read(addr & M32, size)
+        return _sx(val, size * 8) & M32 if signed else val
+
+    # -- run
+    def call(self, addr, args=(), max_cycles=1000000):
+        for i, a in enumerate(args):
+            self.r[i] = a & M32
+        self.r[14] = RETURN_MAGIC | 1
+        self.r[15] = addr & ~1
+        start = self.cycles
+        while self.r[15] != RETURN_MAGIC:
+            self.step()
+            if self.cycles - start > max_cycles:
+                raise BenchError("no return after %d cycles (pc 0x%08x)" % (max_cycles, self.r[15]))
+        return self.cycles - start
+
+    def step(self):
+        pc = self.r[15]
+        hw = self.mem.read(pc, 2)
+        if (hw >> 11) in (0b11101, 0b11110, 0b11111):
+            self._exec32(hw, self.mem.read(pc + 2, 2))
+        else:
+            self._exec16(hw)
+
+    def _branch(self, target):
+        self.r[15] = target & ~1 & M32
+
+    def _exec32(self, h1, h2):
+        pc = self.r[15]
+        if (h1 >> 11) == 0b11110 and (h2 & 0xD000) == 0xD000:  # BL
+            s = (h1 >> 10) & 1
+            i1 = 1 - (((h2 >> 13) & 1) ^ s)
+            i2 = 1 - (((h2 >> 11) & 1) ^ s)
+            imm = (s << 24) | (i1 << 23) | (i2 << 22) | ((h1 & 0x3FF) << 12) | ((h2 & 0x7FF) << 1)
+            self.r[14] = (pc + 4) | 1
+            self._branch(pc + 4 + _sx(imm, 25))
+            self.cycles += 3
+            return
+        if (h1 & 0xFFF0) == 0xF380 and (h2 & 0xFF00) == 0x8800:  # MSR
+            val = self.r[h1 & 15]
+            sysm = h2 & 0xFF
+            if sysm == 8:
+                self.r[13] = val & ~3
+            elif sysm == 16:
+                self.primask = val & 1
+            self.r[15] = pc + 4
+            self.cycles += 3
+            return
+        if h1 == 0xF3EF and (h2 & 0xF000) == 0x8000:  # MRS
+            sysm = h2 & 0xFF
+            if sysm <= 7:
+                val = (self.n << 31) | (self.z << 30) | (self.c << 29) | (self.v << 28)
+            elif sysm == 8:
+                val = self.r[13]
+            elif sysm == 16:
+                val = self.primask
+            else:
+                val = 0
+            self.r[(h2 >> 8) & 15] = val
+            self.r[15] = pc + 4
+            self.cycles += 3
+            return
+        if h1 == 0xF3BF and (h2 & 0xFF00) == 0x8F00:  # DSB/DMB/ISB
+            self.r[15] = pc + 4
+            self.cycles += 3
+            return
+        raise BenchError("unsupported 32-bit instruction %04x %04x at 0x%08x" % (h1, h2, pc))
+
+    def _exec16(self, i):
+        r = self.r
+        pc = r[15]
+        nxt = pc + 2
+        cyc = 1
+
+        if (i >> 13) == 0b000:
+            rd = i & 7
+            rm = (i >> 3) & 7
+            op = (i >> 11) & 3
+            if op != 3:  # LSL/LSR/ASR immediate
+                imm = (i >> 6) & 31
+                v = r[rm]
+                if op == 0:
+                    res = v
+                    if imm:
+                        self.c = (v >> (32 - imm)) & 1
+                        res = (v << imm) & M32
+                elif op == 1:
+                    n = imm or 32
+                    self.c = (v >> (n - 1)) & 1
+                    res = v >> n if n < 32 else 0
+                else:
+                    n = imm or 32
+                    sv = _sx(v, 32)
+                    self.c = (sv >> (n - 1)) & 1
+                    res = (sv >> n) & M32
+                r[rd] = res
+                self._nz(res)
+            else:  # ADD/SUB register or imm3
+                opc = (i >> 9) & 3
+                x = (i >> 6) & 7
+                b = r[x] if opc < 2 else x
+                if opc in (0, 2):
+                    r[rd] = self._addc(r[rm], b, 0)
+                else:
+                    r[rd] = self._addc(r[rm], ~b, 1)
+
+        elif (i >> 13) == 0b001:  # MOV/CMP/ADD/SUB imm8
+            rd = (i >> 8) & 7
+            imm = i & 0xFF
+            op = (i >> 11) & 3
+            if op == 0:
+                r[rd] = imm
+                self._nz(imm)
+            elif op == 1:
+                self._addc(r[rd], ~imm, 1)
+            elif op == 2:
+                r[rd] = self._addc(r[rd], imm, 0)
+            else:
+                r[rd] = self._addc(r[rd], ~imm, 1)
+
+        elif (i >> 10) == 0b010000:  # data processing
+            op = (i >> 6) & 15
+            rm = (i >> 3) & 7
+            rdn = i & 7
+            a, b = r[rdn], r[rm]
+            res = None
+            if op == 0:
+                res = a & b
+            elif op == 1:
+                res = a ^ b
+            elif op in (2, 3, 4, 7):
+                n = b & 0xFF
+                res = a
+                if n:
+                    if op == 2:
+                        self.c = ((a >> (32 - n)) & 1) if n <= 32 else 0
+                        res = (a << n) & M32 if n < 32 else 0
+                    elif op == 3:
+                        self.c = ((a >> (n - 1)) & 1) if n <= 32 else 0
+                        res = a >> n if n < 32 else 0
+                    elif op == 4:
+                        if n < 32:
+                            self.c = (_sx(a, 32) >> (n - 1)) & 1
+                            res = (_sx(a, 32) >> n) & M32
+                        else:
+                            self.c = a >> 31
+                            res = M32 if self.c else 0
+                    else:
+                        s = n & 31
+                        res = ((a >> s) | (a << (32 - s))) & M32 if s else a
+                        self.c = res >> 31
+            elif op == 5:
+                r[rdn] = self._addc(a, b, self.c)
+            elif op == 6:
+                r[rdn] = self._addc(a, ~b, self.c)
+            elif op == 8:
+                self._nz(a & b)
+            elif op == 9:
+                r[rdn] = self._addc(~b & M32, 0, 1)
+            elif op == 10:
+                self._addc(a, ~b, 1)
+            elif op == 11:
+                self._addc(a, b, 0)
+            elif op == 12:
+                res = a | b
+            elif op == 13:
+                res = (a * b) & M32
+                cyc = self.mul_cycles
+            elif op == 14:
+                res = a & ~b & M32
+            else:
+                res = ~b & M32
+            if res is not None:
+                r[rdn] = res
+                self._nz(res)
+
+        elif (i >> 10) == 0b010001:  # high register ops, BX/BLX
+            op = (i >> 8) & 3
+            rm = (i >> 3) & 15
+            rdn = ((i >> 4) & 8) | (i & 7)
+            if op == 0:
+                res = (self._get(rdn) + self._get(rm)) & M32
+                if rdn == 15:
+                    nxt, cyc = res & ~1, 2
+                else:
+                    r[rdn] = res
+            elif op == 1:
+                self._addc(self._get(rdn), ~self._get(rm), 1)
+            elif op == 2:
+                val = self._get(rm)
+                if rdn == 15:
+                    nxt, cyc = val & ~1, 2
+                else:
+                    r[rdn] = val
+            else:
+                target = self._get(rm)
+                if i & 0x80:
+                    r[14] = (pc + 2) | 1
+                nxt, cyc = target & ~1, 2
+
+        elif (i >> 11) == 0b01001:  # LDR literal
+            addr = ((pc + 4) & ~3) + (i & 0xFF) * 4
+            r[(i >> 8) & 7] = self._load(addr, 4)
+            cyc = 2
+
+        elif (i >> 12) == 0b0101:  # load/store register offset
+            op = (i >> 9) & 7
+            addr = (r[(i >> 3) & 7] + r[(i >> 6) & 7]) & M32
+            rt = i & 7
+            if op == 0:
+                self.mem.write(addr, 4, r[rt])
+            elif op == 1:
+                self.mem.write(addr, 2, r[rt])
+            elif op == 2:
+                self.mem.write(addr, 1, r[rt])
+            else:
+                size, signed = {3: (1, True), 4: (4, False), 5: (2, False),
+                                6: (1, False), 7: (2, True)}[op]
+                r[rt] = self._load(addr, size, signed)
+            cyc = 2
+
+        elif (i >> 13) == 0b011 or (i >> 12) == 0b1000:  # load/store imm5
+            if (i >> 13) == 0b011:
+                size = 1 if (i >> 12) & 1 else 4
+            else:
+                size = 2
+            addr = (r[(i >> 3) & 7] + ((i >> 6) & 31) * size) & M32
+            rt = i & 7
+            if (i >> 11) & 1:
+                r[rt] = self._load(addr, size)
+            else:
+                self.mem.write(addr, size, r[rt])
+            cyc = 2
+
+        elif (i >> 12) == 0b1001:  # load/store SP-relative
+            addr = (r[13] + (i & 0xFF) * 4) & M32
+            rt = (i >> 8) & 7
+            if (i >> 11) & 1:
+                r[rt] = self._load(addr, 4)
+            else:
+                self.mem.write(addr, 4, r[rt])
+            cyc = 2
+
+        elif (i >> 11) == 0b10100:  # ADR
+            r[(i >> 8) & 7] = ((pc + 4) & ~3) + (i & 0xFF) * 4
+
+        elif (i >> 11) == 0b10101:  # ADD Rd, SP, imm8
+            r[(i >> 8) & 7] = (r[13] + (i & 0xFF) * 4) & M32
+
+        elif (i >> 12) == 0b1011:  # miscellaneous
+            if (i & 0xFF00) == 0xB000:
+                imm = (i & 0x7F) * 4
+                r[13] = (r[13] - imm if i & 0x80 else r[13] + imm) & M32
+            elif (i & 0xFF00) == 0xB200:
+                v = r[(i >> 3) & 7]
+                op = (i >> 6) & 3
+                r[i & 7] = [_sx(v, 16) & M32, _sx(v, 8) & M32, v & 0xFFFF, v & 0xFF][op]
+            elif (i & 0xFE00) == 0xB400:  # PUSH
+                regs = [n for n in range(8) if i & (1 << n)] + ([14] if i & 0x100 else [])
+                sp = (r[13] - 4 * len(regs)) & M32
+                for k, n in enumerate(regs):
+                    self.mem.write(sp + 4 * k, 4, r[n])
+                r[13] = sp
+                cyc = 1 + len(regs)
+            elif (i & 0xFFEF) == 0xB662:  # CPSID/CPSIE i
+                self.primask = (i >> 4) & 1
+            elif (i & 0xFF00) == 0xBA00:
+                v = r[(i >> 3) & 7]
+                op = (i >> 6) & 3
+                if op == 0:
+                    res = int.from_bytes(v.to_bytes(4, "little"), "big")
+                elif op == 1:
+                    res = ((v & 0x00FF00FF) << 8 | (v >> 8) & 0x00FF00FF) & M32
+                elif op == 3:
+                    res = _sx(((v & 0xFF) << 8) | ((v >> 8) & 0xFF), 16) & M32
+                else:
+                    raise BenchError("undefined instruction %04x at 0x%08x" % (i, pc))
+                r[i & 7] = res
+            elif (i & 0xFE00) == 0xBC00:  # POP
+                regs = [n for n in range(8) if i & (1 << n)]
+                sp = r[13]
+                for k, n in enumerate(regs):
+                    r[n] = self._load(sp + 4 * k, 4)
+                count = len(regs)
+                cyc = 1 + count
+                if i & 0x100:
+                    nxt = self._load(sp + 4 * count, 4) & ~1
+                    count += 1
+                    cyc = 3 + count
+                r[13] = (sp + 4 * count) & M32
+            elif (i & 0xFF00) == 0xBF00:  # NOP and hints
+                pass
+            else:
+                raise BenchError("unsupported instruction %04x at 0x%08x" % (i, pc))
+
+        elif (i >> 12) == 0b1100:  # STM/LDM
+            rn = (i >> 8) & 7
+            regs = [n for n in range(8) if i & (1 << n)]
+            addr = r[rn]
+            load = (i >> 11) & 1
+            for k, n in enumerate(regs):
+                if load:
+                    r[n] = self._load(addr + 4 * k, 4)
+                else:
+                    self.mem.write(addr + 4 * k, 4, r[n])
+            if not (load and rn in regs):
+                r[rn] = (addr + 4 * len(regs)) & M32
+            cyc = 1 + len(regs)
+
+        elif (i >> 12) == 0b1101:  # B<cond>, UDF, SVC
+            cond = (i >> 8) & 15
+            if cond >= 14:
+                raise BenchError("trap instruction %04x at 0x%08x" % (i, pc))
+            if self._cond(cond):
+                nxt, cyc = pc + 4 + _sx(i & 0xFF, 8) * 2, 2
+
+        elif (i >> 11) == 0b11100:  # B
+            nxt, cyc = pc + 4 + _sx(i & 0x7FF, 11) * 2, 2
+
+        else:
+            raise BenchError("unsupported instruction %04x at 0x%08x" % (i, pc))
+
+        r[15] = nxt & M32
+        self.cycles += cyc
+
+
+# ---- ELF -------------------------------------------------------------------
+
+class Elf:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        d = self.data
+        if d[:4] != b"\x7fELF" or d[4] != 1 or d[5] != 1:
+            raise BenchError("%s: not a little-endian ELF32 file" % path)
+        (self.type, _, _, self.entry, self.phoff, self.shoff, _, _,
+         self.phentsize, self.phnum, self.shentsize, self.shnum, _) = \
+            struct.unpack_from("<HHIIIIIHHHHHH", d, 16)
+        self.sections = [struct.unpack_from("<IIIIIIIIII", d, self.shoff + k * self.shentsize)
+                         for k in range(self.shnum)]
+        self.symbols = {}
+        for sh in self.sections:
+            if sh[1] != 2:  # SHT_SYMTAB
+                continue
+            strtab = self.sections[sh[6]]
+            for k in range(sh[5] // 16):
+                name_off, value, size, info, _, _ = struct.unpack_from("<IIIBBH", d, sh[4] + k * 16)
+                name = self._str(strtab[4] + name_off)
+                if name and (info & 0xF) in (1, 2):  # OBJECT, FUNC
+                    self.symbols.setdefault(name, (value, size))
+
+    def _str(self, off):
+        end = self.data.index(b"\0", off)
+        return self.data[off:end].decode()
+
+    def load(self, mem):
+        for k in range(self.phnum):
+            p_type, off, vaddr, paddr, filesz, _, _, _ = \
+                struct.unpack_from("<IIIIIIII", self.data, self.phoff + k * self.phentsize)
+            if p_type != 1 or filesz == 0:
+                continue
+            seg = self.data[off:off + filesz]
+            mem.load(paddr, seg)
+            if vaddr != paddr:  # .data: what the startup copy loop does
+                mem.load(vaddr, seg)
+
+
+# ---- Cases -----------------------------------------------------------------
+
+WS_BUF = RAM_BASE + RAM_SIZE - 0x200  # below the stack, above .bss
+
+
+class Case:
+    def __init__(self, name, func, args=(), globals_=None, regs=None, data=None, calls=64):
+        self.name = name
+        self.func = func
+        self.args = args
+        self.globals = globals_ or {}
+        self.regs = regs or {}
+        self.data = data
+        self.calls = calls
+
+
+CASES = [
+    Case("TIM16_IRQHandler(50%)", "TIM16_IRQHandler",
+         globals_={"current_mode": 1, "pwm_permille": 500},
+         regs={TIM16_BASE + TIM_SR: 1, TIM16_BASE + TIM_DIER: 1}, calls=256),
+    Case("TIM16_IRQHandler(100%)", "TIM16_IRQHandler",
+         globals_={"current_mode": 1, "pwm_permille": 1000},
+         regs={TIM16_BASE + TIM_SR: 1, TIM16_BASE + TIM_DIER: 1}, calls=256),
+    Case("HBridge_Systick(off)", "HBridge_Systick", globals_={"current_mode": 0}),
+    Case("HBridge_Systick(on)", "HBridge_Systick", globals_={"current_mode": 1}),
+    Case("ws2812_sendarray(3)", "ws2812_sendarray", args=(WS_BUF, 3),
+         data=(WS_BUF, bytes([0x55, 0xAA, 0x0F])), calls=4),
+    Case("VBat_ComputeVddMv", "VBat_ComputeVddMv", args=(1328,),
+         globals_={"vref_scale": 1200 * 4095, "vdd_mv": 3700}),
+]
+
+
+def run_cases(elf, mul_cycles, only=None):
+    results = {}
+    unknown = set(only or ()) - set(case.name for case in CASES)
+    if unknown:
+        raise BenchError("no such case: %s" % ", ".join(sorted(unknown)))
+    for case in CASES:
+        if only and case.name not in only:
+            continue
+        if case.func not in elf.symbols:
+            raise BenchError("%s: %s not in ELF (inlined or renamed?)" % (case.name, case.func))
+        mem = Memory()
+        elf.load(mem)
+        cpu = CortexM0Plus(mem, mul_cycles)
+        sp = mem.read(FLASH_BASE, 4)  # initial MSP from the vector table
+        cpu.r[13] = sp if RAM_BASE < sp <= RAM_BASE + RAM_SIZE else RAM_BASE + RAM_SIZE
+        for name, value in case.globals.items():
+            if name not in elf.symbols:
+                raise BenchError("%s: symbol %s not found" % (case.name, name))
+            addr, size = elf.symbols[name]
+            mem.write(addr, size if size in (1, 2, 4) else 4, value)
+        if case.data:
+            mem.load(*case.data)
+
+        func = elf.symbols[case.func][0]
+        samples = []
+        for _ in range(case.calls):
+            for addr, value in case.regs.items():
+                mem.write(addr, 4, value)
+            samples.append(cpu.call(func, case.args))
+        results[case.name] = (sum(samples) / len(samples), min(samples), max(samples))
+    return results
+
+
+# ---- Self-test -------------------------------------------------------------
+
+# Hand-assembled snippets (halfwords) with cycle counts worked out from the
+# Cortex-M0+ TRM table 3-1, each ending in BX LR (2 cycles).
+SELF_TESTS = [
+    # MOVS, ADDS, LSLS 1 each; MULS 1 (fast multiplier), BX 2
+    ("alu", [0x2001, 0x1840, 0x0080, 0x4348, 0x4770], (0, 3), 6, 1),
+    # same with the 32-cycle iterative multiplier
+    ("alu (slow mul)", [0x2001, 0x1840, 0x0080, 0x4348, 0x4770], (0, 3), 37, 32),
+    # LDR, STR, LDRB 2 each
+    ("load/store", [0x6801, 0x6041, 0x7842, 0x4770], (RAM_BASE,), 8, 1),
+    # SUBS; BNE: 3 per pass, the last BNE falls through in 1
+    ("delay loop x10", [0x3801, 0xD1FD, 0x4770], (10,), 10 * 3 - 1 + 2, 1),
+    # PUSH {r4,lr} 1+2, BL 3, BX 2, POP {r4,pc} 3+2
+    ("call/return", [0xB510, 0xF000, 0xF801, 0xBD10, 0x4770], (), 13, 1),
+    # STM 1+3, SUBS 1, LDM 1+3
+    ("stm/ldm", [0xC00E, 0x380C, 0xC80E, 0x4770], (RAM_BASE, 1, 2, 3), 11, 1),
+    # MRS 3, CPSID 1, CPSIE 1
+    ("mrs/cps", [0xF3EF, 0x8010, 0xB672, 0xB662, 0x4770], (), 7, 1),
+]
+
+
+def self_test():
+    failed = 0
+    for name, code, args, expect, mul_cycles in SELF_TESTS:
+        mem = Memory()
+        mem.load(FLASH_BASE, b"".join(struct.pack("<H", h) for h in code))
+        cpu = CortexM0Plus(mem, mul_cycles)
+        cpu.r[13] = RAM_BASE + RAM_SIZE
+        got = cpu.call(FLASH_BASE, args, max_cycles=1000)
+        if got != expect:
+            print("self-test %-16s %3d cycles, TRM says %d" % (name, got, expect))
+            failed += 1
+    print("self-test: %s (%d snippets)" % ("FAIL" if failed else "ok", len(SELF_TESTS)))
+    return failed
+
+
+def read_baseline(path):
+    base = {}
+    try:
+        with open(path) as f:
+            for line in f:
+                line = line.split("#", 1)[0].split()
+                if len(line) == 2:
+                    base[line[0]] = float(line[1])
+    except FileNotFoundError:
+        return None
+    return base
+
+
+def write_baseline(path, results):
+    with open(path, "w") as f:
+        f.write("# case  mean-cycles-per-call (m0_bench.py --update)\n")
+        for name, (mean, _, _) in results.items():
+            f.write("%s %.1f\n" % (name, mean))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("elf", nargs="?")
+    ap.add_argument("--baseline", help="baseline file to compare against")
+    ap.add_argument("--tolerance", type=float, default=10.0, help="allowed regression in percent")
+    ap.add_argument("--update", action="store_true", help="rewrite the baseline from this run")
+    ap.add_argument("--mul-cycles", type=int, default=1, choices=(1, 32), help="multiplier option")
+    ap.add_argument("--case", action="append", help="run only the named case")
+    ap.add_argument("--self-test", action="store_true", help="check the cycle table, then the ELF if given")
+    args = ap.parse_args()
+
+    if args.self_test:
+        if self_test():
+            return 1
+        if not args.elf:
+            return 0
+    elif not args.elf:
+        ap.error("an ELF file is required without --self-test")
+
+    base = read_baseline(args.baseline) if args.baseline else None
+    if args.baseline and base is None and not args.update:
+        print("m0_bench: warning: no baseline at %s, nothing compared; run with --update to create it"
+              % args.baseline, file=sys.stderr)
+
+    try:
+        results = run_cases(Elf(args.elf), args.mul_cycles, args.case)
+    except BenchError as e:
+        print("m0_bench: %s" % e, file=sys.stderr)
+        return 2
+
+    failed = 0
+    print("%-26s %9s %7s %7s %9s" % ("case", "cycles", "min", "max", "baseline"))
+    for name, (mean, lo, hi) in results.items():
+        line = "%-26s %9.1f %7d %7d" % (name, mean, lo, hi)
+        if base and name in base:
+            delta = 100.0 * (mean - base[name]) / base[name] if base[name] else 0.0
+            line += " %9.1f %+6.1f%%" % (base[name], delta)
+            if delta > args.tolerance:
+                line += "  REGRESSION"
+                failed += 1
+        print(line)
+    print("(IRQ handlers exclude %d cycles of exception entry)" % IRQ_ENTRY_CYCLES)
+    for name in (base or {}):
+        if name not in results and not args.case:
+            print("m0_bench: %s is in the baseline but was not run" % name, file=sys.stderr)
+            failed += 1
+
+    if args.baseline and args.update:
+        write_baseline(args.baseline, results)
+        print("baseline written to %s" % args.baseline)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
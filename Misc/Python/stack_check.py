@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""
+Worst-case stack depth from the GCC call graph (make stack).
+
+Reads the .ci files written by -fcallgraph-info=su next to each object and
+computes the deepest call chain below main and below every exception
+handler. Handlers at one NVIC priority cannot preempt each other, so the
+worst case is main plus the deepest handler of each enabled priority level
+plus one exception frame per level; HardFault and NMI sit above all of them.
+The result is compared with _Min_Stack_Size in the linker script and, with
+--map, with the RAM actually left between the end of .bss/heap and _estack.
+
+Priorities come from HAL_NVIC_SetPriority(<name>_IRQn, <prio>, ...) calls in
+the sources; SysTick runs at TICK_INT_PRIORITY (lowest). Handlers that never
+get a priority are treated as not enabled.
+
+Indirect calls are resolved to the static functions of the same file that
+have no direct caller (dispatch tables such as the RTT console); anything else
+that cannot be resolved is charged --unknown bytes and listed.
+"""
+import argparse
+import glob
+import os
+import re
+import sys
+
+EXC_FRAME = 32 + 4  # R0-R3, R12, LR, PC, xPSR plus the 8-byte alignment pad
+PRIO_LOWEST = 3     # 2 priority bits on Cortex-M0+
+ALWAYS = {"HardFault_Handler": -1, "NMI_Handler": -2}
+# Calls made from inline assembly, which -fcallgraph-info does not see
+ASM_CALLS = {"HardFault_Handler": ["FaultLog_Capture"]}
+
+RE_NODE = re.compile(r'^node: \{ title: "([^"]+)" label: "([^"\\]+)(?:\\n([^"\\]*))?(?:\\n(\d+) bytes \(([^)]+)\))?"')
+RE_EDGE = re.compile(r'^edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+RE_PRIO = re.compile(r"HAL_NVIC_SetPriority\s*\(\s*(\w+)_IRQn\s*,\s*(\d+)")
+RE_LDSYM = re.compile(r"^\s*(_Min_Stack_Size|_Min_Heap_Size)\s*=\s*(0x[0-9a-fA-F]+|\d+)")
+RE_MAPSYM = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+(?:PROVIDE \()?(_estack|_ebss|end)\s*(?:=|$)")
+
+
+class Graph:
+    def __init__(self):
+        self.frame = {}     # title -> bytes
+        self.qual = {}      # title -> static / dynamic / dynamic,bounded
+        self.name = {}      # title -> plain function name
+        self.file = {}      # title -> source of the definition
+        self.calls = {}     # title -> set of callee titles
+        self.by_name = {}   # plain name -> defined title
+
+    def load(self, path):
+        with open(path, errors="replace") as f:
+            for line in f:
+                m = RE_NODE.match(line)
+                if m and m.group(4) is not None:
+                    title = m.group(1)
+                    self.frame[title] = int(m.group(4))
+                    self.qual[title] = m.group(5)
+                    self.name[title] = m.group(2)
+                    self.file[title] = (m.group(3) or "").split(":")[0]
+                    self.by_name.setdefault(m.group(2), title)
+                    self.calls.setdefault(title, set())
+                    continue
+                m = RE_EDGE.match(line)
+                if m:
+                    self.calls.setdefault(m.group(1), set()).add(m.group(2))
+
+    def resolve_indirect(self):
+        called = set()
+        for callees in self.calls.values():
+            called |= callees
+        unresolved = []
+        for title, callees in self.calls.items():
+            if "__indirect_call" not in callees:
+                continue
+            src = self.file.get(title)
+            targets = {t for t in self.frame if self.file[t] == src and t not in called
+                       and ":" in t and t != title}
+            callees.discard("__indirect_call")
+            if targets:
+                callees |= targets
+            else:
+                callees.add("__indirect_call")
+                unresolved.append(self.name.get(title, title))
+        return unresolved
+
+    def key(self, title):
+        if title in self.frame:
+            return title
+        return self.by_name.get(title, title)
+
+    def depth(self, root, unknown_cost):
+        """Returns (bytes, path, unknown callees, recursive functions, dynamic frames)."""
+        memo = {}
+        unknown, recursive, dynamic = set(), set(), set()
+
+        def visit(title, active):
+            title = self.key(title)
+            if title not in self.frame:
+                unknown.add(title)
+                return unknown_cost, [title + "?"]
+            if title in memo:
+                return memo[title]
+            if title in active:
+                recursive.add(self.name[title])
+                return 0, [self.name[title] + " (recursion)"]
+            if self.qual[title] == "dynamic":
+                dynamic.add(self.name[title])
+            active.add(title)
+            best, best_path = 0, []
+            for callee in sorted(self.calls.get(title, ())):
+                d, p = visit(callee, active)
+                if d > best:
+                    best, best_path = d, p
+            active.discard(title)
+            memo[title] = (self.frame[title] + best, [self.name[title]] + best_path)
+            return memo[title]
+
+        d, p = visit(root, set())
+        return d, p, unknown, recursive, dynamic
+
+
+def read_priorities(src_dirs):
+    prio = {"SysTick_Handler": PRIO_LOWEST}
+    for d in src_dirs:
+        for path in glob.glob(os.path.join(d, "**", "*.c"), recursive=True):
+            with open(path, errors="replace") as f:
+                for m in RE_PRIO.finditer(f.read()):
+                    prio[m.group(1) + "_IRQHandler"] = int(m.group(2))
+    return prio
+
+
+def read_ld(path):
+    vals = {}
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = RE_LDSYM.match(line)
+            if m:
+                vals[m.group(1)] = int(m.group(2), 0)
+    return vals
+
+
+def read_map(path):
+    vals = {}
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = RE_MAPSYM.match(line)
+            if m:
+                vals.setdefault(m.group(2), int(m.group(1), 16))
+    return vals
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("build_dir", help="directory searched for .ci files")
+    ap.add_argument("--ld", help="linker script with _Min_Stack_Size/_Min_Heap_Size")
+    ap.add_argument("--map", help="linker map, for the RAM actually left to the stack")
+    ap.add_argument("--src", action="append", default=[], help="sources scanned for NVIC priorities")
+    ap.add_argument("--unknown", type=int, default=32, help="bytes charged to functions without call graph")
+    ap.add_argument("--entry", default="main")
+    args = ap.parse_args()
+
+    graph = Graph()
+    files = [p for p in glob.glob(os.path.join(args.build_dir, "**", "*.ci"), recursive=True)
+             if os.sep + "sim" + os.sep not in p]
+    if not files:
+        print("stack_check: no .ci files under %s (build with -fcallgraph-info=su)" % args.build_dir,
+              file=sys.stderr)
+        return 2
+    for path in files:
+        graph.load(path)
+    unresolved = graph.resolve_indirect()
+    for caller, callees in ASM_CALLS.items():
+        if caller in graph.by_name:
+            graph.calls[graph.by_name[caller]].update(callees)
+    prio = read_priorities(args.src)
+
+    roots = [("thread", args.entry)]
+    skipped = []
+    for name in sorted(graph.by_name):
+        if not name.endswith("_Handler") and not name.endswith("_IRQHandler"):
+            continue
+        if name in ALWAYS:
+            roots.append((ALWAYS[name], name))
+        elif name in prio:
+            roots.append((prio[name], name))
+        else:
+            skipped.append(name)
+    roots[1:] = sorted(roots[1:], key=lambda r: (-r[0], r[1]))  # least urgent first
+
+    unknown, recursive, dynamic = set(), set(), set()
+    levels = {}
+    print("%-8s %-24s %6s  %s" % ("level", "entry", "bytes", "deepest path"))
+    for level, name in roots:
+        d, path, u, r, dyn = graph.depth(name, args.unknown)
+        unknown |= u
+        recursive |= r
+        dynamic |= dyn
+        label = level if level == "thread" else ("prio %d" % level if level >= 0 else "fault")
+        print("%-8s %-24s %6d  %s" % (label, name, d, " > ".join(path)))
+        if level != "thread":
+            levels[level] = max(levels.get(level, 0), d)
+
+    thread = graph.depth(args.entry, args.unknown)[0]
+    worst = thread + sum(d + EXC_FRAME for d in levels.values())
+    print("worst case: %d (thread) + %d preemption level(s) x %d-byte frame + handlers = %d bytes"
+          % (thread, len(levels), EXC_FRAME, worst))
+
+    if skipped:
+        print("not enabled (no NVIC priority set): %s" % ", ".join(skipped))
+    if unresolved:
+        print("unresolved indirect calls in: %s (charged %d bytes)" % (", ".join(sorted(unresolved)), args.unknown))
+    unknown.discard("__indirect_call")
+    if unknown:
+        print("no call graph, charged %d bytes each: %s" % (args.unknown, ", ".join(sorted(unknown))))
+    if recursive:
+        print("WARNING recursion, depth not bounded: %s" % ", ".join(sorted(recursive)))
+    if dynamic:
+        print("WARNING unbounded dynamic frames: %s" % ", ".join(sorted(dynamic)))
+
+    failed = 0
+    if args.ld:
+        ld = read_ld(args.ld)
+        if "_Min_Stack_Size" in ld:
+            reserve = ld["_Min_Stack_Size"]
+            print("_Min_Stack_Size %d: headroom %d bytes" % (reserve, reserve - worst))
+            failed |= worst > reserve
+    if args.map:
+        syms = read_map(args.map)
+        if "_estack" in syms and "end" in syms:
+            heap = read_ld(args.ld).get("_Min_Heap_Size", 0) if args.ld else 0
+            free = syms["_estack"] - syms["end"] - heap
+            print("RAM above .bss and %d-byte heap: %d bytes, headroom %d bytes" % (heap, free, free - worst))
+            failed |= worst > free
+    return 1 if failed or recursive else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
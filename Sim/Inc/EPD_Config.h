@@ -0,0 +1,8 @@
+#pragma once
+
+/* Host stand-in for the e-paper platform config: the paint library only
+   needs the types and debug switch, no panel is attached. */
+#include <stdint.h>
+#include <stdio.h>
+
+#define EPD_DEBUG 0
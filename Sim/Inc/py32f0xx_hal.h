@@ -0,0 +1,391 @@
+/*
+ * Virtual HAL for the host simulation build (make sim).
+ *
+ * Declares the subset of the PY32F0xx HAL/CMSIS API used by User/ with the
+ * same names and semantics, backed by the simulated peripherals in
+ * Sim/Src/sim_hal.c. It shadows the real py32f0xx_hal.h because Sim/Inc
+ * comes first in the include path of the sim target.
+ */
+#ifndef __SIM_PY32F0XX_HAL_H
+#define __SIM_PY32F0XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* ---- CMSIS-style basics ------------------------------------------------ */
+#define __IO volatile
+
+typedef enum { RESET = 0U, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { DISABLE = 0U, ENABLE = !DISABLE } FunctionalState;
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+#define HAL_MAX_DELAY      0xFFFFFFFFU
+
+#define SET_BIT(REG, BIT)     ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)   ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)    ((REG) & (BIT))
+#define WRITE_REG(REG, VAL)   ((REG) = (VAL))
+#define READ_REG(REG)         ((REG))
+
+typedef enum
+{
+  NonMaskableInt_IRQn = -14,
+  HardFault_IRQn      = -13,
+  SVC_IRQn            = -5,
+  PendSV_IRQn         = -2,
+  SysTick_IRQn        = -1,
+  EXTI4_15_IRQn       = 7,
+  ADC_COMP_IRQn       = 12,
+  TIM1_BRK_UP_TRG_COM_IRQn = 13,
+  TIM16_IRQn          = 21,
+} IRQn_Type;
+
+extern uint32_t SystemCoreClock;
+
+uint32_t __get_PRIMASK(void);
+void __disable_irq(void);
+void __enable_irq(void);
+void __NOP(void);
+
+/* ---- Memory map (flash is mapped at its real address by the sim) ------- */
+#define FLASH_BASE            0x08000000UL
+#define FLASH_SIZE            (20U * 1024U)
+#define FLASH_PAGE_SIZE       0x00000080U
+#define FLASH_SECTOR_SIZE     0x00001000U
+
+/* ---- Peripheral register blocks ---------------------------------------- */
+typedef struct
+{
+  __IO uint32_t MODER;
+  __IO uint32_t PUPDR;
+  __IO uint32_t IDR;
+  __IO uint32_t ODR;
+  __IO uint32_t BSRR;
+  __IO uint32_t BRR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR1;
+  __IO uint32_t CR2;
+  __IO uint32_t DIER;
+  __IO uint32_t SR;
+  __IO uint32_t CNT;
+  __IO uint32_t PSC;
+  __IO uint32_t ARR;
+  __IO uint32_t RCR;
+} TIM_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t ISR;
+  __IO uint32_t IER;
+  __IO uint32_t CR;
+  __IO uint32_t CFGR1;
+  __IO uint32_t TR;
+  __IO uint32_t CHSELR;
+  __IO uint32_t DR;
+} ADC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t SR;
+} FLASH_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t KR;
+  __IO uint32_t PR;
+  __IO uint32_t RLR;
+  __IO uint32_t SR;
+} IWDG_TypeDef;
+
+extern GPIO_TypeDef sim_gpioa, sim_gpiob;
+extern TIM_TypeDef sim_tim1, sim_tim16;
+extern ADC_TypeDef sim_adc1;
+extern FLASH_TypeDef sim_flash;
+extern IWDG_TypeDef sim_iwdg;
+
+#define GPIOA   (&sim_gpioa)
+#define GPIOB   (&sim_gpiob)
+#define TIM1    (&sim_tim1)
+#define TIM16   (&sim_tim16)
+#define ADC1    (&sim_adc1)
+#define FLASH   (&sim_flash)
+#define IWDG    (&sim_iwdg)
+
+#define FLASH_CR_LOCK         (1UL << 31)
+
+/* ---- RCC ---------------------------------------------------------------- */
+#define __HAL_RCC_GPIOA_CLK_ENABLE()    do { } while (0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE()    do { } while (0)
+#define __HAL_RCC_TIM1_CLK_ENABLE()     do { } while (0)
+#define __HAL_RCC_TIM16_CLK_ENABLE()    do { } while (0)
+#define __HAL_RCC_ADC_CLK_ENABLE()      do { } while (0)
+#define __HAL_RCC_ADC_FORCE_RESET()     do { } while (0)
+#define __HAL_RCC_ADC_RELEASE_RESET()   do { } while (0)
+#define __HAL_RCC_PWR_CLK_ENABLE()      do { } while (0)
+#define __HAL_RCC_DBGMCU_CLK_ENABLE()   do { } while (0)
+#define __HAL_DBGMCU_FREEZE_IWDG()      do { } while (0)
+
+/* Reset flags: every simulated run starts from power-on */
+#define RCC_FLAG_OBLRST                 0x01U
+#define RCC_FLAG_PINRST                 0x02U
+#define RCC_FLAG_PWRRST                 0x04U
+#define RCC_FLAG_SFTRST                 0x08U
+#define RCC_FLAG_IWDGRST                0x10U
+
+#define __HAL_RCC_GET_FLAG(__FLAG__)    Sim_RccGetFlag(__FLAG__)
+#define __HAL_RCC_CLEAR_RESET_FLAGS()   Sim_RccClearResetFlags()
+
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint8_t Sim_RccGetFlag(uint32_t flag);
+void Sim_RccClearResetFlags(void);
+
+/* ---- Core HAL ----------------------------------------------------------- */
+HAL_StatusTypeDef HAL_Init(void);
+void HAL_IncTick(void);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_SystemReset(void);
+
+/* ---- GPIO --------------------------------------------------------------- */
+typedef enum { GPIO_PIN_RESET = 0U, GPIO_PIN_SET } GPIO_PinState;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+#define GPIO_PIN_0    ((uint16_t)0x0001)
+#define GPIO_PIN_1    ((uint16_t)0x0002)
+#define GPIO_PIN_2    ((uint16_t)0x0004)
+#define GPIO_PIN_3    ((uint16_t)0x0008)
+#define GPIO_PIN_4    ((uint16_t)0x0010)
+#define GPIO_PIN_5    ((uint16_t)0x0020)
+#define GPIO_PIN_6    ((uint16_t)0x0040)
+#define GPIO_PIN_7    ((uint16_t)0x0080)
+#define GPIO_PIN_8    ((uint16_t)0x0100)
+
+#define GPIO_MODE_INPUT         0x00000000U
+#define GPIO_MODE_OUTPUT_PP     0x00000001U
+#define GPIO_MODE_OUTPUT_OD     0x00000011U
+#define GPIO_MODE_ANALOG        0x00000003U
+#define GPIO_MODE_IT_FALLING    0x10210000U
+
+#define GPIO_NOPULL             0x00000000U
+#define GPIO_PULLUP             0x00000001U
+#define GPIO_PULLDOWN           0x00000002U
+
+#define GPIO_SPEED_FREQ_LOW         0x00000000U
+#define GPIO_SPEED_FREQ_MEDIUM      0x00000001U
+#define GPIO_SPEED_FREQ_HIGH        0x00000002U
+#define GPIO_SPEED_FREQ_VERY_HIGH   0x00000003U
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin);
+
+/* ---- TIM ---------------------------------------------------------------- */
+typedef struct
+{
+  uint32_t Prescaler;
+  uint32_t CounterMode;
+  uint32_t Period;
+  uint32_t ClockDivision;
+  uint32_t RepetitionCounter;
+  uint32_t AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef struct
+{
+  TIM_TypeDef *Instance;
+  TIM_Base_InitTypeDef Init;
+} TIM_HandleTypeDef;
+
+typedef struct
+{
+  uint32_t MasterOutputTrigger;
+  uint32_t MasterSlaveMode;
+} TIM_MasterConfigTypeDef;
+
+#define TIM_COUNTERMODE_UP              0x00000000U
+#define TIM_CLOCKDIVISION_DIV1          0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_DISABLE  0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_ENABLE   0x00000080U
+#define TIM_TRGO_RESET                  0x00000000U
+#define TIM_TRGO_UPDATE                 0x00000020U
+#define TIM_MASTERSLAVEMODE_DISABLE     0x00000000U
+
+#define TIM_CR1_CEN       0x00000001U
+#define TIM_FLAG_UPDATE   0x00000001U
+#define TIM_IT_UPDATE     0x00000001U
+
+#define __HAL_TIM_GET_FLAG(__HANDLE__, __FLAG__)        (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+#define __HAL_TIM_GET_IT_SOURCE(__HANDLE__, __IT__)     ((((__HANDLE__)->Instance->DIER & (__IT__)) == (__IT__)) ? SET : RESET)
+#define __HAL_TIM_CLEAR_IT(__HANDLE__, __IT__)          ((__HANDLE__)->Instance->SR = ~(__IT__) & (__HANDLE__)->Instance->SR)
+#define __HAL_TIM_SET_COUNTER(__HANDLE__, __COUNTER__)  ((__HANDLE__)->Instance->CNT = (__COUNTER__))
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig);
+
+/* ---- ADC ---------------------------------------------------------------- */
+typedef struct
+{
+  uint32_t ClockPrescaler;
+  uint32_t Resolution;
+  uint32_t DataAlign;
+  uint32_t ScanConvMode;
+  uint32_t EOCSelection;
+  FunctionalState LowPowerAutoWait;
+  FunctionalState ContinuousConvMode;
+  FunctionalState DiscontinuousConvMode;
+  uint32_t ExternalTrigConv;
+  uint32_t ExternalTrigConvEdge;
+  FunctionalState DMAContinuousRequests;
+  uint32_t Overrun;
+  uint32_t SamplingTimeCommon;
+} ADC_InitTypeDef;
+
+typedef struct
+{
+  ADC_TypeDef *Instance;
+  ADC_InitTypeDef Init;
+  __IO uint32_t State;
+  __IO uint32_t ErrorCode;
+} ADC_HandleTypeDef;
+
+typedef struct
+{
+  uint32_t Channel;
+  uint32_t Rank;
+  uint32_t SamplingTime;
+} ADC_ChannelConfTypeDef;
+
+typedef struct
+{
+  uint32_t WatchdogMode;
+  uint32_t Channel;
+  FunctionalState ITMode;
+  uint32_t HighThreshold;
+  uint32_t LowThreshold;
+} ADC_AnalogWDGConfTypeDef;
+
+#define ADC_CLOCK_SYNC_PCLK_DIV1          0x00000000U
+#define ADC_RESOLUTION_12B                0x00000000U
+#define ADC_DATAALIGN_RIGHT               0x00000000U
+#define ADC_SCAN_DIRECTION_FORWARD        0x00000001U
+#define ADC_SCAN_DIRECTION_BACKWARD       0x00000002U
+#define ADC_EOC_SINGLE_CONV               0x00000004U
+#define ADC_EOC_SEQ_CONV                  0x00000008U
+#define ADC_SOFTWARE_START                0x00000100U
+#define ADC_EXTERNALTRIGCONV_T1_TRGO      0x00000000U
+#define ADC_EXTERNALTRIGCONVEDGE_NONE     0x00000000U
+#define ADC_EXTERNALTRIGCONVEDGE_RISING   0x00000400U
+#define ADC_OVR_DATA_OVERWRITTEN          0x00000000U
+#define ADC_OVR_DATA_PRESERVED            0x00000001U
+#define ADC_SAMPLETIME_239CYCLES_5        0x00000007U
+#define ADC_RANK_CHANNEL_NUMBER           0x00001000U
+#define ADC_CHANNEL_VREFINT               12U
+#define ADC_CHANNEL_TEMPSENSOR            11U
+#define ADC_ANALOGWATCHDOG_NONE           0x00000000U
+#define ADC_ANALOGWATCHDOG_SINGLE_REG     0x00C00000U
+#define ADC_ANALOGWATCHDOG_ALL_REG        0x00800000U
+
+#define ADC_FLAG_EOC    0x00000004U
+#define ADC_FLAG_EOS    0x00000008U
+#define ADC_FLAG_OVR    0x00000010U
+#define ADC_FLAG_AWD    0x00000080U
+#define ADC_IT_EOC      ADC_FLAG_EOC
+#define ADC_IT_EOS      ADC_FLAG_EOS
+#define ADC_IT_AWD      ADC_FLAG_AWD
+
+#define __HAL_ADC_GET_FLAG(__HANDLE__, __FLAG__)    ((((__HANDLE__)->Instance->ISR) & (__FLAG__)) == (__FLAG__))
+#define __HAL_ADC_CLEAR_FLAG(__HANDLE__, __FLAG__)  ((__HANDLE__)->Instance->ISR &= ~(__FLAG__))
+#define __HAL_ADC_ENABLE_IT(__HANDLE__, __IT__)     ((__HANDLE__)->Instance->IER |= (__IT__))
+#define __HAL_ADC_DISABLE_IT(__HANDLE__, __IT__)    ((__HANDLE__)->Instance->IER &= ~(__IT__))
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADCEx_Calibration_Start(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *sConfig);
+HAL_StatusTypeDef HAL_ADC_AnalogWDGConfig(ADC_HandleTypeDef *hadc, ADC_AnalogWDGConfTypeDef *AnalogWDGConfig);
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout);
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *hadc);
+
+/* ---- FLASH -------------------------------------------------------------- */
+typedef struct
+{
+  uint32_t TypeErase;
+  uint32_t PageAddress;
+  uint32_t NbPages;
+  uint32_t SectorAddress;
+  uint32_t NbSectors;
+} FLASH_EraseInitTypeDef;
+
+#define FLASH_TYPEERASE_MASSERASE     0x01U
+#define FLASH_TYPEERASE_PAGEERASE     0x02U
+#define FLASH_TYPEERASE_SECTORERASE   0x03U
+#define FLASH_TYPEPROGRAM_PAGE        0x01U
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint32_t *DataAddr);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError);
+
+/* ---- IWDG (LSI 32.768 kHz) --------------------------------------------- */
+typedef struct
+{
+  uint32_t Prescaler;
+  uint32_t Reload;
+} IWDG_InitTypeDef;
+
+typedef struct
+{
+  IWDG_TypeDef *Instance;
+  IWDG_InitTypeDef Init;
+} IWDG_HandleTypeDef;
+
+#define IWDG_PRESCALER_4      0x00000000U
+#define IWDG_PRESCALER_8      0x00000001U
+#define IWDG_PRESCALER_16     0x00000002U
+#define IWDG_PRESCALER_32     0x00000003U
+#define IWDG_PRESCALER_64     0x00000004U
+#define IWDG_PRESCALER_128    0x00000005U
+#define IWDG_PRESCALER_256    0x00000006U
+
+HAL_StatusTypeDef HAL_IWDG_Init(IWDG_HandleTypeDef *hiwdg);
+HAL_StatusTypeDef HAL_IWDG_Refresh(IWDG_HandleTypeDef *hiwdg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_PY32F0XX_HAL_H */
@@ -0,0 +1,2 @@
+/* Virtual HAL: all declarations live in py32f0xx_hal.h */
+#include "py32f0xx_hal.h"
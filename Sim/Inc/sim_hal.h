@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Virtual time base of the simulator */
+#define SIM_NS_PER_US   1000ULL
+#define SIM_NS_PER_MS   1000000ULL
+
+typedef enum
+{
+  SIM_PORT_A = 0,
+  SIM_PORT_B,
+  SIM_PORT_COUNT
+} sim_port_t;
+
+/* Run control */
+void Sim_Init(const char *flash_file);
+int Sim_Run(int (*entry)(void), uint64_t end_ns);
+void Sim_Shutdown(void);
+uint64_t Sim_Now(void);
+
+/* Stimulus, applied at the given virtual time */
+void Sim_ScheduleVdd(uint64_t at_ns, uint32_t vdd_mv);
+void Sim_SchedulePin(uint64_t at_ns, sim_port_t port, uint16_t pin, int8_t level);
+void Sim_ScheduleConsole(uint64_t at_ns, const char *line);
+void Sim_ScheduleHang(uint64_t at_ns);
+void Sim_SetVrefint(uint32_t mv);
+
+/* Observation */
+uint32_t Sim_GetVdd(void);
+uint8_t Sim_GetPin(sim_port_t port, uint16_t pin);
+void Sim_GetLed(uint8_t *r, uint8_t *g, uint8_t *b);
+/* 0 while running, else the Sim_Run reason: 2 software reset, 3 IWDG */
+int Sim_GetResetReason(void);
+/* fn runs on every 1 ms boundary of virtual time, even with SysTick stopped */
+void Sim_SetObserver(void (*fn)(uint64_t t_ns));
+
+typedef struct
+{
+  uint64_t systick;
+  uint64_t tim16;
+  uint64_t adc_conv;
+  uint64_t adc_irq;
+  uint64_t exti;
+  uint64_t flash_erase;
+  uint64_t flash_program;
+  uint64_t ws2812_frames;
+  uint64_t iwdg_refresh;
+} sim_stats_t;
+
+const sim_stats_t *Sim_GetStats(void);
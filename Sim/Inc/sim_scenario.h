@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Runs every scenario in path (or only the one called name), each in a
+   fresh forked simulator, up to jobs at a time. Returns the failure count. */
+int SimScenario_RunFile(const char *path, const char *name, unsigned jobs, int (*entry)(void));
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* Virtual logic analyser: pin transitions with virtual timestamps */
+void SimTrace_Enable(void);
+uint8_t SimTrace_Enabled(void);
+void SimTrace_Edge(uint64_t t_ns, uint8_t port, uint16_t pin, uint8_t level);
+
+/* Export and analysis of the captured window [from_ns, end_ns) */
+int SimTrace_WriteVcd(const char *path, uint64_t end_ns);
+void SimTrace_Report(FILE *out, uint64_t from_ns, uint64_t end_ns);
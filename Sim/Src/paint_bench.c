@@ -0,0 +1,591 @@
+/*
+ * Host micro-benchmark for the e-paper paint library.
+ *
+ *   Build/sim/paint_bench [iterations]
+ *
+ * Draws window fills, ASCII and CN text through the span primitives and a
+ * per-pixel Paint_SetPixel() loop that mirrors the original drawing code,
+ * checks both give the same image for every scale, rotation and mirror,
+ * then reports the time per call of each path on a 200x200 panel.
+ * The same scene drawn with the packed fonts and bitmap (Misc/Python/
+ * epd_pack.py) must match too, as must a packed full-frame bitmap drawn
+ * directly and in bands, and black and red planes rendered in bands from
+ * one display list must match two full images. A dithered 7-colour
+ * picture must render the same in bands, and flat palette colours must
+ * dither to themselves. Every pixel a drawing call changes must lie in the
+ * dirty box, and Paint_Flush() must pick full and window refreshes as
+ * documented. Exit status 1 if any check fails.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "GUI_Paint.h"
+#include "EPD_TestImage.h"
+#include "EPD_7in3f.h"
+
+#define BENCH_W     200U
+#define BENCH_H     200U
+#define BENCH_BYTES (BENCH_W * BENCH_H / 2U)  /* 4 bpp is the largest format */
+
+static UBYTE image_span[BENCH_BYTES];
+static UBYTE image_pixel[BENCH_BYTES];
+
+/* gImage_2in13b_V4b: 122x250, 1 bpp */
+#define LOGO_W      122U
+#define LOGO_H      250U
+#define LOGO_BYTES  (16U * LOGO_H)
+#define LOGO_BAND   16U
+#define PASTE_H     60U   /* top rows only: Paint_SetPixel() wraps x == Width into the next row */
+
+enum { SCENE_SPAN, SCENE_PIXEL, SCENE_PACKED };
+
+static const char bench_text[] = "Waveshare 1.54 e-Paper 0123456789";
+static const char bench_text_cn[] = "你好微雪电子";
+
+static void Ref_ClearWindows(UWORD x0, UWORD y0, UWORD x1, UWORD y1, UWORD color)
+{
+  for (UWORD y = y0; y < y1; y++)
+  {
+    for (UWORD x = x0; x < x1; x++)
+    {
+      Paint_SetPixel(x, y, color);
+    }
+  }
+}
+
+static void Ref_DrawChar(UWORD x0, UWORD y0, char c, sFONT *font, UWORD fg, UWORD bg)
+{
+  UWORD row_bytes = font->Width / 8U + (font->Width % 8U ? 1U : 0U);
+  const unsigned char *ptr = &font->table[(c - ' ') * font->Height * row_bytes];
+
+  for (UWORD y = 0; y < font->Height; y++, ptr += row_bytes)
+  {
+    for (UWORD x = 0; x < font->Width; x++)
+    {
+      if (ptr[x / 8U] & (0x80U >> (x % 8U)))
+      {
+        Paint_SetPixel(x0 + x, y0 + y, fg);
+      }
+      else if (bg != FONT_BACKGROUND)
+      {
+        Paint_SetPixel(x0 + x, y0 + y, bg);
+      }
+    }
+  }
+}
+
+/* Linear search of all index bytes, then one Paint_SetPixel() per pixel */
+static void Ref_TextCN(UWORD x, UWORD y, cFONT *font, UWORD fg, UWORD bg)
+{
+  UWORD row_bytes = font->Width / 8U + (font->Width % 8U ? 1U : 0U);
+
+  for (const char *p = bench_text_cn; *p; p += 3, x += font->Width)
+  {
+    for (UWORD n = 0; n < font->size; n++)
+    {
+      const unsigned char *ptr = (const unsigned char *)font->table[n].matrix;
+      if (memcmp(font->table[n].index, p, 3) != 0)
+      {
+        continue;
+      }
+      for (UWORD gy = 0; gy < font->Height; gy++, ptr += row_bytes)
+      {
+        for (UWORD gx = 0; gx < font->Width; gx++)
+        {
+          if (ptr[gx / 8U] & (0x80U >> (gx % 8U)))
+          {
+            Paint_SetPixel(x + gx, y + gy, fg);
+          }
+          else if (bg != FONT_BACKGROUND)
+          {
+            Paint_SetPixel(x + gx, y + gy, bg);
+          }
+        }
+      }
+      break;
+    }
+  }
+}
+
+static void Span_Text(UWORD x, UWORD y, sFONT *font, UWORD fg, UWORD bg)
+{
+  for (const char *p = bench_text; *p && x + font->Width <= Paint.Width; p++, x += font->Width)
+  {
+    Paint_DrawChar(x, y, *p, font, fg, bg);
+  }
+}
+
+static void Ref_Text(UWORD x, UWORD y, sFONT *font, UWORD fg, UWORD bg)
+{
+  for (const char *p = bench_text; *p && x + font->Width <= Paint.Width; p++, x += font->Width)
+  {
+    Ref_DrawChar(x, y, *p, font, fg, bg);
+  }
+}
+
+static void Bench_Select(UBYTE *image, UBYTE scale, UWORD rotate, UBYTE mirror)
+{
+  memset(image, 0x5A, BENCH_BYTES);
+  Paint_NewImage(image, BENCH_W, BENCH_H, rotate, WHITE);
+  Paint_SetScale(scale);
+  Paint_SetMirroring(mirror);
+}
+
+/* Colors valid for every scale: 2 -> black/white, 4 -> grey levels, 7 -> palette */
+static void Bench_Colors(UBYTE scale, UWORD *fg, UWORD *bg)
+{
+  *fg = (scale == 2) ? BLACK : 1;
+  *bg = (scale == 2) ? WHITE : 2;
+}
+
+static void Bench_Scene(int mode)
+{
+  UWORD fg, bg;
+  Bench_Colors(Paint.Scale, &fg, &bg);
+
+  if (mode == SCENE_PIXEL)
+  {
+    Ref_ClearWindows(0, 0, Paint.Width, Paint.Height, bg);
+    Paint_DrawBitMap_Paste(gImage_2in13b_V4b, 70, 130, LOGO_W, PASTE_H, 1);
+    Ref_ClearWindows(3, 5, 97, 61, fg);
+    Ref_ClearWindows(101, 7, 102, 90, fg);
+    Ref_Text(1, 70, &Font20, fg, bg);
+    Ref_Text(5, 100, &Font12, bg, fg);
+    Ref_Text(2, 130, &Font24, fg, FONT_BACKGROUND);
+    Ref_TextCN(3, 156, &Font24CN, bg, fg);
+  }
+  else
+  {
+    int packed = (mode == SCENE_PACKED);
+    Paint_ClearWindows(0, 0, Paint.Width, Paint.Height, bg);
+    if (packed)
+    {
+      Paint_DrawBitMapPacked_Paste(gImage_2in13b_V4b_Packed, 70, 130, LOGO_W, PASTE_H, 1);
+    }
+    else
+    {
+      Paint_DrawBitMap_Paste(gImage_2in13b_V4b, 70, 130, LOGO_W, PASTE_H, 1);
+    }
+    Paint_ClearWindows(3, 5, 97, 61, fg);
+    Paint_ClearWindows(101, 7, 102, 90, fg);
+    Span_Text(1, 70, packed ? &Font20P : &Font20, fg, bg);
+    Span_Text(5, 100, &Font12, bg, fg);
+    Span_Text(2, 130, packed ? &Font24P : &Font24, fg, FONT_BACKGROUND);
+    Paint_DrawString_CN(3, 156, bench_text_cn, packed ? &Font24CNP : &Font24CN, bg, fg);
+  }
+}
+
+static int Bench_Verify(void)
+{
+  static const UBYTE scales[] = { 2, 4, 7 };
+  static const UWORD rotates[] = { ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270 };
+  static const int modes[] = { SCENE_SPAN, SCENE_PACKED };
+  int failures = 0;
+
+  for (unsigned s = 0; s < sizeof(scales); s++)
+  {
+    for (unsigned r = 0; r < sizeof(rotates) / sizeof(rotates[0]); r++)
+    {
+      for (UBYTE m = MIRROR_NONE; m <= MIRROR_ORIGIN; m++)
+      {
+        Bench_Select(image_pixel, scales[s], rotates[r], m);
+        Bench_Scene(SCENE_PIXEL);
+        for (unsigned k = 0; k < sizeof(modes) / sizeof(modes[0]); k++)
+        {
+          Bench_Select(image_span, scales[s], rotates[r], m);
+          Bench_Scene(modes[k]);
+          if (memcmp(image_pixel, image_span, BENCH_BYTES) != 0)
+          {
+            printf("MISMATCH %s scale %u rotate %u mirror %u\n", modes[k] == SCENE_PACKED ? "packed" : "span",
+                   scales[s], rotates[r], m);
+            failures++;
+          }
+        }
+      }
+    }
+  }
+  return failures;
+}
+
+static UBYTE *band_frame;
+
+static void Bench_Flush(const UBYTE *band, UWORD ystart, UWORD rows)
+{
+  memcpy(band_frame + ystart * Paint.WidthByte, band, (size_t)rows * Paint.WidthByte);
+}
+
+/* Packed full-frame bitmap, drawn directly and through 16-row bands */
+static int Bench_VerifyBitmap(void)
+{
+  static PAINT_CMD list[1];
+  int failures = 0;
+
+  Paint_NewImage(image_pixel, LOGO_W, LOGO_H, ROTATE_0, WHITE);
+  Paint_DrawBitMap(gImage_2in13b_V4b);
+  memset(image_span, 0x5A, LOGO_BYTES);
+  Paint_NewImage(image_span, LOGO_W, LOGO_H, ROTATE_0, WHITE);
+  Paint_DrawBitMapPacked(gImage_2in13b_V4b_Packed);
+  if (memcmp(image_pixel, image_span, LOGO_BYTES) != 0)
+  {
+    printf("MISMATCH packed bitmap\n");
+    failures++;
+  }
+
+  band_frame = image_span;
+  memset(image_span, 0x5A, LOGO_BYTES);
+  Paint_NewImage(image_span + LOGO_BYTES, LOGO_W, LOGO_H, ROTATE_0, WHITE);
+  Paint_BeginList(list, 1);
+  Paint_DrawBitMapPacked(gImage_2in13b_V4b_Packed);
+  if (Paint_RenderBands(LOGO_BAND, Bench_Flush) < 0 || memcmp(image_pixel, image_span, LOGO_BYTES) != 0)
+  {
+    printf("MISMATCH packed bitmap in bands\n");
+    failures++;
+  }
+  return failures;
+}
+
+/* A decimal beyond float precision must render the same from the display list */
+static int Bench_VerifyDecimals(void)
+{
+  static PAINT_CMD list[2];
+
+  Paint_NewImage(image_pixel, LOGO_W, LOGO_H, ROTATE_0, WHITE);
+  Paint_Clear(WHITE);
+  Paint_DrawNumDecimals(5, 30, 1234567.89, &Font12, 2, BLACK, WHITE);
+
+  band_frame = image_span;
+  memset(image_span, 0x5A, LOGO_BYTES);
+  Paint_NewImage(image_span + LOGO_BYTES, LOGO_W, LOGO_H, ROTATE_0, WHITE);
+  Paint_BeginList(list, 2);
+  Paint_Clear(WHITE);
+  Paint_DrawNumDecimals(5, 30, 1234567.89, &Font12, 2, BLACK, WHITE);
+  if (Paint_RenderBands(LOGO_BAND, Bench_Flush) < 0 || memcmp(image_pixel, image_span, LOGO_BYTES) != 0)
+  {
+    printf("MISMATCH decimals in bands\n");
+    return 1;
+  }
+  return 0;
+}
+
+static void Bench_PlaneFlush(const UBYTE *band, UBYTE plane, UWORD ystart, UWORD rows)
+{
+  memcpy(band_frame + plane * LOGO_BYTES + ystart * Paint.WidthByte, band, (size_t)rows * Paint.WidthByte);
+}
+
+static void Bench_PlaneScene(UBYTE plane)
+{
+  if (plane == PAINT_PLANE_BLACK)
+  {
+    Paint_DrawLine(20, 70, 50, 100, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    Paint_DrawRectangle(60, 70, 90, 100, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawString_CN(5, 15, "你好abc", &Font24CN, WHITE, BLACK);
+  }
+  else
+  {
+    Paint_DrawCircle(165, 85, 15, RED, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawString_EN(5, 0, "waveshare Electronics", &Font12, BLACK, WHITE);
+    Paint_DrawNum(5, 50, 987654321, &Font20, WHITE, RED);
+  }
+}
+
+/* Black and red planes from one display list in 20-row bands, against two full images */
+static int Bench_VerifyPlanes(void)
+{
+  static PAINT_CMD list[8];
+  int failures = 0;
+
+  for (UBYTE plane = PAINT_PLANE_BLACK; plane <= PAINT_PLANE_RED; plane++)
+  {
+    Paint_NewImage(image_pixel + plane * LOGO_BYTES, LOGO_W, LOGO_H, ROTATE_90, WHITE);
+    Paint_Clear(WHITE);
+    Bench_PlaneScene(plane);
+  }
+
+  band_frame = image_span;
+  memset(image_span, 0x5A, 2U * LOGO_BYTES);
+  Paint_NewImage(image_span + 2U * LOGO_BYTES, LOGO_W, LOGO_H, ROTATE_90, WHITE);
+  Paint_BeginList(list, 8);
+  Bench_PlaneScene(PAINT_PLANE_BLACK);
+  Paint_SelectPlane(PAINT_PLANE_RED);
+  Bench_PlaneScene(PAINT_PLANE_RED);
+  if (Paint_RenderPlanes(20, 2, Bench_PlaneFlush) != 2 * 13 ||
+      memcmp(image_pixel, image_span, 2U * LOGO_BYTES) != 0)
+  {
+    printf("MISMATCH planes in bands\n");
+    failures++;
+  }
+  return failures;
+}
+
+#define DITHER_W      120U
+#define DITHER_H      100U
+#define DITHER_BYTES  (DITHER_W / 2U * DITHER_H)
+
+static UDOUBLE dither_flat;
+
+static UDOUBLE Bench_Gradient(UWORD x, UWORD y)
+{
+  UDOUBLE r = x * 255U / (DITHER_W - 1U), g = y * 255U / (DITHER_H - 1U);
+  return r << 16 | g << 8 | (255U - (r + g) / 2U);
+}
+
+static UDOUBLE Bench_Flat(UWORD x, UWORD y)
+{
+  (void)x;
+  (void)y;
+  return dither_flat;
+}
+
+/* Flat palette colours must dither to themselves only */
+static int Bench_DitherFlat(UBYTE scale, const UBYTE *palette, UBYTE colors, UBYTE spread)
+{
+  const PAINT_DITHER dither = { Bench_Flat, palette, colors, spread };
+  UWORD x, y;
+
+  for (UBYTE i = 0; i < colors; i++)
+  {
+    const UBYTE *p = palette + i * 3;
+    dither_flat = (UDOUBLE)p[0] << 16 | (UDOUBLE)p[1] << 8 | p[2];
+    Paint_NewImage(image_pixel, 8, 8, ROTATE_0, WHITE);
+    Paint_SetScale(scale);
+    Paint_DrawDithered(0, 0, 8, 8, &dither);
+    for (y = 0; y < 8; y++)
+    {
+      for (x = 0; x < 8; x++)
+      {
+        UBYTE bits = scale == 4 ? 2 : 4;
+        UBYTE v = (image_pixel[y * Paint.WidthByte + x * bits / 8] >> (8 - bits - x * bits % 8)) & ((1 << bits) - 1);
+        if (v != i)
+        {
+          printf("MISMATCH dither scale %d colour %d gives %d\n", scale, i, v);
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/* 7-colour gradient drawn directly and from a display list in 10-row bands */
+static int Bench_VerifyDither(void)
+{
+  static const UWORD rotates[] = { ROTATE_0, ROTATE_90 };
+  const PAINT_DITHER dither = { Bench_Gradient, Paint_Palette7F, 7, 64 };
+  static PAINT_CMD list[2];
+  int failures = 0;
+
+  for (unsigned r = 0; r < sizeof(rotates) / sizeof(rotates[0]); r++)
+  {
+    UWORD w = rotates[r] == ROTATE_0 ? DITHER_W : DITHER_H;
+    UWORD h = rotates[r] == ROTATE_0 ? DITHER_H : DITHER_W;
+
+    Paint_NewImage(image_pixel, DITHER_W, DITHER_H, rotates[r], EPD_7IN3F_WHITE);
+    Paint_SetScale(7);
+    Paint_Clear(EPD_7IN3F_WHITE);
+    Paint_DrawDithered(4, 2, w - 8, h - 4, &dither);
+
+    band_frame = image_span;
+    memset(image_span, 0x5A, DITHER_BYTES);
+    Paint_NewImage(image_span + DITHER_BYTES, DITHER_W, DITHER_H, rotates[r], EPD_7IN3F_WHITE);
+    Paint_SetScale(7);
+    Paint_BeginList(list, 2);
+    Paint_DrawDithered(4, 2, w - 8, h - 4, &dither);
+    if (Paint_RenderBands(10, Bench_Flush) != DITHER_H / 10 ||
+        memcmp(image_pixel, image_span, DITHER_BYTES) != 0)
+    {
+      printf("MISMATCH dithered picture in bands, rotate %d\n", rotates[r]);
+      failures++;
+    }
+  }
+  return failures + Bench_DitherFlat(7, Paint_Palette7F, 7, 64) + Bench_DitherFlat(4, Paint_Palette4G, 4, 64) +
+         Bench_DitherFlat(4, Paint_PaletteGray4, 4, 85);
+}
+
+static int flush_full, flush_window;
+static UWORD flush_box[4];
+
+static void Bench_PanelFull(UBYTE *image)
+{
+  (void)image;
+  flush_full++;
+}
+
+static void Bench_PanelWindow(const UBYTE *image, UWORD x0, UWORD y0, UWORD x1, UWORD y1)
+{
+  (void)image;
+  flush_window++;
+  flush_box[0] = x0;
+  flush_box[1] = y0;
+  flush_box[2] = x1;
+  flush_box[3] = y1;
+}
+
+/* Memory pixels that differ between image_pixel and image_span lie in the dirty box */
+static int Bench_DirtyCovers(void)
+{
+  UWORD x0, y0, x1, y1;
+  int dirty = Paint_GetDirty(&x0, &y0, &x1, &y1);
+
+  for (UWORD y = 0; y < BENCH_H; y++)
+  {
+    for (UWORD x = 0; x < BENCH_W; x++)
+    {
+      UWORD addr = y * Paint.WidthByte + x / 8U;
+      if (((image_pixel[addr] ^ image_span[addr]) & (0x80U >> (x % 8U))) &&
+          (!dirty || x < x0 || x > x1 || y < y0 || y > y1))
+      {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+static int Bench_VerifyDirty(void)
+{
+  static const PAINT_PANEL panel = { Bench_PanelFull, Bench_PanelWindow, 3 };
+  static const UWORD rotates[] = { ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270 };
+  int failures = 0;
+
+  for (unsigned r = 0; r < sizeof(rotates) / sizeof(rotates[0]); r++)
+  {
+    for (UBYTE m = MIRROR_NONE; m <= MIRROR_ORIGIN; m++)
+    {
+      int ok;
+      Bench_Select(image_span, 2, rotates[r], m);
+      Paint_Clear(WHITE);
+      flush_full = flush_window = 0;
+      ok = (Paint_Flush(&panel) == 2) && (Paint_Flush(&panel) == 0);
+
+      memcpy(image_pixel, image_span, BENCH_BYTES);
+      Paint_DrawString_EN(20, 30, "12:34", &Font20, WHITE, BLACK);
+      Paint_DrawLine(5, 150, 60, 190, BLACK, DOT_PIXEL_2X2, LINE_STYLE_SOLID);
+      Paint_DrawCircle(150, 150, 20, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+      Paint_DrawBitMapPacked_Paste(gImage_2in13b_V4b_Packed, 100, 10, LOGO_W, 40, 0);
+      ok &= Bench_DirtyCovers();
+
+      // Three windows, then the fourth partial is forced full; a clear is full too
+      for (int i = 0; i < 4; i++)
+      {
+        Paint_DrawPoint(10 + i, 10, BLACK, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+        ok &= (Paint_Flush(&panel) == (i < 3 ? 1 : 2));
+      }
+      Paint_Clear(BLACK);
+      ok &= (Paint_Flush(&panel) == 2) && flush_full == 3 && flush_window == 3;
+      if (!ok)
+      {
+        printf("MISMATCH dirty rotate %u mirror %u\n", rotates[r], m);
+        failures++;
+      }
+    }
+  }
+  return failures;
+}
+
+static double Bench_NowUs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e6 + (double)ts.tv_nsec / 1e3;
+}
+
+/* Average microseconds per call of fn over iterations */
+static double Bench_Time(void (*fn)(int), int arg, unsigned iterations)
+{
+  double t0 = Bench_NowUs();
+  for (unsigned i = 0; i < iterations; i++)
+  {
+    fn(arg);
+  }
+  return (Bench_NowUs() - t0) / iterations;
+}
+
+static void Bench_Fill(int reference)
+{
+  if (reference)
+  {
+    Ref_ClearWindows(0, 0, Paint.Width, Paint.Height, BLACK);
+  }
+  else
+  {
+    Paint_ClearWindows(0, 0, Paint.Width, Paint.Height, BLACK);
+  }
+}
+
+static void Bench_TextCN(int reference)
+{
+  if (reference)
+  {
+    Ref_TextCN(0, 40, &Font24CN, WHITE, BLACK);
+  }
+  else
+  {
+    Paint_DrawString_CN(0, 40, bench_text_cn, &Font24CN, WHITE, BLACK);
+  }
+}
+
+static void Bench_TextPacked(int reference)
+{
+  if (reference)
+  {
+    Ref_Text(0, 40, &Font20, WHITE, BLACK);
+  }
+  else
+  {
+    Span_Text(0, 40, &Font20P, WHITE, BLACK);
+  }
+}
+
+static void Bench_Text(int reference)
+{
+  if (reference)
+  {
+    Ref_Text(0, 40, &Font20, WHITE, BLACK);
+  }
+  else
+  {
+    Span_Text(0, 40, &Font20, WHITE, BLACK);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  unsigned iterations = (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 10) : 2000U;
+  static const struct
+  {
+    const char *name;
+    void (*fn)(int);
+  } cases[] =
+  {
+    { "fill 200x200", Bench_Fill },
+    { "text Font20 x14", Bench_Text },
+    { "text Font24CN x6", Bench_TextCN },
+    { "text Font20P x14", Bench_TextPacked },
+  };
+  int failures;
+
+  if (iterations == 0U)
+  {
+    iterations = 1U;
+  }
+
+  failures = Bench_Verify() + Bench_VerifyBitmap() + Bench_VerifyDecimals() + Bench_VerifyPlanes() + Bench_VerifyDither() + Bench_VerifyDirty();
+  printf("verify: %s (3 scales x 4 rotations x 4 mirrors, packed fonts and bitmaps, decimals, planes, dithering, dirty box)\n",
+         failures ? "FAIL" : "ok");
+
+  printf("%-18s %6s %12s %12s %8s\n", "case", "rotate", "pixel us", "span us", "speedup");
+  for (unsigned c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+  {
+    for (UWORD rotate = ROTATE_0; rotate <= ROTATE_270; rotate += 90)
+    {
+      double ref, span;
+      Bench_Select(image_pixel, 2, rotate, MIRROR_NONE);
+      ref = Bench_Time(cases[c].fn, 1, iterations);
+      span = Bench_Time(cases[c].fn, 0, iterations);
+      printf("%-18s %6u %12.2f %12.2f %7.1fx\n", cases[c].name, rotate, ref, span, ref / span);
+    }
+  }
+  return failures ? 1 : 0;
+}
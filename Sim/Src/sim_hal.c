@@ -0,0 +1,1056 @@
+/*
+ * Virtual PY32F002A peripherals for the host simulation build.
+ *
+ * Time is virtual and kept in nanoseconds. It only moves when the firmware
+ * waits (HAL_Delay, ADC polling, flash operations, WS2812 frames), so a
+ * minute of firmware time runs in a few milliseconds of host time. Pending
+ * timer, ADC and EXTI events are dispatched to the application's IRQ
+ * handlers in priority order whenever interrupts are unmasked.
+ *
+ * Not modelled: ISR preemption (handlers run to completion), bus timing of
+ * ordinary code, and anything the application does not use.
+ */
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "py32f0xx_hal.h"
+#include "py32f0xx_it.h"
+#include "SEGGER_RTT.h"
+#include "sim_hal.h"
+#include "sim_trace.h"
+#include "ws2812_config.h"
+#include "ram_watermark.h"
+#include "fault_log.h"
+
+#define SIM_CORE_HZ         8000000UL
+#define SIM_VREFINT_MV      1200U
+#define SIM_ADC_CONV_NS     (252ULL * 125ULL)   /* 239.5 + 12.5 ADC clocks at 8 MHz */
+#define SIM_FLASH_ERASE_NS  (4ULL * SIM_NS_PER_MS)
+#define SIM_FLASH_PROG_NS   (1500ULL * SIM_NS_PER_US)
+#define SIM_WS2812_BIT_NS   1250ULL
+#define SIM_WS2812_T0H_NS   350ULL
+#define SIM_WS2812_T1H_NS   700ULL
+#define SIM_POLL_COST_NS    (1ULL * SIM_NS_PER_US) /* CPU time charged per HAL_GetTick */
+#define SIM_SYSTICK_PRIO    3U /* TICK_INT_PRIORITY: lowest */
+#define SIM_STIM_MAX        256U
+#define SIM_FEED_SIZE       256U
+#define SIM_LSI_HZ          32768ULL
+
+/* Register bits the stub keeps in the virtual peripherals */
+#define SIM_ADC_CR_ADSTART  0x00000004UL
+#define SIM_ADC_CFGR1_AWDEN 0x00800000UL
+#define SIM_TIM_DIER_UIE    0x00000001UL
+#define SIM_TIM_SR_UIF      0x00000001UL
+
+/* Application interrupt handlers */
+void TIM16_IRQHandler(void);
+void ADC_COMP_IRQHandler(void);
+void HAL_MspInit(void);
+
+uint32_t SystemCoreClock = SIM_CORE_HZ;
+
+GPIO_TypeDef sim_gpioa, sim_gpiob;
+TIM_TypeDef sim_tim1, sim_tim16;
+ADC_TypeDef sim_adc1;
+FLASH_TypeDef sim_flash = { FLASH_CR_LOCK, 0 };
+IWDG_TypeDef sim_iwdg;
+
+typedef struct
+{
+  uint16_t output;
+  uint16_t pullup;
+  uint16_t it_falling;
+  uint16_t ext_mask;
+  uint16_t ext_level;
+} sim_pins_t;
+
+typedef enum
+{
+  STIM_VDD = 0,
+  STIM_PIN,
+  STIM_CONSOLE,
+  STIM_HANG,
+} sim_stim_type_t;
+
+typedef struct
+{
+  uint64_t at_ns;
+  sim_stim_type_t type;
+  uint8_t port;
+  uint16_t pin;
+  int32_t value;
+  const char *text;
+} sim_stim_t;
+
+static GPIO_TypeDef *const ports[SIM_PORT_COUNT] = { &sim_gpioa, &sim_gpiob };
+static sim_pins_t pins[SIM_PORT_COUNT];
+
+static uint64_t now_ns;
+static uint64_t end_ns = UINT64_MAX;
+static jmp_buf exit_jmp;
+static int reset_reason;
+static volatile uint32_t uw_tick;
+
+static uint32_t primask;
+static uint8_t in_isr;
+static uint8_t stalled;
+static uint32_t nvic_enabled;
+static uint32_t nvic_pending;
+static uint8_t nvic_prio[32];
+static uint8_t systick_running;
+static uint8_t systick_pending;
+
+static uint64_t systick_next;
+static uint64_t tim16_next;
+static uint64_t tim16_period_ns;
+static uint64_t tim1_next;
+static uint64_t tim1_period_ns;
+static uint8_t tim1_trgo_update;
+static uint64_t adc_done_ns;
+static uint8_t adc_soft_start;
+static uint16_t exti_pending;
+static uint64_t iwdg_deadline;
+static uint64_t iwdg_period_ns;
+static void (*observer)(uint64_t t_ns);
+static uint64_t observe_next;
+
+static uint32_t vdd_mv = 3700U;
+static uint32_t vrefint_mv = SIM_VREFINT_MV;
+static uint8_t led_grb[3];
+
+static sim_stim_t stim[SIM_STIM_MAX];
+static uint32_t stim_count;
+static uint32_t stim_next;
+
+static char feed[SIM_FEED_SIZE];
+static uint32_t feed_head;
+static uint32_t feed_tail;
+
+static uint8_t *flash_mem;
+static const char *flash_path;
+static uint8_t rtt_line_start = 1;
+
+static sim_stats_t stats;
+
+static void Sim_AdvanceTo(uint64_t target);
+
+/* ---- Time base ---------------------------------------------------------- */
+
+static uint64_t Sim_TimerPeriodNs(TIM_TypeDef *tim)
+{
+  uint64_t ticks = (uint64_t)(tim->PSC + 1U) * (uint64_t)(tim->ARR + 1U);
+  return (ticks * 1000000000ULL) / SystemCoreClock;
+}
+
+static uint64_t Sim_NextEvent(void)
+{
+  uint64_t t = UINT64_MAX;
+  if (systick_running && systick_next < t) t = systick_next;
+  if ((sim_tim16.CR1 & TIM_CR1_CEN) && tim16_next < t) t = tim16_next;
+  if ((sim_tim1.CR1 & TIM_CR1_CEN) && tim1_next < t) t = tim1_next;
+  if (adc_done_ns && adc_done_ns < t) t = adc_done_ns;
+  if (iwdg_period_ns && iwdg_deadline < t) t = iwdg_deadline;
+  if (stim_next < stim_count && stim[stim_next].at_ns < t) t = stim[stim_next].at_ns;
+  if (observer && observe_next < t) t = observe_next;
+  return t;
+}
+
+static void Sim_PendIrq(IRQn_Type irq)
+{
+  if (nvic_enabled & (1UL << irq))
+  {
+    nvic_pending |= (1UL << irq);
+  }
+}
+
+/* Runs pending handlers, highest priority (lowest value) first */
+static void Sim_Dispatch(void)
+{
+  while (!primask && !in_isr && !stalled)
+  {
+    int best = -1;
+    for (int i = 0; i < 32; i++)
+    {
+      if ((nvic_pending & (1UL << i)) && (best < 0 || nvic_prio[i] < nvic_prio[best]))
+      {
+        best = i;
+      }
+    }
+
+    if (best < 0 && !systick_pending)
+    {
+      return;
+    }
+
+    in_isr = 1;
+    if (best < 0 || (systick_pending && SIM_SYSTICK_PRIO < nvic_prio[best]))
+    {
+      systick_pending = 0;
+      stats.systick++;
+      SysTick_Handler();
+    }
+    else
+    {
+      nvic_pending &= ~(1UL << best);
+      switch (best)
+      {
+      case TIM16_IRQn:
+        stats.tim16++;
+        TIM16_IRQHandler();
+        break;
+      case ADC_COMP_IRQn:
+        stats.adc_irq++;
+        ADC_COMP_IRQHandler();
+        break;
+      case EXTI4_15_IRQn:
+        stats.exti++;
+        EXTI4_15_IRQHandler();
+        break;
+      default:
+        break;
+      }
+    }
+    in_isr = 0;
+  }
+}
+
+/* ---- GPIO --------------------------------------------------------------- */
+
+static void Sim_UpdateInputs(sim_port_t port)
+{
+  GPIO_TypeDef *gpio = ports[port];
+  sim_pins_t *p = &pins[port];
+  uint16_t driven = (p->ext_mask & p->ext_level) | (~p->ext_mask & p->pullup);
+  uint16_t idr = (uint16_t)((gpio->ODR & p->output) | (driven & ~p->output));
+  uint16_t fell = (uint16_t)(gpio->IDR & ~idr & p->it_falling);
+  uint16_t changed = (uint16_t)(gpio->IDR ^ idr);
+
+  gpio->IDR = idr;
+  for (uint16_t bit = 1U; changed && bit; bit <<= 1)
+  {
+    if (changed & bit)
+    {
+      SimTrace_Edge(now_ns, (uint8_t)port, bit, (idr & bit) ? 1U : 0U);
+      changed &= ~bit;
+    }
+  }
+  if (fell)
+  {
+    exti_pending |= fell;
+    if (fell & 0xFFF0U)
+    {
+      Sim_PendIrq(EXTI4_15_IRQn);
+    }
+  }
+}
+
+static int Sim_PortIndex(GPIO_TypeDef *gpio)
+{
+  return (gpio == &sim_gpiob) ? SIM_PORT_B : SIM_PORT_A;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  sim_port_t port = (sim_port_t)Sim_PortIndex(GPIOx);
+  sim_pins_t *p = &pins[port];
+  uint16_t mask = (uint16_t)GPIO_Init->Pin;
+
+  p->output &= ~mask;
+  p->pullup &= ~mask;
+  p->it_falling &= ~mask;
+  if (GPIO_Init->Mode == GPIO_MODE_OUTPUT_PP || GPIO_Init->Mode == GPIO_MODE_OUTPUT_OD)
+  {
+    p->output |= mask;
+  }
+  if (GPIO_Init->Mode == GPIO_MODE_IT_FALLING)
+  {
+    p->it_falling |= mask;
+  }
+  if (GPIO_Init->Pull == GPIO_PULLUP)
+  {
+    p->pullup |= mask;
+  }
+  Sim_UpdateInputs(port);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  if (PinState != GPIO_PIN_RESET)
+  {
+    GPIOx->ODR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+  }
+  Sim_UpdateInputs((sim_port_t)Sim_PortIndex(GPIOx));
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  GPIOx->ODR ^= GPIO_Pin;
+  Sim_UpdateInputs((sim_port_t)Sim_PortIndex(GPIOx));
+}
+
+__attribute__((weak)) void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  (void)GPIO_Pin;
+}
+
+void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin)
+{
+  if (exti_pending & GPIO_Pin)
+  {
+    exti_pending &= ~GPIO_Pin;
+    HAL_GPIO_EXTI_Callback(GPIO_Pin);
+  }
+}
+
+/* ---- ADC ---------------------------------------------------------------- */
+
+static void Sim_AdcStartConversion(void)
+{
+  if ((sim_adc1.CR & SIM_ADC_CR_ADSTART) && adc_done_ns == 0)
+  {
+    adc_done_ns = now_ns + SIM_ADC_CONV_NS;
+  }
+}
+
+static void Sim_AdcComplete(void)
+{
+  uint32_t raw = (vrefint_mv * 4095U + vdd_mv / 2U) / (vdd_mv ? vdd_mv : 1U);
+  uint32_t high = (sim_adc1.TR >> 16) & 0xFFFU;
+  uint32_t low = sim_adc1.TR & 0xFFFU;
+
+  adc_done_ns = 0;
+  stats.adc_conv++;
+  if (raw > 0xFFFU) raw = 0xFFFU;
+
+  if (sim_adc1.ISR & ADC_FLAG_EOC)
+  {
+    sim_adc1.ISR |= ADC_FLAG_OVR;
+  }
+  sim_adc1.DR = raw;
+  sim_adc1.ISR |= ADC_FLAG_EOC | ADC_FLAG_EOS;
+  if ((sim_adc1.CFGR1 & SIM_ADC_CFGR1_AWDEN) && (raw > high || raw < low))
+  {
+    sim_adc1.ISR |= ADC_FLAG_AWD;
+  }
+  if (sim_adc1.ISR & sim_adc1.IER & (ADC_FLAG_EOC | ADC_FLAG_EOS | ADC_FLAG_OVR | ADC_FLAG_AWD))
+  {
+    Sim_PendIrq(ADC_COMP_IRQn);
+  }
+  if (adc_soft_start && (sim_adc1.CR & SIM_ADC_CR_ADSTART))
+  {
+    sim_adc1.CR &= ~SIM_ADC_CR_ADSTART;
+  }
+}
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc)
+{
+  adc_soft_start = (hadc->Init.ExternalTrigConv == ADC_SOFTWARE_START);
+  hadc->Instance->CFGR1 = (hadc->Instance->CFGR1 & SIM_ADC_CFGR1_AWDEN) | hadc->Init.ExternalTrigConvEdge;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_Calibration_Start(ADC_HandleTypeDef *hadc)
+{
+  (void)hadc;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *sConfig)
+{
+  hadc->Instance->CHSELR |= (1UL << sConfig->Channel);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_AnalogWDGConfig(ADC_HandleTypeDef *hadc, ADC_AnalogWDGConfTypeDef *AnalogWDGConfig)
+{
+  if (hadc->Instance->CR & SIM_ADC_CR_ADSTART)
+  {
+    return HAL_ERROR;
+  }
+  if (AnalogWDGConfig->WatchdogMode == ADC_ANALOGWATCHDOG_NONE)
+  {
+    hadc->Instance->CFGR1 &= ~SIM_ADC_CFGR1_AWDEN;
+  }
+  else
+  {
+    hadc->Instance->CFGR1 |= SIM_ADC_CFGR1_AWDEN;
+  }
+  hadc->Instance->TR = ((AnalogWDGConfig->HighThreshold & 0xFFFU) << 16) | (AnalogWDGConfig->LowThreshold & 0xFFFU);
+  hadc->Instance->ISR &= ~ADC_FLAG_AWD;
+  if (AnalogWDGConfig->ITMode == ENABLE)
+  {
+    hadc->Instance->IER |= ADC_IT_AWD;
+  }
+  else
+  {
+    hadc->Instance->IER &= ~ADC_IT_AWD;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *hadc)
+{
+  hadc->Instance->ISR &= ~(ADC_FLAG_EOC | ADC_FLAG_EOS | ADC_FLAG_OVR);
+  hadc->Instance->CR |= SIM_ADC_CR_ADSTART;
+  if (adc_soft_start)
+  {
+    Sim_AdcStartConversion();
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef *hadc)
+{
+  hadc->Instance->CR &= ~SIM_ADC_CR_ADSTART;
+  adc_done_ns = 0;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  while (!(hadc->Instance->ISR & ADC_FLAG_EOC))
+  {
+    if (Timeout != HAL_MAX_DELAY && (HAL_GetTick() - tickstart) > Timeout)
+    {
+      return HAL_TIMEOUT;
+    }
+    Sim_AdvanceTo(Sim_NextEvent());
+  }
+  return HAL_OK;
+}
+
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *hadc)
+{
+  hadc->Instance->ISR &= ~ADC_FLAG_EOC;
+  return hadc->Instance->DR;
+}
+
+/* ---- TIM ---------------------------------------------------------------- */
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim)
+{
+  htim->Instance->PSC = htim->Init.Prescaler;
+  htim->Instance->ARR = htim->Init.Period;
+  htim->Instance->RCR = htim->Init.RepetitionCounter;
+  return HAL_OK;
+}
+
+static void Sim_TimerStart(TIM_HandleTypeDef *htim)
+{
+  uint64_t period = Sim_TimerPeriodNs(htim->Instance);
+  htim->Instance->CR1 |= TIM_CR1_CEN;
+  if (htim->Instance == &sim_tim16)
+  {
+    tim16_period_ns = period;
+    tim16_next = now_ns + period;
+  }
+  else
+  {
+    tim1_period_ns = period;
+    tim1_next = now_ns + period;
+  }
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+  Sim_TimerStart(htim);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef *htim)
+{
+  htim->Instance->CR1 &= ~TIM_CR1_CEN;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+  htim->Instance->DIER |= SIM_TIM_DIER_UIE;
+  Sim_TimerStart(htim);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim)
+{
+  htim->Instance->DIER &= ~SIM_TIM_DIER_UIE;
+  htim->Instance->CR1 &= ~TIM_CR1_CEN;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig)
+{
+  if (htim->Instance == &sim_tim1)
+  {
+    tim1_trgo_update = (sMasterConfig->MasterOutputTrigger == TIM_TRGO_UPDATE);
+  }
+  return HAL_OK;
+}
+
+/* ---- FLASH -------------------------------------------------------------- */
+
+/* The CPU fetches from flash, so it stalls (IRQs included) while busy */
+static void Sim_FlashBusy(uint64_t ns)
+{
+  stalled = 1;
+  Sim_AdvanceTo(now_ns + ns);
+  stalled = 0;
+}
+
+static uint8_t Sim_FlashValid(uint32_t addr, uint32_t len)
+{
+  return addr >= FLASH_BASE && (addr - FLASH_BASE) + len <= FLASH_SIZE;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+  sim_flash.CR &= ~FLASH_CR_LOCK;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+  sim_flash.CR |= FLASH_CR_LOCK;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint32_t *DataAddr)
+{
+  if (TypeProgram != FLASH_TYPEPROGRAM_PAGE || (sim_flash.CR & FLASH_CR_LOCK) ||
+      (Address % FLASH_PAGE_SIZE) != 0U || !Sim_FlashValid(Address, FLASH_PAGE_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  /* NOR semantics: programming can only clear bits */
+  uint32_t *dst = (uint32_t *)(uintptr_t)Address;
+  for (uint32_t i = 0; i < FLASH_PAGE_SIZE / 4U; i++)
+  {
+    dst[i] &= DataAddr[i];
+  }
+  stats.flash_program++;
+  Sim_FlashBusy(SIM_FLASH_PROG_NS);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError)
+{
+  uint32_t addr = pEraseInit->PageAddress;
+  uint32_t len = pEraseInit->NbPages * FLASH_PAGE_SIZE;
+
+  *PageError = 0xFFFFFFFFU;
+  if (pEraseInit->TypeErase == FLASH_TYPEERASE_SECTORERASE)
+  {
+    addr = pEraseInit->SectorAddress;
+    len = pEraseInit->NbSectors * FLASH_SECTOR_SIZE;
+  }
+  if ((sim_flash.CR & FLASH_CR_LOCK) || !Sim_FlashValid(addr, len))
+  {
+    *PageError = addr;
+    return HAL_ERROR;
+  }
+
+  memset((void *)(uintptr_t)addr, 0xFF, len);
+  stats.flash_erase++;
+  Sim_FlashBusy(SIM_FLASH_ERASE_NS);
+  return HAL_OK;
+}
+
+/* ---- WS2812 ------------------------------------------------------------- */
+
+static void Sim_WsPin(uint8_t level)
+{
+  HAL_GPIO_WritePin(LIGHT_WS2812_GPIO_PORT, LIGHT_WS2812_GPIO_PIN, level ? GPIO_PIN_SET : GPIO_PIN_RESET);
+}
+
+/* Replaces the cycle-counted bitbang in light_ws2812_cortex.c; the data
+   line carries the real bit timing so it shows up in traces */
+void ws2812_sendarray(uint8_t *ledarray, int length)
+{
+  for (int i = 0; i < length && i < 3; i++)
+  {
+    led_grb[i] = ledarray[i];
+  }
+  stats.ws2812_frames++;
+
+  for (int i = 0; i < length; i++)
+  {
+    for (uint8_t mask = 0x80U; mask; mask >>= 1)
+    {
+      uint64_t bit_start = now_ns;
+      uint64_t high_ns = (ledarray[i] & mask) ? SIM_WS2812_T1H_NS : SIM_WS2812_T0H_NS;
+      Sim_WsPin(1);
+      Sim_AdvanceTo(bit_start + high_ns);
+      Sim_WsPin(0);
+      Sim_AdvanceTo(bit_start + SIM_WS2812_BIT_NS);
+    }
+  }
+}
+
+/* ---- RAM watermark and fault log ---------------------------------------- */
+
+/* Replaces ram_watermark.c: the host stack says nothing about the target's */
+void RamWatermark_Get(ram_watermark_t *wm)
+{
+  memset(wm, 0, sizeof(*wm));
+}
+
+void RamWatermark_Report(void)
+{
+  SEGGER_RTT_WriteString(0, "mem: not modelled in the simulator\r\n");
+}
+
+/* Replaces fault_log.c: host faults end the process, nothing survives a reset */
+void FaultLog_Init(void)
+{
+}
+
+uint8_t FaultLog_Pending(void)
+{
+  return 0;
+}
+
+/* ---- Core --------------------------------------------------------------- */
+
+uint32_t __get_PRIMASK(void)
+{
+  return primask;
+}
+
+void __disable_irq(void)
+{
+  primask = 1;
+}
+
+void __enable_irq(void)
+{
+  primask = 0;
+  Sim_Dispatch();
+}
+
+void __NOP(void)
+{
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+  return SystemCoreClock;
+}
+
+HAL_StatusTypeDef HAL_Init(void)
+{
+  systick_running = 1;
+  systick_next = now_ns + SIM_NS_PER_MS;
+  HAL_MspInit();
+  return HAL_OK;
+}
+
+void HAL_IncTick(void)
+{
+  uw_tick++;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  if (!in_isr && !stalled)
+  {
+    Sim_AdvanceTo(now_ns + SIM_POLL_COST_NS);
+  }
+  return uw_tick;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t wait = Delay;
+  if (wait < HAL_MAX_DELAY)
+  {
+    wait += 1U;
+  }
+  while ((HAL_GetTick() - tickstart) < wait)
+  {
+    Sim_AdvanceTo(Sim_NextEvent());
+  }
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  (void)SubPriority;
+  if (IRQn >= 0)
+  {
+    nvic_prio[IRQn] = (uint8_t)PreemptPriority;
+  }
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  nvic_enabled |= (1UL << IRQn);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  nvic_enabled &= ~(1UL << IRQn);
+  nvic_pending &= ~(1UL << IRQn);
+}
+
+/* Ends the run; from a handler it ends once control is back in thread mode */
+static void Sim_Reset(int reason)
+{
+  end_ns = now_ns;
+  reset_reason = reason;
+  if (!in_isr)
+  {
+    longjmp(exit_jmp, reason);
+  }
+}
+
+void HAL_NVIC_SystemReset(void)
+{
+  fprintf(stderr, "sim: system reset requested at %.3f ms\n", (double)now_ns / SIM_NS_PER_MS);
+  Sim_Reset(2);
+}
+
+/* ---- RCC reset flags and IWDG ------------------------------------------- */
+
+static uint32_t rcc_reset_flags = RCC_FLAG_PWRRST | RCC_FLAG_PINRST;
+
+uint8_t Sim_RccGetFlag(uint32_t flag)
+{
+  return (rcc_reset_flags & flag) ? 1U : 0U;
+}
+
+void Sim_RccClearResetFlags(void)
+{
+  rcc_reset_flags = 0;
+}
+
+HAL_StatusTypeDef HAL_IWDG_Init(IWDG_HandleTypeDef *hiwdg)
+{
+  uint64_t ticks = (uint64_t)(hiwdg->Init.Reload + 1U) << (hiwdg->Init.Prescaler + 2U);
+  hiwdg->Instance->PR = hiwdg->Init.Prescaler;
+  hiwdg->Instance->RLR = hiwdg->Init.Reload;
+  iwdg_period_ns = ticks * 1000000000ULL / SIM_LSI_HZ;
+  return HAL_IWDG_Refresh(hiwdg);
+}
+
+HAL_StatusTypeDef HAL_IWDG_Refresh(IWDG_HandleTypeDef *hiwdg)
+{
+  (void)hiwdg;
+  iwdg_deadline = now_ns + iwdg_period_ns;
+  stats.iwdg_refresh++;
+  return HAL_OK;
+}
+
+/* ---- Stimulus and host I/O ---------------------------------------------- */
+
+static void Sim_ScheduleStim(const sim_stim_t *s)
+{
+  if (stim_count >= SIM_STIM_MAX)
+  {
+    fprintf(stderr, "sim: too many stimulus events\n");
+    return;
+  }
+
+  /* Keep the queue sorted by time, stable for equal times */
+  uint32_t i = stim_count++;
+  while (i > stim_next && stim[i - 1].at_ns > s->at_ns)
+  {
+    stim[i] = stim[i - 1];
+    i--;
+  }
+  stim[i] = *s;
+}
+
+void Sim_ScheduleVdd(uint64_t at_ns, uint32_t mv)
+{
+  sim_stim_t s = { at_ns, STIM_VDD, 0, 0, (int32_t)mv, NULL };
+  Sim_ScheduleStim(&s);
+}
+
+void Sim_SchedulePin(uint64_t at_ns, sim_port_t port, uint16_t pin, int8_t level)
+{
+  sim_stim_t s = { at_ns, STIM_PIN, (uint8_t)port, pin, level, NULL };
+  Sim_ScheduleStim(&s);
+}
+
+void Sim_ScheduleHang(uint64_t at_ns)
+{
+  sim_stim_t s = { at_ns, STIM_HANG, 0, 0, 0, NULL };
+  Sim_ScheduleStim(&s);
+}
+
+void Sim_ScheduleConsole(uint64_t at_ns, const char *line)
+{
+  sim_stim_t s = { at_ns, STIM_CONSOLE, 0, 0, 0, line };
+  Sim_ScheduleStim(&s);
+}
+
+static void Sim_ApplyStim(const sim_stim_t *s)
+{
+  switch (s->type)
+  {
+  case STIM_VDD:
+    vdd_mv = (uint32_t)s->value;
+    break;
+  case STIM_PIN:
+  {
+    sim_pins_t *p = &pins[s->port];
+    if (s->value < 0)
+    {
+      p->ext_mask &= ~s->pin;
+    }
+    else
+    {
+      p->ext_mask |= s->pin;
+      p->ext_level = s->value ? (p->ext_level | s->pin) : (p->ext_level & ~s->pin);
+    }
+    Sim_UpdateInputs((sim_port_t)s->port);
+    break;
+  }
+  case STIM_HANG:
+    /* SysTick dies: HAL_Delay never returns and the tick stops advancing */
+    systick_running = 0;
+    systick_pending = 0;
+    break;
+  case STIM_CONSOLE:
+    for (const char *c = s->text; *c; c++)
+    {
+      if (feed_head - feed_tail < SIM_FEED_SIZE)
+      {
+        feed[feed_head++ % SIM_FEED_SIZE] = *c;
+      }
+    }
+    if (feed_head - feed_tail < SIM_FEED_SIZE)
+    {
+      feed[feed_head++ % SIM_FEED_SIZE] = '\n';
+    }
+    break;
+  }
+}
+
+/* Host side of RTT: feed the down buffer, print the up buffer */
+static void Sim_ServiceRtt(void)
+{
+  char buf[64];
+  unsigned n;
+
+  while (feed_tail != feed_head &&
+         SEGGER_RTT_WriteDownBuffer(0, &feed[feed_tail % SIM_FEED_SIZE], 1) == 1U)
+  {
+    feed_tail++;
+  }
+
+  while ((n = SEGGER_RTT_ReadUpBuffer(0, buf, sizeof(buf))) > 0U)
+  {
+    for (unsigned i = 0; i < n; i++)
+    {
+      if (buf[i] == '\r')
+      {
+        continue;
+      }
+      if (rtt_line_start)
+      {
+        printf("[%10.3f] ", (double)now_ns / SIM_NS_PER_MS);
+        rtt_line_start = 0;
+      }
+      putchar(buf[i]);
+      if (buf[i] == '\n')
+      {
+        rtt_line_start = 1;
+      }
+    }
+  }
+}
+
+static void Sim_AdvanceTo(uint64_t target)
+{
+  if (target > end_ns && !in_isr && !stalled)
+  {
+    target = end_ns;
+  }
+
+  for (;;)
+  {
+    uint64_t t = Sim_NextEvent();
+    if (t > target)
+    {
+      break;
+    }
+    now_ns = t;
+
+    if (systick_running && systick_next <= now_ns)
+    {
+      systick_next += SIM_NS_PER_MS;
+      systick_pending = 1;
+    }
+    if ((sim_tim16.CR1 & TIM_CR1_CEN) && tim16_next <= now_ns)
+    {
+      tim16_next += tim16_period_ns;
+      sim_tim16.SR |= SIM_TIM_SR_UIF;
+      if (sim_tim16.DIER & SIM_TIM_DIER_UIE)
+      {
+        Sim_PendIrq(TIM16_IRQn);
+      }
+    }
+    if ((sim_tim1.CR1 & TIM_CR1_CEN) && tim1_next <= now_ns)
+    {
+      tim1_next += tim1_period_ns;
+      sim_tim1.SR |= SIM_TIM_SR_UIF;
+      if (tim1_trgo_update && !adc_soft_start &&
+          (sim_adc1.CFGR1 & ADC_EXTERNALTRIGCONVEDGE_RISING))
+      {
+        Sim_AdcStartConversion();
+      }
+    }
+    if (adc_done_ns && adc_done_ns <= now_ns)
+    {
+      Sim_AdcComplete();
+    }
+    if (iwdg_period_ns && iwdg_deadline <= now_ns)
+    {
+      fprintf(stderr, "sim: IWDG reset at %.3f ms\n", (double)now_ns / SIM_NS_PER_MS);
+      iwdg_period_ns = 0;
+      Sim_Reset(3);
+    }
+    while (stim_next < stim_count && stim[stim_next].at_ns <= now_ns)
+    {
+      Sim_ApplyStim(&stim[stim_next++]);
+    }
+
+    Sim_Dispatch();
+
+    /* after the handlers, so it sees what the firmware made of this instant */
+    if (observer && observe_next <= now_ns)
+    {
+      observe_next += SIM_NS_PER_MS;
+      observer(now_ns);
+    }
+  }
+
+  if (target > now_ns)
+  {
+    now_ns = target;
+  }
+  Sim_Dispatch();
+
+  if (!in_isr && !stalled)
+  {
+    Sim_ServiceRtt();
+    if (now_ns >= end_ns)
+    {
+      longjmp(exit_jmp, reset_reason ? reset_reason : 1);
+    }
+  }
+  else if (now_ns > end_ns + 1000ULL * SIM_NS_PER_MS)
+  {
+    fprintf(stderr, "sim: stuck in an interrupt handler past end of run\n");
+    exit(2);
+  }
+}
+
+/* ---- Run control -------------------------------------------------------- */
+
+void Sim_Init(const char *flash_file)
+{
+  flash_mem = mmap((void *)FLASH_BASE, FLASH_SIZE, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if (flash_mem != (uint8_t *)FLASH_BASE)
+  {
+    fprintf(stderr, "sim: cannot map virtual flash at 0x%08lx\n", (unsigned long)FLASH_BASE);
+    exit(1);
+  }
+  memset(flash_mem, 0xFF, FLASH_SIZE);
+
+  flash_path = flash_file;
+  if (flash_path)
+  {
+    FILE *f = fopen(flash_path, "rb");
+    if (f)
+    {
+      size_t n = fread(flash_mem, 1, FLASH_SIZE, f);
+      (void)n;
+      fclose(f);
+    }
+  }
+}
+
+int Sim_Run(int (*entry)(void), uint64_t run_ns)
+{
+  int reason = setjmp(exit_jmp);
+  if (reason == 0)
+  {
+    end_ns = run_ns;
+    entry();
+  }
+  fflush(stdout);
+  return reason;
+}
+
+void Sim_Shutdown(void)
+{
+  if (flash_path)
+  {
+    FILE *f = fopen(flash_path, "wb");
+    if (f)
+    {
+      fwrite(flash_mem, 1, FLASH_SIZE, f);
+      fclose(f);
+    }
+  }
+  munmap(flash_mem, FLASH_SIZE);
+}
+
+uint64_t Sim_Now(void)
+{
+  return now_ns;
+}
+
+void Sim_SetObserver(void (*fn)(uint64_t t_ns))
+{
+  observer = fn;
+  observe_next = now_ns;
+}
+
+int Sim_GetResetReason(void)
+{
+  return reset_reason;
+}
+
+void Sim_SetVrefint(uint32_t mv)
+{
+  vrefint_mv = mv;
+}
+
+uint32_t Sim_GetVdd(void)
+{
+  return vdd_mv;
+}
+
+uint8_t Sim_GetPin(sim_port_t port, uint16_t pin)
+{
+  return (ports[port]->IDR & pin) ? 1U : 0U;
+}
+
+void Sim_GetLed(uint8_t *r, uint8_t *g, uint8_t *b)
+{
+  *g = led_grb[0];
+  *r = led_grb[1];
+  *b = led_grb[2];
+}
+
+const sim_stats_t *Sim_GetStats(void)
+{
+  return &stats;
+}
@@ -0,0 +1,205 @@
+/*
+ * Host simulation harness: runs the firmware against the virtual HAL.
+ *
+ *   Build/sim/app_sim [options]
+ *     -t <ms>            virtual run time (default 60000)
+ *     -v <mV>            initial Vdd (default 3700)
+ *     -V <ms>:<mV>       step Vdd at the given time
+ *     -r <mV>            actual Vrefint of the simulated part (default 1200)
+ *     -p <pin>:<ms>:<d>  hold PA<pin> low (button press) at <ms> for <d> ms
+ *     -c <ms>:<text>     type a console line over RTT at <ms>
+ *     -H <ms>            stop SysTick at <ms> (main-loop hang, IWDG test)
+ *     -f <file>          persist the virtual flash in <file> across runs
+ *     -q                 do not echo RTT output
+ *     -w <file.vcd>      capture pin transitions and write them as VCD
+ *     -m                 capture pin transitions and print waveform metrics
+ *     -a <ms>            start of the metrics window (default 0)
+ *     -s <file>          run the scenarios in <file>, exit status 1 on failure
+ *     -n <name>          only run scenario <name>, with RTT output
+ *     -j <n>             scenarios run in parallel (default 1)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sim_hal.h"
+#include "sim_trace.h"
+#include "sim_scenario.h"
+#include "hbridge.h"
+#include "ws2812_ctrl.h"
+
+int App_Main(void);
+
+static int Sim_ParsePair(const char *arg, unsigned long *a, unsigned long *b, const char **rest)
+{
+  char *end;
+  *a = strtoul(arg, &end, 10);
+  if (*end != ':')
+  {
+    return 0;
+  }
+  if (b == NULL)
+  {
+    *rest = end + 1;
+    return 1;
+  }
+  *b = strtoul(end + 1, &end, 10);
+  if (rest)
+  {
+    if (*end != ':')
+    {
+      return 0;
+    }
+    *rest = end + 1;
+    return 1;
+  }
+  return *end == '\0';
+}
+
+static void Sim_Usage(const char *prog)
+{
+  fprintf(stderr, "usage: %s [-t ms] [-v mV] [-V ms:mV] [-r mV] [-p pin:ms:dur] "
+                  "[-c ms:text] [-H ms] [-f flash.bin] [-q] [-w trace.vcd] [-m] [-a ms] "
+                  "[-s scenarios [-n name] [-j n]]\n", prog);
+  exit(1);
+}
+
+static double Sim_WallMs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long run_ms = 60000UL;
+  unsigned long analyse_ms = 0UL;
+  const char *flash_file = NULL;
+  const char *vcd_file = NULL;
+  const char *scenario_file = NULL;
+  const char *scenario_name = NULL;
+  unsigned jobs = 1U;
+  int quiet = 0;
+  int metrics = 0;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:v:V:r:p:c:H:f:qw:ma:s:n:j:")) != -1)
+  {
+    unsigned long a, b, c;
+    const char *rest;
+
+    switch (opt)
+    {
+    case 't':
+      run_ms = strtoul(optarg, NULL, 10);
+      break;
+    case 'v':
+      Sim_ScheduleVdd(0, (uint32_t)strtoul(optarg, NULL, 10));
+      break;
+    case 'V':
+      if (!Sim_ParsePair(optarg, &a, &b, NULL)) Sim_Usage(argv[0]);
+      Sim_ScheduleVdd(a * SIM_NS_PER_MS, (uint32_t)b);
+      break;
+    case 'r':
+      Sim_SetVrefint((uint32_t)strtoul(optarg, NULL, 10));
+      break;
+    case 'p':
+      if (!Sim_ParsePair(optarg, &a, &b, &rest)) Sim_Usage(argv[0]);
+      c = strtoul(rest, NULL, 10);
+      if (a > 15U) Sim_Usage(argv[0]);
+      Sim_SchedulePin(b * SIM_NS_PER_MS, SIM_PORT_A, (uint16_t)(1U << a), 0);
+      Sim_SchedulePin((b + c) * SIM_NS_PER_MS, SIM_PORT_A, (uint16_t)(1U << a), -1);
+      break;
+    case 'c':
+      if (!Sim_ParsePair(optarg, &a, NULL, &rest)) Sim_Usage(argv[0]);
+      Sim_ScheduleConsole(a * SIM_NS_PER_MS, rest);
+      break;
+    case 'H':
+      Sim_ScheduleHang(strtoul(optarg, NULL, 10) * SIM_NS_PER_MS);
+      break;
+    case 'f':
+      flash_file = optarg;
+      break;
+    case 'q':
+      quiet = 1;
+      break;
+    case 'w':
+      vcd_file = optarg;
+      SimTrace_Enable();
+      break;
+    case 'm':
+      metrics = 1;
+      SimTrace_Enable();
+      break;
+    case 'a':
+      analyse_ms = strtoul(optarg, NULL, 10);
+      break;
+    case 's':
+      scenario_file = optarg;
+      break;
+    case 'n':
+      scenario_name = optarg;
+      break;
+    case 'j':
+      jobs = (unsigned)strtoul(optarg, NULL, 10);
+      break;
+    default:
+      Sim_Usage(argv[0]);
+    }
+  }
+
+  /* stimulus options given with -s apply to every scenario */
+  if (scenario_file)
+  {
+    return SimScenario_RunFile(scenario_file, scenario_name, jobs, App_Main) ? 1 : 0;
+  }
+
+  if (quiet)
+  {
+    fflush(stdout);
+    if (freopen("/dev/null", "w", stdout) == NULL) return 1;
+  }
+
+  Sim_Init(flash_file);
+  double wall_start = Sim_WallMs();
+  int reason = Sim_Run(App_Main, (uint64_t)run_ms * SIM_NS_PER_MS);
+  double wall_ms = Sim_WallMs() - wall_start;
+
+  uint8_t r, g, b;
+  const sim_stats_t *st = Sim_GetStats();
+  Sim_GetLed(&r, &g, &b);
+
+  fprintf(stderr, "\n--- sim summary ---\n");
+  fprintf(stderr, "virtual time   : %.3f ms (%s)\n", (double)Sim_Now() / SIM_NS_PER_MS,
+          reason == 3 ? "watchdog reset" : reason == 2 ? "reset requested" : "end of run");
+  fprintf(stderr, "host time      : %.3f ms\n", wall_ms);
+  fprintf(stderr, "vdd            : %u mV (measured %u mV)\n",
+          (unsigned)Sim_GetVdd(), (unsigned)WS2812_Ctrl_GetVddMv());
+  fprintf(stderr, "h-bridge       : mode %d, brightness %u%%\n",
+          (int)HBridge_GetMode(), (unsigned)HBridge_GetBrightness());
+  fprintf(stderr, "ws2812         : r=%u g=%u b=%u (%llu frames)\n", r, g, b,
+          (unsigned long long)st->ws2812_frames);
+  fprintf(stderr, "irqs           : systick %llu, tim16 %llu, adc %llu, exti %llu\n",
+          (unsigned long long)st->systick, (unsigned long long)st->tim16,
+          (unsigned long long)st->adc_irq, (unsigned long long)st->exti);
+  fprintf(stderr, "adc conversions: %llu\n", (unsigned long long)st->adc_conv);
+  fprintf(stderr, "flash          : %llu erases, %llu programs\n",
+          (unsigned long long)st->flash_erase, (unsigned long long)st->flash_program);
+  fprintf(stderr, "iwdg refreshes : %llu\n", (unsigned long long)st->iwdg_refresh);
+
+  if (metrics)
+  {
+    uint64_t from = (uint64_t)analyse_ms * SIM_NS_PER_MS;
+    SimTrace_Report(stderr, from < Sim_Now() ? from : 0, Sim_Now());
+  }
+  if (vcd_file && SimTrace_WriteVcd(vcd_file, Sim_Now()) != 0)
+  {
+    fprintf(stderr, "sim: cannot write %s\n", vcd_file);
+  }
+
+  Sim_Shutdown();
+  return 0;
+}
@@ -0,0 +1,823 @@
+/*
+ * Scenario runner for the host simulation build.
+ *
+ * A scenario file holds named timelines of stimulus and expectations:
+ *
+ *   # SW1 long press from OFF: light comes on, then the ramp dims it
+ *   scenario long_press_dims
+ *     t=0 press SW1; t=1200 release SW1
+ *     t=1200 expect mode == FORWARD within 100
+ *     t=1300 hold mode == FORWARD for 500
+ *   end
+ *
+ * Each statement is "[t=<ms>|t=+<ms>] <action>", several per line split by
+ * ';'. A statement without a time reuses the previous one.
+ *   press|release SW1|SW2|PA<n>     drive a button / release to its pull-up
+ *   click SW1 [<ms>]                press, release after <ms> (default 100)
+ *   vdd <mV>                        step the supply
+ *   console <text>                  type a line on RTT down-channel 0
+ *   hang                            stop SysTick
+ *   expect <obs> <op> <value> [within <ms>]
+ *   hold <obs> <op> <value> for <ms>
+ *   expect <obs> rising|falling for <ms>
+ *   duration <ms>                   run length (default: last check + 100)
+ * Observables: mode, brightness, red, green, blue, vdd (firmware's filtered
+ * reading), pa<n>, reset. Values are numbers or OFF, FORWARD, REVERSE,
+ * none, software, watchdog, low, high. Operators: == != < <= > >=.
+ *
+ * The firmware keeps its state in statics, so every scenario runs in a
+ * forked child with fresh RAM and blank flash; up to -j children at once.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "py32f0xx_hal.h"
+#include "sim_hal.h"
+#include "sim_scenario.h"
+#include "hbridge.h"
+#include "ws2812_ctrl.h"
+
+#define SCN_CHECKS_MAX      64U
+#define SCN_STMT_MAX        96U
+#define SCN_JOBS_MAX        64U
+#define SCN_TAIL_MS         100U
+#define SCN_CLICK_MS        100U
+
+typedef enum
+{
+  OBS_MODE = 0,
+  OBS_BRIGHTNESS,
+  OBS_RED,
+  OBS_GREEN,
+  OBS_BLUE,
+  OBS_VDD,
+  OBS_PIN,
+  OBS_RESET,
+} scn_obs_t;
+
+typedef enum
+{
+  OP_EQ = 0,
+  OP_NE,
+  OP_LT,
+  OP_LE,
+  OP_GT,
+  OP_GE,
+} scn_op_t;
+
+typedef enum
+{
+  CHECK_AT = 0,   /* at the given instant */
+  CHECK_WITHIN,   /* becomes true before the window closes */
+  CHECK_HOLD,     /* stays true for the whole window */
+  CHECK_RISING,   /* never decreases and ends higher */
+  CHECK_FALLING,  /* never increases and ends lower */
+} scn_kind_t;
+
+typedef struct
+{
+  unsigned line;
+  char text[SCN_STMT_MAX];
+  scn_kind_t kind;
+  scn_obs_t obs;
+  uint16_t pin;
+  scn_op_t op;
+  long value;
+  uint64_t start_ns;
+  uint64_t window_ns;
+  int8_t result;        /* 0 pending, 1 passed, -1 failed */
+  uint8_t started;
+  uint64_t at_ns;       /* when it passed or failed */
+  long first;
+  long seen;
+} scn_check_t;
+
+typedef struct
+{
+  const char *name;
+  unsigned first_line;  /* index of the "scenario" line */
+  unsigned end_line;    /* index of the "end" line */
+} scn_block_t;
+
+typedef struct
+{
+  const char *name;
+  long value;
+} scn_symbol_t;
+
+typedef struct
+{
+  pid_t pid;
+  int fd;
+} scn_job_t;
+
+static const char *const obs_names[] = { "mode", "brightness", "red", "green", "blue", "vdd" };
+static const char *const op_names[] = { "==", "!=", "<", "<=", ">", ">=" };
+
+static const scn_symbol_t symbols[] =
+{
+  { "OFF", HBRIDGE_OFF }, { "FORWARD", HBRIDGE_FORWARD }, { "REVERSE", HBRIDGE_REVERSE },
+  { "none", 0 }, { "software", 2 }, { "watchdog", 3 },
+  { "low", 0 }, { "high", 1 },
+};
+
+/* Button pins, see button_ctrl.c */
+static const scn_symbol_t buttons[] =
+{
+  { "SW1", 6 }, { "SW2", 5 },
+};
+
+static scn_check_t checks[SCN_CHECKS_MAX];
+static unsigned check_count;
+
+/* ---- Parsing ------------------------------------------------------------ */
+
+static char *Scn_Trim(char *s)
+{
+  char *e;
+  while (*s == ' ' || *s == '\t')
+  {
+    s++;
+  }
+  e = s + strlen(s);
+  while (e > s && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\r' || e[-1] == '\n'))
+  {
+    *--e = '\0';
+  }
+  return s;
+}
+
+/* Splits off the next space-separated word in place; "" at end of input */
+static char *Scn_Word(char **p)
+{
+  char *s = *p;
+  char *w;
+  while (*s == ' ' || *s == '\t')
+  {
+    s++;
+  }
+  w = s;
+  while (*s && *s != ' ' && *s != '\t')
+  {
+    s++;
+  }
+  if (*s)
+  {
+    *s++ = '\0';
+  }
+  *p = s;
+  return w;
+}
+
+static int Scn_Number(const char *s, long *out)
+{
+  char *end;
+  if (*s == '\0')
+  {
+    return 0;
+  }
+  *out = strtol(s, &end, 10);
+  return *end == '\0';
+}
+
+static int Scn_Lookup(const scn_symbol_t *table, unsigned n, const char *s, long *out)
+{
+  for (unsigned i = 0; i < n; i++)
+  {
+    if (strcasecmp(table[i].name, s) == 0)
+    {
+      *out = table[i].value;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* SW1, SW2 or PA<n> to a port A pin mask */
+static int Scn_Pin(const char *s, uint16_t *pin)
+{
+  long n;
+  if (!Scn_Lookup(buttons, sizeof(buttons) / sizeof(buttons[0]), s, &n))
+  {
+    if (strncasecmp(s, "PA", 2) != 0 || !Scn_Number(s + 2, &n))
+    {
+      return 0;
+    }
+  }
+  if (n < 0 || n > 15)
+  {
+    return 0;
+  }
+  *pin = (uint16_t)(1U << n);
+  return 1;
+}
+
+static int Scn_Observable(const char *s, scn_check_t *c)
+{
+  for (unsigned i = 0; i < sizeof(obs_names) / sizeof(obs_names[0]); i++)
+  {
+    if (strcmp(s, obs_names[i]) == 0)
+    {
+      c->obs = (scn_obs_t)i;
+      return 1;
+    }
+  }
+  if (strcmp(s, "reset") == 0)
+  {
+    c->obs = OBS_RESET;
+    return 1;
+  }
+  if ((s[0] == 'p' || s[0] == 'P') && Scn_Pin(s, &c->pin))
+  {
+    c->obs = OBS_PIN;
+    return 1;
+  }
+  return 0;
+}
+
+static int Scn_Op(const char *s, scn_op_t *op)
+{
+  for (unsigned i = 0; i < sizeof(op_names) / sizeof(op_names[0]); i++)
+  {
+    if (strcmp(s, op_names[i]) == 0)
+    {
+      *op = (scn_op_t)i;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* "<obs> <op> <value> [within|for <ms>]" or "<obs> rising|falling for <ms>" */
+static int Scn_ParseCheck(char *p, scn_check_t *c, int hold)
+{
+  char *w = Scn_Word(&p);
+  long ms;
+
+  if (!Scn_Observable(w, c))
+  {
+    return 0;
+  }
+  w = Scn_Word(&p);
+  if (!hold && (strcmp(w, "rising") == 0 || strcmp(w, "falling") == 0))
+  {
+    c->kind = (w[0] == 'r') ? CHECK_RISING : CHECK_FALLING;
+    if (strcmp(Scn_Word(&p), "for") != 0 || !Scn_Number(Scn_Word(&p), &ms) || ms <= 0)
+    {
+      return 0;
+    }
+    c->window_ns = (uint64_t)ms * SIM_NS_PER_MS;
+    return *Scn_Word(&p) == '\0';
+  }
+  if (!Scn_Op(w, &c->op))
+  {
+    return 0;
+  }
+  w = Scn_Word(&p);
+  if (!Scn_Number(w, &c->value) &&
+      !Scn_Lookup(symbols, sizeof(symbols) / sizeof(symbols[0]), w, &c->value))
+  {
+    return 0;
+  }
+
+  w = Scn_Word(&p);
+  c->kind = hold ? CHECK_HOLD : CHECK_AT;
+  if (*w == '\0')
+  {
+    return !hold;
+  }
+  if (strcmp(w, hold ? "for" : "within") != 0 || !Scn_Number(Scn_Word(&p), &ms) || ms < 0)
+  {
+    return 0;
+  }
+  if (!hold)
+  {
+    c->kind = CHECK_WITHIN;
+  }
+  c->window_ns = (uint64_t)ms * SIM_NS_PER_MS;
+  return *Scn_Word(&p) == '\0';
+}
+
+/* One statement after its time prefix. Returns 0 on a syntax error. */
+static int Scn_ParseAction(char *stmt, unsigned line, uint64_t t_ns, uint64_t *last_ns, long *duration_ms)
+{
+  char text[SCN_STMT_MAX];
+  char *p = stmt;
+  char *w;
+  uint16_t pin;
+  long n;
+
+  snprintf(text, sizeof(text), "%s", stmt);
+  w = Scn_Word(&p);
+
+  if (strcmp(w, "press") == 0 || strcmp(w, "release") == 0)
+  {
+    if (!Scn_Pin(Scn_Word(&p), &pin) || *Scn_Word(&p) != '\0')
+    {
+      return 0;
+    }
+    Sim_SchedulePin(t_ns, SIM_PORT_A, pin, (w[0] == 'p') ? 0 : -1);
+  }
+  else if (strcmp(w, "click") == 0)
+  {
+    if (!Scn_Pin(Scn_Word(&p), &pin))
+    {
+      return 0;
+    }
+    w = Scn_Word(&p);
+    n = SCN_CLICK_MS;
+    if (*w != '\0' && (!Scn_Number(w, &n) || n <= 0))
+    {
+      return 0;
+    }
+    Sim_SchedulePin(t_ns, SIM_PORT_A, pin, 0);
+    Sim_SchedulePin(t_ns + (uint64_t)n * SIM_NS_PER_MS, SIM_PORT_A, pin, -1);
+    t_ns += (uint64_t)n * SIM_NS_PER_MS;
+  }
+  else if (strcmp(w, "vdd") == 0)
+  {
+    if (!Scn_Number(Scn_Word(&p), &n) || n <= 0 || *Scn_Word(&p) != '\0')
+    {
+      return 0;
+    }
+    Sim_ScheduleVdd(t_ns, (uint32_t)n);
+  }
+  else if (strcmp(w, "console") == 0)
+  {
+    /* the stimulus queue keeps the pointer: the line buffer outlives the run */
+    Sim_ScheduleConsole(t_ns, Scn_Trim(p));
+  }
+  else if (strcmp(w, "hang") == 0)
+  {
+    Sim_ScheduleHang(t_ns);
+  }
+  else if (strcmp(w, "duration") == 0)
+  {
+    return Scn_Number(Scn_Word(&p), duration_ms) && *duration_ms > 0;
+  }
+  else if (strcmp(w, "expect") == 0 || strcmp(w, "hold") == 0)
+  {
+    scn_check_t *c;
+    if (check_count >= SCN_CHECKS_MAX)
+    {
+      return 0;
+    }
+    c = &checks[check_count];
+    memset(c, 0, sizeof(*c));
+    c->line = line;
+    c->start_ns = t_ns;
+    snprintf(c->text, sizeof(c->text), "%s", text);
+    if (!Scn_ParseCheck(p, c, w[0] == 'h'))
+    {
+      return 0;
+    }
+    check_count++;
+    t_ns += c->window_ns;
+  }
+  else
+  {
+    return 0;
+  }
+
+  if (t_ns > *last_ns)
+  {
+    *last_ns = t_ns;
+  }
+  return 1;
+}
+
+/* ---- Evaluation --------------------------------------------------------- */
+
+static long Scn_Read(const scn_check_t *c)
+{
+  uint8_t r, g, b;
+
+  switch (c->obs)
+  {
+  case OBS_MODE:
+    return (long)HBridge_GetMode();
+  case OBS_BRIGHTNESS:
+    return (long)HBridge_GetBrightness();
+  case OBS_RED:
+  case OBS_GREEN:
+  case OBS_BLUE:
+    Sim_GetLed(&r, &g, &b);
+    return (c->obs == OBS_RED) ? r : (c->obs == OBS_GREEN) ? g : b;
+  case OBS_VDD:
+    return (long)WS2812_Ctrl_GetVddMv();
+  case OBS_PIN:
+    return (long)Sim_GetPin(SIM_PORT_A, c->pin);
+  case OBS_RESET:
+    return (long)Sim_GetResetReason();
+  }
+  return 0;
+}
+
+static int Scn_Compare(scn_op_t op, long a, long b)
+{
+  switch (op)
+  {
+  case OP_EQ: return a == b;
+  case OP_NE: return a != b;
+  case OP_LT: return a < b;
+  case OP_LE: return a <= b;
+  case OP_GT: return a > b;
+  case OP_GE: return a >= b;
+  }
+  return 0;
+}
+
+static void Scn_Settle(scn_check_t *c, int8_t result, uint64_t t_ns)
+{
+  c->result = result;
+  c->at_ns = t_ns;
+}
+
+/* Called by the simulator on every virtual millisecond */
+static void Scn_Observe(uint64_t t_ns)
+{
+  for (unsigned i = 0; i < check_count; i++)
+  {
+    scn_check_t *c = &checks[i];
+    uint64_t close_ns = c->start_ns + c->window_ns;
+    long v;
+    int ok;
+
+    if (c->result != 0 || t_ns < c->start_ns)
+    {
+      continue;
+    }
+    v = Scn_Read(c);
+    ok = Scn_Compare(c->op, v, c->value);
+    if (!c->started)
+    {
+      c->started = 1;
+      c->first = v;
+      c->seen = v;
+    }
+
+    switch (c->kind)
+    {
+    case CHECK_AT:
+      Scn_Settle(c, ok ? 1 : -1, t_ns);
+      break;
+    case CHECK_WITHIN:
+      if (ok)
+      {
+        Scn_Settle(c, 1, t_ns);
+      }
+      else if (t_ns >= close_ns)
+      {
+        Scn_Settle(c, -1, t_ns);
+      }
+      break;
+    case CHECK_HOLD:
+      if (!ok)
+      {
+        Scn_Settle(c, -1, t_ns);
+      }
+      else if (t_ns >= close_ns)
+      {
+        Scn_Settle(c, 1, t_ns);
+      }
+      break;
+    case CHECK_RISING:
+    case CHECK_FALLING:
+      if ((c->kind == CHECK_RISING) ? (v < c->seen) : (v > c->seen))
+      {
+        Scn_Settle(c, -1, t_ns);
+      }
+      else if (t_ns >= close_ns)
+      {
+        ok = (c->kind == CHECK_RISING) ? (v > c->first) : (v < c->first);
+        Scn_Settle(c, ok ? 1 : -1, t_ns);
+      }
+      break;
+    }
+    c->seen = v;
+  }
+}
+
+/* Checks still open when the run ended (end of time or a reset) */
+static void Scn_Finish(uint64_t t_ns)
+{
+  for (unsigned i = 0; i < check_count; i++)
+  {
+    scn_check_t *c = &checks[i];
+    if (c->result != 0)
+    {
+      continue;
+    }
+    c->seen = Scn_Read(c);
+    if ((c->kind == CHECK_AT || c->kind == CHECK_WITHIN) && t_ns >= c->start_ns &&
+        Scn_Compare(c->op, c->seen, c->value))
+    {
+      Scn_Settle(c, 1, t_ns);
+    }
+    else
+    {
+      Scn_Settle(c, -1, t_ns);
+    }
+  }
+}
+
+static void Scn_Report(const char *name, uint64_t end_ns)
+{
+  unsigned failed = 0;
+
+  for (unsigned i = 0; i < check_count; i++)
+  {
+    failed += (checks[i].result < 0);
+  }
+  fprintf(stderr, "%s %s (%.0f ms virtual)\n", failed ? "FAIL" : "PASS", name,
+          (double)end_ns / SIM_NS_PER_MS);
+
+  for (unsigned i = 0; i < check_count; i++)
+  {
+    const scn_check_t *c = &checks[i];
+    double at_ms = (double)c->at_ns / SIM_NS_PER_MS;
+
+    fprintf(stderr, "  %4u: %-44s ", c->line, c->text);
+    if (c->result < 0)
+    {
+      fprintf(stderr, "FAILED at %.0f ms, saw %ld\n", at_ms, c->seen);
+    }
+    else if (c->kind == CHECK_WITHIN)
+    {
+      /* slack left in the window: what a timing change may eat before it fails */
+      fprintf(stderr, "ok at %.0f ms, margin %.0f ms\n", at_ms,
+              (double)(c->start_ns + c->window_ns - c->at_ns) / SIM_NS_PER_MS);
+    }
+    else if (c->kind == CHECK_RISING || c->kind == CHECK_FALLING)
+    {
+      fprintf(stderr, "ok %ld -> %ld\n", c->first, c->seen);
+    }
+    else
+    {
+      fprintf(stderr, "ok\n");
+    }
+  }
+}
+
+/* Child side: schedule the block, run it, report on stderr */
+static int Scn_RunBlock(char **lines, const scn_block_t *blk, int (*entry)(void))
+{
+  uint64_t t_ns = 0;
+  uint64_t last_ns = 0;
+  long duration_ms = 0;
+  int reason;
+
+  Sim_Init(NULL);
+
+  for (unsigned ln = blk->first_line + 1U; ln < blk->end_line; ln++)
+  {
+    char *save;
+    for (char *stmt = strtok_r(lines[ln], ";", &save); stmt; stmt = strtok_r(NULL, ";", &save))
+    {
+      stmt = Scn_Trim(stmt);
+      if (*stmt == '\0')
+      {
+        continue;
+      }
+      if (strncmp(stmt, "t=", 2) == 0)
+      {
+        char *end;
+        int rel = (stmt[2] == '+');
+        unsigned long ms = strtoul(stmt + 2 + rel, &end, 10);
+        if (end == stmt + 2 + rel || (*end != ' ' && *end != '\t'))
+        {
+          fprintf(stderr, "FAIL %s\n  %4u: syntax error: %s\n", blk->name, ln + 1U, stmt);
+          return 1;
+        }
+        t_ns = (rel ? t_ns : 0) + (uint64_t)ms * SIM_NS_PER_MS;
+        stmt = Scn_Trim(end);
+      }
+      if (!Scn_ParseAction(stmt, ln + 1U, t_ns, &last_ns, &duration_ms))
+      {
+        fprintf(stderr, "FAIL %s\n  %4u: syntax error: %s\n", blk->name, ln + 1U, stmt);
+        return 1;
+      }
+    }
+  }
+
+  if (duration_ms == 0)
+  {
+    duration_ms = (long)(last_ns / SIM_NS_PER_MS) + SCN_TAIL_MS;
+  }
+  Sim_SetObserver(Scn_Observe);
+  reason = Sim_Run(entry, (uint64_t)duration_ms * SIM_NS_PER_MS);
+  (void)reason;
+  Scn_Finish(Sim_Now());
+  Scn_Report(blk->name, Sim_Now());
+
+  for (unsigned i = 0; i < check_count; i++)
+  {
+    if (checks[i].result < 0)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* ---- Runner ------------------------------------------------------------- */
+
+static double Scn_WallMs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+}
+
+/* Copies the child's report through in start order and reaps it */
+static int Scn_Collect(scn_job_t *job)
+{
+  char buf[512];
+  ssize_t n;
+  int status;
+
+  while ((n = read(job->fd, buf, sizeof(buf))) > 0)
+  {
+    fwrite(buf, 1, (size_t)n, stderr);
+  }
+  close(job->fd);
+  waitpid(job->pid, &status, 0);
+  if (WIFSIGNALED(status))
+  {
+    fprintf(stderr, "  crashed: signal %d\n", WTERMSIG(status));
+    return 1;
+  }
+  return WEXITSTATUS(status) != 0;
+}
+
+static int Scn_Start(scn_job_t *job, char **lines, const scn_block_t *blk, int quiet, int (*entry)(void))
+{
+  int fds[2];
+
+  fflush(stdout);
+  fflush(stderr);
+  if (pipe(fds) != 0 || (job->pid = fork()) < 0)
+  {
+    perror("sim: scenario");
+    return 0;
+  }
+  if (job->pid == 0)
+  {
+    close(fds[0]);
+    dup2(fds[1], STDERR_FILENO);
+    close(fds[1]);
+    if (quiet && freopen("/dev/null", "w", stdout) == NULL)
+    {
+      _exit(1);
+    }
+    int rc = Scn_RunBlock(lines, blk, entry);
+    fflush(stdout);
+    fflush(stderr);
+    _exit(rc);
+  }
+  close(fds[1]);
+  job->fd = fds[0];
+  return 1;
+}
+
+/* Splits the file into lines and finds the scenario ... end blocks */
+static char *Scn_Load(const char *path, char ***lines_out, scn_block_t **blocks_out, unsigned *count_out)
+{
+  FILE *f = fopen(path, "rb");
+  char *text;
+  char **lines;
+  scn_block_t *blocks;
+  long size;
+  unsigned nlines = 0;
+  unsigned count = 0;
+  int open_block = 0;
+
+  if (f == NULL || fseek(f, 0, SEEK_END) != 0 || (size = ftell(f)) < 0)
+  {
+    fprintf(stderr, "sim: cannot read %s\n", path);
+    return NULL;
+  }
+  rewind(f);
+  text = malloc((size_t)size + 1U);
+  if (fread(text, 1, (size_t)size, f) != (size_t)size)
+  {
+    fprintf(stderr, "sim: cannot read %s\n", path);
+    return NULL;
+  }
+  fclose(f);
+  text[size] = '\0';
+
+  lines = malloc(((size_t)size + 2U) * sizeof(char *));
+  blocks = malloc(((size_t)size / 2U + 1U) * sizeof(scn_block_t));
+  for (char *p = text; p; nlines++)
+  {
+    char *nl = strchr(p, '\n');
+    char *hash;
+    lines[nlines] = p;
+    if (nl)
+    {
+      *nl = '\0';
+    }
+    hash = strchr(p, '#');
+    if (hash)
+    {
+      *hash = '\0';
+    }
+    p = nl ? nl + 1 : NULL;
+  }
+
+  for (unsigned i = 0; i < nlines; i++)
+  {
+    char *s = Scn_Trim(lines[i]);
+    if (strncmp(s, "scenario ", 9) == 0 && !open_block)
+    {
+      blocks[count].name = Scn_Trim(s + 9);
+      blocks[count].first_line = i;
+      open_block = 1;
+    }
+    else if (strcmp(s, "end") == 0 && open_block)
+    {
+      blocks[count++].end_line = i;
+      open_block = 0;
+    }
+    else if (*s != '\0' && !open_block)
+    {
+      fprintf(stderr, "%s:%u: statement outside a scenario block\n", path, i + 1U);
+      return NULL;
+    }
+    lines[i] = s;
+  }
+  if (open_block)
+  {
+    fprintf(stderr, "%s: scenario %s has no end\n", path, blocks[count].name);
+    return NULL;
+  }
+
+  *lines_out = lines;
+  *blocks_out = blocks;
+  *count_out = count;
+  return text;
+}
+
+int SimScenario_RunFile(const char *path, const char *name, unsigned jobs, int (*entry)(void))
+{
+  scn_job_t queue[SCN_JOBS_MAX];
+  char **lines;
+  scn_block_t *blocks;
+  unsigned count;
+  unsigned head = 0, inflight = 0, run = 0;
+  int failed = 0;
+  double wall_start = Scn_WallMs();
+
+  if (Scn_Load(path, &lines, &blocks, &count) == NULL)
+  {
+    return 1;
+  }
+  if (jobs == 0U || jobs > SCN_JOBS_MAX)
+  {
+    jobs = (jobs == 0U) ? 1U : SCN_JOBS_MAX;
+  }
+
+  for (unsigned i = 0; i < count; i++)
+  {
+    if (name && strcmp(name, blocks[i].name) != 0)
+    {
+      continue;
+    }
+    if (inflight == jobs)
+    {
+      failed += Scn_Collect(&queue[head]);
+      head = (head + 1U) % jobs;
+      inflight--;
+    }
+    /* RTT output only makes sense when a single scenario is picked */
+    if (!Scn_Start(&queue[(head + inflight) % jobs], lines, &blocks[i], name == NULL, entry))
+    {
+      failed++;
+      break;
+    }
+    inflight++;
+    run++;
+  }
+  while (inflight > 0U)
+  {
+    failed += Scn_Collect(&queue[head]);
+    head = (head + 1U) % jobs;
+    inflight--;
+  }
+
+  double wall_ms = Scn_WallMs() - wall_start;
+  fprintf(stderr, "\n--- scenarios ---\n%u run, %u passed, %d failed in %.1f ms (%.0f/s)\n",
+          run, run - (unsigned)failed, failed, wall_ms, wall_ms > 0.0 ? run * 1000.0 / wall_ms : 0.0);
+  if (name && run == 0U)
+  {
+    fprintf(stderr, "sim: no scenario named %s in %s\n", name, path);
+    return 1;
+  }
+  return failed;
+}
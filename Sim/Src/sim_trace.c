@@ -0,0 +1,436 @@
+/*
+ * Virtual logic analyser for the host simulation build.
+ *
+ * Records every transition on the board's named pins with its virtual
+ * timestamp, exports VCD for GTKWave and derives the numbers we tune
+ * against: effective duty, flicker spectrum of the LED driver enable and
+ * break-before-make gaps on the H-bridge inputs.
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "py32f0xx_hal.h"
+#include "sim_hal.h"
+#include "sim_trace.h"
+
+#define TRACE_SPECTRUM_FS     8192U  /* Hz, box-averaged light samples */
+#define TRACE_SPECTRUM_MIN_N  64U
+#define TRACE_SPECTRUM_PEAKS  5U
+#define TRACE_PEAK_FLOOR_PCT  0.1
+
+typedef struct
+{
+  uint8_t port;
+  uint16_t pin;
+  const char *name;
+} trace_signal_t;
+
+typedef struct
+{
+  uint64_t t;
+  uint8_t sig;
+  uint8_t level;
+} trace_edge_t;
+
+/* Board pin map, see hbridge.c, button_ctrl.c and ws2812_config.h */
+static const trace_signal_t signals[] =
+{
+  { SIM_PORT_A, GPIO_PIN_0, "nslp" },
+  { SIM_PORT_A, GPIO_PIN_1, "in1" },
+  { SIM_PORT_A, GPIO_PIN_2, "in2" },
+  { SIM_PORT_A, GPIO_PIN_4, "ctrl" },
+  { SIM_PORT_A, GPIO_PIN_5, "sw2" },
+  { SIM_PORT_A, GPIO_PIN_6, "sw1" },
+  { SIM_PORT_B, GPIO_PIN_0, "ws2812" },
+};
+
+#define TRACE_NUM_SIGNALS  (sizeof(signals) / sizeof(signals[0]))
+#define SIG_IN1   1U
+#define SIG_IN2   2U
+#define SIG_CTRL  3U
+
+static uint8_t enabled;
+static uint8_t level_now[TRACE_NUM_SIGNALS];
+static trace_edge_t *edges;
+static size_t edge_count;
+static size_t edge_cap;
+
+void SimTrace_Enable(void)
+{
+  enabled = 1;
+}
+
+uint8_t SimTrace_Enabled(void)
+{
+  return enabled;
+}
+
+void SimTrace_Edge(uint64_t t_ns, uint8_t port, uint16_t pin, uint8_t level)
+{
+  if (!enabled)
+  {
+    return;
+  }
+
+  for (uint8_t i = 0; i < TRACE_NUM_SIGNALS; i++)
+  {
+    if (signals[i].port != port || signals[i].pin != pin || level_now[i] == level)
+    {
+      continue;
+    }
+    if (edge_count == edge_cap)
+    {
+      edge_cap = edge_cap ? edge_cap * 2U : 65536U;
+      edges = realloc(edges, edge_cap * sizeof(*edges));
+      if (edges == NULL)
+      {
+        fprintf(stderr, "sim: out of memory for trace\n");
+        exit(1);
+      }
+    }
+    edges[edge_count].t = t_ns;
+    edges[edge_count].sig = i;
+    edges[edge_count].level = level;
+    edge_count++;
+    level_now[i] = level;
+    return;
+  }
+}
+
+/* ---- VCD export --------------------------------------------------------- */
+
+int SimTrace_WriteVcd(const char *path, uint64_t end_ns)
+{
+  FILE *f = fopen(path, "w");
+  if (f == NULL)
+  {
+    return -1;
+  }
+
+  fprintf(f, "$version py32f002a host simulation $end\n");
+  fprintf(f, "$timescale 1ns $end\n");
+  fprintf(f, "$scope module board $end\n");
+  for (size_t i = 0; i < TRACE_NUM_SIGNALS; i++)
+  {
+    fprintf(f, "$var wire 1 %c %s $end\n", (char)('!' + i), signals[i].name);
+  }
+  fprintf(f, "$upscope $end\n$enddefinitions $end\n");
+
+  /* All pins come out of reset low */
+  fprintf(f, "#0\n$dumpvars\n");
+  for (size_t i = 0; i < TRACE_NUM_SIGNALS; i++)
+  {
+    fprintf(f, "0%c\n", (char)('!' + i));
+  }
+  fprintf(f, "$end\n");
+
+  uint64_t last_t = 0;
+  for (size_t i = 0; i < edge_count; i++)
+  {
+    if (edges[i].t != last_t)
+    {
+      fprintf(f, "#%llu\n", (unsigned long long)edges[i].t);
+      last_t = edges[i].t;
+    }
+    fprintf(f, "%u%c\n", edges[i].level, (char)('!' + edges[i].sig));
+  }
+  if (end_ns > last_t)
+  {
+    fprintf(f, "#%llu\n", (unsigned long long)end_ns);
+  }
+
+  fclose(f);
+  return 0;
+}
+
+/* ---- Duty and pulse widths ---------------------------------------------- */
+
+typedef struct
+{
+  uint64_t high_ns;
+  uint64_t edges;
+  uint64_t min_high_ns;
+  uint64_t min_low_ns;
+} trace_duty_t;
+
+static void SimTrace_Duty(uint64_t from_ns, uint64_t end_ns, trace_duty_t *duty)
+{
+  uint8_t level[TRACE_NUM_SIGNALS] = {0};
+  uint64_t since[TRACE_NUM_SIGNALS] = {0};
+
+  memset(duty, 0, sizeof(trace_duty_t) * TRACE_NUM_SIGNALS);
+  for (size_t i = 0; i < edge_count && edges[i].t < end_ns; i++)
+  {
+    const trace_edge_t *e = &edges[i];
+    trace_duty_t *d = &duty[e->sig];
+    uint64_t start = since[e->sig];
+
+    if (e->t > from_ns)
+    {
+      uint64_t width = e->t - start;
+      if (level[e->sig])
+      {
+        d->high_ns += e->t - (start > from_ns ? start : from_ns);
+      }
+      /* Only pulses fully inside the window count towards the minimum */
+      if (start >= from_ns && start > 0)
+      {
+        uint64_t *min = level[e->sig] ? &d->min_high_ns : &d->min_low_ns;
+        if (*min == 0 || width < *min) *min = width;
+      }
+      d->edges++;
+    }
+    level[e->sig] = e->level;
+    since[e->sig] = e->t;
+  }
+
+  for (size_t s = 0; s < TRACE_NUM_SIGNALS; s++)
+  {
+    if (level[s])
+    {
+      duty[s].high_ns += end_ns - (since[s] > from_ns ? since[s] : from_ns);
+    }
+  }
+}
+
+/* ---- Flicker ------------------------------------------------------------ */
+
+static void SimTrace_Fft(double *re, double *im, size_t n)
+{
+  for (size_t i = 1, j = 0; i < n; i++)
+  {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j |= bit;
+    if (i < j)
+    {
+      double t = re[i]; re[i] = re[j]; re[j] = t;
+      t = im[i]; im[i] = im[j]; im[j] = t;
+    }
+  }
+
+  for (size_t len = 2; len <= n; len <<= 1)
+  {
+    double ang = -2.0 * M_PI / (double)len;
+    double wr = cos(ang), wi = sin(ang);
+    for (size_t i = 0; i < n; i += len)
+    {
+      double cr = 1.0, ci = 0.0;
+      for (size_t k = 0; k < len / 2U; k++)
+      {
+        size_t a = i + k, b = i + k + len / 2U;
+        double tr = re[b] * cr - im[b] * ci;
+        double ti = re[b] * ci + im[b] * cr;
+        re[b] = re[a] - tr; im[b] = im[a] - ti;
+        re[a] += tr; im[a] += ti;
+        double nr = cr * wr - ci * wi;
+        ci = cr * wi + ci * wr;
+        cr = nr;
+      }
+    }
+  }
+}
+
+/* Light output as seen by the eye: ctrl high time averaged per sample bin */
+static size_t SimTrace_SampleLight(uint8_t sig, uint64_t from_ns, uint64_t end_ns, double **out)
+{
+  double bin_ns = 1e9 / TRACE_SPECTRUM_FS;
+  size_t bins = (size_t)((double)(end_ns - from_ns) / bin_ns);
+  size_t n = 1;
+
+  while (n * 2U <= bins) n *= 2U;
+  if (bins < TRACE_SPECTRUM_MIN_N)
+  {
+    return 0;
+  }
+
+  double *x = calloc(n, sizeof(double));
+  uint8_t level = 0;
+  uint64_t since = 0;
+  double win_end = (double)from_ns + bin_ns * (double)n;
+
+  for (size_t i = 0; i <= edge_count; i++)
+  {
+    uint64_t t = (i < edge_count) ? edges[i].t : (uint64_t)win_end;
+    if (i < edge_count && edges[i].sig != sig)
+    {
+      continue;
+    }
+    if (level)
+    {
+      double a = (double)(since > from_ns ? since : from_ns) - (double)from_ns;
+      double b = ((double)t < win_end ? (double)t : win_end) - (double)from_ns;
+      while (a < b)
+      {
+        size_t k = (size_t)(a / bin_ns);
+        double edge = (double)(k + 1U) * bin_ns;
+        double stop = b < edge ? b : edge;
+        if (k < n) x[k] += (stop - a) / bin_ns;
+        a = stop;
+      }
+    }
+    if (i == edge_count || (double)t >= win_end)
+    {
+      break;
+    }
+    level = edges[i].level;
+    since = t;
+  }
+
+  *out = x;
+  return n;
+}
+
+static void SimTrace_Flicker(FILE *out, uint8_t sig, uint64_t from_ns, uint64_t end_ns)
+{
+  double *x;
+  size_t n = SimTrace_SampleLight(sig, from_ns, end_ns, &x);
+  if (n == 0)
+  {
+    fprintf(out, "flicker        : window too short\n");
+    return;
+  }
+
+  double mean = 0.0, max = 0.0, min = 1.0, above = 0.0;
+  for (size_t i = 0; i < n; i++)
+  {
+    mean += x[i];
+    if (x[i] > max) max = x[i];
+    if (x[i] < min) min = x[i];
+  }
+  mean /= (double)n;
+  for (size_t i = 0; i < n; i++)
+  {
+    if (x[i] > mean) above += x[i] - mean;
+  }
+
+  fprintf(out, "flicker %-6s : %.1f%% modulation, index %.4f (%u Hz samples, %zu bins)\n",
+          signals[sig].name,
+          (max + min) > 0.0 ? 100.0 * (max - min) / (max + min) : 0.0,
+          mean > 0.0 ? above / (mean * (double)n) : 0.0,
+          TRACE_SPECTRUM_FS, n);
+
+  double *im = calloc(n, sizeof(double));
+  SimTrace_Fft(x, im, n);
+
+  /* Strongest local maxima, amplitude relative to the mean level */
+  double mag_dc = x[0] / (double)n;
+  size_t peaks[TRACE_SPECTRUM_PEAKS] = {0};
+  double peak_pct[TRACE_SPECTRUM_PEAKS] = {0};
+  double prev = 0.0, cur = 0.0;
+  for (size_t k = 1; k < n / 2U; k++)
+  {
+    double next = 2.0 * hypot(x[k + 1U], im[k + 1U]) / (double)n;
+    cur = 2.0 * hypot(x[k], im[k]) / (double)n;
+    if (cur > prev && cur >= next && mag_dc > 0.0)
+    {
+      double pct = 100.0 * cur / mag_dc;
+      for (size_t p = 0; p < TRACE_SPECTRUM_PEAKS; p++)
+      {
+        if (pct > peak_pct[p])
+        {
+          memmove(&peaks[p + 1U], &peaks[p], (TRACE_SPECTRUM_PEAKS - 1U - p) * sizeof(size_t));
+          memmove(&peak_pct[p + 1U], &peak_pct[p], (TRACE_SPECTRUM_PEAKS - 1U - p) * sizeof(double));
+          peaks[p] = k;
+          peak_pct[p] = pct;
+          break;
+        }
+      }
+    }
+    prev = cur;
+  }
+
+  for (size_t p = 0; p < TRACE_SPECTRUM_PEAKS && peak_pct[p] >= TRACE_PEAK_FLOOR_PCT; p++)
+  {
+    fprintf(out, "  %9.2f Hz  %6.2f%%\n",
+            (double)peaks[p] * TRACE_SPECTRUM_FS / (double)n, peak_pct[p]);
+  }
+
+  free(im);
+  free(x);
+}
+
+/* ---- Break-before-make -------------------------------------------------- */
+
+static void SimTrace_BreakBeforeMake(FILE *out, uint64_t from_ns, uint64_t end_ns)
+{
+  uint8_t level[TRACE_NUM_SIGNALS] = {0};
+  uint64_t fell[TRACE_NUM_SIGNALS] = {0};
+  uint64_t rose[TRACE_NUM_SIGNALS] = {0};
+  uint64_t switches = 0, overlaps = 0, hot = 0;
+  uint64_t min_gap = UINT64_MAX;
+
+  for (size_t i = 0; i < edge_count && edges[i].t < end_ns; i++)
+  {
+    const trace_edge_t *e = &edges[i];
+    uint8_t in_window = (e->t >= from_ns);
+
+    if (e->sig == SIG_IN1 || e->sig == SIG_IN2)
+    {
+      uint8_t other = (e->sig == SIG_IN1) ? SIG_IN2 : SIG_IN1;
+      if (in_window && level[SIG_CTRL])
+      {
+        hot++; /* input changed with the LED driver enabled */
+      }
+      if (in_window && e->level)
+      {
+        if (level[other])
+        {
+          overlaps++;
+        }
+        else if (rose[other] > rose[e->sig] && fell[other] >= rose[other])
+        {
+          /* Direction change: the other input was the last one driven */
+          uint64_t gap = e->t - fell[other];
+          switches++;
+          if (gap < min_gap) min_gap = gap;
+        }
+      }
+      if (e->level) rose[e->sig] = e->t;
+      else fell[e->sig] = e->t;
+    }
+    level[e->sig] = e->level;
+  }
+
+  fprintf(out, "break-before-make in1/in2: %llu direction changes", (unsigned long long)switches);
+  if (switches)
+  {
+    fprintf(out, ", min gap %.3f ms", (double)min_gap / SIM_NS_PER_MS);
+  }
+  fprintf(out, ", %llu overlaps, %llu switched with ctrl high\n",
+          (unsigned long long)overlaps, (unsigned long long)hot);
+}
+
+void SimTrace_Report(FILE *out, uint64_t from_ns, uint64_t end_ns)
+{
+  trace_duty_t duty[TRACE_NUM_SIGNALS];
+  uint64_t window = end_ns - from_ns;
+
+  if (!enabled || end_ns <= from_ns)
+  {
+    return;
+  }
+
+  fprintf(out, "--- trace %.3f .. %.3f ms, %zu edges ---\n",
+          (double)from_ns / SIM_NS_PER_MS, (double)end_ns / SIM_NS_PER_MS, edge_count);
+  SimTrace_Duty(from_ns, end_ns, duty);
+  for (size_t s = 0; s < TRACE_NUM_SIGNALS; s++)
+  {
+    fprintf(out, "%-7s duty %7.3f%%  edges %-8llu", signals[s].name,
+            100.0 * (double)duty[s].high_ns / (double)window,
+            (unsigned long long)duty[s].edges);
+    if (duty[s].min_high_ns)
+    {
+      fprintf(out, "  min high %.3f us", (double)duty[s].min_high_ns / SIM_NS_PER_US);
+    }
+    if (duty[s].min_low_ns)
+    {
+      fprintf(out, "  min low %.3f us", (double)duty[s].min_low_ns / SIM_NS_PER_US);
+    }
+    fprintf(out, "\n");
+  }
+
+  SimTrace_Flicker(out, SIG_CTRL, from_ns, end_ns);
+  SimTrace_BreakBeforeMake(out, from_ns, end_ns);
+}
@@ -2,14 +2,16 @@
 #include "py32f0xx_hal.h"
 #include "hbridge.h"
 #include "ws2812_ctrl.h"
+#include "supervisor.h"
+#include "params.h"
 
 #define BTN1_PORT GPIOA
 #define BTN1_PIN  GPIO_PIN_6 /* SW1 */
 #define BTN2_PORT GPIOA
 #define BTN2_PIN  GPIO_PIN_5 /* SW2 (safety) */
 
-#define BTN_DEBOUNCE_MS       25U
-#define DOUBLE_CLICK_MS       400U
+#define BTN_DEBOUNCE_MS       PARAM(PARAM_BTN_DEBOUNCE_MS)
+#define DOUBLE_CLICK_MS       PARAM(PARAM_DOUBLE_CLICK_MS)
 #define LONG_PRESS_MS_SW1     1000U
 #define LONG_PRESS_MS_SW2     800U
 #define BR_STEP_MS        75U   /* brightness step interval during long hold (smoothed +50%) */
@@ -108,6 +110,13 @@ static void Handle_Btn1_LongEnd(void)
   HBridge_SaveBrightness(); /* persist last value */
 }
 
+/* SW1 clicked while SW2 is held: step the indicator dimming and show it */
+static void Handle_Btn1_WithBtn2(void)
+{
+  WS2812_Ctrl_StepDimLevel();
+  WS2812_Ctrl_RequestBatteryIndication(BATT_INDICATE_MS);
+}
+
 static void Handle_Btn1_Single(void)
 {
   hbridge_mode_t mode = HBridge_GetMode();
@@ -162,6 +171,8 @@ void ButtonCtrl_Task(void)
 {
   uint32_t now = HAL_GetTick();
 
+  Supervisor_CheckIn(SUPERVISOR_BUTTON);
+
   uint8_t raw1 = HAL_GPIO_ReadPin(BTN1_PORT, BTN1_PIN);
   uint8_t raw2 = HAL_GPIO_ReadPin(BTN2_PORT, BTN2_PIN);
 
@@ -186,6 +197,12 @@ void ButtonCtrl_Task(void)
       Handle_Btn1_LongEnd();
       btn1.long_fired = 0;
     }
+    else if (btn2.stable == GPIO_PIN_RESET)
+    {
+      /* chord, not a click: the light stays as it is */
+      Handle_Btn1_WithBtn2();
+      btn1_single_pending = 0;
+    }
     else
     {
       /* release of short press -> start or complete click combo */
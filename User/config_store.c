@@ -0,0 +1,210 @@
+#include "config_store.h"
+#include "py32f0xx_hal.h"
+#include "py32f0xx_hal_flash.h"
+#include "py32f0xx_hal_flash_ex.h"
+
+#define CONFIG_MAGIC      0xBEEFCAFEUL
+#define CONFIG_PAGE_ADDR  0x08004C00UL /* aligned page near end of 20KB flash */
+
+/* Emergency slot: the following page is kept erased so a single field can be
+   recorded on brown-out with one program cycle and no erase. */
+#define SLOT_MAGIC        0x5AFE5AFEUL
+#define SLOT_PAGE_ADDR    (CONFIG_PAGE_ADDR + FLASH_PAGE_SIZE)
+
+static volatile uint8_t erase_locked = 0;
+
+static uint8_t ConfigStore_PageBlank(uint32_t addr)
+{
+  const uint32_t *p = (const uint32_t *)addr;
+  for (uint32_t i = 0; i < CONFIG_WORDS; i++)
+  {
+    if (p[i] != CONFIG_UNSET)
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void ConfigStore_ErasePage(uint32_t addr)
+{
+  FLASH_EraseInitTypeDef erase = {0};
+  uint32_t page_error = 0;
+  erase.TypeErase = FLASH_TYPEERASE_PAGEERASE;
+  erase.PageAddress = addr;
+  erase.NbPages = 1;
+  HAL_FLASHEx_Erase(&erase, &page_error);
+}
+
+/* Unlock the flash unless the brown-out lock is set. The lock is tested with
+   IRQs masked: a watchdog IRQ after the test finds the flash unlocked and
+   backs off in EmergencyWrite. Returns 0 if the flash stays locked. */
+static uint8_t ConfigStore_Unlock(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint8_t ok;
+
+  __disable_irq();
+  ok = !erase_locked;
+  if (ok)
+  {
+    HAL_FLASH_Unlock();
+  }
+  if (!primask) __enable_irq();
+  return ok;
+}
+
+/* Rewrite the config page from page_buf and return the slot to erased state.
+   Returns 0 if the supply dropped before the erase. */
+static uint8_t ConfigStore_Commit(uint32_t *page_buf)
+{
+  page_buf[CONFIG_MAGIC_WORD] = CONFIG_MAGIC;
+
+  if (!ConfigStore_Unlock())
+  {
+    return 0;
+  }
+
+  ConfigStore_ErasePage(CONFIG_PAGE_ADDR);
+  HAL_FLASH_Program(FLASH_TYPEPROGRAM_PAGE, CONFIG_PAGE_ADDR, page_buf);
+
+  /* the slot is only a copy now; if Vdd sagged meanwhile, leave it to Flush */
+  if (!erase_locked && !ConfigStore_PageBlank(SLOT_PAGE_ADDR))
+  {
+    ConfigStore_ErasePage(SLOT_PAGE_ADDR);
+  }
+
+  HAL_FLASH_Lock();
+  return 1;
+}
+
+/* Snapshot of all fields, with a pending emergency record folded in */
+static void ConfigStore_Snapshot(uint32_t *page_buf)
+{
+  for (uint32_t i = 0; i < CONFIG_WORDS; i++)
+  {
+    page_buf[i] = ConfigStore_Read((config_field_t)i);
+  }
+}
+
+uint32_t ConfigStore_Read(config_field_t field)
+{
+  const uint32_t *p = (const uint32_t *)CONFIG_PAGE_ADDR;
+  const uint32_t *slot = (const uint32_t *)SLOT_PAGE_ADDR;
+  if (field == CONFIG_MAGIC_WORD || field >= CONFIG_WORDS)
+  {
+    return CONFIG_UNSET;
+  }
+
+  /* an emergency record is newer than the page it shadows */
+  if (slot[0] == SLOT_MAGIC && slot[1] == (uint32_t)field)
+  {
+    return slot[2];
+  }
+
+  if (p[CONFIG_MAGIC_WORD] != CONFIG_MAGIC)
+  {
+    return CONFIG_UNSET;
+  }
+  return p[field];
+}
+
+void ConfigStore_Write(config_field_t field, uint32_t value)
+{
+  uint32_t page_buf[CONFIG_WORDS]; /* 32 * 4 = 128 bytes */
+
+  if (field == CONFIG_MAGIC_WORD || field >= CONFIG_WORDS || erase_locked)
+  {
+    return;
+  }
+
+  /* skip the erase cycle when nothing changes */
+  if (ConfigStore_Read(field) == value && ConfigStore_PageBlank(SLOT_PAGE_ADDR))
+  {
+    return;
+  }
+
+  /* read-modify-write so other settings in the page survive */
+  ConfigStore_Snapshot(page_buf);
+  page_buf[field] = value;
+  ConfigStore_Commit(page_buf);
+}
+
+/* Several consecutive fields in one erase cycle. Returns 0 if refused */
+uint8_t ConfigStore_WriteBlock(config_field_t first, const uint32_t *values, uint32_t count)
+{
+  uint32_t page_buf[CONFIG_WORDS];
+  uint8_t changed = 0;
+
+  if (first == CONFIG_MAGIC_WORD || (uint32_t)first + count > CONFIG_WORDS || erase_locked)
+  {
+    return 0;
+  }
+
+  ConfigStore_Snapshot(page_buf);
+  for (uint32_t i = 0; i < count; i++)
+  {
+    changed |= (page_buf[first + i] != values[i]);
+    page_buf[first + i] = values[i];
+  }
+  if (changed || !ConfigStore_PageBlank(SLOT_PAGE_ADDR))
+  {
+    return ConfigStore_Commit(page_buf);
+  }
+  return 1;
+}
+
+/* Folds a pending emergency record into the page and re-arms the slot */
+void ConfigStore_Flush(void)
+{
+  uint32_t page_buf[CONFIG_WORDS];
+
+  if (erase_locked || ConfigStore_PageBlank(SLOT_PAGE_ADDR))
+  {
+    return;
+  }
+
+  ConfigStore_Snapshot(page_buf);
+  ConfigStore_Commit(page_buf);
+}
+
+/* While locked (supply too low for a safe erase) Write and Flush are no-ops */
+void ConfigStore_SetEraseLock(uint8_t lock)
+{
+  erase_locked = lock ? 1U : 0U;
+}
+
+/* IRQ-safe brown-out path: one page program into the pre-erased slot.
+   Returns 0 if the slot is already used or the flash is busy. */
+uint8_t ConfigStore_EmergencyWrite(config_field_t field, uint32_t value)
+{
+  uint32_t slot_buf[CONFIG_WORDS];
+
+  erase_locked = 1;
+
+  if (field == CONFIG_MAGIC_WORD || field >= CONFIG_WORDS ||
+      !ConfigStore_PageBlank(SLOT_PAGE_ADDR))
+  {
+    return 0;
+  }
+
+  /* flash unlocked means the interrupted code is mid erase/program */
+  if (READ_BIT(FLASH->CR, FLASH_CR_LOCK) == 0U)
+  {
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < CONFIG_WORDS; i++)
+  {
+    slot_buf[i] = CONFIG_UNSET;
+  }
+  slot_buf[0] = SLOT_MAGIC;
+  slot_buf[1] = (uint32_t)field;
+  slot_buf[2] = value;
+
+  HAL_FLASH_Unlock();
+  HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_PAGE, SLOT_PAGE_ADDR, slot_buf);
+  HAL_FLASH_Lock();
+
+  return (status == HAL_OK) ? 1U : 0U;
+}
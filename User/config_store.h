@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Word index of each persistent setting inside the 128-byte config page.
+   Word 0 holds the magic; unwritten words read back as CONFIG_UNSET. */
+typedef enum
+{
+  CONFIG_MAGIC_WORD = 0,
+  CONFIG_BRIGHTNESS,      /* H-bridge brightness, % */
+  CONFIG_VREF_SCALE,      /* Vdd[mV] * Vrefint raw counts measured at calibration */
+  CONFIG_WS_DIM,          /* WS2812 indicator dimming level (right shift) */
+  CONFIG_HANG_RESETS,     /* watchdog resets after a task stopped checking in */
+  CONFIG_FAULT_RESETS,    /* watchdog resets forced by the HardFault handler */
+  CONFIG_PARAMS,          /* first of the console-tuned values (params.h) */
+  CONFIG_PARAMS_LAST = CONFIG_PARAMS + 11,
+  CONFIG_WORDS = 32
+} config_field_t;
+
+#define CONFIG_UNSET 0xFFFFFFFFUL
+
+uint32_t ConfigStore_Read(config_field_t field);
+void ConfigStore_Write(config_field_t field, uint32_t value);
+uint8_t ConfigStore_WriteBlock(config_field_t first, const uint32_t *values, uint32_t count);
+void ConfigStore_Flush(void);
+void ConfigStore_SetEraseLock(uint8_t lock);
+uint8_t ConfigStore_EmergencyWrite(config_field_t field, uint32_t value);
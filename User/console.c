@@ -0,0 +1,235 @@
+#include "console.h"
+#include "SEGGER_RTT.h"
+#include "ws2812_ctrl.h"
+#include "ram_watermark.h"
+#include "params.h"
+
+/* Line-oriented command reader on RTT down-channel 0.
+   Commands:
+     vdd          print the filtered supply voltage
+     cal <mV>     measure Vrefint against a known supply and store the trim
+     mem          print the stack and heap high-water marks
+     get [name]   print one tunable parameter, or all of them
+     set <name> <value>  change a parameter until reset
+     save         store all parameters in the config page */
+
+#define CONSOLE_LINE_MAX  32U
+
+typedef struct
+{
+  const char *name;
+  void (*handler)(const char *args);
+} console_cmd_t;
+
+static char line[CONSOLE_LINE_MAX];
+static uint8_t line_len = 0;
+static uint8_t line_overflow = 0; /* rest of the line dropped: never run a prefix */
+
+static const char *Console_SkipSpaces(const char *s)
+{
+  while (*s == ' ')
+  {
+    s++;
+  }
+  return s;
+}
+
+/* Parses a decimal number, returns 0 if no digits or trailing garbage */
+static uint8_t Console_ParseU32(const char *s, uint32_t *out)
+{
+  uint32_t val = 0;
+  s = Console_SkipSpaces(s);
+  if (*s < '0' || *s > '9')
+  {
+    return 0;
+  }
+  while (*s >= '0' && *s <= '9')
+  {
+    if (val > 0x19999998UL) /* would overflow on the next digit */
+    {
+      return 0;
+    }
+    val = val * 10U + (uint32_t)(*s - '0');
+    s++;
+  }
+  if (*Console_SkipSpaces(s) != '\0')
+  {
+    return 0;
+  }
+  *out = val;
+  return 1;
+}
+
+static void Cmd_Vdd(const char *args)
+{
+  (void)args;
+  SEGGER_RTT_printf(0, "vdd %u mV\r\n", (unsigned)WS2812_Ctrl_GetVddMv());
+}
+
+static void Cmd_Cal(const char *args)
+{
+  uint32_t mv;
+  if (!Console_ParseU32(args, &mv))
+  {
+    SEGGER_RTT_WriteString(0, "usage: cal <mV>\r\n");
+    return;
+  }
+  if (WS2812_Ctrl_CalibrateVdd(mv))
+  {
+    SEGGER_RTT_printf(0, "cal ok, vdd %u mV\r\n", (unsigned)WS2812_Ctrl_GetVddMv());
+  }
+  else
+  {
+    SEGGER_RTT_WriteString(0, "cal rejected\r\n");
+  }
+}
+
+static void Cmd_Mem(const char *args)
+{
+  (void)args;
+  RamWatermark_Report();
+}
+
+/* Splits off the parameter name; returns the rest of the line */
+static const char *Console_ParseParam(const char *s, param_id_t *id)
+{
+  uint32_t len = 0;
+  s = Console_SkipSpaces(s);
+  while (s[len] != '\0' && s[len] != ' ')
+  {
+    len++;
+  }
+  *id = Params_Find(s, len);
+  return s + len;
+}
+
+static void Console_PrintParam(param_id_t id)
+{
+  SEGGER_RTT_printf(0, "%s %u\r\n", Params_Name(id), (unsigned)PARAM(id));
+}
+
+static void Cmd_Get(const char *args)
+{
+  param_id_t id;
+  if (*Console_SkipSpaces(args) == '\0')
+  {
+    for (uint32_t i = 0; i < PARAM_COUNT; i++)
+    {
+      Console_PrintParam((param_id_t)i);
+    }
+    return;
+  }
+  if (*Console_SkipSpaces(Console_ParseParam(args, &id)) != '\0' || id == PARAM_COUNT)
+  {
+    SEGGER_RTT_WriteString(0, "unknown parameter\r\n");
+    return;
+  }
+  Console_PrintParam(id);
+}
+
+static void Cmd_Set(const char *args)
+{
+  param_id_t id;
+  uint32_t value;
+  const char *rest = Console_ParseParam(args, &id);
+  if (id == PARAM_COUNT || !Console_ParseU32(rest, &value))
+  {
+    SEGGER_RTT_WriteString(0, "usage: set <name> <value>\r\n");
+    return;
+  }
+  if (!Params_Set(id, value))
+  {
+    SEGGER_RTT_WriteString(0, "out of range\r\n");
+    return;
+  }
+  Console_PrintParam(id);
+}
+
+static void Cmd_Save(const char *args)
+{
+  (void)args;
+  SEGGER_RTT_WriteString(0, Params_Save() ? "saved\r\n" : "save refused\r\n");
+}
+
+static const console_cmd_t commands[] =
+{
+  { "vdd", Cmd_Vdd },
+  { "cal", Cmd_Cal },
+  { "mem", Cmd_Mem },
+  { "get", Cmd_Get },
+  { "set", Cmd_Set },
+  { "save", Cmd_Save },
+};
+
+/* Returns the argument string if line starts with the word name, else 0 */
+static const char *Console_MatchWord(const char *s, const char *name)
+{
+  while (*name)
+  {
+    if (*s++ != *name++)
+    {
+      return 0;
+    }
+  }
+  if (*s != '\0' && *s != ' ')
+  {
+    return 0;
+  }
+  return s;
+}
+
+static void Console_Execute(const char *s)
+{
+  s = Console_SkipSpaces(s);
+  if (*s == '\0')
+  {
+    return;
+  }
+  for (uint32_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++)
+  {
+    const char *args = Console_MatchWord(s, commands[i].name);
+    if (args)
+    {
+      commands[i].handler(args);
+      return;
+    }
+  }
+  SEGGER_RTT_WriteString(0, "unknown command\r\n");
+}
+
+void Console_Task(void)
+{
+  char c;
+
+  /* cheap poll of the ring offsets when no host is attached */
+  if (!SEGGER_RTT_HasData(0))
+  {
+    return;
+  }
+
+  while (SEGGER_RTT_Read(0, &c, 1) == 1)
+  {
+    if (c == '\r' || c == '\n')
+    {
+      if (line_overflow)
+      {
+        SEGGER_RTT_WriteString(0, "line too long\r\n");
+      }
+      else
+      {
+        line[line_len] = '\0';
+        Console_Execute(line);
+      }
+      line_len = 0;
+      line_overflow = 0;
+    }
+    else if (line_len < CONSOLE_LINE_MAX - 1U)
+    {
+      line[line_len++] = c;
+    }
+    else
+    {
+      line_overflow = 1;
+    }
+  }
+}
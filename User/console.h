@@ -0,0 +1,5 @@
+#pragma once
+
+#include <stdint.h>
+
+void Console_Task(void);
@@ -0,0 +1,146 @@
+#include "fault_log.h"
+#include "py32f0xx_hal.h"
+#include "ram_watermark.h"
+#include "SEGGER_RTT.h"
+
+/* Words scanned above the exception frame for return addresses */
+#define FAULT_SCAN_WORDS      64U
+/* Hardware-stacked frame: r0-r3, r12, lr, pc, xpsr */
+#define FAULT_FRAME_WORDS     8U
+/* xPSR bit 9: the core inserted a pad word to 8-byte align the frame */
+#define FAULT_XPSR_PAD        0x00000200UL
+
+/* IWDG keys (RM: independent watchdog) */
+#define FAULT_IWDG_KEY_START  0xCCCCU
+#define FAULT_IWDG_KEY_UNLOCK 0x5555U
+#define FAULT_IWDG_KEY_RELOAD 0xAAAAU
+
+extern uint32_t _estack;
+extern uint32_t _etext;
+
+/* Not zeroed by Reset_Handler and outside the painted heap/stack region */
+static fault_record_t fault_record __attribute__((section(".noinit")));
+
+static uint32_t FaultLog_Check(const fault_record_t *r)
+{
+  return ~r->magic ^ r->pc ^ r->lr;
+}
+
+static uint8_t FaultLog_IsCode(uint32_t addr)
+{
+  return (addr & 1U) && addr > FLASH_BASE && addr < (uint32_t)&_etext;
+}
+
+/* Shortest IWDG period (LSI/4, reload 1): resets within a few hundred us
+   and leaves IWDGRSTF set for the reset-reason check on the next boot */
+static void FaultLog_WatchdogReset(void)
+{
+  IWDG->KR = FAULT_IWDG_KEY_START;
+  IWDG->KR = FAULT_IWDG_KEY_UNLOCK;
+  IWDG->PR = 0U;
+  IWDG->RLR = 1U;
+  while (IWDG->SR != 0U)
+  {
+  }
+  IWDG->KR = FAULT_IWDG_KEY_RELOAD;
+  while (1)
+  {
+  }
+}
+
+void FaultLog_Capture(uint32_t *frame, uint32_t exc_return)
+{
+  fault_record_t *r = &fault_record;
+  uint32_t addr = (uint32_t)frame;
+  uint32_t i;
+
+  for (i = 0; i < sizeof(*r) / sizeof(uint32_t); i++)
+  {
+    ((uint32_t *)r)[i] = 0U;
+  }
+  r->exc_return = exc_return;
+  r->tick = HAL_GetTick();
+  r->sp = addr;
+
+  /* a blown stack can leave sp outside RAM: reading it would lock up */
+  if ((addr & 3U) == 0U && addr >= SRAM_BASE &&
+      addr + FAULT_FRAME_WORDS * 4U <= (uint32_t)&_estack)
+  {
+    r->r0 = frame[0];
+    r->r1 = frame[1];
+    r->r2 = frame[2];
+    r->r3 = frame[3];
+    r->r12 = frame[4];
+    r->lr = frame[5];
+    r->pc = frame[6];
+    r->xpsr = frame[7];
+    r->sp = addr + FAULT_FRAME_WORDS * 4U + ((r->xpsr & FAULT_XPSR_PAD) ? 4U : 0U);
+
+    const uint32_t *p = (const uint32_t *)r->sp;
+    uint32_t n = 0;
+    for (i = 0; i < FAULT_SCAN_WORDS && p < &_estack && n < FAULT_LOG_TRACE_DEPTH; i++, p++)
+    {
+      if (FaultLog_IsCode(*p))
+      {
+        r->trace[n++] = *p;
+      }
+    }
+  }
+  r->magic = FAULT_LOG_MAGIC;
+  r->check = FaultLog_Check(r);
+
+  /* a stack overflow is the usual suspect: show how deep it got */
+  RamWatermark_Report();
+  FaultLog_WatchdogReset();
+}
+
+/* Picks the stack the core pushed the frame on (EXC_RETURN bit 2) and hands
+   it to FaultLog_Capture without touching the stack first */
+__attribute__((naked)) void HardFault_Handler(void)
+{
+  __asm volatile(
+    "  movs r0, #4              \n"
+    "  mov  r1, lr              \n"
+    "  tst  r0, r1              \n"
+    "  bne  1f                  \n"
+    "  mrs  r0, msp             \n"
+    "  b    2f                  \n"
+    "1:                         \n"
+    "  mrs  r0, psp             \n"
+    "2:                         \n"
+    "  ldr  r2, =FaultLog_Capture\n"
+    "  bx   r2                  \n"
+    "  .ltorg                   \n");
+}
+
+uint8_t FaultLog_Pending(void)
+{
+  return fault_record.magic == FAULT_LOG_MAGIC && fault_record.check == FaultLog_Check(&fault_record);
+}
+
+void FaultLog_Init(void)
+{
+  fault_record_t *r = &fault_record;
+
+  if (!FaultLog_Pending())
+  {
+    r->magic = 0U;
+    return;
+  }
+
+  /* one line per group, decoded by Misc/Python/fault_decode.py */
+  SEGGER_RTT_printf(0, "FAULT pc=%08x lr=%08x xpsr=%08x sp=%08x exc=%08x tick=%u\r\n",
+                    (unsigned)r->pc, (unsigned)r->lr, (unsigned)r->xpsr,
+                    (unsigned)r->sp, (unsigned)r->exc_return, (unsigned)r->tick);
+  SEGGER_RTT_printf(0, "FAULT r0=%08x r1=%08x r2=%08x r3=%08x r12=%08x\r\n",
+                    (unsigned)r->r0, (unsigned)r->r1, (unsigned)r->r2,
+                    (unsigned)r->r3, (unsigned)r->r12);
+  SEGGER_RTT_WriteString(0, "FAULT trace=");
+  for (uint32_t i = 0; i < FAULT_LOG_TRACE_DEPTH && r->trace[i]; i++)
+  {
+    SEGGER_RTT_printf(0, "%08x ", (unsigned)r->trace[i]);
+  }
+  SEGGER_RTT_WriteString(0, "\r\n");
+
+  r->magic = 0U;
+}
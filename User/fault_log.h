@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+#define FAULT_LOG_MAGIC       0xFA017C0DUL
+#define FAULT_LOG_TRACE_DEPTH 6U
+
+/* Post-mortem record kept in .noinit across the watchdog reset */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t r0;
+  uint32_t r1;
+  uint32_t r2;
+  uint32_t r3;
+  uint32_t r12;
+  uint32_t lr;
+  uint32_t pc;
+  uint32_t xpsr;
+  uint32_t sp;          /* stack pointer at the fault, before the stacked frame */
+  uint32_t exc_return;  /* LR on handler entry: which stack, thread or handler */
+  uint32_t tick;
+  uint32_t trace[FAULT_LOG_TRACE_DEPTH]; /* code addresses found above the frame */
+  uint32_t check;       /* ~magic ^ pc ^ lr: rejects a half-written record */
+} fault_record_t;
+
+/* Prints and clears the record left by the previous run, if any */
+void FaultLog_Init(void);
+/* Non-zero while a valid record from the previous run is unreported */
+uint8_t FaultLog_Pending(void);
+/* Called by HardFault_Handler with the stacked frame; does not return */
+void FaultLog_Capture(uint32_t *frame, uint32_t exc_return);
@@ -1,9 +1,10 @@
 #include "hbridge.h"
 #include "py32f0xx_hal.h"
-#include "py32f0xx_hal_flash.h"
-#include "py32f0xx_hal_flash_ex.h"
 #include "py32f0xx_hal_tim.h"
 #include "SEGGER_RTT.h"
+#include "config_store.h"
+#include "supervisor.h"
+#include "params.h"
 
 #define HBRIDGE_NSLP_PORT GPIOA
 #define HBRIDGE_NSLP_PIN  GPIO_PIN_0
@@ -17,17 +18,14 @@
 #define SWITCH_PAUSE_MS   5U
 #define DRIVER_PAUSE_MS   1U
 #define HBRIDGE_FADE_MS        500U   /* reserved for future use */
-#define HBRIDGE_FADE_ON_MS    1000U   /* smooth turn-on from OFF */
+#define HBRIDGE_FADE_ON_MS    PARAM(PARAM_FADE_ON_MS)   /* smooth turn-on from OFF */
 
 #define BRIGHT_MIN_PCT    10U
 #define BRIGHT_MAX_PCT    100U
 
-#define CONFIG_MAGIC      0xBEEFCAFEUL
-#define CONFIG_PAGE_ADDR  0x08004C00UL /* aligned page near end of 20KB flash */
-
 #define PWM_WINDOW_MS     10U          /* 100 Hz software PWM via SysTick */
 #define HBRIDGE_FADE_STEPS    128U     /* perceptual steps for power-on fade */
-#define PWM_IRQ_HZ       32000U        /* 32 kHz interrupt-driven PDM on PA4 (GPIO) -> above audible */
+#define PWM_IRQ_HZ       PARAM(PARAM_PWM_HZ) /* 32 kHz interrupt-driven PDM on PA4 (GPIO) -> above audible */
 
 /* Ease-in curve (quadratic-ish) normalized to 0..100% for smoother low-end ramp */
 static const uint8_t fade_curve_pct[HBRIDGE_FADE_STEPS] =
@@ -51,13 +49,14 @@ static const uint8_t fade_curve_pct[HBRIDGE_FADE_STEPS] =
 };
 
 static volatile hbridge_mode_t current_mode = HBRIDGE_OFF;
+static volatile uint8_t cutoff_latched = 0;  /* set by low-battery watchdog IRQ */
 static hbridge_mode_t preferred_mode = HBRIDGE_FORWARD;
 static uint8_t brightness_pct = BRIGHT_MAX_PCT; /* target (user) brightness */
 static volatile uint8_t pwm_pct = 0;            /* actual PWM value on PA4 */
 static uint32_t pwm_window_start = 0;
 static volatile uint16_t pwm_permille = 0;      /* 0..1000 for high-res duty */
 static volatile uint16_t sd_accum = 0;          /* sigma-delta accumulator */
-static TIM_HandleTypeDef htim16;
+static TIM_HandleTypeDef htim16 = { .Instance = TIM16 }; /* bound early: SysTick may stop PWM before init */
 static struct
 {
   volatile uint8_t active;
@@ -115,23 +114,21 @@ static void HBridge_PWM_Stop(void)
   HAL_GPIO_WritePin(HBRIDGE_CTRL_PORT, HBRIDGE_CTRL_PIN, GPIO_PIN_RESET);
 }
 
-static void HBridge_UpdatePins(hbridge_mode_t mode)
+/* New PDM rate from the console: reload TIM16, keep running if it was */
+void HBridge_ApplyPwmRate(void)
 {
-  /* Driver fully off */
-  HAL_GPIO_WritePin(HBRIDGE_CTRL_PORT, HBRIDGE_CTRL_PIN, GPIO_PIN_RESET);
+  uint8_t running = (htim16.Instance->CR1 & TIM_CR1_CEN) != 0U;
 
-  /* Step 1: put bridge to sleep and tri-state outputs */
-  HAL_GPIO_WritePin(HBRIDGE_NSLP_PORT, HBRIDGE_NSLP_PIN, GPIO_PIN_RESET);
-  HAL_GPIO_WritePin(HBRIDGE_IN1_PORT, HBRIDGE_IN1_PIN, GPIO_PIN_RESET);
-  HAL_GPIO_WritePin(HBRIDGE_IN2_PORT, HBRIDGE_IN2_PIN, GPIO_PIN_RESET);
-  HAL_Delay(SWITCH_PAUSE_MS);
-
-  if (mode == HBRIDGE_OFF)
+  HBridge_PWM_Stop();
+  HBridge_PWM_TimerInit();
+  if (running)
   {
-    return;
+    HBridge_PWM_Start();
   }
+}
 
-  /* Step 2: set direction while unpowered */
+static void HBridge_SetDirection(hbridge_mode_t mode)
+{
   if (mode == HBRIDGE_FORWARD)
   {
     HAL_GPIO_WritePin(HBRIDGE_IN1_PORT, HBRIDGE_IN1_PIN, GPIO_PIN_SET);
@@ -142,36 +139,66 @@ static void HBridge_UpdatePins(hbridge_mode_t mode)
     HAL_GPIO_WritePin(HBRIDGE_IN1_PORT, HBRIDGE_IN1_PIN, GPIO_PIN_RESET);
     HAL_GPIO_WritePin(HBRIDGE_IN2_PORT, HBRIDGE_IN2_PIN, GPIO_PIN_SET);
   }
+}
 
-  /* Step 3: wake bridge */
-  HAL_GPIO_WritePin(HBRIDGE_NSLP_PORT, HBRIDGE_NSLP_PIN, GPIO_PIN_SET);
-  HAL_Delay(DRIVER_PAUSE_MS);
+/* Runs one step of the wake sequence unless the watchdog has cut off the
+   bridge; the latch is tested with IRQs masked so the cutoff cannot land
+   between the test and the pin writes. Returns 0 if the bridge is parked. */
+static uint8_t HBridge_WakeStep(hbridge_mode_t mode, uint8_t wake)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint8_t ok;
 
-  /* Step 4: reassert direction */
-  if (mode == HBRIDGE_FORWARD)
+  __disable_irq();
+  ok = !cutoff_latched;
+  if (ok)
   {
-    HAL_GPIO_WritePin(HBRIDGE_IN1_PORT, HBRIDGE_IN1_PIN, GPIO_PIN_SET);
-    HAL_GPIO_WritePin(HBRIDGE_IN2_PORT, HBRIDGE_IN2_PIN, GPIO_PIN_RESET);
+    HBridge_SetDirection(mode);
+    if (wake)
+    {
+      HAL_GPIO_WritePin(HBRIDGE_NSLP_PORT, HBRIDGE_NSLP_PIN, GPIO_PIN_SET);
+    }
   }
-  else
+  if (!primask) __enable_irq();
+  return ok;
+}
+
+/* Returns 0 if the mode is OFF or the low-battery cutoff parked the bridge */
+static uint8_t HBridge_UpdatePins(hbridge_mode_t mode)
+{
+  /* Driver fully off */
+  HAL_GPIO_WritePin(HBRIDGE_CTRL_PORT, HBRIDGE_CTRL_PIN, GPIO_PIN_RESET);
+
+  /* Step 1: put bridge to sleep and tri-state outputs */
+  HAL_GPIO_WritePin(HBRIDGE_NSLP_PORT, HBRIDGE_NSLP_PIN, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(HBRIDGE_IN1_PORT, HBRIDGE_IN1_PIN, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(HBRIDGE_IN2_PORT, HBRIDGE_IN2_PIN, GPIO_PIN_RESET);
+  HAL_Delay(SWITCH_PAUSE_MS);
+
+  if (mode == HBRIDGE_OFF)
   {
-    HAL_GPIO_WritePin(HBRIDGE_IN1_PORT, HBRIDGE_IN1_PIN, GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(HBRIDGE_IN2_PORT, HBRIDGE_IN2_PIN, GPIO_PIN_SET);
+    return 0;
+  }
+
+  /* Step 2 and 3: set direction while unpowered, then wake bridge */
+  if (!HBridge_WakeStep(mode, 1))
+  {
+    return 0;
   }
+  HAL_Delay(DRIVER_PAUSE_MS);
+
+  /* Step 4: reassert direction (HBridge_Cutoff() has parked the pins if it ran) */
+  return HBridge_WakeStep(mode, 0);
 }
 
 static void HBridge_LoadBrightness(void)
 {
-  uint32_t *p = (uint32_t *)CONFIG_PAGE_ADDR;
-  if (p[0] == CONFIG_MAGIC)
+  uint32_t val = ConfigStore_Read(CONFIG_BRIGHTNESS);
+  if (val >= BRIGHT_MIN_PCT && val <= BRIGHT_MAX_PCT)
   {
-    uint32_t val = p[1];
-    if (val >= BRIGHT_MIN_PCT && val <= BRIGHT_MAX_PCT)
-    {
-      brightness_pct = (uint8_t)val;
-      pwm_pct = brightness_pct;
-      return;
-    }
+    brightness_pct = (uint8_t)val;
+    pwm_pct = brightness_pct;
+    return;
   }
   brightness_pct = BRIGHT_MAX_PCT;
   pwm_pct = brightness_pct;
@@ -205,6 +232,16 @@ void HBridge_Init(void)
   HBridge_UpdatePins(HBRIDGE_OFF);
 }
 
+/* The cutoff fired during a switch: stay OFF instead of starting the PWM */
+static void HBridge_Parked(void)
+{
+  current_mode = HBRIDGE_OFF;
+  fade.active = 0;
+  pwm_pct = 0;
+  HBridge_PWM_Stop();
+  SEGGER_RTT_printf(0, "H-bridge locked out: low battery\r\n");
+}
+
 void HBridge_SetMode(hbridge_mode_t mode)
 {
   hbridge_mode_t prev = current_mode;
@@ -213,6 +250,12 @@ void HBridge_SetMode(hbridge_mode_t mode)
     return;
   }
 
+  if (cutoff_latched && mode != HBRIDGE_OFF)
+  {
+    SEGGER_RTT_printf(0, "H-bridge locked out: low battery\r\n");
+    return;
+  }
+
   /* If changing direction, pass through OFF to guarantee both legs off */
   if ((current_mode == HBRIDGE_FORWARD && mode == HBRIDGE_REVERSE) ||
       (current_mode == HBRIDGE_REVERSE && mode == HBRIDGE_FORWARD))
@@ -229,14 +272,22 @@ void HBridge_SetMode(hbridge_mode_t mode)
     pwm_window_start = HAL_GetTick();
 
     current_mode = mode;
-    HBridge_UpdatePins(current_mode);
+    if (!HBridge_UpdatePins(mode))
+    {
+      HBridge_Parked();
+      return;
+    }
     HBridge_StartFade(target, HBRIDGE_FADE_ON_MS);
     HBridge_PWM_Start();
   }
   else
   {
     current_mode = mode;
-    HBridge_UpdatePins(current_mode);
+    if (!HBridge_UpdatePins(mode) && mode != HBRIDGE_OFF)
+    {
+      HBridge_Parked();
+      return;
+    }
 
     if (current_mode != HBRIDGE_OFF)
     {
@@ -254,9 +305,38 @@ void HBridge_SetMode(hbridge_mode_t mode)
   SEGGER_RTT_printf(0, "H-bridge mode: %d\r\n", current_mode);
 }
 
+/* Called from the ADC analog watchdog IRQ: pins only, no HAL_Delay.
+   TIM16 is stopped by HBridge_Systick once it sees the OFF mode. */
+void HBridge_Cutoff(void)
+{
+  current_mode = HBRIDGE_OFF;
+  fade.active = 0;
+  pwm_pct = 0;
+  pwm_permille = 0;
+  cutoff_latched = 1;
+
+  HAL_GPIO_WritePin(HBRIDGE_CTRL_PORT, HBRIDGE_CTRL_PIN, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(HBRIDGE_NSLP_PORT, HBRIDGE_NSLP_PIN, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(HBRIDGE_IN1_PORT, HBRIDGE_IN1_PIN, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(HBRIDGE_IN2_PORT, HBRIDGE_IN2_PIN, GPIO_PIN_RESET);
+}
+
+void HBridge_ClearCutoff(void)
+{
+  cutoff_latched = 0;
+}
+
 void HBridge_Task(void)
 {
-  /* no-op: fade handled in SysTick for 1ms resolution */
+  static uint32_t last_tick = 0;
+  uint32_t now = HAL_GetTick();
+
+  /* fade runs in SysTick: report in only while the tick is advancing */
+  if (now != last_tick)
+  {
+    last_tick = now;
+    Supervisor_CheckIn(SUPERVISOR_HBRIDGE);
+  }
 }
 
 hbridge_mode_t HBridge_GetMode(void)
@@ -299,26 +379,7 @@ void HBridge_SetBrightness(uint8_t pct)
 
 void HBridge_SaveBrightness(void)
 {
-  uint32_t page_buf[32]; /* 32 * 4 = 128 bytes */
-  for (uint32_t i = 0; i < 32; i++)
-  {
-    page_buf[i] = 0xFFFFFFFFUL;
-  }
-  page_buf[0] = CONFIG_MAGIC;
-  page_buf[1] = brightness_pct;
-
-  HAL_FLASH_Unlock();
-
-  FLASH_EraseInitTypeDef erase = {0};
-  uint32_t page_error = 0;
-  erase.TypeErase = FLASH_TYPEERASE_PAGEERASE;
-  erase.PageAddress = CONFIG_PAGE_ADDR;
-  erase.NbPages = 1;
-  HAL_FLASHEx_Erase(&erase, &page_error);
-
-  HAL_FLASH_Program(FLASH_TYPEPROGRAM_PAGE, CONFIG_PAGE_ADDR, page_buf);
-
-  HAL_FLASH_Lock();
+  ConfigStore_Write(CONFIG_BRIGHTNESS, brightness_pct);
 }
 
 void HBridge_Systick(void)
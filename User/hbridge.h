@@ -19,3 +19,6 @@ hbridge_mode_t HBridge_GetMode(void);
 hbridge_mode_t HBridge_GetPreferredMode(void);
 void HBridge_TogglePreferredMode(void);
 void HBridge_Systick(void);
+void HBridge_Cutoff(void);
+void HBridge_ClearCutoff(void);
+void HBridge_ApplyPwmRate(void);
@@ -26,15 +26,24 @@
 #include "hbridge.h"
 #include "SEGGER_RTT.h"
 #include "button_ctrl.h"
+#include "console.h"
+#include "power_guard.h"
+#include "fault_log.h"
+#include "supervisor.h"
+#include "params.h"
 
 int main(void)
 {
   HAL_Init();
+  Supervisor_Init();
+  FaultLog_Init();
+  Params_Init();
 
   /* Default system clock is HSI 8MHz; keep as-is to match F_CPU for ws2812 */
   WS2812_Ctrl_Init();
   HBridge_Init();
   ButtonCtrl_Init();
+  PowerGuard_Init();
 
   SEGGER_RTT_printf(0, "\r\nPY32F0xx WS2812 + DRV8837 Demo SYSCLK: %lu\r\n", SystemCoreClock);
 
@@ -43,6 +52,9 @@ int main(void)
     WS2812_Ctrl_Task();
     ButtonCtrl_Task();
     HBridge_Task();
+    Console_Task();
+    PowerGuard_Task();
+    Supervisor_Task();
     HAL_Delay(20);
   }
 }
@@ -0,0 +1,89 @@
+#include "params.h"
+#include "config_store.h"
+#include "hbridge.h"
+#include "ws2812_ctrl.h"
+
+typedef struct
+{
+  const char *name;
+  uint16_t def;
+  uint16_t min;
+  uint16_t max;
+  void (*apply)(void); /* re-programs hardware that latched the old value */
+} param_desc_t;
+
+/* Defaults are the values the modules were tuned with at build time */
+static const param_desc_t params[PARAM_COUNT] =
+{
+  [PARAM_BTN_DEBOUNCE_MS] = { "debounce",  25U,    5U,    200U,  0 },
+  [PARAM_DOUBLE_CLICK_MS] = { "dclick",    400U,   100U,  1500U, 0 },
+  [PARAM_FADE_ON_MS]      = { "fade_on",   1000U,  0U,    5000U, 0 },
+  [PARAM_PWM_HZ]          = { "pwm_hz",    32000U, 4000U, 40000U, HBridge_ApplyPwmRate },
+  [PARAM_VBAT_CUTOFF_MV]  = { "cutoff",    3000U,  2500U, 3600U, WS2812_Ctrl_ApplyCutoff },
+  [PARAM_VBAT_HYST_MV]    = { "hyst",      200U,   50U,   600U,  0 },
+};
+
+uint16_t param_values[PARAM_COUNT];
+
+static uint8_t Params_InRange(param_id_t id, uint32_t value)
+{
+  return value >= params[id].min && value <= params[id].max;
+}
+
+void Params_Init(void)
+{
+  for (uint32_t i = 0; i < PARAM_COUNT; i++)
+  {
+    uint32_t v = ConfigStore_Read((config_field_t)(CONFIG_PARAMS + i));
+    /* unset or out of range (e.g. limits tightened since the save) */
+    param_values[i] = Params_InRange((param_id_t)i, v) ? (uint16_t)v : params[i].def;
+  }
+}
+
+param_id_t Params_Find(const char *name, uint32_t len)
+{
+  for (uint32_t i = 0; i < PARAM_COUNT; i++)
+  {
+    const char *p = params[i].name;
+    uint32_t n = 0;
+    while (n < len && p[n] == name[n])
+    {
+      n++;
+    }
+    if (n == len && p[n] == '\0')
+    {
+      return (param_id_t)i;
+    }
+  }
+  return PARAM_COUNT;
+}
+
+const char *Params_Name(param_id_t id)
+{
+  return params[id].name;
+}
+
+uint8_t Params_Set(param_id_t id, uint32_t value)
+{
+  if (id >= PARAM_COUNT || !Params_InRange(id, value))
+  {
+    return 0;
+  }
+  param_values[id] = (uint16_t)value;
+  if (params[id].apply)
+  {
+    params[id].apply();
+  }
+  return 1;
+}
+
+uint8_t Params_Save(void)
+{
+  uint32_t values[PARAM_COUNT];
+
+  for (uint32_t i = 0; i < PARAM_COUNT; i++)
+  {
+    values[i] = param_values[i];
+  }
+  return ConfigStore_WriteBlock(CONFIG_PARAMS, values, PARAM_COUNT);
+}
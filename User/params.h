@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Runtime-tunable parameters, readable and writable from the RTT console.
+   Order is the persistence layout: entry i lives in CONFIG_PARAMS + i. */
+typedef enum
+{
+  PARAM_BTN_DEBOUNCE_MS = 0,
+  PARAM_DOUBLE_CLICK_MS,
+  PARAM_FADE_ON_MS,
+  PARAM_PWM_HZ,           /* sigma-delta update rate on PA4 */
+  PARAM_VBAT_CUTOFF_MV,
+  PARAM_VBAT_HYST_MV,
+  PARAM_COUNT
+} param_id_t;
+
+/* Live values; modules read them through PARAM() in place of a constant */
+extern uint16_t param_values[PARAM_COUNT];
+#define PARAM(id) (param_values[(id)])
+
+/* Loads saved values over the defaults; call before the modules init */
+void Params_Init(void);
+/* Returns PARAM_COUNT if no parameter has that name */
+param_id_t Params_Find(const char *name, uint32_t len);
+const char *Params_Name(param_id_t id);
+/* Range-checked write; runs the owner's re-apply hook. Returns 0 if rejected */
+uint8_t Params_Set(param_id_t id, uint32_t value);
+/* Writes all values to the config page in one erase. Returns 0 if refused */
+uint8_t Params_Save(void);
@@ -0,0 +1,88 @@
+#include "power_guard.h"
+#include "py32f0xx_hal.h"
+#include "config_store.h"
+#include "hbridge.h"
+#include "ws2812_ctrl.h"
+#include "SEGGER_RTT.h"
+
+/* Flash erases are refused below this supply (a torn erase loses the page) */
+#define POWER_ERASE_MIN_MV    3000U
+/* Supply must recover this far above the erase limit before clearing a trip */
+#define POWER_RECOVER_MV      3200U
+
+#if defined(PWR_PVD_SUPPORT)
+/* PVD falling threshold, level 6 is ~3.0 V (see datasheet PVD table) */
+#define POWER_PVD_LEVEL       PWR_PVDLEVEL_6
+#endif
+
+static volatile uint8_t tripped = 0;
+
+#if defined(PWR_PVD_SUPPORT)
+static void PowerGuard_PvdInit(void)
+{
+  PWR_PVDTypeDef pvd = {0};
+
+  __HAL_RCC_PWR_CLK_ENABLE();
+
+  pvd.PVDSource = PWR_PVD_SOURCE_VCC;
+  pvd.PVDFilter = PWR_PVD_FILTER_16CLOCK;
+  pvd.PVDLevel = POWER_PVD_LEVEL;
+  pvd.Mode = PWR_PVD_MODE_IT_FALLING;
+  HAL_PWR_ConfigPVD(&pvd);
+  HAL_PWR_EnablePVD();
+
+  HAL_NVIC_SetPriority(PVD_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(PVD_IRQn);
+}
+
+void PVD_IRQHandler(void)
+{
+  if (__HAL_PWR_PVD_EXTI_GET_FLAG() != RESET)
+  {
+    __HAL_PWR_PVD_EXTI_CLEAR_FLAG();
+    PowerGuard_Trip();
+  }
+}
+#endif
+
+void PowerGuard_Init(void)
+{
+#if defined(PWR_PVD_SUPPORT)
+  PowerGuard_PvdInit();
+#endif
+  /* parts without a PVD (PY32F002A) are tripped by the ADC analog watchdog */
+}
+
+/* Brown-out path, called from IRQ context: drop the LED load first to buy
+   hold-up time, then record the unsaved brightness into the pre-erased slot. */
+void PowerGuard_Trip(void)
+{
+  HBridge_Cutoff();
+
+  if (tripped)
+  {
+    return;
+  }
+  tripped = 1;
+  ConfigStore_EmergencyWrite(CONFIG_BRIGHTNESS, HBridge_GetBrightness());
+}
+
+void PowerGuard_Task(void)
+{
+  uint32_t vdd = WS2812_Ctrl_GetVddMv();
+
+  if (tripped)
+  {
+    if (vdd < POWER_RECOVER_MV)
+    {
+      return;
+    }
+    tripped = 0;
+    SEGGER_RTT_printf(0, "Supply recovered: %u mV\r\n", (unsigned)vdd);
+  }
+
+  ConfigStore_SetEraseLock(vdd < POWER_ERASE_MIN_MV);
+
+  /* fold a pending emergency record back into the config page */
+  ConfigStore_Flush();
+}
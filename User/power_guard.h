@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
+void PowerGuard_Init(void);
+void PowerGuard_Task(void);
+void PowerGuard_Trip(void);
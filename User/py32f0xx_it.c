@@ -44,16 +44,6 @@ void NMI_Handler(void)
 {
 }
 
-/**
-  * @brief This function handles Hard fault interrupt.
-  */
-void HardFault_Handler(void)
-{
-  while (1)
-  {
-  }
-}
-
 /**
   * @brief This function handles System service call via SWI instruction.
   */
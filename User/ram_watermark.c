@@ -0,0 +1,48 @@
+#include "ram_watermark.h"
+#include "SEGGER_RTT.h"
+
+/* Linker script symbols: heap starts at `end`, the stack grows down from
+   _estack; _Min_Heap_Size and _Min_Stack_Size are absolute values. */
+extern uint32_t end;
+extern uint32_t _estack;
+extern uint32_t _Min_Heap_Size;
+extern uint32_t _Min_Stack_Size;
+
+/* The region [end, _estack) is painted by Reset_Handler. The heap grows up
+   from `end` and the stack down from _estack, so the first painted word above
+   the heap and the first written word above that bound the untouched gap. */
+void RamWatermark_Get(ram_watermark_t *wm)
+{
+  const uint32_t *lo = &end;
+  const uint32_t *hi = &_estack;
+  const uint32_t *p = lo;
+
+  while (p < hi && *p != RAM_WATERMARK_PATTERN)
+  {
+    p++;
+  }
+  const uint32_t *heap_top = p;
+
+  while (p < hi && *p == RAM_WATERMARK_PATTERN)
+  {
+    p++;
+  }
+
+  wm->heap_used = (uint16_t)((heap_top - lo) * 4);
+  wm->heap_size = (uint16_t)(uint32_t)&_Min_Heap_Size;
+  wm->stack_used = (uint16_t)((hi - p) * 4);
+  wm->stack_size = (uint16_t)((hi - lo) * 4 - wm->heap_size);
+  wm->untouched = (uint16_t)((p - heap_top) * 4);
+}
+
+void RamWatermark_Report(void)
+{
+  ram_watermark_t wm;
+
+  RamWatermark_Get(&wm);
+  SEGGER_RTT_printf(0, "stack %u/%u B (min %u), heap %u/%u B, untouched %u B\r\n",
+                    (unsigned)wm.stack_used, (unsigned)wm.stack_size,
+                    (unsigned)(uint32_t)&_Min_Stack_Size,
+                    (unsigned)wm.heap_used, (unsigned)wm.heap_size,
+                    (unsigned)wm.untouched);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Word written over heap and stack by Reset_Handler before main() */
+#define RAM_WATERMARK_PATTERN 0xA5A5A5A5UL
+
+typedef struct
+{
+  uint16_t heap_used;     /* bytes above `end` ever touched by the heap */
+  uint16_t heap_size;     /* _Min_Heap_Size reserved by the linker script */
+  uint16_t stack_used;    /* peak depth below _estack */
+  uint16_t stack_size;    /* RAM from the heap reserve up to _estack */
+  uint16_t untouched;     /* never-written gap between heap and stack */
+} ram_watermark_t;
+
+void RamWatermark_Get(ram_watermark_t *wm);
+void RamWatermark_Report(void);
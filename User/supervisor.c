@@ -0,0 +1,152 @@
+#include "supervisor.h"
+#include "py32f0xx_hal.h"
+#include "config_store.h"
+#include "fault_log.h"
+#include "SEGGER_RTT.h"
+
+/* LSI 32.768 kHz / 32 = 1024 Hz, 1024 counts: ~1 s to check in. The main
+   loop runs every 20 ms, so only a real hang (or the HardFault path) bites. */
+#define SUPERVISOR_PRESCALER    IWDG_PRESCALER_32
+#define SUPERVISOR_RELOAD       1023U
+#define SUPERVISOR_ALL_TASKS    ((1U << SUPERVISOR_TASKS) - 1U)
+/* Reset counts reach flash only after this much healthy uptime, so a unit
+   stuck in a reset loop does not wear out the config page */
+#define SUPERVISOR_PERSIST_MS   60000UL
+#define SUPERVISOR_MAGIC        0x5D0651A1UL
+
+/* Resets counted since the last power-up and not yet in the config page */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t hangs;
+  uint32_t faults;
+  uint32_t check;
+} supervisor_pending_t;
+
+static IWDG_HandleTypeDef hiwdg = { .Instance = IWDG };
+static supervisor_pending_t pending __attribute__((section(".noinit")));
+static reset_cause_t reset_cause = RESET_CAUSE_OTHER;
+static volatile uint8_t checked_in = 0;
+
+static const char *const cause_names[] =
+{
+  "power", "pin", "software", "watchdog", "fault", "other"
+};
+
+static uint32_t Supervisor_Check(const supervisor_pending_t *p)
+{
+  return ~p->magic ^ p->hangs ^ p->faults;
+}
+
+static uint32_t Supervisor_Stored(config_field_t field)
+{
+  uint32_t v = ConfigStore_Read(field);
+  return (v == CONFIG_UNSET) ? 0U : v;
+}
+
+/* Folds counts from .noinit into the config page, once per field */
+static void Supervisor_Persist(config_field_t field, uint32_t *count)
+{
+  uint32_t total;
+
+  if (*count == 0U)
+  {
+    return;
+  }
+  total = Supervisor_Stored(field) + *count;
+  ConfigStore_Write(field, total);
+  if (ConfigStore_Read(field) == total) /* not refused by the erase lock */
+  {
+    *count = 0U;
+    pending.check = Supervisor_Check(&pending);
+  }
+}
+
+static reset_cause_t Supervisor_ReadResetCause(void)
+{
+  reset_cause_t cause = RESET_CAUSE_OTHER;
+
+  /* PWRRST comes with PINRST, IWDG and software resets pulse NRST too */
+  if (__HAL_RCC_GET_FLAG(RCC_FLAG_IWDGRST))
+  {
+    cause = FaultLog_Pending() ? RESET_CAUSE_FAULT : RESET_CAUSE_HANG;
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_SFTRST))
+  {
+    cause = RESET_CAUSE_SOFTWARE;
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_PWRRST))
+  {
+    cause = RESET_CAUSE_POWER;
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_PINRST))
+  {
+    cause = RESET_CAUSE_PIN;
+  }
+  __HAL_RCC_CLEAR_RESET_FLAGS();
+  return cause;
+}
+
+/* Call before FaultLog_Init() consumes the fault record */
+void Supervisor_Init(void)
+{
+  reset_cause = Supervisor_ReadResetCause();
+
+  /* RAM content is random after power-up */
+  if (reset_cause == RESET_CAUSE_POWER || pending.magic != SUPERVISOR_MAGIC ||
+      pending.check != Supervisor_Check(&pending))
+  {
+    pending.magic = SUPERVISOR_MAGIC;
+    pending.hangs = 0U;
+    pending.faults = 0U;
+  }
+  if (reset_cause == RESET_CAUSE_HANG)
+  {
+    pending.hangs++;
+  }
+  else if (reset_cause == RESET_CAUSE_FAULT)
+  {
+    pending.faults++;
+  }
+  pending.check = Supervisor_Check(&pending);
+
+  SEGGER_RTT_printf(0, "reset: %s (hangs %u, faults %u)\r\n", cause_names[reset_cause],
+                    (unsigned)(Supervisor_Stored(CONFIG_HANG_RESETS) + pending.hangs),
+                    (unsigned)(Supervisor_Stored(CONFIG_FAULT_RESETS) + pending.faults));
+
+  /* keep the dog quiet while halted in the debugger */
+  __HAL_RCC_DBGMCU_CLK_ENABLE();
+  __HAL_DBGMCU_FREEZE_IWDG();
+
+  hiwdg.Init.Prescaler = SUPERVISOR_PRESCALER;
+  hiwdg.Init.Reload = SUPERVISOR_RELOAD;
+  HAL_IWDG_Init(&hiwdg);
+}
+
+void Supervisor_CheckIn(supervisor_task_t task)
+{
+  checked_in |= (uint8_t)(1U << task);
+}
+
+/* Thread-mode only: feeding from an ISR would keep a hung main loop alive.
+   The IWDG keeps counting in Stop mode, so any future low-power wait must
+   wake and pass through here within the window. */
+void Supervisor_Task(void)
+{
+  if (checked_in == SUPERVISOR_ALL_TASKS)
+  {
+    checked_in = 0;
+    HAL_IWDG_Refresh(&hiwdg);
+  }
+
+  if (HAL_GetTick() >= SUPERVISOR_PERSIST_MS)
+  {
+    Supervisor_Persist(CONFIG_HANG_RESETS, &pending.hangs);
+    Supervisor_Persist(CONFIG_FAULT_RESETS, &pending.faults);
+  }
+}
+
+reset_cause_t Supervisor_GetResetCause(void)
+{
+  return reset_cause;
+}
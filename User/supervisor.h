@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Tasks that must report in every watchdog window */
+typedef enum
+{
+  SUPERVISOR_WS2812 = 0,
+  SUPERVISOR_BUTTON,
+  SUPERVISOR_HBRIDGE,
+  SUPERVISOR_TASKS
+} supervisor_task_t;
+
+typedef enum
+{
+  RESET_CAUSE_POWER = 0,  /* POR/BOR */
+  RESET_CAUSE_PIN,        /* NRST */
+  RESET_CAUSE_SOFTWARE,   /* NVIC_SystemReset */
+  RESET_CAUSE_HANG,       /* IWDG expired: a task stopped checking in */
+  RESET_CAUSE_FAULT,      /* IWDG forced by the HardFault handler */
+  RESET_CAUSE_OTHER
+} reset_cause_t;
+
+void Supervisor_Init(void);
+void Supervisor_CheckIn(supervisor_task_t task);
+void Supervisor_Task(void);
+reset_cause_t Supervisor_GetResetCause(void);
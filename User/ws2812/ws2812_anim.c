@@ -0,0 +1,134 @@
+#include "ws2812_anim.h"
+
+/* All timing is derived from the tick passed to WS_Anim_Render, so the
+   animation speed does not depend on how often the main loop calls it. */
+
+#define WS_BREATHE_SHIFT     5U    /* 32 ms per LUT step, 64 steps = 2048 ms period */
+#define WS_BLINK_SHIFT       8U    /* 256 ms on, 256 ms off */
+#define WS_PULSE_SHIFT       9U    /* 512 ms per pulse slot */
+#define WS_PULSE_ON_MS       256U  /* lit part of each slot */
+#define WS_PULSE_GAP_MS      1024U /* dark pause after the last pulse */
+#define WS_HUE_SLEW_SHIFT    3U    /* hue moves one step per 8 ms while blending */
+
+/* Rising half of a raised cosine, 8..255; mirrored for the falling half */
+static const uint8_t breathe_lut[32] =
+{
+    8,   9,  11,  14,  18,  24,  30,  38,
+   46,  56,  66,  77,  89, 101, 113, 125,
+  138, 150, 162, 174, 186, 197, 207, 217,
+  225, 233, 239, 245, 249, 252, 254, 255
+};
+
+static ws_anim_mode_t anim_mode = WS_ANIM_OFF;
+static uint32_t anim_start = 0;
+static uint8_t hue_cur = WS_HUE_RED;
+static uint8_t hue_target = WS_HUE_RED;
+static uint32_t hue_last_ms = 0;
+static uint8_t pulse_count = 1;
+
+/* Integer HSV -> RGB at full saturation: one multiply, no division */
+static void WS_Anim_HueToRgb(uint8_t hue, uint8_t val, cRGB *out)
+{
+  uint8_t sector = hue >> 5;
+  uint8_t rise = (uint8_t)(((uint16_t)val * (uint16_t)((hue & 31U) << 3)) >> 8);
+  uint8_t fall = val - rise;
+
+  switch (sector)
+  {
+    case 0:  out->r = val;  out->g = rise; out->b = 0;    break;
+    case 1:  out->r = fall; out->g = val;  out->b = 0;    break;
+    case 2:  out->r = 0;    out->g = val;  out->b = rise; break;
+    case 3:  out->r = 0;    out->g = fall; out->b = val;  break;
+    case 4:  out->r = rise; out->g = 0;    out->b = val;  break;
+    default: out->r = val;  out->g = 0;    out->b = fall; break;
+  }
+}
+
+static void WS_Anim_BlendHue(uint32_t now)
+{
+  uint32_t steps = (now - hue_last_ms) >> WS_HUE_SLEW_SHIFT;
+  if (steps == 0U)
+  {
+    return;
+  }
+  hue_last_ms += steps << WS_HUE_SLEW_SHIFT;
+
+  if (hue_cur < hue_target)
+  {
+    hue_cur = ((uint32_t)(hue_target - hue_cur) > steps) ? (uint8_t)(hue_cur + steps) : hue_target;
+  }
+  else if (hue_cur > hue_target)
+  {
+    hue_cur = ((uint32_t)(hue_cur - hue_target) > steps) ? (uint8_t)(hue_cur - steps) : hue_target;
+  }
+}
+
+static uint8_t WS_Anim_Breathe(uint32_t t)
+{
+  uint8_t idx = (uint8_t)((t >> WS_BREATHE_SHIFT) & 63U);
+  return (idx < 32U) ? breathe_lut[idx] : breathe_lut[63U - idx];
+}
+
+static uint8_t WS_Anim_Pulses(uint32_t now)
+{
+  uint32_t pulses_ms = (uint32_t)pulse_count << WS_PULSE_SHIFT;
+  uint32_t period = pulses_ms + WS_PULSE_GAP_MS;
+  uint32_t t = now - anim_start;
+
+  /* advance the cycle origin instead of taking a modulo every frame */
+  while (t >= period)
+  {
+    anim_start += period;
+    t -= period;
+  }
+
+  if (t >= pulses_ms)
+  {
+    return 0;
+  }
+  return ((t & ((1UL << WS_PULSE_SHIFT) - 1U)) < WS_PULSE_ON_MS) ? 255U : 0U;
+}
+
+/* Restarts the pattern only when the mode actually changes */
+void WS_Anim_Start(ws_anim_mode_t mode, uint32_t now)
+{
+  if (mode == anim_mode)
+  {
+    return;
+  }
+  if (anim_mode == WS_ANIM_OFF)
+  {
+    hue_cur = hue_target; /* first frame shows the target, no sweep from red */
+  }
+  anim_mode = mode;
+  anim_start = now;
+  hue_last_ms = now;
+}
+
+void WS_Anim_SetHue(uint8_t hue)
+{
+  hue_target = (hue > WS_HUE_MAX) ? WS_HUE_MAX : hue;
+}
+
+void WS_Anim_SetPulses(uint8_t count)
+{
+  pulse_count = count ? count : 1U;
+}
+
+void WS_Anim_Render(uint32_t now, cRGB *out)
+{
+  uint8_t val;
+
+  WS_Anim_BlendHue(now);
+
+  switch (anim_mode)
+  {
+    case WS_ANIM_SOLID:   val = 255U; break;
+    case WS_ANIM_BREATHE: val = WS_Anim_Breathe(now - anim_start); break;
+    case WS_ANIM_PULSES:  val = WS_Anim_Pulses(now); break;
+    case WS_ANIM_BLINK:   val = (((now - anim_start) >> WS_BLINK_SHIFT) & 1U) ? 0U : 255U; break;
+    default:              val = 0; break;
+  }
+
+  WS_Anim_HueToRgb(hue_cur, val, out);
+}
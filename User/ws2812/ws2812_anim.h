@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+/* One WS2812 pixel in wire order (Green-Red-Blue) */
+typedef struct
+{
+  uint8_t g;
+  uint8_t r;
+  uint8_t b;
+} cRGB;
+
+typedef enum
+{
+  WS_ANIM_OFF = 0,
+  WS_ANIM_SOLID,
+  WS_ANIM_BREATHE,   /* raised-cosine fade, WS_BREATHE_PERIOD_MS */
+  WS_ANIM_PULSES,    /* N blinks then a pause, repeating */
+  WS_ANIM_BLINK,     /* fast on/off */
+} ws_anim_mode_t;
+
+/* Hue wheel is 0..191: six 32-step sectors so conversion needs only shifts */
+#define WS_HUE_RED      0U
+#define WS_HUE_YELLOW   32U
+#define WS_HUE_GREEN    64U
+#define WS_HUE_MAX      191U
+
+void WS_Anim_Start(ws_anim_mode_t mode, uint32_t now);
+void WS_Anim_SetHue(uint8_t hue);
+void WS_Anim_SetPulses(uint8_t count);
+void WS_Anim_Render(uint32_t now, cRGB *out);
@@ -1,7 +1,13 @@
 #include "ws2812_ctrl.h"
 #include "light_ws2812_cortex.h"
+#include "ws2812_anim.h"
 #include "ws2812_config.h"
 #include "py32f0xx_hal.h"
+#include "config_store.h"
+#include "hbridge.h"
+#include "power_guard.h"
+#include "supervisor.h"
+#include "params.h"
 
 /* How often to refresh battery measurement (ms) */
 #define VBAT_SAMPLE_PERIOD_MS   1000U
@@ -9,21 +15,66 @@
 /* Nominal internal reference voltage in mV (from LL ADC header) */
 #define VREFINT_NOMINAL_MV      1200U
 
+/* Vdd = vref_scale / raw; the nominal scale is Vrefint * full-scale code.
+   A factory calibration replaces it with Vdd_known * raw measured on this die. */
+#define VREF_SCALE_NOMINAL      (VREFINT_NOMINAL_MV * 4095UL)
+/* Reject calibrations further than ~10% off nominal (datasheet spread is smaller) */
+#define VREF_SCALE_MIN          (VREF_SCALE_NOMINAL - VREF_SCALE_NOMINAL / 10U)
+#define VREF_SCALE_MAX          (VREF_SCALE_NOMINAL + VREF_SCALE_NOMINAL / 10U)
+/* Samples averaged during calibration (power of two) */
+#define VREF_CAL_SAMPLES_SHIFT  4U
+/* Accepted reference supply range for calibration */
+#define VREF_CAL_MIN_MV         1800U
+#define VREF_CAL_MAX_MV         5500U
+
+/* Hardware low-battery cutoff: TIM1 TRGO triggers a Vrefint conversion at
+   this rate and the ADC analog watchdog trips the H-bridge without CPU polling */
+#define VBAT_AWD_TRIGGER_HZ     1000U
+#define VBAT_CUTOFF_MV          PARAM(PARAM_VBAT_CUTOFF_MV)
+#define VBAT_CUTOFF_HYST_MV     PARAM(PARAM_VBAT_HYST_MV) /* re-arm only after recovering this much */
+/* Consecutive out-of-window samples before the cutoff trips. The H-bridge
+   load ripple at the PWM edges lands in single samples; 3 of them in a row
+   delay a real brown-out by 2 ms, well inside the cell's hold-up time. */
+#define VBAT_AWD_CONFIRM        3U
+
 /* Simple IIR filter factor for voltage smoothing (1/4 new, 3/4 old) */
 #define VBAT_FILTER_SHIFT       2U
 
-typedef struct
-{
-  uint8_t g;
-  uint8_t r;
-  uint8_t b;
-} cRGB;
+/* Gamma curve evaluated by the compiler: mean of x^2 and x^3 (~gamma 2.4)
+   over 64 input steps, so the send path is one table load per channel */
+#define WS_GAMMA_IN_MAX         63UL
+#define WS_GAMMA(i)             ((uint8_t)((255UL * (i) * (i) * (i) / (WS_GAMMA_IN_MAX * WS_GAMMA_IN_MAX * WS_GAMMA_IN_MAX) + \
+                                            255UL * (i) * (i) / (WS_GAMMA_IN_MAX * WS_GAMMA_IN_MAX)) / 2U))
+#define WS_GAMMA8(i)            WS_GAMMA(i), WS_GAMMA((i) + 1), WS_GAMMA((i) + 2), WS_GAMMA((i) + 3), \
+                                WS_GAMMA((i) + 4), WS_GAMMA((i) + 5), WS_GAMMA((i) + 6), WS_GAMMA((i) + 7)
+
+/* Global indicator dimming: each level halves the output (a shift, not a multiply) */
+#define WS_DIM_LEVELS           5U
+#define WS_DIM_DEFAULT          1U
+
+/* At or below this charge the indicator switches to a fast red blink */
+#define VBAT_CRITICAL_PCT       15U
 
 static ADC_HandleTypeDef hadc;
-static cRGB led;
+static TIM_HandleTypeDef htim1;
+static const uint8_t gamma_lut[WS_GAMMA_IN_MAX + 1U] =
+{
+  WS_GAMMA8(0),  WS_GAMMA8(8),  WS_GAMMA8(16), WS_GAMMA8(24),
+  WS_GAMMA8(32), WS_GAMMA8(40), WS_GAMMA8(48), WS_GAMMA8(56)
+};
+
+static cRGB led;                /* colour currently latched in the LED (before gamma) */
+static cRGB led_wire;           /* gamma-corrected, dimmed bytes sent on the wire */
+static uint8_t led_valid = 0;
+static uint8_t dim_level = WS_DIM_DEFAULT;
+static uint8_t dim_unsaved = 0;     /* stepped from the buttons, saved when the indicator closes */
 static uint32_t vdd_mv = 3300U;
+static uint32_t vref_scale = VREF_SCALE_NOMINAL;
 static uint8_t soc_pct = 0;
 static uint32_t last_sample = 0xFFFFFFFFUL - VBAT_SAMPLE_PERIOD_MS; /* force immediate first sample */
+static volatile uint8_t awd_armed = 0;
+static volatile uint8_t awd_count = 0;  /* out-of-window samples in a row, 0 while AWD waits */
+static uint32_t awd_high = 0xFFFU;      /* threshold the EOC path confirms against */
 static uint8_t ws_enabled = 0;
 static uint8_t indicator_active = 0;
 static uint32_t indicator_start = 0;
@@ -39,10 +90,25 @@ static void WS_SendArray_Blocking(uint8_t *data, int len)
   if (!primask) __enable_irq();
 }
 
+/* Only touches the wire (and masks IRQs) when the colour actually changes */
+static void WS_Show(const cRGB *c)
+{
+  if (led_valid && c->r == led.r && c->g == led.g && c->b == led.b)
+  {
+    return;
+  }
+  led = *c;
+  led_valid = 1;
+  led_wire.r = gamma_lut[led.r >> 2] >> dim_level;
+  led_wire.g = gamma_lut[led.g >> 2] >> dim_level;
+  led_wire.b = gamma_lut[led.b >> 2] >> dim_level;
+  WS_SendArray_Blocking((uint8_t *)&led_wire, sizeof(led_wire));
+}
+
 static void WS_SendOff(void)
 {
-  led.r = led.g = led.b = 0;
-  WS_SendArray_Blocking((uint8_t *)&led, sizeof(led));
+  static const cRGB off = {0, 0, 0};
+  WS_Show(&off);
 }
 
 static void VBat_AdcInit(void)
@@ -65,9 +131,9 @@ static void VBat_AdcInit(void)
   hadc.Init.LowPowerAutoWait      = DISABLE;
   hadc.Init.ContinuousConvMode    = DISABLE;
   hadc.Init.DiscontinuousConvMode = DISABLE;
-  hadc.Init.ExternalTrigConv      = ADC_SOFTWARE_START;
-  hadc.Init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_NONE;
-  hadc.Init.Overrun               = ADC_OVR_DATA_PRESERVED;
+  hadc.Init.ExternalTrigConv      = ADC_EXTERNALTRIGCONV_T1_TRGO;
+  hadc.Init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_RISING;
+  hadc.Init.Overrun               = ADC_OVR_DATA_OVERWRITTEN; /* DR always holds the latest sample */
   hadc.Init.SamplingTimeCommon    = ADC_SAMPLETIME_239CYCLES_5; /* long sample for internal ref */
   HAL_ADC_Init(&hadc);
 
@@ -80,25 +146,98 @@ static void VBat_AdcInit(void)
   HAL_Delay(1);
 }
 
+static void VBat_TriggerTimerInit(void)
+{
+  __HAL_RCC_TIM1_CLK_ENABLE();
+
+  /* 1 MHz timer tick, update event (TRGO) at VBAT_AWD_TRIGGER_HZ */
+  htim1.Instance = TIM1;
+  htim1.Init.Prescaler = (HAL_RCC_GetPCLK1Freq() / 1000000U) - 1U;
+  htim1.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim1.Init.Period = (1000000U / VBAT_AWD_TRIGGER_HZ) - 1U;
+  htim1.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim1.Init.RepetitionCounter = 0;
+  htim1.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  HAL_TIM_Base_Init(&htim1);
+
+  TIM_MasterConfigTypeDef master = {0};
+  master.MasterOutputTrigger = TIM_TRGO_UPDATE;
+  master.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  HAL_TIMEx_MasterConfigSynchronization(&htim1, &master);
+
+  HAL_TIM_Base_Start(&htim1);
+}
+
+/* (Re)program the watchdog window from the current calibration.
+   Vrefint raw rises as Vdd falls, so the cutoff is an upper threshold. */
+static void VBat_AwdArm(void)
+{
+  ADC_AnalogWDGConfTypeDef awd = {0};
+  uint32_t high = vref_scale / VBAT_CUTOFF_MV;
+  if (high > 0xFFFU) high = 0xFFFU;
+
+  HAL_ADC_Stop(&hadc);
+  __HAL_ADC_DISABLE_IT(&hadc, ADC_IT_EOC);
+  awd_count = 0;
+  awd_high = high;
+  awd.WatchdogMode = ADC_ANALOGWATCHDOG_SINGLE_REG;
+  awd.Channel = ADC_CHANNEL_VREFINT;
+  awd.ITMode = ENABLE;
+  awd.HighThreshold = high;
+  awd.LowThreshold = 0;
+  HAL_ADC_AnalogWDGConfig(&hadc, &awd);
+  awd_armed = 1;
+  HBridge_ClearCutoff(); /* trips again on the next sample if Vdd is still low */
+  HAL_ADC_Start(&hadc); /* conversions now paced by TIM1 TRGO */
+
+  HAL_NVIC_SetPriority(ADC_COMP_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(ADC_COMP_IRQn);
+}
+
+/* Latest hardware-triggered sample, no waiting */
+static uint16_t VBat_ReadVrefLatest(void)
+{
+  return (uint16_t)HAL_ADC_GetValue(&hadc);
+}
+
+/* Waits for the next triggered conversion (at most one trigger period) */
 static uint16_t VBat_ReadVrefRaw(void)
 {
-  HAL_ADC_Start(&hadc);
+  __HAL_ADC_CLEAR_FLAG(&hadc, ADC_FLAG_EOC | ADC_FLAG_EOS);
   HAL_ADC_PollForConversion(&hadc, 10);
-  uint16_t raw = HAL_ADC_GetValue(&hadc);
-  HAL_ADC_Stop(&hadc);
-  return raw;
+  return (uint16_t)HAL_ADC_GetValue(&hadc);
 }
 
-static uint32_t VBat_ComputeVddMv(uint16_t vref_raw)
+/* Kept out of line so that make bench can time it */
+__attribute__((noinline, noclone)) static uint32_t VBat_ComputeVddMv(uint16_t vref_raw)
 {
   if (vref_raw == 0)
     return vdd_mv;
-  /* Vdd = Vref_nominal * fullscale / vref_raw */
-  uint32_t new_mv = (uint32_t)VREFINT_NOMINAL_MV * 4095U / vref_raw;
+  /* Vdd = Vref * fullscale / vref_raw, with Vref * fullscale trimmed per unit */
+  uint32_t new_mv = vref_scale / vref_raw;
   /* IIR filter to smooth noise */
   return (vdd_mv * ((1U << VBAT_FILTER_SHIFT) - 1U) + new_mv) >> VBAT_FILTER_SHIFT;
 }
 
+static void VBat_LoadCalibration(void)
+{
+  uint32_t val = ConfigStore_Read(CONFIG_VREF_SCALE);
+  if (val >= VREF_SCALE_MIN && val <= VREF_SCALE_MAX)
+  {
+    vref_scale = val;
+  }
+  else
+  {
+    vref_scale = VREF_SCALE_NOMINAL;
+  }
+}
+
+static void WS_LoadDimLevel(void)
+{
+  uint32_t val = ConfigStore_Read(CONFIG_WS_DIM);
+  dim_level = (val < WS_DIM_LEVELS) ? (uint8_t)val : WS_DIM_DEFAULT;
+}
+
 static uint8_t VBat_VoltageToPercent(uint32_t mv)
 {
   if (mv >= 4200U)
@@ -128,40 +267,46 @@ static uint8_t VBat_VoltageToPercent(uint32_t mv)
   }
 }
 
-static void WS_SetColorForPercent(uint32_t now_ms)
+/* 0..100% -> red..yellow..green (hue 0..64) without a division */
+static uint8_t WS_HueForPercent(uint8_t pct)
 {
-  uint8_t r = 0, g = 0, b = 0;
+  return (uint8_t)(((uint16_t)pct * 164U) >> 8);
+}
 
-  if (soc_pct <= 15U)
+/* N blinks = N x 20%, rounded up */
+static uint8_t WS_PulsesForPercent(uint8_t pct)
+{
+  uint8_t n = 1;
+  for (uint8_t thr = 20U; thr < 100U && pct > thr; thr += 20U)
   {
-    /* Blink red when critically low */
-    if (((now_ms / 400U) & 0x1U) == 0U)
-    {
-      r = 255;
-    }
+    n++;
   }
-  else if (soc_pct <= 25U)
+  return n;
+}
+
+static void WS_UpdateIndicator(uint32_t now_ms)
+{
+  cRGB c;
+
+  if (soc_pct <= VBAT_CRITICAL_PCT)
   {
-    /* Solid red from 25% down to 15% */
-    r = 255;
+    WS_Anim_SetHue(WS_HUE_RED);
+    WS_Anim_Start(WS_ANIM_BLINK, now_ms);
   }
-  else if (soc_pct <= 50U)
+  else if (indicator_active)
   {
-    /* Yellow at 50% fading to red at 25% */
-    r = 255;
-    g = (uint8_t)(((uint16_t)(soc_pct - 25U) * 255U) / (50U - 25U));
+    WS_Anim_SetHue(WS_HueForPercent(soc_pct));
+    WS_Anim_SetPulses(WS_PulsesForPercent(soc_pct));
+    WS_Anim_Start(WS_ANIM_PULSES, now_ms);
   }
   else
   {
-    /* Green to yellow: green fixed, red fades in */
-    g = 255;
-    r = (uint8_t)(((uint16_t)(100U - soc_pct) * 255U) / (100U - 50U));
+    WS_Anim_SetHue(WS_HueForPercent(soc_pct));
+    WS_Anim_Start(WS_ANIM_BREATHE, now_ms);
   }
 
-  led.r = r;
-  led.g = g;
-  led.b = b;
-  WS_SendArray_Blocking((uint8_t *)&led, sizeof(led));
+  WS_Anim_Render(now_ms, &c);
+  WS_Show(&c);
 }
 
 void WS2812_Ctrl_Init(void)
@@ -179,6 +324,10 @@ void WS2812_Ctrl_Init(void)
   HAL_GPIO_WritePin(LIGHT_WS2812_GPIO_PORT, LIGHT_WS2812_GPIO_PIN, GPIO_PIN_RESET);
 
   VBat_AdcInit();
+  VBat_LoadCalibration();
+  WS_LoadDimLevel();
+  VBat_AwdArm();
+  VBat_TriggerTimerInit();
   WS_SendOff();
 }
 
@@ -188,6 +337,7 @@ void WS2812_Ctrl_SetEnabled(uint8_t enable)
   if (!ws_enabled)
   {
     indicator_active = 0;
+    WS_Anim_Start(WS_ANIM_OFF, HAL_GetTick());
     WS_SendOff();
   }
 }
@@ -201,6 +351,74 @@ void WS2812_Ctrl_RequestBatteryIndication(uint32_t duration_ms)
   last_sample = now - VBAT_SAMPLE_PERIOD_MS; /* force refresh at next task run */
 }
 
+uint8_t WS2812_Ctrl_GetDimLevel(void)
+{
+  return dim_level;
+}
+
+void WS2812_Ctrl_SetDimLevel(uint8_t level)
+{
+  if (level >= WS_DIM_LEVELS)
+  {
+    level = WS_DIM_LEVELS - 1U;
+  }
+  dim_level = level;
+  dim_unsaved = 0;
+  led_valid = 0; /* resend the current colour at the new level */
+  ConfigStore_Write(CONFIG_WS_DIM, dim_level);
+}
+
+/* Brightest -> dimmest, then wraps around. RAM only: a run of clicks costs
+   one page write, done when the indicator closes. */
+void WS2812_Ctrl_StepDimLevel(void)
+{
+  dim_level = (dim_level + 1U < WS_DIM_LEVELS) ? (uint8_t)(dim_level + 1U) : 0U;
+  dim_unsaved = 1;
+  led_valid = 0;
+}
+
+uint32_t WS2812_Ctrl_GetVddMv(void)
+{
+  return vdd_mv;
+}
+
+uint8_t WS2812_Ctrl_CalibrateVdd(uint32_t known_mv)
+{
+  uint32_t sum = 0;
+  if (known_mv < VREF_CAL_MIN_MV || known_mv > VREF_CAL_MAX_MV)
+  {
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < (1UL << VREF_CAL_SAMPLES_SHIFT); i++)
+  {
+    sum += VBat_ReadVrefRaw();
+  }
+
+  /* known_mv * sum stays below 2^32 for Vdd up to 5.5 V with 16 samples */
+  uint32_t scale = (known_mv * sum) >> VREF_CAL_SAMPLES_SHIFT;
+  if (scale < VREF_SCALE_MIN || scale > VREF_SCALE_MAX)
+  {
+    return 0;
+  }
+
+  vref_scale = scale;
+  vdd_mv = known_mv; /* restart the IIR filter from the reference point */
+  soc_pct = VBat_VoltageToPercent(vdd_mv);
+  ConfigStore_Write(CONFIG_VREF_SCALE, vref_scale);
+  VBat_AwdArm(); /* cutoff threshold follows the new trim */
+  return 1;
+}
+
+/* New cutoff from the console; a tripped watchdog re-arms from the task */
+void WS2812_Ctrl_ApplyCutoff(void)
+{
+  if (awd_armed)
+  {
+    VBat_AwdArm();
+  }
+}
+
 uint8_t WS2812_Ctrl_IsActive(void)
 {
   return (ws_enabled || indicator_active);
@@ -210,28 +428,86 @@ void WS2812_Ctrl_Task(void)
 {
   uint32_t now = HAL_GetTick();
 
+  Supervisor_CheckIn(SUPERVISOR_WS2812);
+
   /* Always keep voltage updated in background */
   if ((now - last_sample) >= VBAT_SAMPLE_PERIOD_MS)
   {
-    uint16_t raw = VBat_ReadVrefRaw();
+    uint16_t raw = VBat_ReadVrefLatest();
     vdd_mv = VBat_ComputeVddMv(raw);
     soc_pct = VBat_VoltageToPercent(vdd_mv);
     last_sample = now;
+
+    /* watchdog fired: re-arm once the cell has recovered with hysteresis */
+    if (!awd_armed && vdd_mv >= (VBAT_CUTOFF_MV + VBAT_CUTOFF_HYST_MV))
+    {
+      VBat_AwdArm();
+    }
   }
 
   if (!WS2812_Ctrl_IsActive())
   {
+    WS_Anim_Start(WS_ANIM_OFF, now);
     WS_SendOff(); /* ensure LED is dark whenever no active indication */
     return;
   }
 
-  WS_SetColorForPercent(now);
+  WS_UpdateIndicator(now);
 
   if (indicator_active && (int32_t)(now - indicator_start) >= (int32_t)indicator_duration_ms)
   {
     indicator_active = 0;
+    if (dim_unsaved)
+    {
+      dim_unsaved = 0;
+      ConfigStore_Write(CONFIG_WS_DIM, dim_level);
+    }
     /* Always shut off after showing charge */
+    WS_Anim_Start(WS_ANIM_OFF, now);
     WS_SendOff();
     ws_enabled = 0;
   }
 }
+
+/* The AWD catches the first low sample; the following ones are judged on EOC
+   until VBAT_AWD_CONFIRM in a row trip the cutoff or one is back in window */
+void ADC_COMP_IRQHandler(void)
+{
+  if (awd_count == 0U)
+  {
+    if (!awd_armed || __HAL_ADC_GET_FLAG(&hadc, ADC_FLAG_AWD) == RESET)
+    {
+      return;
+    }
+    __HAL_ADC_CLEAR_FLAG(&hadc, ADC_FLAG_AWD | ADC_FLAG_EOC);
+    __HAL_ADC_DISABLE_IT(&hadc, ADC_IT_AWD);
+    __HAL_ADC_ENABLE_IT(&hadc, ADC_IT_EOC);
+    awd_count = 1U;
+  }
+  else
+  {
+    if (__HAL_ADC_GET_FLAG(&hadc, ADC_FLAG_EOC) == RESET)
+    {
+      return;
+    }
+    if (HAL_ADC_GetValue(&hadc) <= awd_high)
+    {
+      /* ripple, not a brown-out: back to the watchdog */
+      __HAL_ADC_DISABLE_IT(&hadc, ADC_IT_EOC);
+      __HAL_ADC_CLEAR_FLAG(&hadc, ADC_FLAG_AWD);
+      __HAL_ADC_ENABLE_IT(&hadc, ADC_IT_AWD);
+      awd_count = 0;
+      return;
+    }
+    awd_count++;
+  }
+
+  if (awd_count >= VBAT_AWD_CONFIRM)
+  {
+    /* one-shot: Vdd stays low, so mask further events until re-armed */
+    __HAL_ADC_DISABLE_IT(&hadc, ADC_IT_EOC);
+    awd_count = 0;
+    awd_armed = 0;
+    PowerGuard_Trip();
+  }
+}
@@ -7,3 +7,9 @@ void WS2812_Ctrl_Task(void);
 void WS2812_Ctrl_SetEnabled(uint8_t enable);
 void WS2812_Ctrl_RequestBatteryIndication(uint32_t duration_ms);
 uint8_t WS2812_Ctrl_IsActive(void);
+uint32_t WS2812_Ctrl_GetVddMv(void);
+uint8_t WS2812_Ctrl_CalibrateVdd(uint32_t known_mv);
+void WS2812_Ctrl_ApplyCutoff(void);
+uint8_t WS2812_Ctrl_GetDimLevel(void);
+void WS2812_Ctrl_SetDimLevel(uint8_t level);
+void WS2812_Ctrl_StepDimLevel(void);
@@ -47,7 +47,7 @@ DEBUG_FLAGS ?= -gdwarf-3
 # c flags
 OPT			?= -O3
 CSTD		?= -std=gnu99
-TGT_CFLAGS 	+= $(ARCH_FLAGS) $(DEBUG_FLAGS) $(OPT) $(CSTD) $(addprefix -D, $(LIB_FLAGS)) -Wall -ffunction-sections -fdata-sections
+TGT_CFLAGS 	+= $(ARCH_FLAGS) $(DEBUG_FLAGS) $(OPT) $(CSTD) $(addprefix -D, $(LIB_FLAGS)) -Wall -ffunction-sections -fdata-sections -fstack-usage -fcallgraph-info=su
 
 # asm flags
 TGT_ASFLAGS += $(ARCH_FLAGS) $(DEBUG_FLAGS) $(OPT) -Wa,--warn
@@ -67,9 +67,15 @@ endif
 TGT_INCFLAGS := $(addprefix -I $(TOP)/, $(INCLUDES))
 
 
-.PHONY: all clean flash echo
+.PHONY: all clean flash echo sim sim-test paint-bench bench bench-selftest footprint stack
 
 all: $(BDIR)/$(PROJECT).elf $(BDIR)/$(PROJECT).bin $(BDIR)/$(PROJECT).hex
+# Only once a baseline is checked in: without one there is nothing to check
+ifeq ($(FOOTPRINT),y)
+ifneq ($(wildcard $(TOP)/$(FOOTPRINT_BASELINE)),)
+all: footprint
+endif
+endif
 
 # for debug
 echo:
@@ -112,6 +118,62 @@ $(BDIR)/$(PROJECT).elf: $(OBJS) $(TOP)/$(LDSCRIPT)
 clean:
 	-$(RMDIR) "$(BDIR)"
 
+# Host simulation build: same application sources, virtual HAL, native compiler
+SIM_BDIR		= $(BDIR)/sim
+SIM_OBJS		= $(SIM_CFILES:%.c=$(SIM_BDIR)/%.o)
+SIM_CFLAGS		+= -O2 -g $(CSTD) -Wall -Wno-int-to-pointer-cast
+SIM_INCFLAGS	:= $(addprefix -I $(TOP)/, $(SIM_INCLUDES))
+
+sim: $(SIM_BDIR)/$(PROJECT)_sim
+
+-include $(SIM_OBJS:.o=.d)
+
+# The firmware entry point is called by the harness, not by the C runtime
+$(SIM_BDIR)/User/main.o: SIM_CFLAGS += -Dmain=App_Main
+
+$(SIM_BDIR)/%.o: %.c
+	@echo "HOSTCC $<"
+	@$(MKDIR) "$(dir $@)" $(MKDIR_NULL)
+	$(Q)$(HOST_CC) $(SIM_CFLAGS) $(SIM_INCFLAGS) -MT $@ -o $@ -c $< -MD -MF $(SIM_BDIR)/$*.d -MP
+
+$(SIM_BDIR)/$(PROJECT)_sim: $(SIM_OBJS)
+	@echo "  HOSTLD $@"
+	$(Q)$(HOST_CC) $(SIM_OBJS) -o $@ -lm
+
+# Scripted button/supply/console timelines with pass/fail and timing margins
+sim-test: $(SIM_BDIR)/$(PROJECT)_sim
+	$(Q)$(foreach f,$(SIM_SCENARIOS),$< -s $(TOP)/$(f) -j $(SIM_JOBS) &&) true
+
+# Span primitives of the e-paper paint library against the per-pixel path
+PAINT_BENCH_OBJS	= $(PAINT_BENCH_CFILES:%.c=$(SIM_BDIR)/%.o)
+
+$(PAINT_BENCH_OBJS): SIM_INCFLAGS := $(addprefix -I $(TOP)/, $(PAINT_BENCH_INCLUDES))
+
+-include $(PAINT_BENCH_OBJS:.o=.d)
+
+$(SIM_BDIR)/paint_bench: $(PAINT_BENCH_OBJS)
+	@echo "  HOSTLD $@"
+	$(Q)$(HOST_CC) $(PAINT_BENCH_OBJS) -o $@ -lm
+
+paint-bench: $(SIM_BDIR)/paint_bench
+	$(Q)$< $(PAINT_BENCH_ARGS)
+
+# Flash/RAM per module from the map file and largest stack frames from the .su files
+footprint: $(BDIR)/$(PROJECT).elf
+	$(Q)$(PYTHON) $(TOP)/Misc/Python/footprint.py $(BDIR)/$(PROJECT).map --baseline $(TOP)/$(FOOTPRINT_BASELINE) --check --slack $(FOOTPRINT_SLACK) $(FOOTPRINT_ARGS)
+
+# Worst-case stack of main plus every enabled preemption level, from the .ci call graphs
+stack: $(BDIR)/$(PROJECT).elf
+	$(Q)$(PYTHON) $(TOP)/Misc/Python/stack_check.py $(BDIR) --ld $(TOP)/$(LDSCRIPT) --map $(BDIR)/$(PROJECT).map $(addprefix --src $(TOP)/, $(STACK_SRC_DIRS))
+
+# Cycle counts of selected functions on an ARMv6-M simulator, checked against the baseline
+bench: $(BDIR)/$(PROJECT).elf
+	$(Q)$(PYTHON) $(TOP)/Misc/Python/m0_bench.py $< --self-test --baseline $(TOP)/$(BENCH_BASELINE) $(BENCH_ARGS)
+
+# The simulator's cycle table against hand-timed snippets; needs no toolchain
+bench-selftest:
+	$(Q)$(PYTHON) $(TOP)/Misc/Python/m0_bench.py --self-test
+
 flash:
 ifeq ($(FLASH_PROGRM),jlink)
 	"$(JLINKEXE)" -device $(JLINK_DEVICE) -if swd -speed $(JLINK_SPEED) -JLinkScriptFile $(TOP)/Misc/jlink-script -CommanderScript $(TOP)/Misc/jlink-command